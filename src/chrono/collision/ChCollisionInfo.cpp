@@ -10,6 +10,8 @@
 //
 // =============================================================================
 
+#include <utility>
+
 #include "chrono/collision/ChCollisionInfo.h"
 
 namespace chrono {
@@ -26,7 +28,9 @@ ChCollisionInfo::ChCollisionInfo()
       vN(ChVector3d(1, 0, 0)),
       distance(0),
       eff_radius(default_eff_radius),
-      reaction_cache(nullptr) {}
+      reaction_cache(nullptr),
+      featureA(-1),
+      featureB(-1) {}
 
 ChCollisionInfo::ChCollisionInfo(const ChCollisionInfo& other, const bool swap) {
     if (!swap) {
@@ -37,6 +41,8 @@ ChCollisionInfo::ChCollisionInfo(const ChCollisionInfo& other, const bool swap)
         vpA = other.vpA;
         vpB = other.vpB;
         vN = other.vN;
+        featureA = other.featureA;
+        featureB = other.featureB;
     } else {
         // copy by swapping models
         modelA = other.modelB;
@@ -46,6 +52,8 @@ ChCollisionInfo::ChCollisionInfo(const ChCollisionInfo& other, const bool swap)
         vpA = other.vpB;
         vpB = other.vpA;
         vN = -other.vN;
+        featureA = other.featureB;
+        featureB = other.featureA;
     }
     distance = other.distance;
     eff_radius = other.eff_radius;
@@ -62,6 +70,30 @@ void ChCollisionInfo::SwapModels() {
     vpA = vpB;
     vpB = vtemp;
     vN = Vmul(vN, -1.0);
+    std::swap(featureA, featureB);
+}
+
+static inline std::uint64_t HashCombine(std::uint64_t key, std::uint64_t val) {
+    return (key ^ val) * 1099511628211ULL;
+}
+
+std::uint64_t ChCollisionInfo::GetKey() const {
+    // Identify the two sides by their shapes or, if not available, by their collision models
+    auto idA = shapeA ? reinterpret_cast<std::uintptr_t>(shapeA) : reinterpret_cast<std::uintptr_t>(modelA);
+    auto idB = shapeB ? reinterpret_cast<std::uintptr_t>(shapeB) : reinterpret_cast<std::uintptr_t>(modelB);
+    int fA = featureA;
+    int fB = featureB;
+    if (idA > idB || (idA == idB && fA > fB)) {
+        std::swap(idA, idB);
+        std::swap(fA, fB);
+    }
+
+    std::uint64_t key = 14695981039346656037ULL;
+    key = HashCombine(key, idA);
+    key = HashCombine(key, (std::uint32_t)fA);
+    key = HashCombine(key, idB);
+    key = HashCombine(key, (std::uint32_t)fB);
+    return key;
 }
 
 void ChCollisionInfo::SetDefaultEffectiveCurvatureRadius(double radius) {
@@ -13,6 +13,8 @@
 #ifndef CH_COLLISION_INFO_H
 #define CH_COLLISION_INFO_H
 
+#include <cstdint>
+
 #include "chrono/collision/ChCollisionModel.h"
 #include "chrono/core/ChApiCE.h"
 #include "chrono/core/ChVector3.h"
@@ -35,6 +37,8 @@ class ChApi ChCollisionInfo {
     double distance;           ///< distance (negative for penetration)
     double eff_radius;         ///< effective radius of curvature at contact (SMC only)
     float* reaction_cache;     ///< pointer to some persistent user cache of reactions
+    int featureA;              ///< feature (e.g., triangle) of shape A at contact, if reported (-1 otherwise)
+    int featureB;              ///< feature (e.g., triangle) of shape B at contact, if reported (-1 otherwise)
 
     /// Basic default constructor.
     ChCollisionInfo();
@@ -45,6 +49,12 @@ class ChApi ChCollisionInfo {
     /// Swap models, that is modelA becomes modelB and viceversa.
     void SwapModels();
 
+    /// Return a key identifying the contact pair (pair of collision shapes and pair of features).
+    /// The key does not depend on the order of the two models and, as long as the collision system reports stable
+    /// feature identifiers, it can be used to match contacts across time steps. Note that multiple contacts may share
+    /// the same key (e.g., the contact points between two boxes).
+    std::uint64_t GetKey() const;
+
     /// Set the default effective radius of curvature (for SMC contact).
     /// <pre>
     /// A collision system should evaluate this value for each collision using
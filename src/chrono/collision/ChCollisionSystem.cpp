@@ -12,6 +12,9 @@
 // Radu Serban
 // =============================================================================
 
+#include <algorithm>
+#include <cstdint>
+
 #include "chrono/collision/ChCollisionSystem.h"
 #include "chrono/physics/ChSystem.h"
 #include "chrono/physics/ChAssembly.h"
@@ -51,6 +54,65 @@ void ChCollisionSystem::UnbindItem(std::shared_ptr<ChPhysicsItem> item) {
     item->RemoveCollisionModelsFromSystem(this);
 }
 
+// Spread the lower 10 bits of v so that there are two zero bits between consecutive bits.
+static std::uint32_t SpreadBits(std::uint32_t v) {
+    v &= 0x000003ff;
+    v = (v | (v << 16)) & 0x030000ff;
+    v = (v | (v << 8)) & 0x0300f00f;
+    v = (v | (v << 4)) & 0x030c30c3;
+    v = (v | (v << 2)) & 0x09249249;
+    return v;
+}
+
+void ChCollisionSystem::SortRays(const std::vector<ChRay>& rays, std::vector<unsigned int>& order) {
+    auto num_rays = (unsigned int)rays.size();
+    order.resize(num_rays);
+    if (num_rays == 0)
+        return;
+
+    // Bounding box of ray midpoints
+    ChVector3d pmin(+1e30);
+    ChVector3d pmax(-1e30);
+    for (const auto& ray : rays) {
+        ChVector3d mid = 0.5 * (ray.from + ray.to);
+        pmin = Vmin(pmin, mid);
+        pmax = Vmax(pmax, mid);
+    }
+    ChVector3d scale;
+    for (int i = 0; i < 3; i++)
+        scale[i] = (pmax[i] > pmin[i]) ? 1023 / (pmax[i] - pmin[i]) : 0;
+
+    // Sort on the 30-bit Morton codes of the quantized midpoints
+    std::vector<std::pair<std::uint32_t, unsigned int>> codes(num_rays);
+    for (unsigned int i = 0; i < num_rays; i++) {
+        ChVector3d mid = 0.5 * (rays[i].from + rays[i].to) - pmin;
+        auto x = (std::uint32_t)(mid.x() * scale.x());
+        auto y = (std::uint32_t)(mid.y() * scale.y());
+        auto z = (std::uint32_t)(mid.z() * scale.z());
+        codes[i] = std::make_pair((SpreadBits(x) << 2) | (SpreadBits(y) << 1) | SpreadBits(z), i);
+    }
+    std::sort(codes.begin(), codes.end());
+
+    for (unsigned int i = 0; i < num_rays; i++)
+        order[i] = codes[i].second;
+}
+
+void ChCollisionSystem::RayHitBatch(const std::vector<ChRay>& rays,
+                                    std::vector<ChRayhitResult>& results,
+                                    int nthreads) const {
+    results.resize(rays.size());
+
+    std::vector<unsigned int> order;
+    SortRays(rays, order);
+
+    int num_rays = (int)rays.size();
+#pragma omp parallel for schedule(dynamic, 64) num_threads(nthreads)
+    for (int k = 0; k < num_rays; k++) {
+        unsigned int i = order[k];
+        RayHit(rays[i].from, rays[i].to, results[i]);
+    }
+}
+
 void ChCollisionSystem::ArchiveOut(ChArchiveOut& archive_out) {
     // version number
     archive_out.VersionWrite<ChCollisionSystem>();
@@ -71,6 +71,10 @@ class ChApi ChCollisionSystem {
     /// Clears all data instanced by this algorithm if any.
     virtual void Clear() = 0;
 
+    /// Discard any contact data cached from previous runs of the collision detection (e.g., persistent contact
+    /// manifolds), so that the next run computes all contacts from scratch. Collision models are not affected.
+    virtual void ClearContactCache() {}
+
     /// Add the specified collision model to the collision engine.
     virtual void Add(std::shared_ptr<ChCollisionModel> model) = 0;
 
@@ -186,6 +190,22 @@ class ChApi ChCollisionSystem {
                         ChCollisionModel* model,
                         ChRayhitResult& result) const = 0;
 
+    /// Ray definition for batched ray-hit tests.
+    struct ChRay {
+        ChVector3d from;  ///< ray start point
+        ChVector3d to;    ///< ray end point
+    };
+
+    /// Perform ray-hit tests with the collision models for a batch of rays, using up to nthreads OpenMP threads.
+    /// On return, results[i] is the result of the test for rays[i]. Rays are processed in a spatially coherent order.
+    /// This default implementation calls RayHit for each ray; derived classes may share the broadphase traversal
+    /// between nearby rays.
+    /// Thread safety: ray-hit queries do not modify the collision system and can be issued concurrently from multiple
+    /// threads, but not concurrently with collision detection (Run) or with adding/removing collision models.
+    virtual void RayHitBatch(const std::vector<ChRay>& rays,
+                             std::vector<ChRayhitResult>& results,
+                             int nthreads = 1) const;
+
     /// Class to be used as a callback interface for user-defined visualization of collision shapes.
     class ChApi VisualizationCallback {
       public:
@@ -230,6 +250,9 @@ class ChApi ChCollisionSystem {
   protected:
     ChCollisionSystem();
 
+    /// Return the indices of the given rays, sorted along a Morton (Z-order) curve through the ray midpoints.
+    static void SortRays(const std::vector<ChRay>& rays, std::vector<unsigned int>& order);
+
     bool m_initialized;
 
     ChSystem* m_system;  ///< associated Chrono system
@@ -89,15 +89,11 @@ cbtScalar cbtManifoldResult::calculateCombinedContactStiffness(const cbtCollisio
 cbtManifoldResult::cbtManifoldResult(const cbtCollisionObjectWrapper* body0Wrap, const cbtCollisionObjectWrapper* body1Wrap)
 	: m_manifoldPtr(0),
 	  m_body0Wrap(body0Wrap),
-	  m_body1Wrap(body1Wrap)
-#ifdef DEBUG_PART_INDEX
-	  ,
-	  m_partId0(-1),
+	  m_body1Wrap(body1Wrap),
+	  m_partId0(-1),  // ***CHRONO*** always initialized (part and feature ids are used to identify contacts)
 	  m_partId1(-1),
 	  m_index0(-1),
-	  m_index1(-1)
-#endif  //DEBUG_PART_INDEX
-	  ,
+	  m_index1(-1),
 	  m_closestPointDistanceThreshold(0)
 {
 }
@@ -58,15 +58,11 @@ protected:
 
 public:
 	cbtManifoldResult()
-		:
-#ifdef DEBUG_PART_INDEX
-
-		  m_partId0(-1),
+		: m_partId0(-1),  // ***CHRONO*** always initialized (part and feature ids are used to identify contacts)
 		  m_partId1(-1),
 		  m_index0(-1),
-		  m_index1(-1)
-#endif  //DEBUG_PART_INDEX
-			  m_closestPointDistanceThreshold(0)
+		  m_index1(-1),
+		  m_closestPointDistanceThreshold(0)
 	{
 	}
 
@@ -43,7 +43,11 @@ CH_UPCASTING(ChCollisionModelBullet, ChCollisionModelImpl)
 // -----------------------------------------------------------------------------
 
 ChCollisionModelBullet::ChCollisionModelBullet(ChCollisionModel* collision_model)
-    : ChCollisionModelImpl(collision_model) {
+    : ChCollisionModelImpl(collision_model),
+      m_ref_radius(0),
+      m_ref_valid(false),
+      m_deformable(false),
+      m_moving(true) {
     bt_collision_object = std::unique_ptr<cbtCollisionObject>(new cbtCollisionObject);
     bt_collision_object->setCollisionShape(nullptr);
     bt_collision_object->setUserPointer((void*)this);
@@ -622,6 +626,9 @@ void ChCollisionModelBullet::injectTriangleMesh(std::shared_ptr<ChCollisionShape
 void ChCollisionModelBullet::injectTriangleProxy(std::shared_ptr<ChCollisionShapeMeshTriangle> shape_triangle) {
     model->SetSafeMargin(shape_triangle->sradius);
 
+    // Triangle vertices move with the mesh nodes, independently of the model frame
+    m_deformable = true;
+
     auto bt_shape = chrono_types::make_shared<cbtCEtriangleShape>(
         shape_triangle->V1, shape_triangle->V2, shape_triangle->V3,              //
         shape_triangle->eP1, shape_triangle->eP2, shape_triangle->eP3,           //
@@ -674,6 +681,30 @@ void ChCollisionModelBullet::SyncPosition() {
     bt_collision_object->getWorldTransform().setBasis(basisA);
 }
 
+bool ChCollisionModelBullet::CheckMotion() {
+    const cbtTransform& X = bt_collision_object->getWorldTransform();
+
+    if (m_ref_valid && !m_deformable) {
+        // Bound the displacement of any point of the model shapes (rotation contributes at most the arc length on the
+        // bounding sphere)
+        cbtScalar dist = (X.getOrigin() - m_ref_transform.getOrigin()).length();
+        cbtScalar angle = (X.getRotation() * m_ref_transform.getRotation().inverse()).getAngleShortestPath();
+        if (dist + angle * m_ref_radius <= cbtScalar(0.5) * GetEnvelope())
+            return false;
+    }
+
+    if (!m_ref_valid) {
+        cbtVector3 center;
+        cbtScalar radius;
+        bt_collision_object->getCollisionShape()->getBoundingSphere(center, radius);
+        m_ref_radius = center.length() + radius;
+    }
+
+    m_ref_transform = X;
+    m_ref_valid = true;
+    return true;
+}
+
 bool ChCollisionModelBullet::SetSphereRadius(double coll_radius, double out_envelope) {
     if (m_bt_shapes.size() != 1)
         return false;
@@ -683,6 +714,7 @@ bool ChCollisionModelBullet::SetSphereRadius(double coll_radius, double out_enve
         model->SetEnvelope(out_envelope);
         bt_sphere_shape->setUnscaledRadius((cbtScalar)(coll_radius + out_envelope));
         ////bt_sphere_shape->setMargin((cbtScalar)(coll_radius + out_envelope));
+        m_ref_valid = false;
         return true;
     }
 
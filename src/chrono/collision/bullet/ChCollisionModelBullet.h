@@ -82,12 +82,23 @@ class ChApi ChCollisionModelBullet : public ChCollisionModelImpl {
 
     cbtScalar GetSuggestedFullMargin();
 
+    /// Check whether this model moved by more than half its envelope since its reference configuration.
+    /// If so (or if the model has no valid reference configuration), the current configuration becomes the reference.
+    /// Used by the incremental narrowphase of ChCollisionSystemBullet.
+    bool CheckMotion();
+
     std::unique_ptr<cbtCollisionObject> bt_collision_object;  ///< Bullet collision object containing Bullet geometries
     std::shared_ptr<cbtCompoundShape> bt_compound_shape;      ///< compound for models with more than one shape
 
     std::vector<std::shared_ptr<cbtCollisionShape>> m_bt_shapes;  ///< list of Bullet collision shapes in model
     std::vector<std::shared_ptr<ChCollisionShape>> m_shapes;      ///< extended list of collision shapes
 
+    cbtTransform m_ref_transform;  ///< reference configuration (at last narrowphase update)
+    cbtScalar m_ref_radius;        ///< radius of a sphere bounding all shapes, centered at the model origin
+    bool m_ref_valid;              ///< true if the reference configuration is valid
+    bool m_deformable;             ///< true if the model shapes deform (e.g., FEA mesh triangles)
+    bool m_moving;                 ///< true if narrowphase must be re-run for all pairs involving this model
+
     friend class ChCollisionSystemBullet;
     friend class ChCollisionSystemBulletMulticore;
     friend class chrono::fea::ChContactSurfaceMesh;
@@ -27,6 +27,7 @@
 #include "chrono/collision/gimpact/GIMPACT/Bullet/cbtGImpactCollisionAlgorithm.h"
 #include "chrono/collision/bullet/BulletCollision/CollisionDispatch/cbtCollisionDispatcherMt.h"
 #include "chrono/collision/bullet/LinearMath/cbtIDebugDraw.h"
+#include "chrono/collision/bullet/LinearMath/cbtAabbUtil2.h"
 
 extern cbtScalar gContactBreakingThreshold;
 
@@ -37,7 +38,8 @@ namespace chrono {
 CH_FACTORY_REGISTER(ChCollisionSystemBullet)
 CH_UPCASTING(ChCollisionSystemBullet, ChCollisionSystem)
 
-ChCollisionSystemBullet::ChCollisionSystemBullet() : m_debug_drawer(nullptr) {
+ChCollisionSystemBullet::ChCollisionSystemBullet()
+    : m_debug_drawer(nullptr), m_incremental_narrowphase(false), m_num_moving_models(0), m_num_threads(1) {
     bt_collision_configuration = new cbtDefaultCollisionConfiguration();
 
 #ifdef BT_USE_OPENMP
@@ -125,6 +127,7 @@ ChCollisionSystemBullet::~ChCollisionSystemBullet() {
 }
 
 void ChCollisionSystemBullet::SetNumThreads(int nthreads) {
+    m_num_threads = std::max(1, nthreads);
 #ifdef BT_USE_OPENMP
     cbtGetOpenMPTaskScheduler()->setNumThreads(nthreads);
 #endif
@@ -146,12 +149,19 @@ void ChCollisionSystemBullet::Add(std::shared_ptr<ChCollisionModel> model) {
 }
 
 void ChCollisionSystemBullet::Clear() {
+    ClearContactCache();
+    bt_models.clear();
+}
+
+void ChCollisionSystemBullet::ClearContactCache() {
     int numManifolds = bt_collision_world->getDispatcher()->getNumManifolds();
     for (int i = 0; i < numManifolds; i++) {
         cbtPersistentManifold* contactManifold = bt_collision_world->getDispatcher()->getManifoldByIndexInternal(i);
         contactManifold->clearManifold();
     }
-    bt_models.clear();
+    // Cached contacts were discarded: force a narrowphase update for models still in the Bullet world
+    for (auto& bt_model : bt_models)
+        bt_model->m_ref_valid = false;
 }
 
 void ChCollisionSystemBullet::Remove(std::shared_ptr<ChCollisionModel> model) {
@@ -180,10 +190,48 @@ void ChCollisionSystemBullet::Remove(ChCollisionModelBullet* bt_model, bool eras
     }
 }
 
+void ChCollisionSystemBullet::EnableIncrementalNarrowphase(bool val) {
+    m_incremental_narrowphase = val;
+    bt_dispatcher->setNearCallback(val ? IncrementalNearCallback : cbtCollisionDispatcher::defaultNearCallback);
+    for (auto& bt_model : bt_models) {
+        bt_model->m_ref_valid = false;
+        bt_model->m_moving = true;
+    }
+}
+
+void ChCollisionSystemBullet::IncrementalNearCallback(cbtBroadphasePair& pair,
+                                                      cbtCollisionDispatcher& dispatcher,
+                                                      const cbtDispatcherInfo& info) {
+    if (pair.m_algorithm) {
+        auto obA = static_cast<cbtCollisionObject*>(pair.m_pProxy0->m_clientObject);
+        auto obB = static_cast<cbtCollisionObject*>(pair.m_pProxy1->m_clientObject);
+        auto bt_modelA = (ChCollisionModelBullet*)obA->getUserPointer();
+        auto bt_modelB = (ChCollisionModelBullet*)obB->getUserPointer();
+        if (!bt_modelA->m_moving && !bt_modelB->m_moving)
+            return;
+    }
+    cbtCollisionDispatcher::defaultNearCallback(pair, dispatcher, info);
+}
+
 void ChCollisionSystemBullet::Run() {
-    if (bt_collision_world) {
-        bt_collision_world->performDiscreteCollisionDetection();
+    if (!bt_collision_world)
+        return;
+
+    // Flag the collision models that moved since the last narrowphase update
+    if (m_incremental_narrowphase) {
+        bt_collision_world->timer_collision_broad.start();
+        m_num_moving_models = 0;
+        for (auto& bt_model : bt_models) {
+            if (!bt_model->GetBulletObject()->getCollisionShape())
+                continue;
+            bt_model->m_moving = bt_model->CheckMotion();
+            if (bt_model->m_moving)
+                m_num_moving_models++;
+        }
+        bt_collision_world->timer_collision_broad.stop();
     }
+
+    bt_collision_world->performDiscreteCollisionDetection();
 }
 
 ChAABB ChCollisionSystemBullet::GetBoundingBox() const {
@@ -212,90 +260,115 @@ void ChCollisionSystemBullet::ReportContacts(ChContactContainer* mcontactcontain
     // This should remove all old contacts (or at least rewind the index)
     mcontactcontainer->BeginAddContact();
 
+    // Manifolds are split in contiguous blocks, processed concurrently into separate contact buffers. User callbacks
+    // are not required to be thread safe, so all manifolds are processed in a single block if any is registered.
+    int numManifolds = bt_collision_world->getDispatcher()->getNumManifolds();
+    int nblocks = (broad_callback || narrow_callback) ? 1 : std::max(1, std::min(m_num_threads, numManifolds));
+    if ((int)m_contact_buffers.size() < nblocks)
+        m_contact_buffers.resize(nblocks);
+
+#pragma omp parallel for schedule(static, 1) num_threads(nblocks)
+    for (int b = 0; b < nblocks; b++) {
+        auto& contacts = m_contact_buffers[b];
+        contacts.clear();
+        int begin = (int)((long long)numManifolds * b / nblocks);
+        int end = (int)((long long)numManifolds * (b + 1) / nblocks);
+        for (int i = begin; i < end; i++)
+            CollectContacts(bt_collision_world->getDispatcher()->getManifoldByIndexInternal(i), contacts);
+    }
+
+    // Add contacts to the container, in the order of the manifolds (independent of the number of blocks)
+    for (int b = 0; b < nblocks; b++)
+        mcontactcontainer->AddContacts(m_contact_buffers[b]);
+
+    mcontactcontainer->EndAddContact();
+}
+
+void ChCollisionSystemBullet::CollectContacts(cbtPersistentManifold* contactManifold,
+                                              std::vector<ChCollisionInfo>& contacts) {
     // NOTE: Bullet does not provide information on radius of curvature at a contact point.
     // As such, for all Bullet-identified contacts, the default value will be used (SMC only).
     ChCollisionInfo icontact;
 
-    int numManifolds = bt_collision_world->getDispatcher()->getNumManifolds();
-    for (int i = 0; i < numManifolds; i++) {
-        cbtPersistentManifold* contactManifold = bt_collision_world->getDispatcher()->getManifoldByIndexInternal(i);
-        const cbtCollisionObject* obA = contactManifold->getBody0();
-        const cbtCollisionObject* obB = contactManifold->getBody1();
-        contactManifold->refreshContactPoints(obA->getWorldTransform(), obB->getWorldTransform());
+    const cbtCollisionObject* obA = contactManifold->getBody0();
+    const cbtCollisionObject* obB = contactManifold->getBody1();
+    contactManifold->refreshContactPoints(obA->getWorldTransform(), obB->getWorldTransform());
 
-        auto bt_modelA = (ChCollisionModelBullet*)obA->getUserPointer();
-        auto bt_modelB = (ChCollisionModelBullet*)obB->getUserPointer();
+    auto bt_modelA = (ChCollisionModelBullet*)obA->getUserPointer();
+    auto bt_modelB = (ChCollisionModelBullet*)obB->getUserPointer();
+
+    icontact.modelA = bt_modelA->model;
+    icontact.modelB = bt_modelB->model;
 
-        icontact.modelA = bt_modelA->model;
-        icontact.modelB = bt_modelB->model;
+    double envelopeA = icontact.modelA->GetEnvelope();
+    double envelopeB = icontact.modelB->GetEnvelope();
 
-        double envelopeA = icontact.modelA->GetEnvelope();
-        double envelopeB = icontact.modelB->GetEnvelope();
+    double marginA = icontact.modelA->GetSafeMargin();
+    double marginB = icontact.modelB->GetSafeMargin();
 
-        double marginA = icontact.modelA->GetSafeMargin();
-        double marginB = icontact.modelB->GetSafeMargin();
+    // Execute custom broadphase callback, if any
+    bool do_narrow_contactgeneration = true;
+    if (broad_callback)
+        do_narrow_contactgeneration = broad_callback->OnBroadphase(icontact.modelA, icontact.modelB);
 
-        // Execute custom broadphase callback, if any
-        bool do_narrow_contactgeneration = true;
-        if (broad_callback)
-            do_narrow_contactgeneration = broad_callback->OnBroadphase(icontact.modelA, icontact.modelB);
+    if (do_narrow_contactgeneration) {
+        int numContacts = contactManifold->getNumContacts();
+        // std::cout << "numContacts=" << numContacts << std::endl;
+        for (int j = 0; j < numContacts; j++) {
+            cbtManifoldPoint& pt = contactManifold->getContactPoint(j);
 
-        if (do_narrow_contactgeneration) {
-            int numContacts = contactManifold->getNumContacts();
-            // std::cout << "numContacts=" << numContacts << std::endl;
-            for (int j = 0; j < numContacts; j++) {
-                cbtManifoldPoint& pt = contactManifold->getContactPoint(j);
+            // Discard "too far" constraints (the Bullet engine also has its threshold)
+            if (pt.getDistance() < marginA + marginB) {
+                cbtVector3 ptA = pt.getPositionWorldOnA();
+                cbtVector3 ptB = pt.getPositionWorldOnB();
 
-                // Discard "too far" constraints (the Bullet engine also has its threshold)
-                if (pt.getDistance() < marginA + marginB) {
-                    cbtVector3 ptA = pt.getPositionWorldOnA();
-                    cbtVector3 ptB = pt.getPositionWorldOnB();
+                icontact.vpA.Set(ptA.getX(), ptA.getY(), ptA.getZ());
+                icontact.vpB.Set(ptB.getX(), ptB.getY(), ptB.getZ());
 
-                    icontact.vpA.Set(ptA.getX(), ptA.getY(), ptA.getZ());
-                    icontact.vpB.Set(ptB.getX(), ptB.getY(), ptB.getZ());
+                icontact.vN.Set(-pt.m_normalWorldOnB.getX(), -pt.m_normalWorldOnB.getY(), -pt.m_normalWorldOnB.getZ());
+                icontact.vN.Normalize();
 
-                    icontact.vN.Set(-pt.m_normalWorldOnB.getX(), -pt.m_normalWorldOnB.getY(),
-                                    -pt.m_normalWorldOnB.getZ());
-                    icontact.vN.Normalize();
+                double ptdist = pt.getDistance();
 
-                    double ptdist = pt.getDistance();
+                icontact.vpA = icontact.vpA - icontact.vN * envelopeA;
+                icontact.vpB = icontact.vpB + icontact.vN * envelopeB;
+                icontact.distance = ptdist + envelopeA + envelopeB;
 
-                    icontact.vpA = icontact.vpA - icontact.vN * envelopeA;
-                    icontact.vpB = icontact.vpB + icontact.vN * envelopeB;
-                    icontact.distance = ptdist + envelopeA + envelopeB;
+                icontact.reaction_cache = pt.reactions_cache;
 
-                    icontact.reaction_cache = pt.reactions_cache;
+                bool compoundA = (obA->getCollisionShape()->getShapeType() == COMPOUND_SHAPE_PROXYTYPE);
+                bool compoundB = (obB->getCollisionShape()->getShapeType() == COMPOUND_SHAPE_PROXYTYPE);
 
-                    bool compoundA = (obA->getCollisionShape()->getShapeType() == COMPOUND_SHAPE_PROXYTYPE);
-                    bool compoundB = (obB->getCollisionShape()->getShapeType() == COMPOUND_SHAPE_PROXYTYPE);
+                int indexA = compoundA ? pt.m_index0 : 0;
+                int indexB = compoundB ? pt.m_index1 : 0;
 
-                    int indexA = compoundA ? pt.m_index0 : 0;
-                    int indexB = compoundB ? pt.m_index1 : 0;
+                icontact.shapeA = bt_modelA->m_shapes[indexA].get();
+                icontact.shapeB = bt_modelB->m_shapes[indexB].get();
 
-                    icontact.shapeA = bt_modelA->m_shapes[indexA].get();
-                    icontact.shapeB = bt_modelB->m_shapes[indexB].get();
+                // Feature identifiers (triangle index for a triangle mesh; for compounds, the child shape already
+                // identifies the feature)
+                icontact.featureA = compoundA ? -1 : pt.m_index0;
+                icontact.featureB = compoundB ? -1 : pt.m_index1;
 
-                    // Execute some user custom callback, if any
-                    bool add_contact = true;
-                    if (this->narrow_callback)
-                        add_contact = this->narrow_callback->OnNarrowphase(icontact);
+                // Execute some user custom callback, if any
+                bool add_contact = true;
+                if (this->narrow_callback)
+                    add_contact = this->narrow_callback->OnNarrowphase(icontact);
 
-                    // Add to contact container
-                    if (add_contact) {
-                        ////std::cout << " add indexA=" << indexA << " indexB=" << indexB << std::endl;
-                        ////std::cout << "     typeA=" << icontact.shapeA->m_type << " typeB=" <<
-                        /// icontact.shapeB->m_type << std::endl;
+                // Add to contact buffer
+                if (add_contact) {
+                    ////std::cout << " add indexA=" << indexA << " indexB=" << indexB << std::endl;
+                    ////std::cout << "     typeA=" << icontact.shapeA->m_type << " typeB=" <<
+                    /// icontact.shapeB->m_type << std::endl;
 
-                        mcontactcontainer->AddContact(icontact);
-                    }
+                    contacts.push_back(icontact);
                 }
             }
         }
-
-        // Uncomment this line to remove all points
-        ////contactManifold->clearManifold();
     }
-    mcontactcontainer->EndAddContact();
+
+    // Uncomment this line to remove all points
+    ////contactManifold->clearManifold();
 }
 
 void ChCollisionSystemBullet::ReportProximities(ChProximityContainer* mproximitycontainer) {
@@ -321,6 +394,27 @@ void ChCollisionSystemBullet::ReportProximities(ChProximityContainer* mproximity
     mproximitycontainer->EndAddProximities();
 }
 
+bool ChCollisionSystemBullet::SetRayhitResult(const cbtCollisionWorld::ClosestRayResultCallback& rayCallback,
+                                              ChRayhitResult& result) {
+    if (rayCallback.hasHit()) {
+        auto bt_model = static_cast<ChCollisionModelBullet*>(rayCallback.m_collisionObject->getUserPointer());
+        result.hitModel = bt_model->model;
+        if (result.hitModel) {
+            result.hit = true;
+            result.abs_hitPoint.Set(rayCallback.m_hitPointWorld.x(), rayCallback.m_hitPointWorld.y(),
+                                    rayCallback.m_hitPointWorld.z());
+            result.abs_hitNormal.Set(rayCallback.m_hitNormalWorld.x(), rayCallback.m_hitNormalWorld.y(),
+                                     rayCallback.m_hitNormalWorld.z());
+            result.abs_hitNormal.Normalize();
+            result.dist_factor = rayCallback.m_closestHitFraction;
+            result.abs_hitPoint = result.abs_hitPoint - result.abs_hitNormal * result.hitModel->GetEnvelope();
+            return true;
+        }
+    }
+    result.hit = false;
+    return false;
+}
+
 bool ChCollisionSystemBullet::RayHit(const ChVector3d& from, const ChVector3d& to, ChRayhitResult& result) const {
     return RayHit(from, to, result, cbtBroadphaseProxy::DefaultFilter, cbtBroadphaseProxy::AllFilter);
 }
@@ -339,23 +433,7 @@ bool ChCollisionSystemBullet::RayHit(const ChVector3d& from,
 
     this->bt_collision_world->rayTest(btfrom, btto, rayCallback);
 
-    if (rayCallback.hasHit()) {
-        auto bt_model = static_cast<ChCollisionModelBullet*>(rayCallback.m_collisionObject->getUserPointer());
-        result.hitModel = bt_model->model;
-        if (result.hitModel) {
-            result.hit = true;
-            result.abs_hitPoint.Set(rayCallback.m_hitPointWorld.x(), rayCallback.m_hitPointWorld.y(),
-                                    rayCallback.m_hitPointWorld.z());
-            result.abs_hitNormal.Set(rayCallback.m_hitNormalWorld.x(), rayCallback.m_hitNormalWorld.y(),
-                                     rayCallback.m_hitNormalWorld.z());
-            result.abs_hitNormal.Normalize();
-            result.dist_factor = rayCallback.m_closestHitFraction;
-            result.abs_hitPoint = result.abs_hitPoint - result.abs_hitNormal * result.hitModel->GetEnvelope();
-            return true;
-        }
-    }
-    result.hit = false;
-    return false;
+    return SetRayhitResult(rayCallback, result);
 }
 
 bool ChCollisionSystemBullet::RayHit(const ChVector3d& from,
@@ -384,7 +462,7 @@ bool ChCollisionSystemBullet::RayHit(const ChVector3d& from,
     int hit = -1;
     cbtScalar fraction = 1;
     for (int i = 0; i < rayCallback.m_collisionObjects.size(); ++i) {
-        auto bt_model = static_cast<ChCollisionModelBullet*>(rayCallback.m_collisionObject->getUserPointer());
+        auto bt_model = static_cast<ChCollisionModelBullet*>(rayCallback.m_collisionObjects[i]->getUserPointer());
         if (bt_model->model == model && rayCallback.m_hitFractions[i] < fraction) {
             hit = i;
             fraction = rayCallback.m_hitFractions[i];
@@ -411,6 +489,84 @@ bool ChCollisionSystemBullet::RayHit(const ChVector3d& from,
     return true;
 }
 
+// Broadphase callback collecting the collision objects overlapping the AABB of a ray packet.
+class RayPacketCollector : public cbtBroadphaseAabbCallback {
+  public:
+    virtual bool process(const cbtBroadphaseProxy* proxy) override {
+        objects.push_back(static_cast<cbtCollisionObject*>(proxy->m_clientObject));
+        return true;
+    }
+
+    std::vector<cbtCollisionObject*> objects;
+};
+
+// Number of rays sharing a broadphase traversal.
+static const int ray_packet_size = 32;
+
+void ChCollisionSystemBullet::RayHitBatch(const std::vector<ChRay>& rays,
+                                          std::vector<ChRayhitResult>& results,
+                                          int nthreads) const {
+    results.resize(rays.size());
+
+    std::vector<unsigned int> order;
+    SortRays(rays, order);
+
+    int num_rays = (int)rays.size();
+    int num_packets = (num_rays + ray_packet_size - 1) / ray_packet_size;
+
+#pragma omp parallel for schedule(dynamic) num_threads(nthreads)
+    for (int p = 0; p < num_packets; p++) {
+        int start = p * ray_packet_size;
+        int end = std::min(start + ray_packet_size, num_rays);
+
+        // Collect candidate objects for all rays in this packet with a single broadphase traversal
+        cbtVector3 aabbMin(BT_LARGE_FLOAT, BT_LARGE_FLOAT, BT_LARGE_FLOAT);
+        cbtVector3 aabbMax(-BT_LARGE_FLOAT, -BT_LARGE_FLOAT, -BT_LARGE_FLOAT);
+        for (int k = start; k < end; k++) {
+            const auto& ray = rays[order[k]];
+            cbtVector3 btfrom((cbtScalar)ray.from.x(), (cbtScalar)ray.from.y(), (cbtScalar)ray.from.z());
+            cbtVector3 btto((cbtScalar)ray.to.x(), (cbtScalar)ray.to.y(), (cbtScalar)ray.to.z());
+            aabbMin.setMin(btfrom);
+            aabbMin.setMin(btto);
+            aabbMax.setMax(btfrom);
+            aabbMax.setMax(btto);
+        }
+
+        RayPacketCollector collector;
+        bt_collision_world->getBroadphase()->aabbTest(aabbMin, aabbMax, collector);
+
+        // Test each ray against the packet candidates
+        for (int k = start; k < end; k++) {
+            unsigned int i = order[k];
+            cbtVector3 btfrom((cbtScalar)rays[i].from.x(), (cbtScalar)rays[i].from.y(), (cbtScalar)rays[i].from.z());
+            cbtVector3 btto((cbtScalar)rays[i].to.x(), (cbtScalar)rays[i].to.y(), (cbtScalar)rays[i].to.z());
+            cbtTransform from_trans(cbtMatrix3x3::getIdentity(), btfrom);
+            cbtTransform to_trans(cbtMatrix3x3::getIdentity(), btto);
+
+            cbtCollisionWorld::ClosestRayResultCallback rayCallback(btfrom, btto);
+
+            for (auto object : collector.objects) {
+                if (rayCallback.m_closestHitFraction == 0)
+                    break;
+                if (!rayCallback.needsCollision(object->getBroadphaseHandle()))
+                    continue;
+
+                // Quick rejection with the object AABB, also culling objects beyond the closest hit so far
+                cbtScalar lambda = rayCallback.m_closestHitFraction;
+                cbtVector3 normal;
+                if (!cbtRayAabb(btfrom, btto, object->getBroadphaseHandle()->m_aabbMin,
+                                object->getBroadphaseHandle()->m_aabbMax, lambda, normal))
+                    continue;
+
+                cbtCollisionWorld::rayTestSingle(from_trans, to_trans, object, object->getCollisionShape(),
+                                                 object->getWorldTransform(), rayCallback);
+            }
+
+            SetRayhitResult(rayCallback, results[i]);
+        }
+    }
+}
+
 void ChCollisionSystemBullet::SetContactBreakingThreshold(double threshold) {
     gContactBreakingThreshold = (cbtScalar)threshold;
 }
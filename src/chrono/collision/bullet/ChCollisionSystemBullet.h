@@ -39,6 +39,9 @@ class ChApi ChCollisionSystemBullet : public ChCollisionSystem {
     /// if any (like persistent contact manifolds)
     virtual void Clear() override;
 
+    /// Discard the points cached in the persistent contact manifolds.
+    virtual void ClearContactCache() override;
+
     /// Add the specified collision model to the collision engine.
     virtual void Add(std::shared_ptr<ChCollisionModel> model) override;
 
@@ -56,6 +59,18 @@ class ChApi ChCollisionSystemBullet : public ChCollisionSystem {
     /// (Contacts will be managed by the Bullet persistent contact cache).
     virtual void Run() override;
 
+    /// Enable incremental narrowphase (default: false).
+    /// If enabled, a collision model is flagged as moving if any of its points moved by more than half the model
+    /// envelope since its last reference configuration. The narrowphase is then re-run only for new broadphase pairs and
+    /// for pairs involving at least one moving model; for all other pairs, the contact points cached in the Bullet
+    /// persistent manifolds from the last update are reported again (refreshed to the current model positions). Models
+    /// with deformable shapes (e.g., FEA contact surfaces) are always treated as moving.
+    /// This can significantly reduce the narrowphase cost for systems with mostly static or slowly moving geometry.
+    void EnableIncrementalNarrowphase(bool val);
+
+    /// Return the number of collision models flagged as moving at the last Run() (incremental narrowphase only).
+    int GetNumMovingModels() const { return m_num_moving_models; }
+
     /// Return an AABB bounding all collision shapes in the system.
     virtual ChAABB GetBoundingBox() const override;
 
@@ -73,8 +88,10 @@ class ChApi ChCollisionSystemBullet : public ChCollisionSystem {
     /// ChContactContainer. For instance ChSystem, after each Run()
     /// collision detection, calls this method multiple times for all contact containers in the system,
     /// The basic behavior of the implementation is the following: collision system
-    /// will call in sequence the functions BeginAddContact(), AddContact() (x n times),
+    /// will call in sequence the functions BeginAddContact(), AddContacts() (once per batch of contacts),
     /// EndAddContact() of the contact container.
+    /// Contact manifolds are processed in parallel (using the number of threads set with SetNumThreads), unless a
+    /// broadphase or narrowphase callback is registered. Contacts are always added in the same order.
     virtual void ReportContacts(ChContactContainer* mcontactcontainer) override;
 
     /// After the Run() has completed, you can call this function to
@@ -95,6 +112,13 @@ class ChApi ChCollisionSystemBullet : public ChCollisionSystem {
                         ChCollisionModel* model,
                         ChRayhitResult& result) const override;
 
+    /// Perform ray-hit tests with all collision models, for a batch of rays.
+    /// Rays are sorted along a space-filling curve and grouped in small packets. The broadphase is traversed once per
+    /// packet, using the bounding box of its rays, and each ray is then tested only against the packet candidates.
+    virtual void RayHitBatch(const std::vector<ChRay>& rays,
+                             std::vector<ChRayhitResult>& results,
+                             int nthreads = 1) const override;
+
     /// Specify a callback object to be used for debug rendering of collision shapes.
     virtual void RegisterVisualizationCallback(std::shared_ptr<VisualizationCallback> callback) override;
 
@@ -136,10 +160,23 @@ class ChApi ChCollisionSystemBullet : public ChCollisionSystem {
                 short int filter_group,
                 short int filter_mask) const;
 
+    /// Set the ray-hit result from the closest hit reported to a Bullet ray callback.
+    static bool SetRayhitResult(const cbtCollisionWorld::ClosestRayResultCallback& rayCallback, ChRayhitResult& result);
+
     /// Remove the specified Bullet model from this collision system.
     /// If erase=true, also remove from the bt_models list.
     void Remove(ChCollisionModelBullet* bt_model, bool erase);
 
+    /// Extract the contacts from the given Bullet manifold into the specified buffer.
+    void CollectContacts(cbtPersistentManifold* manifold, std::vector<ChCollisionInfo>& contacts);
+
+    /// Bullet near callback for incremental narrowphase.
+    /// Pairs with an existing collision algorithm (and hence persistent manifold) are processed only if one of the two
+    /// collision models is flagged as moving.
+    static void IncrementalNearCallback(cbtBroadphasePair& pair,
+                                        cbtCollisionDispatcher& dispatcher,
+                                        const cbtDispatcherInfo& info);
+
     std::vector<std::shared_ptr<ChCollisionModelBullet>> bt_models;
 
     cbtCollisionConfiguration* bt_collision_configuration;
@@ -160,6 +197,12 @@ class ChApi ChCollisionSystemBullet : public ChCollisionSystem {
 
     cbtIDebugDraw* m_debug_drawer;
 
+    bool m_incremental_narrowphase;  ///< if true, narrowphase is only re-run for pairs involving moving models
+    int m_num_moving_models;         ///< number of models flagged as moving at the last Run()
+
+    int m_num_threads;                                            ///< number of threads for contact reporting
+    std::vector<std::vector<ChCollisionInfo>> m_contact_buffers;  ///< contact buffers (one per block of manifolds)
+
     friend class ChCollisionModelBullet;
 };
 
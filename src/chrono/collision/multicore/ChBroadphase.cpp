@@ -14,6 +14,7 @@
 
 #include <algorithm>
 #include <climits>
+#include <cmath>
 
 #include "chrono/collision/multicore/ChBroadphase.h"
 #include "chrono/collision/multicore/ChCollisionUtils.h"
@@ -38,6 +39,7 @@ ChBroadphase::ChBroadphase()
       grid_resolution(vec3(10, 10, 10)),
       bin_size(real3(1, 1, 1)),
       grid_density(5),
+      level_ratio(4),
       cd_data(nullptr) {}
 
 // -----------------------------------------------------------------------------
@@ -162,6 +164,7 @@ void ChBroadphase::DetermineBoundingBox() {
     cd_data->min_bounding_point = min_point;
     cd_data->max_bounding_point = max_point;
     cd_data->global_origin = min_point;
+    cd_data->grid_max_point = max_point;
 }
 
 void ChBroadphase::OffsetAABB() {
@@ -196,6 +199,7 @@ void ChBroadphase::ComputeTopLevelResolution() {
             bins_per_axis.z = (int)std::ceil(diag.z / bin_size.z);
             break;
         case GridType::FIXED_DENSITY:
+        case GridType::ADAPTIVE:
             bins_per_axis = Compute_Grid_Resolution(num_shapes, diag, grid_density);
     }
 
@@ -210,8 +214,23 @@ void ChBroadphase::ComputeTopLevelResolution() {
 
 // Use spatial subdivision to detect the list of POSSIBLE collisions
 void ChBroadphase::Process() {
-    // Compute overall AABB and then offset all AABBs
+    // Compute overall AABB
     DetermineBoundingBox();
+
+    // With an adaptive grid, select the level of each shape and the resolution of the two grids, then offset all
+    // AABBs relative to the fine grid
+    if (grid_type == GridType::ADAPTIVE && cd_data->num_rigid_shapes != 0) {
+        AssignLevels();
+        OffsetAABB();
+        FineLevelBroadphase();
+        CoarseLevelBroadphase();
+        cd_data->num_rigid_contacts = cd_data->num_possible_collisions;
+        return;
+    }
+
+    cd_data->coarse_shapes.clear();
+
+    // Offset all AABBs
     OffsetAABB();
 
     // Determine resolution of the top level grid
@@ -226,30 +245,21 @@ void ChBroadphase::Process() {
 
 void ChBroadphase::OneLevelBroadphase() {
     const std::vector<uint>& obj_data_id = cd_data->shape_data.id_rigid;
-    const std::vector<short2>& fam_data = cd_data->shape_data.fam_rigid;
-
-    const std::vector<char>& obj_active = *cd_data->state_data.active_rigid;
-    const std::vector<char>& obj_collide = *cd_data->state_data.collide_rigid;
 
     const std::vector<real3>& aabb_min = cd_data->aabb_min;
     const std::vector<real3>& aabb_max = cd_data->aabb_max;
-    std::vector<long long>& pair_shapeIDs = cd_data->pair_shapeIDs;
     std::vector<uint>& bin_intersections = cd_data->bin_intersections;
     std::vector<uint>& bin_number = cd_data->bin_number;
     std::vector<uint>& bin_aabb_number = cd_data->bin_aabb_number;
     std::vector<uint>& bin_active = cd_data->bin_active;
     std::vector<uint>& bin_start_index = cd_data->bin_start_index;
-    std::vector<uint>& bin_start_index_ext = cd_data->bin_start_index_ext;
-    std::vector<uint>& bin_num_contact = cd_data->bin_num_contact;
 
     const int num_shapes = cd_data->num_rigid_shapes;
 
     const vec3& bins_per_axis = cd_data->bins_per_axis;
     const real3& inv_bin_size = cd_data->inv_bin_size;
     uint& num_bins = cd_data->num_bins;
-    uint& num_active_bins = cd_data->num_active_bins;
     uint& num_bin_aabb_intersections = cd_data->num_bin_aabb_intersections;
-    uint& num_possible_collisions = cd_data->num_possible_collisions;
 
     num_bins = bins_per_axis.x * bins_per_axis.y * bins_per_axis.z;
 
@@ -284,12 +294,41 @@ void ChBroadphase::OneLevelBroadphase() {
                                       bin_aabb_number);
     }
 
-    // Find the number of active bins (i.e. with at least one shape AABB intersection)
     Thrust_Sort_By_Key(bin_number, bin_aabb_number);
+
+    ProcessActiveBins();
+}
+
+// Find the active bins from the sorted bin-shape AABB intersections and the shape pairs in potential collision
+void ChBroadphase::ProcessActiveBins() {
+    const std::vector<uint>& obj_data_id = cd_data->shape_data.id_rigid;
+    const std::vector<short2>& fam_data = cd_data->shape_data.fam_rigid;
+
+    const std::vector<char>& obj_active = *cd_data->state_data.active_rigid;
+    const std::vector<char>& obj_collide = *cd_data->state_data.collide_rigid;
+
+    const std::vector<real3>& aabb_min = cd_data->aabb_min;
+    const std::vector<real3>& aabb_max = cd_data->aabb_max;
+    std::vector<long long>& pair_shapeIDs = cd_data->pair_shapeIDs;
+    std::vector<uint>& bin_number = cd_data->bin_number;
+    std::vector<uint>& bin_aabb_number = cd_data->bin_aabb_number;
+    std::vector<uint>& bin_active = cd_data->bin_active;
+    std::vector<uint>& bin_start_index = cd_data->bin_start_index;
+    std::vector<uint>& bin_start_index_ext = cd_data->bin_start_index_ext;
+    std::vector<uint>& bin_num_contact = cd_data->bin_num_contact;
+
+    const vec3& bins_per_axis = cd_data->bins_per_axis;
+    const real3& inv_bin_size = cd_data->inv_bin_size;
+    const uint num_bins = cd_data->num_bins;
+    uint& num_active_bins = cd_data->num_active_bins;
+    uint& num_possible_collisions = cd_data->num_possible_collisions;
+
+    // Find the number of active bins (i.e. with at least one shape AABB intersection)
     num_active_bins = (int)(Run_Length_Encode(bin_number, bin_active, bin_start_index));
 
     if (num_active_bins <= 0) {
         num_possible_collisions = 0;
+        bin_start_index_ext.assign(num_bins + 1, 0);
         return;
     }
 
@@ -343,4 +382,439 @@ void ChBroadphase::OneLevelBroadphase() {
     }
 }
 
+// -----------------------------------------------------------------------------
+// Adaptive two-level grid
+// -----------------------------------------------------------------------------
+
+// Number of buckets in the histogram of shape sizes.
+// Bucket k collects sizes in [2^(k-33), 2^(k-32)); bucket 0 also collects degenerate shapes.
+static const int num_size_buckets = 64;
+
+// Maximum number of layers of bin-shape intersections merged at the fine level (see FineLevelBroadphase).
+static const int max_fine_layers = 64;
+
+// Histogram bucket for the given shape size.
+static int SizeBucket(real size) {
+    if (!(size > 0))
+        return 0;
+    int exp;
+    std::frexp(size, &exp);
+    return std::min(std::max(exp + 32, 0), num_size_buckets - 1);
+}
+
+// Smallest bucket upper bound such that the given fraction of the recorded sizes are below it.
+static real SizeQuantile(const std::vector<uint>& histogram, uint count, real fraction) {
+    uint target = std::max(1u, (uint)std::ceil(fraction * count));
+    uint sum = 0;
+    for (int k = 0; k < num_size_buckets; k++) {
+        sum += histogram[k];
+        if (sum >= target)
+            return std::ldexp(real(1), k - 32);
+    }
+    return std::ldexp(real(1), num_size_buckets - 33);
+}
+
+// Number of bins along each axis of a grid with given extents, such that bins have roughly the specified size.
+// The bin size is increased if needed, so that the grid has no more than max_bins bins.
+static vec3 GridResolution(const real3& diag, real size, real max_bins) {
+    real3 n(std::ceil(diag.x / size), std::ceil(diag.y / size), std::ceil(diag.z / size));
+    real total = n.x * n.y * n.z;
+    if (total > max_bins) {
+        size *= std::cbrt(total / max_bins);
+        n = real3(std::ceil(diag.x / size), std::ceil(diag.y / size), std::ceil(diag.z / size));
+    }
+    return Max(vec3((int)n.x, (int)n.y, (int)n.z), vec3(1, 1, 1));
+}
+
+// Sort keys which are expected to be nearly sorted (e.g., keys from the previous step, updated after a small motion).
+// Insertion sort is used as long as the total displacement of the keys stays linear in their number; otherwise, the
+// sort is completed with a full sort.
+static void CoherentSort(std::vector<std::uint64_t>& keys) {
+    const size_t n = keys.size();
+    size_t budget = 4 * n;
+    for (size_t i = 1; i < n; i++) {
+        if (keys[i - 1] <= keys[i])
+            continue;
+        std::uint64_t key = keys[i];
+        size_t j = i;
+        while (j > 0 && keys[j - 1] > key) {
+            keys[j] = keys[j - 1];
+            j--;
+        }
+        keys[j] = key;
+        if (i - j > budget) {
+            Thrust_Sort(keys);
+            return;
+        }
+        budget -= i - j;
+    }
+}
+
+// Select the level of each shape and the resolution of the fine and coarse grids.
+void ChBroadphase::AssignLevels() {
+    const int num_shapes = cd_data->num_rigid_shapes;
+    const std::vector<real3>& aabb_min = cd_data->aabb_min;
+    const std::vector<real3>& aabb_max = cd_data->aabb_max;
+    const std::vector<uint>& id_rigid = cd_data->shape_data.id_rigid;
+    const std::vector<char>& collide_rigid = *cd_data->state_data.collide_rigid;
+    std::vector<uint>& coarse_shapes = cd_data->coarse_shapes;
+
+    // Histogram of the sizes of all shapes to be binned (excluding inactive shapes and shapes on non-colliding bodies)
+    shape_level.resize(num_shapes);
+    std::vector<uint> histogram(num_size_buckets, 0);
+    uint count = 0;
+    for (int i = 0; i < num_shapes; i++) {
+        uint id = id_rigid[i];
+        if (id == UINT_MAX || collide_rigid[id] == 0) {
+            shape_level[i] = -1;
+            continue;
+        }
+        shape_level[i] = 0;
+        histogram[SizeBucket(Max(aabb_max[i] - aabb_min[i]))]++;
+        count++;
+    }
+
+    // Fine bins are sized so that most shapes span at most two bins in each direction.
+    // Shapes larger than level_ratio fine bins are moved to the coarse level.
+    real fine_size = SizeQuantile(histogram, count, real(0.9));
+    real max_fine_size = level_ratio * fine_size;
+
+    std::vector<uint> coarse_histogram(num_size_buckets, 0);
+    coarse_shapes.clear();
+    real3 fine_min(+C_REAL_MAX);
+    real3 fine_max(-C_REAL_MAX);
+    uint num_fine = 0;
+    for (int i = 0; i < num_shapes; i++) {
+        if (shape_level[i] < 0)
+            continue;
+        real size = Max(aabb_max[i] - aabb_min[i]);
+        if (size > max_fine_size) {
+            shape_level[i] = 1;
+            coarse_shapes.push_back(i);
+            coarse_histogram[SizeBucket(size)]++;
+        } else {
+            shape_level[i] = 0;
+            fine_min = Min(fine_min, aabb_min[i]);
+            fine_max = Max(fine_max, aabb_max[i]);
+            num_fine++;
+        }
+    }
+
+    // The fine grid bounds only the fine-level shapes.
+    // Inflate its bounding box slightly and make sure it is at least one fine bin wide in each direction.
+    if (num_fine == 0) {
+        fine_min = cd_data->min_bounding_point;
+        fine_max = cd_data->max_bounding_point;
+    } else {
+        real3 size = fine_max - fine_min;
+        for (unsigned int k = 0; k < 3; k++) {
+            real margin = std::max(real(1e-3) * size[k], real(0.5) * (fine_size - size[k]));
+            fine_min[k] -= margin;
+            fine_max[k] += margin;
+        }
+    }
+
+    real3 fine_diag = fine_max - fine_min;
+    vec3& bins_per_axis = cd_data->bins_per_axis;
+    bins_per_axis = GridResolution(fine_diag, fine_size, real(4) * num_fine + 64);
+    cd_data->bin_size = fine_diag / real3(bins_per_axis.x, bins_per_axis.y, bins_per_axis.z);
+    cd_data->inv_bin_size = 1.0 / cd_data->bin_size;
+    cd_data->global_origin = fine_min;
+    cd_data->grid_max_point = fine_max;
+
+    // The coarse grid bounds all shapes. Coarse bins are at least as large as the largest fine-level shape, so that
+    // fine-level shapes span at most two coarse bins in each direction.
+    real coarse_size = max_fine_size;
+    if (!coarse_shapes.empty())
+        coarse_size = std::max(coarse_size, SizeQuantile(coarse_histogram, (uint)coarse_shapes.size(), real(0.5)));
+
+    real3 coarse_diag = cd_data->max_bounding_point - cd_data->min_bounding_point;
+    coarse_bins_per_axis = GridResolution(coarse_diag, coarse_size, real(4) * coarse_shapes.size() + 64);
+    coarse_inv_bin_size =
+        1.0 / (coarse_diag / real3(coarse_bins_per_axis.x, coarse_bins_per_axis.y, coarse_bins_per_axis.z));
+    coarse_origin = cd_data->min_bounding_point - fine_min;
+}
+
+// Fine-level broadphase, using the shape order of the previous step.
+// Shapes are kept sorted by the bin of their lower corner (this order changes little from one step to the next). A
+// shape spanning (sx,sy,sz) bins intersects the bins at offsets (dx,dy,dz) < (sx,sy,sz) from its lower corner bin.
+// All intersections with the same offset form a layer which is already sorted by bin index, so that the sorted list of
+// intersections is obtained by merging a few sorted layers.
+void ChBroadphase::FineLevelBroadphase() {
+    const std::vector<real3>& aabb_min = cd_data->aabb_min;
+    const std::vector<real3>& aabb_max = cd_data->aabb_max;
+    std::vector<uint>& bin_number = cd_data->bin_number;
+    std::vector<uint>& bin_aabb_number = cd_data->bin_aabb_number;
+
+    const int num_shapes = cd_data->num_rigid_shapes;
+
+    const vec3& bins_per_axis = cd_data->bins_per_axis;
+    const real3& inv_bin_size = cd_data->inv_bin_size;
+    uint& num_bin_aabb_intersections = cd_data->num_bin_aabb_intersections;
+
+    cd_data->num_bins = bins_per_axis.x * bins_per_axis.y * bins_per_axis.z;
+
+    // Update the keys of all shapes, in the order of the previous step (shapes not in the fine level go last)
+    if (shape_keys.size() != (size_t)num_shapes) {
+        shape_keys.resize(num_shapes);
+        for (int i = 0; i < num_shapes; i++)
+            shape_keys[i] = (std::uint64_t)i;
+    }
+
+#pragma omp parallel for
+    for (int p = 0; p < num_shapes; p++) {
+        uint i = (uint)(shape_keys[p] & 0xffffffff);
+        uint bin = UINT_MAX;
+        if (shape_level[i] == 0)
+            bin = Hash_Index(HashMin(aabb_min[i], inv_bin_size), bins_per_axis);
+        shape_keys[p] = ((std::uint64_t)bin << 32) | i;
+    }
+
+    CoherentSort(shape_keys);
+
+    int num_fine = (int)(std::lower_bound(shape_keys.begin(), shape_keys.end(), (std::uint64_t)UINT_MAX << 32) -
+                         shape_keys.begin());
+
+    // Number of bins spanned by each shape, and size of the layers
+    std::vector<vec3> span(num_fine);
+    vec3 max_span(1, 1, 1);
+    for (int p = 0; p < num_fine; p++) {
+        uint i = (uint)(shape_keys[p] & 0xffffffff);
+        span[p] = Max(HashMax(aabb_max[i], inv_bin_size) - HashMin(aabb_min[i], inv_bin_size) + 1, vec3(1, 1, 1));
+        max_span = Max(max_span, span[p]);
+    }
+
+    int num_layers = max_span.x * max_span.y * max_span.z;
+    if (num_layers > max_fine_layers) {
+        // Shapes span too many bins: generate all intersections and perform a full sort
+        fine_keys.clear();
+        for (int p = 0; p < num_fine; p++) {
+            uint i = (uint)(shape_keys[p] & 0xffffffff);
+            vec3 gmin = HashMin(aabb_min[i], inv_bin_size);
+            for (int k = 0; k < span[p].z; k++)
+                for (int j = 0; j < span[p].y; j++)
+                    for (int l = 0; l < span[p].x; l++) {
+                        std::uint64_t bin = Hash_Index(gmin + vec3(l, j, k), bins_per_axis);
+                        fine_keys.push_back((bin << 32) | i);
+                    }
+        }
+        Thrust_Sort(fine_keys);
+    } else {
+        // Count the intersections in each layer (layer index: (dz * max_span.y + dy) * max_span.x + dx)
+        std::vector<uint> layer_start(num_layers + 1, 0);
+        for (int p = 0; p < num_fine; p++) {
+            for (int k = 0; k < span[p].z; k++)
+                for (int j = 0; j < span[p].y; j++)
+                    for (int l = 0; l < span[p].x; l++)
+                        layer_start[(k * max_span.y + j) * max_span.x + l + 1]++;
+        }
+        for (int m = 0; m < num_layers; m++)
+            layer_start[m + 1] += layer_start[m];
+
+        fine_keys.resize(layer_start[num_layers]);
+
+        // Fill the layers; each layer is sorted since shapes are sorted by the bin of their lower corner
+#pragma omp parallel for schedule(dynamic)
+        for (int m = 0; m < num_layers; m++) {
+            vec3 offset(m % max_span.x, (m / max_span.x) % max_span.y, m / (max_span.x * max_span.y));
+            std::uint64_t shift = Hash_Index(offset, bins_per_axis);
+            uint pos = layer_start[m];
+            for (int p = 0; p < num_fine; p++) {
+                if (span[p].x > offset.x && span[p].y > offset.y && span[p].z > offset.z)
+                    fine_keys[pos++] = shape_keys[p] + (shift << 32);
+            }
+        }
+
+        // Merge pairs of adjacent layers until a single sorted sequence is left
+        std::vector<uint> runs(layer_start);
+        while (runs.size() > 2) {
+            int num_merges = (int)(runs.size() - 1) / 2;
+#pragma omp parallel for
+            for (int r = 0; r < num_merges; r++) {
+                std::inplace_merge(fine_keys.begin() + runs[2 * r], fine_keys.begin() + runs[2 * r + 1],
+                                   fine_keys.begin() + runs[2 * r + 2]);
+            }
+            std::vector<uint> merged;
+            for (size_t r = 0; r < runs.size(); r += 2)
+                merged.push_back(runs[r]);
+            if (merged.back() != runs.back())
+                merged.push_back(runs.back());
+            runs.swap(merged);
+        }
+    }
+
+    num_bin_aabb_intersections = (uint)fine_keys.size();
+    bin_number.resize(num_bin_aabb_intersections);
+    bin_aabb_number.resize(num_bin_aabb_intersections);
+    cd_data->bin_active.resize(num_bin_aabb_intersections);       // will be resized in ProcessActiveBins
+    cd_data->bin_start_index.resize(num_bin_aabb_intersections);  // will be resized in ProcessActiveBins
+
+#pragma omp parallel for
+    for (int j = 0; j < (signed)num_bin_aabb_intersections; j++) {
+        bin_number[j] = (uint)(fine_keys[j] >> 32);
+        bin_aabb_number[j] = (uint)(fine_keys[j] & 0xffffffff);
+    }
+
+    ProcessActiveBins();
+}
+
+// Check whether two shapes are in potential collision (this is the same test as in the one-level grid).
+static bool CheckPair(uint shapeA,
+                      uint shapeB,
+                      const std::vector<real3>& aabb_min,
+                      const std::vector<real3>& aabb_max,
+                      const std::vector<short2>& fam_data,
+                      const std::vector<char>& body_active,
+                      const std::vector<char>& body_collide,
+                      const std::vector<uint>& body_id) {
+    uint bodyA = body_id[shapeA];
+    uint bodyB = body_id[shapeB];
+    if (bodyA == UINT_MAX || bodyB == UINT_MAX)
+        return false;
+    if (shapeA == shapeB || bodyA == bodyB)
+        return false;
+    if (body_collide[bodyA] == 0 || body_collide[bodyB] == 0)
+        return false;
+    if (!body_active[bodyA] && !body_active[bodyB])
+        return false;
+    if (!collide(fam_data[shapeA], fam_data[shapeB]))
+        return false;
+    return overlap(aabb_min[shapeA], aabb_max[shapeA], aabb_min[shapeB], aabb_max[shapeB]);
+}
+
+// Coarse-level broadphase.
+// Coarse-level shapes are binned in all coarse bins they intersect. Fine-level shapes are only binned in coarse bins
+// which are intersected by at least one coarse-level shape. Only pairs involving at least one coarse-level shape are
+// tested (pairs of fine-level shapes were found by the fine-level broadphase).
+void ChBroadphase::CoarseLevelBroadphase() {
+    const std::vector<uint>& obj_data_id = cd_data->shape_data.id_rigid;
+    const std::vector<short2>& fam_data = cd_data->shape_data.fam_rigid;
+
+    const std::vector<char>& obj_active = *cd_data->state_data.active_rigid;
+    const std::vector<char>& obj_collide = *cd_data->state_data.collide_rigid;
+
+    const std::vector<real3>& aabb_min = cd_data->aabb_min;
+    const std::vector<real3>& aabb_max = cd_data->aabb_max;
+    const std::vector<uint>& coarse_shapes = cd_data->coarse_shapes;
+    std::vector<long long>& pair_shapeIDs = cd_data->pair_shapeIDs;
+
+    const int num_shapes = cd_data->num_rigid_shapes;
+    const vec3& bins_per_axis = coarse_bins_per_axis;
+    const vec3 max_bin = coarse_bins_per_axis - vec3(1, 1, 1);
+
+    if (coarse_shapes.empty())
+        return;
+
+    // Range of coarse bins intersected by a shape AABB
+    auto bin_min = [&](uint i) {
+        return Clamp(HashMin(aabb_min[i] - coarse_origin, coarse_inv_bin_size), vec3(0, 0, 0), max_bin);
+    };
+    auto bin_max = [&](uint i) {
+        return Clamp(HashMax(aabb_max[i] - coarse_origin, coarse_inv_bin_size), vec3(0, 0, 0), max_bin);
+    };
+
+    // Flag the coarse bins intersected by coarse-level shapes
+    coarse_occupied.assign((size_t)bins_per_axis.x * bins_per_axis.y * bins_per_axis.z, 0);
+    for (uint i : coarse_shapes) {
+        vec3 gmin = bin_min(i);
+        vec3 gmax = bin_max(i);
+        for (int k = gmin.z; k <= gmax.z; k++)
+            for (int j = gmin.y; j <= gmax.y; j++)
+                for (int l = gmin.x; l <= gmax.x; l++)
+                    coarse_occupied[Hash_Index(vec3(l, j, k), bins_per_axis)] = 1;
+    }
+
+    // Count and store the bin-shape AABB intersections
+    std::vector<uint> shape_count(num_shapes + 1, 0);
+#pragma omp parallel for
+    for (int i = 0; i < num_shapes; i++) {
+        if (shape_level[i] < 0)
+            continue;
+        vec3 gmin = bin_min(i);
+        vec3 gmax = bin_max(i);
+        uint count = 0;
+        for (int k = gmin.z; k <= gmax.z; k++)
+            for (int j = gmin.y; j <= gmax.y; j++)
+                for (int l = gmin.x; l <= gmax.x; l++)
+                    count += (shape_level[i] == 1 || coarse_occupied[Hash_Index(vec3(l, j, k), bins_per_axis)]);
+        shape_count[i] = count;
+    }
+
+    Thrust_Exclusive_Scan(shape_count);
+    coarse_keys.resize(shape_count[num_shapes]);
+
+#pragma omp parallel for
+    for (int i = 0; i < num_shapes; i++) {
+        if (shape_level[i] < 0)
+            continue;
+        vec3 gmin = bin_min(i);
+        vec3 gmax = bin_max(i);
+        uint pos = shape_count[i];
+        for (int k = gmin.z; k <= gmax.z; k++)
+            for (int j = gmin.y; j <= gmax.y; j++)
+                for (int l = gmin.x; l <= gmax.x; l++) {
+                    std::uint64_t bin = Hash_Index(vec3(l, j, k), bins_per_axis);
+                    if (shape_level[i] == 1 || coarse_occupied[bin])
+                        coarse_keys[pos++] = (bin << 32) | (uint)i;
+                }
+    }
+
+    Thrust_Sort(coarse_keys);
+
+    // Find the active coarse bins
+    coarse_start.clear();
+    for (size_t j = 0; j < coarse_keys.size(); j++) {
+        if (j == 0 || (coarse_keys[j] >> 32) != (coarse_keys[j - 1] >> 32))
+            coarse_start.push_back((uint)j);
+    }
+    const int num_active = (int)coarse_start.size();
+    coarse_start.push_back((uint)coarse_keys.size());
+
+    // Pairs of shapes in a bin, with at least one coarse-level shape. A pair is reported only in the bin containing the
+    // lower corner of the intersection of the two AABBs.
+    auto for_each_pair = [&](int b, auto&& f) {
+        uint bin = (uint)(coarse_keys[coarse_start[b]] >> 32);
+        for (uint a = coarse_start[b]; a < coarse_start[b + 1]; a++) {
+            uint shapeA = (uint)(coarse_keys[a] & 0xffffffff);
+            for (uint c = a + 1; c < coarse_start[b + 1]; c++) {
+                uint shapeB = (uint)(coarse_keys[c] & 0xffffffff);
+                if (shape_level[shapeA] == 0 && shape_level[shapeB] == 0)
+                    continue;
+                if (!CheckPair(shapeA, shapeB, aabb_min, aabb_max, fam_data, obj_active, obj_collide, obj_data_id))
+                    continue;
+                real3 corner = Max(aabb_min[shapeA], aabb_min[shapeB]) - coarse_origin;
+                vec3 cbin = Clamp(HashMin(corner, coarse_inv_bin_size), vec3(0, 0, 0), max_bin);
+                if (Hash_Index(cbin, bins_per_axis) != bin)
+                    continue;
+                f(std::min(shapeA, shapeB), std::max(shapeA, shapeB));
+            }
+        }
+    };
+
+    coarse_num_contact.assign(num_active + 1, 0);
+#pragma omp parallel for
+    for (int b = 0; b < num_active; b++) {
+        uint count = 0;
+        for_each_pair(b, [&count](uint, uint) { count++; });
+        coarse_num_contact[b] = count;
+    }
+
+    Thrust_Exclusive_Scan(coarse_num_contact);
+    uint num_fine_pairs = cd_data->num_possible_collisions;
+    uint num_coarse_pairs = coarse_num_contact[num_active];
+    pair_shapeIDs.resize(num_fine_pairs + num_coarse_pairs);
+
+#pragma omp parallel for
+    for (int b = 0; b < num_active; b++) {
+        uint pos = num_fine_pairs + coarse_num_contact[b];
+        for_each_pair(b, [&](uint shapeA, uint shapeB) {
+            pair_shapeIDs[pos++] = ((long long)shapeA << 32 | (long long)shapeB);
+        });
+    }
+
+    cd_data->num_possible_collisions = num_fine_pairs + num_coarse_pairs;
+    cd_data->num_active_bins += (uint)num_active;
+    cd_data->num_bin_aabb_intersections += (uint)coarse_keys.size();
+}
+
 }  // end namespace chrono
@@ -18,6 +18,9 @@
 
 #pragma once
 
+#include <cstdint>
+#include <vector>
+
 #include "chrono/collision/ChCollisionModel.h"
 #include "chrono/collision/multicore/ChCollisionData.h"
 
@@ -27,13 +30,20 @@ namespace chrono {
 /// @{
 
 /// Class for performing broad-phase collision detection.
+/// With GridType::ADAPTIVE, shapes are split in two levels based on their size. Small shapes are binned in a fine grid
+/// bounding only the small shapes; shapes larger than a given multiple of the fine bin size are binned in a coarse grid
+/// bounding all shapes, together with those small shapes that fall in coarse bins occupied by large shapes. The bin
+/// size of each level is selected from a histogram of the sizes of the shapes in that level. Since shapes move little
+/// from one step to the next, the fine-level bin-shape pairs are generated in the order of the previous step, so that
+/// they only need to be partially re-sorted.
 class ChApi ChBroadphase {
   public:
     /// Method for computing grid resolution
     enum class GridType {
         FIXED_RESOLUTION,  ///< user-specified number of bins in each direction
         FIXED_BIN_SIZE,    ///< user-specified grid bin dimension
-        FIXED_DENSITY      ///< user-specified density of shapes per bin
+        FIXED_DENSITY,     ///< user-specified density of shapes per bin
+        ADAPTIVE           ///< two-level grid, with bin sizes selected from the distribution of shape sizes
     };
 
     ChBroadphase();
@@ -50,12 +60,29 @@ class ChApi ChBroadphase {
     void RigidBoundingBox();
     void FluidBoundingBox();
 
+    void ProcessActiveBins();
+    void AssignLevels();
+    void FineLevelBroadphase();
+    void CoarseLevelBroadphase();
+
     std::shared_ptr<ChCollisionData> cd_data;
 
     GridType grid_type;    ///< (input) method for setting grid resolution
     vec3 grid_resolution;  ///< (input) number of bins (used for GridType::FIXED_RESOLUTION)
     real3 bin_size;        ///< (input) desired bin dimensions (used for GridType::FIXED_BIN_SIZE)
     real grid_density;     ///< (input) collision grid density (used for GridType::FIXED_DENSITY)
+    real level_ratio;      ///< (input) size ratio of coarse-level shapes to fine bins (used for GridType::ADAPTIVE)
+
+    std::vector<char> shape_level;           ///< level of each shape (-1: not binned, 0: fine, 1: coarse)
+    std::vector<std::uint64_t> shape_keys;   ///< shapes sorted by the fine bin of their lower corner (bin << 32 | ID)
+    std::vector<std::uint64_t> fine_keys;    ///< fine-level bin-shape AABB intersections (bin << 32 | shape ID)
+    std::vector<std::uint64_t> coarse_keys;  ///< coarse-level bin-shape AABB intersections (bin << 32 | shape ID)
+    std::vector<uint> coarse_start;          ///< start of each active coarse bin in coarse_keys
+    std::vector<uint> coarse_num_contact;    ///< candidate pairs in each active coarse bin (exclusive scan)
+    std::vector<char> coarse_occupied;       ///< flags for coarse bins intersected by at least one coarse shape
+    vec3 coarse_bins_per_axis;               ///< number of coarse bins in each direction
+    real3 coarse_inv_bin_size;               ///< coarse bin size reciprocals in each direction
+    real3 coarse_origin;                     ///< coarse grid zero point, relative to the global origin
 
     friend class ChCollisionSystemMulticore;
     friend class ChCollisionSystemChronoMulticore;
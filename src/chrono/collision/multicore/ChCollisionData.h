@@ -103,6 +103,7 @@ class ChApi ChCollisionData {
           min_bounding_point(real3(0)),
           max_bounding_point(real3(0)),
           global_origin(real3(0)),
+          grid_max_point(real3(0)),
           num_bins(0),
           num_bin_aabb_intersections(0),
           num_active_bins(0),
@@ -191,7 +192,8 @@ class ChApi ChCollisionData {
     real3 inv_bin_size;               ///< bin size reciprocals in each direction
     real3 min_bounding_point;         ///< LBR (left-bottom-rear) corner of union of all AABBs
     real3 max_bounding_point;         ///< RTF (right-top-front) corner of union of all AABBs
-    real3 global_origin;              ///< grid zero point (same as LBR)
+    real3 global_origin;              ///< grid zero point (same as LBR, except with an adaptive grid)
+    real3 grid_max_point;             ///< grid RTF corner (same as RTF, except with an adaptive grid)
     uint num_bins;                    ///< total number of bins
     uint num_bin_aabb_intersections;  ///< number of bin - shape AABB intersections
     uint num_active_bins;             ///< number of bins intersecting at least one shape AABB
@@ -211,6 +213,7 @@ class ChApi ChCollisionData {
     std::vector<uint> bin_start_index;      ///< [num_active_bins+1]
     std::vector<uint> bin_start_index_ext;  ///< [num_bins+1]
     std::vector<uint> bin_num_contact;      ///< [num_active_bins+1]
+    std::vector<uint> coarse_shapes;        ///< shapes in the coarse level of an adaptive grid (not in the above bins)
 
     // Indexing variables
     // ------------------
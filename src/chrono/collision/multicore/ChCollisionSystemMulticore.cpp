@@ -62,6 +62,11 @@ void ChCollisionSystemMulticore::SetBroadphaseGridDensity(double density) {
     broadphase.grid_type = ChBroadphase::GridType::FIXED_DENSITY;
 }
 
+void ChCollisionSystemMulticore::SetBroadphaseGridAdaptive(double level_ratio) {
+    broadphase.level_ratio = real(level_ratio);
+    broadphase.grid_type = ChBroadphase::GridType::ADAPTIVE;
+}
+
 void ChCollisionSystemMulticore::SetNarrowphaseAlgorithm(ChNarrowphase::Algorithm algorithm) {
     narrowphase.algorithm = algorithm;
 }
@@ -356,6 +361,8 @@ void ChCollisionSystemMulticore::ReportContacts(ChContactContainer* container) {
         cinfo.vpB = ToChVector(cd_data->cptb_rigid_rigid[i]);
         cinfo.distance = cd_data->dpth_rigid_rigid[i];
         cinfo.eff_radius = cd_data->erad_rigid_rigid[i];
+        cinfo.featureA = s1;  // global shape IDs are stable (and identify individual triangles of a mesh)
+        cinfo.featureB = s2;
 
         // Execute user custom callback, if any
         bool add_contact = true;
@@ -577,6 +584,13 @@ bool ChCollisionSystemMulticore::RayHit(const ChVector3d& from, const ChVector3d
     }
 
     ChRayTest tester(cd_data);
+    return RayHit(tester, from, to, result);
+}
+
+bool ChCollisionSystemMulticore::RayHit(ChRayTest& tester,
+                                        const ChVector3d& from,
+                                        const ChVector3d& to,
+                                        ChRayhitResult& result) const {
     ChRayTest::RayHitInfo info;
     if (tester.Check(FromChVector(from), FromChVector(to), info)) {
         // Hit point
@@ -598,6 +612,35 @@ bool ChCollisionSystemMulticore::RayHit(const ChVector3d& from, const ChVector3d
     return false;
 }
 
+void ChCollisionSystemMulticore::RayHitBatch(const std::vector<ChRay>& rays,
+                                             std::vector<ChRayhitResult>& results,
+                                             int nthreads) const {
+    results.resize(rays.size());
+
+    if (cd_data->num_active_bins == 0) {
+        for (auto& result : results)
+            result.hit = false;
+        return;
+    }
+
+    std::vector<unsigned int> order;
+    SortRays(rays, order);
+
+    int num_rays = (int)rays.size();
+
+#pragma omp parallel num_threads(nthreads)
+    {
+        // The ray tester records per-ray statistics, so each thread uses its own
+        ChRayTest tester(cd_data);
+
+#pragma omp for schedule(dynamic, 64)
+        for (int k = 0; k < num_rays; k++) {
+            unsigned int i = order[k];
+            RayHit(tester, rays[i].from, rays[i].to, results[i]);
+        }
+    }
+}
+
 bool ChCollisionSystemMulticore::RayHit(const ChVector3d& from,
                                         const ChVector3d& to,
                                         ChCollisionModel* model,
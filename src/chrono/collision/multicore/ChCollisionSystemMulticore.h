@@ -35,6 +35,7 @@ namespace chrono {
 // forward references
 class ChAssembly;
 class ChParticleCloud;
+class ChRayTest;
 
 /// @addtogroup collision_mc
 /// @{
@@ -77,6 +78,11 @@ class ChApi ChCollisionSystemMulticore : public ChCollisionSystem {
     /// By default, a fixed number of bins is used (see SetBroadphaseGridResolution).
     void SetBroadphaseGridDensity(double density);
 
+    /// Use an adaptive two-level grid, with bin sizes selected at each step from the distribution of shape sizes.
+    /// Shapes larger than `level_ratio` fine bins are binned in a separate coarse grid. This is best suited for systems
+    /// with a wide range of shape sizes (e.g., granular material in contact with large containers or vehicles).
+    void SetBroadphaseGridAdaptive(double level_ratio = 4);
+
     /// Set the narrowphase algorithm (default: ChNarrowphase::Algorithm::HYBRID).
     /// The Chrono collision detection system provides several analytical collision detection algorithms, for particular
     /// pairs of shapes (see ChNarrowphasePRIMS). For general convex shapes, the collision system relies on the
@@ -136,6 +142,12 @@ class ChApi ChCollisionSystemMulticore : public ChCollisionSystem {
                         ChCollisionModel* model,
                         ChRayhitResult& result) const override;
 
+    /// Perform ray-hit tests with all collision models, for a batch of rays.
+    /// Rays are traversed through the broadphase grid in a spatially coherent order, with one ray tester per thread.
+    virtual void RayHitBatch(const std::vector<ChRay>& rays,
+                             std::vector<ChRayhitResult>& results,
+                             int nthreads = 1) const override;
+
     /// Method to trigger debug visualization of collision shapes.
     /// The 'flags' argument can be any of the VisualizationModes enums, or a combination thereof (using bit-wise
     /// operators). The calling program must invoke this function from within the simulation loop. No-op if a
@@ -152,6 +164,9 @@ class ChApi ChCollisionSystemMulticore : public ChCollisionSystem {
     virtual void ArchiveIn(ChArchiveIn& archive_in) override;
 
   protected:
+    /// Perform a ray-hit test with all collision models, using the provided ray tester.
+    bool RayHit(ChRayTest& tester, const ChVector3d& from, const ChVector3d& to, ChRayhitResult& result) const;
+
     /// Mark bodies whose AABB is contained within the specified box.
     virtual void GetOverlappingAABB(std::vector<char>& active_id, real3 Amin, real3 Amax);
 
@@ -382,20 +382,46 @@ bool ChRayTest::Check(const real3& start, const real3& end, RayHitInfo& info) {
     const vec3& bins_per_axis = cd_data->bins_per_axis;
     const real3& bin_size = cd_data->bin_size;
     const real3& inv_bin_size = cd_data->inv_bin_size;
-    const real3& lbr = cd_data->min_bounding_point;
-    const real3& rtf = cd_data->max_bounding_point;
+    const real3& lbr = cd_data->global_origin;
+    const real3& rtf = cd_data->grid_max_point;
     const std::vector<uint>& bin_start_index_ext = cd_data->bin_start_index_ext;
     const std::vector<uint>& bin_aabb_number = cd_data->bin_aabb_number;
+    const std::vector<uint>& coarse_shapes = cd_data->coarse_shapes;
+    const std::vector<real3>& aabb_min = cd_data->aabb_min;
+    const std::vector<real3>& aabb_max = cd_data->aabb_max;
 
-    // Calculate ray parameter at intersection of overall AABB. Return now if no intersection
-    real3 center = 0.5 * (rtf + lbr), loc, normal;
-    real t_min;
-    if (!aabb_ray(0.5 * (rtf - lbr), start - center, end - center, t_min, loc, normal))
-        return false;
+    ConvexShape shape(-1, &cd_data->shape_data);
+    real mindist2 = C_REAL_MAX;
+    bool hit = false;
+    int hit_shape = -1;
 
     // Ray direction
     real3 ray = end - start;
 
+    // Test ray against all shapes in the coarse level of an adaptive grid (these are not in the grid bins).
+    // Shapes are first tested against their AABB (relative to the grid origin).
+    for (uint index : coarse_shapes) {
+        real3 center = lbr + 0.5 * (aabb_max[index] + aabb_min[index]), loc, normal;
+        real t;
+        if (!aabb_ray(0.5 * (aabb_max[index] - aabb_min[index]), start - center, end - center, t, loc, normal))
+            continue;
+        num_shape_tests++;
+        shape.index = index;
+        if (CheckShape(shape, start, end, info.normal, mindist2)) {
+            hit = true;
+            hit_shape = shape.index;
+        }
+    }
+
+    // Calculate ray parameter at intersection of grid AABB. Return now if no intersection
+    real3 center = 0.5 * (rtf + lbr), loc, normal;
+    real t_min;
+    if (!aabb_ray(0.5 * (rtf - lbr), start - center, end - center, t_min, loc, normal)) {
+        if (hit)
+            SetHitInfo(start, ray, hit_shape, mindist2, info);
+        return hit;
+    }
+
     // Find entry bin
     auto bin = Clamp(HashMin(start - lbr, inv_bin_size), vec3(0, 0, 0), bins_per_axis - vec3(1, 1, 1));
 
@@ -425,9 +451,7 @@ bool ChRayTest::Check(const real3& start, const real3& end, RayHitInfo& info) {
     }
 
     // Walk through each bin intersected by the ray (DDA).
-    ConvexShape shape(-1, &cd_data->shape_data);
-    real mindist2 = C_REAL_MAX;
-    bool hit = false;
+    real length2 = Length2(ray);
 
     ////std::cout << "Ray start: [" << start.x << "," << start.y << "," << start.z << "]" << std::endl;
     ////std::cout << "Ray end:   [" << end.x << "," << end.y << "," << end.z << "]" << std::endl;
@@ -441,20 +465,22 @@ bool ChRayTest::Check(const real3& start, const real3& end, RayHitInfo& info) {
         auto start_index = bin_start_index_ext[bin_index];
         auto end_index = bin_start_index_ext[bin_index + 1];
 
+        bool bin_hit = false;
         for (uint j = start_index; j < end_index; j++) {
             num_shape_tests++;
             shape.index = bin_aabb_number[j];
             ////std::cout << "    Test SHAPE: " << shape.index << std::endl;
-            if (CheckShape(shape, start, end, info.normal, mindist2))
-                hit = true;
+            if (CheckShape(shape, start, end, info.normal, mindist2)) {
+                bin_hit = true;
+                hit_shape = shape.index;
+            }
         }
 
         // If a shape in the current bin was hit, stop.
-        if (hit) {
-            info.shapeID = shape.index;         // Identifier of closest hit shape
-            info.dist = Sqrt(mindist2);         // Distance from ray origin
-            info.t = info.dist / Length(ray);   // Ray parameter at intersection with closest shape
-            info.point = start + info.t * ray;  // Intersection point
+        // Also stop if a coarse-level shape was hit before the ray exits the current bin.
+        real t_exit = Min(t_next[0], Min(t_next[1], t_next[2]));
+        if (bin_hit || (hit && mindist2 <= t_exit * t_exit * length2)) {
+            hit = true;
             break;
         }
 
@@ -468,9 +494,19 @@ bool ChRayTest::Check(const real3& start, const real3& end, RayHitInfo& info) {
         t_next[axis] += delta[axis];
     }
 
+    if (hit)
+        SetHitInfo(start, ray, hit_shape, mindist2, info);
+
     return hit;
 }
 
+void ChRayTest::SetHitInfo(const real3& start, const real3& ray, int shape, real mindist2, RayHitInfo& info) {
+    info.shapeID = shape;               // Identifier of closest hit shape
+    info.dist = Sqrt(mindist2);         // Distance from ray origin
+    info.t = info.dist / Length(ray);   // Ray parameter at intersection with closest shape
+    info.point = start + info.t * ray;  // Intersection point
+}
+
 // Narrowphase dispatcher for ray intersection test.  It uses analytical formulaes for known primitive shapes with
 // fallback on a generic ray-convex intersection test.
 bool ChRayTest::CheckShape(const ConvexBase& shape,
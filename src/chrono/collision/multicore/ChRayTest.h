@@ -42,7 +42,8 @@ class ChApi ChRayTest {
 
     /// Check for intersection of the given ray with all collision shapes in the system.
     /// Uses a variant of the 3D Digital Differential Analyser (Akira Fujimoto, "ARTS: Accelerated Ray Tracing Systems",
-    /// 1986) to efficiently traverse the broadphase grid and analytical shape-ray intersection tests.
+    /// 1986) to efficiently traverse the broadphase grid and analytical shape-ray intersection tests. With an adaptive
+    /// grid, shapes in the coarse level are tested directly (after a test against their AABB).
     bool Check(const real3& start,  ///< ray start point
                const real3& end,    ///< ray end point
                RayHitInfo& info     ///< [output] test result info
@@ -63,6 +64,9 @@ class ChApi ChRayTest {
                     real& mindist2            ///< [output] smallest squared distance to ray origin
     );
 
+    /// Fill the ray test result info for the closest hit shape.
+    static void SetHitInfo(const real3& start, const real3& ray, int shape, real mindist2, RayHitInfo& info);
+
     std::shared_ptr<ChCollisionData> cd_data;  ///< shared collision detection data
     uint num_bin_tests;                        ///< number of bins visited during last ray test
     uint num_shape_tests;                      ///< number of shape checked during last ray test
@@ -63,6 +63,21 @@ friend const CwiseBinaryOp<internal::scalar_sum_op<Scalar>, const ConstantReturn
         mat.derived().Constant(mat.rows(), mat.cols(), val), mat.derived());
 }
 
+// Return a pointer to the coefficients if they are stored contiguously (in the order of linear indices), else nullptr.
+template <typename D = Derived>
+typename std::enable_if<(internal::traits<D>::Flags & DirectAccessBit) != 0, const Scalar*>::type ArchiveRawData()
+    const {
+    if (derived().innerStride() == 1 && derived().outerStride() == derived().innerSize())
+        return derived().data();
+    return nullptr;
+}
+
+template <typename D = Derived>
+typename std::enable_if<(internal::traits<D>::Flags & DirectAccessBit) == 0, const Scalar*>::type ArchiveRawData()
+    const {
+    return nullptr;
+}
+
 void ArchiveOut(chrono::ChArchiveOut& archive_out) {
     // suggested: use versioning
     archive_out.VersionWrite<chrono::ChMatrix_dense_version_tag>();  // btw use the ChMatrixDynamic version tag also for
@@ -95,6 +110,8 @@ void ArchiveOut(chrono::ChArchiveOut& archive_out) {
         size_t tot_elements = derived().rows() * derived().cols();
         double* foo = 0;
         chrono::ChValueSpecific<double*> specVal(foo, "data", 0);
+        if (archive_out.out_array_block(specVal, ArchiveRawData(), tot_elements))
+            return;
         archive_out.out_array_pre(specVal, tot_elements);
         for (size_t i = 0; i < tot_elements; i++) {
             archive_out << chrono::CHNVP(derived()((Eigen::Index)i), std::to_string(i).c_str());
@@ -121,6 +138,10 @@ void ArchiveIn(chrono::ChArchiveIn& archive_in) {
     // custom input of matrix data as array
     size_t tot_elements = derived().rows() * derived().cols();
     archive_in.in_array_pre("data", tot_elements);
+    if (archive_in.in_array_block("data", const_cast<Scalar*>(ArchiveRawData()), tot_elements)) {
+        archive_in.in_array_end("data");
+        return;
+    }
     for (size_t i = 0; i < tot_elements; i++) {
         archive_in >> chrono::CHNVP(derived()((Eigen::Index)i), std::to_string(i).c_str());
         archive_in.in_array_between("data");
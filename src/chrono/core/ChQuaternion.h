@@ -398,6 +398,14 @@ class ChQuaternion {
 
 CH_CLASS_VERSION(ChQuaternion<double>, 0)
 
+/// Arrays of ChQuaternion are archived as raw blocks in binary archives.
+template <class Real>
+struct ChArchiveBlockTraits<ChQuaternion<Real>> {
+    static const bool value = sizeof(ChQuaternion<Real>) == 4 * sizeof(Real);
+    static const size_t scalar_size = sizeof(Real);
+    static const bool compound = true;
+};
+
 // -----------------------------------------------------------------------------
 
 /// Alias for double-precision quaternions.
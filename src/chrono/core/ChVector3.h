@@ -269,6 +269,14 @@ class ChVector3 {
 
 CH_CLASS_VERSION(ChVector3<double>, 0)
 
+/// Arrays of ChVector3 are archived as raw blocks in binary archives.
+template <class Real>
+struct ChArchiveBlockTraits<ChVector3<Real>> {
+    static const bool value = sizeof(ChVector3<Real>) == 3 * sizeof(Real);
+    static const size_t scalar_size = sizeof(Real);
+    static const bool compound = true;
+};
+
 // -----------------------------------------------------------------------------
 
 /// Alias for double-precision vectors.
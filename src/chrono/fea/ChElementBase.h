@@ -104,6 +104,11 @@ class ChApi ChElementBase {
     ///   R += forces * c
     virtual void EleIntLoadResidual_F(ChVectorDynamic<>& R, const double c) {}
 
+    /// Same as EleIntLoadResidual_F, but the caller guarantees that no other thread concurrently updates the entries
+    /// of R associated with the nodes of this element (see ChMesh element coloring), so no atomic updates are needed.
+    /// The default implementation calls EleIntLoadResidual_F.
+    virtual void EleIntLoadResidual_F_exclusive(ChVectorDynamic<>& R, const double c) { EleIntLoadResidual_F(R, c); }
+
     /// Add the product of element mass M by a vector w (pasted at global nodes offsets) into
     /// a global vector R, multiplied by a scaling factor c, as
     ///   R += M * w * c
@@ -122,6 +127,13 @@ class ChApi ChElementBase {
     /// and not even the g vector, for instance if using lumped masses.
     virtual void EleIntLoadResidual_F_gravity(ChVectorDynamic<>& R, const ChVector3d& G_acc, const double c) = 0;
 
+    /// Same as EleIntLoadResidual_F_gravity, but the caller guarantees that no other thread concurrently updates the
+    /// entries of R associated with the nodes of this element, so no atomic updates are needed.
+    /// The default implementation calls EleIntLoadResidual_F_gravity.
+    virtual void EleIntLoadResidual_F_gravity_exclusive(ChVectorDynamic<>& R, const ChVector3d& G_acc, const double c) {
+        EleIntLoadResidual_F_gravity(R, G_acc, c);
+    }
+
     // Functions for interfacing to the solver
 
     /// Register with the given system descriptor any ChKRMBlock objects associated with this item.
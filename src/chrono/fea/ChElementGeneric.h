@@ -44,6 +44,9 @@ class ChApi ChElementGeneric : public ChElementBase {
     /// This default implementation is SLIGHTLY INEFFICIENT.
     virtual void EleIntLoadResidual_F(ChVectorDynamic<>& R, const double c) override;
 
+    /// Same as EleIntLoadResidual_F, without atomic updates of R.
+    virtual void EleIntLoadResidual_F_exclusive(ChVectorDynamic<>& R, const double c) override;
+
     /// Add the product of element mass M by a vector w (pasted at global nodes offsets) into
     /// a global vector R, multiplied by a scaling factor c, as
     ///   R += M * w * c
@@ -63,6 +66,11 @@ class ChApi ChElementGeneric : public ChElementBase {
     /// only if they are inherited by ChLoadableUVW so it can use GetDensity() and Gauss quadrature.
     virtual void EleIntLoadResidual_F_gravity(ChVectorDynamic<>& R, const ChVector3d& G_acc, const double c) override;
 
+    /// Same as EleIntLoadResidual_F_gravity, without atomic updates of R.
+    virtual void EleIntLoadResidual_F_gravity_exclusive(ChVectorDynamic<>& R,
+                                                        const ChVector3d& G_acc,
+                                                        const double c) override;
+
     // FEM functions
 
     /// Compute the gravitational forces.
@@ -93,6 +101,10 @@ class ChApi ChElementGeneric : public ChElementBase {
 
   protected:
     ChKRMBlock Kmatr;
+
+  private:
+    /// Add the element vector F (with the element's coordinate layout) into the global vector R.
+    void ScatterResidual(ChVectorDynamic<>& R, const ChVectorDynamic<>& F, bool atomic);
 };
 
 /// @} fea_elements
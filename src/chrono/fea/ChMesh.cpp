@@ -18,6 +18,7 @@
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 
 #include "chrono/core/ChFrame.h"
 #include "chrono/physics/ChLoad.h"
@@ -28,6 +29,7 @@
 #include "chrono/fea/ChMesh.h"
 #include "chrono/fea/ChNodeFEAxyz.h"
 #include "chrono/fea/ChNodeFEAxyzrot.h"
+#include "chrono/utils/ChProfiler.h"
 
 namespace chrono {
 namespace fea {
@@ -47,12 +49,17 @@ ChMesh::ChMesh(const ChMesh& other) : ChIndexedNodes(other) {
 
     ncalls_internal_forces = 0;
     ncalls_KRMload = 0;
+
+    elem_coloring_valid = false;
+    elem_sequential_color = false;
 }
 
 void ChMesh::SetupInitial() {
     n_dofs = 0;
     n_dofs_w = 0;
 
+    elem_coloring_valid = false;
+
     for (unsigned int i = 0; i < vnodes.size(); i++) {
         if (!vnodes[i]->IsFixed()) {
             vnodes[i]->SetupInitial(GetSystem());
@@ -87,6 +94,8 @@ void ChMesh::AddNode(std::shared_ptr<ChNodeFEAbase> node) {
     node->SetIndex(static_cast<unsigned int>(vnodes.size()) + 1);
     vnodes.push_back(node);
 
+    elem_coloring_valid = false;
+
     // If the mesh is already added to a system, mark the system uninitialized and out-of-date
     if (system) {
         system->is_initialized = false;
@@ -97,6 +106,8 @@ void ChMesh::AddNode(std::shared_ptr<ChNodeFEAbase> node) {
 void ChMesh::AddElement(std::shared_ptr<ChElementBase> elem) {
     velements.push_back(elem);
 
+    elem_coloring_valid = false;
+
     // If the mesh is already added to a system, mark the system uninitialized and out-of-date
     if (system) {
         system->is_initialized = false;
@@ -108,6 +119,8 @@ void ChMesh::ClearElements() {
     velements.clear();
     vcontactsurfaces.clear();
 
+    elem_coloring_valid = false;
+
     // If the mesh is already added to a system, mark the system out-of-date
     if (system) {
         system->is_updated = false;
@@ -119,6 +132,8 @@ void ChMesh::ClearNodes() {
     vnodes.clear();
     vcontactsurfaces.clear();
 
+    elem_coloring_valid = false;
+
     // If the mesh is already added to a system, mark the system out-of-date
     if (system) {
         system->is_updated = false;
@@ -160,6 +175,8 @@ void ChMesh::Setup() {
 // Updates all time-dependant variables, if any...
 // Ex: maybe the elasticity can increase in time, etc.
 void ChMesh::Update(double m_time, bool update_assets) {
+    CH_PROFILE_ZONE("ChMesh::Update");
+
     // Parent class update
     ChIndexedNodes::Update(m_time, update_assets);
 
@@ -278,7 +295,79 @@ void ChMesh::IntStateGetIncrement(const unsigned int off_x,
     }
 }
 
+// Maximum number of colors assigned to elements. Elements that cannot be colored are processed sequentially.
+static const int max_elem_colors = 64;
+
+void ChMesh::UpdateElementColoring() {
+    // Index the mesh nodes (elements may also refer to nodes that were not added to the mesh)
+    std::unordered_map<ChNodeFEAbase*, unsigned int> node_index;
+    node_index.reserve(vnodes.size());
+    for (unsigned int in = 0; in < vnodes.size(); in++)
+        node_index.emplace(vnodes[in].get(), in);
+
+    std::vector<std::uint64_t> node_colors(vnodes.size(), 0);  // colors of elements using each node (bitmask)
+    std::vector<int> elem_color(velements.size());
+    std::vector<unsigned int> color_count(max_elem_colors + 1, 0);
+    std::vector<unsigned int> elem_nodes;
+
+    // Greedy coloring: assign each element the first color not used by the elements sharing any of its nodes
+    for (unsigned int ie = 0; ie < velements.size(); ie++) {
+        elem_nodes.clear();
+        for (unsigned int n = 0; n < velements[ie]->GetNumNodes(); n++) {
+            auto node = velements[ie]->GetNode(n).get();
+            auto it = node_index.find(node);
+            if (it == node_index.end()) {
+                it = node_index.emplace(node, (unsigned int)node_colors.size()).first;
+                node_colors.push_back(0);
+            }
+            elem_nodes.push_back(it->second);
+        }
+
+        std::uint64_t used = 0;
+        for (auto in : elem_nodes)
+            used |= node_colors[in];
+
+        int color = max_elem_colors;
+        for (int c = 0; c < max_elem_colors; c++) {
+            if (!(used & (std::uint64_t(1) << c))) {
+                color = c;
+                break;
+            }
+        }
+
+        if (color < max_elem_colors) {
+            for (auto in : elem_nodes)
+                node_colors[in] |= (std::uint64_t(1) << color);
+        }
+
+        elem_color[ie] = color;
+        color_count[color]++;
+    }
+
+    // Sort elements by color (preserving their order within a color), skipping unused colors
+    std::vector<unsigned int> color_pos(max_elem_colors + 1, 0);
+    elem_color_start.clear();
+    elem_color_start.push_back(0);
+    unsigned int pos = 0;
+    for (int c = 0; c <= max_elem_colors; c++) {
+        color_pos[c] = pos;
+        if (color_count[c] > 0) {
+            pos += color_count[c];
+            elem_color_start.push_back(pos);
+        }
+    }
+    elem_sequential_color = color_count[max_elem_colors] > 0;
+
+    elem_colored.resize(velements.size());
+    for (unsigned int ie = 0; ie < velements.size(); ie++)
+        elem_colored[color_pos[elem_color[ie]]++] = ie;
+
+    elem_coloring_valid = true;
+}
+
 void ChMesh::IntLoadResidual_F(const unsigned int off, ChVectorDynamic<>& R, const double c) {
+    CH_PROFILE_ZONE("ChMesh::IntLoadResidual_F");
+
     // nodes applied forces
     unsigned int local_off_v = 0;
     for (unsigned int j = 0; j < vnodes.size(); j++) {
@@ -290,42 +379,86 @@ void ChMesh::IntLoadResidual_F(const unsigned int off, ChVectorDynamic<>& R, con
 
     int nthreads = GetSystem()->nthreads_chrono;
 
+    // With multiple threads, process the elements one color at a time: elements of the same color do not share nodes
+    // and can update R in parallel without atomic operations.
+    // In deterministic mode, the colored order is also used with a single thread, so that the contributions to each
+    // node are always accumulated in the same order.
+    bool colored = nthreads > 1 || GetSystem()->IsDeterministic();
+    if (colored && !elem_coloring_valid)
+        UpdateElementColoring();
+    unsigned int num_colors = colored ? GetNumElementColors() : 0;
+
     // elements internal forces
+    // (each thread records its share of the work as a profiler zone, before the barrier closing the parallel region)
     timer_internal_forces.start();
-    //// PARALLEL FOR, must use omp atomic to avoid race condition in writing to R
-#pragma omp parallel for schedule(dynamic, 4) num_threads(nthreads)
-    for (int ie = 0; ie < velements.size(); ie++) {
-        velements[ie]->EleIntLoadResidual_F(R, c);
+    if (colored) {
+        for (unsigned int k = 0; k < num_colors; k++) {
+            int start = (int)elem_color_start[k];
+            int end = (int)elem_color_start[k + 1];
+            int nthreads_color = (elem_sequential_color && k == num_colors - 1) ? 1 : nthreads;
+#pragma omp parallel num_threads(nthreads_color)
+            {
+                CH_PROFILE_ZONE("ChMesh::InternalForces (color)");
+#pragma omp for schedule(dynamic, 4) nowait
+                for (int j = start; j < end; j++) {
+                    velements[elem_colored[j]]->EleIntLoadResidual_F_exclusive(R, c);
+                }
+            }
+        }
+    } else {
+        //// PARALLEL FOR, must use omp atomic to avoid race condition in writing to R
+#pragma omp parallel num_threads(nthreads)
+        {
+            CH_PROFILE_ZONE("ChMesh::InternalForces");
+#pragma omp for schedule(dynamic, 4) nowait
+            for (int ie = 0; ie < velements.size(); ie++) {
+                velements[ie]->EleIntLoadResidual_F(R, c);
+            }
+        }
     }
     timer_internal_forces.stop();
     ncalls_internal_forces++;
 
     // elements gravity forces
     if (automatic_gravity_load) {
-        //// PARALLEL FOR, must use omp atomic to avoid race condition in writing to R
+        const ChVector3d& G_acc = GetSystem()->GetGravitationalAcceleration();
+        if (colored) {
+            for (unsigned int k = 0; k < num_colors; k++) {
+                int start = (int)elem_color_start[k];
+                int end = (int)elem_color_start[k + 1];
+                int nthreads_color = (elem_sequential_color && k == num_colors - 1) ? 1 : nthreads;
+#pragma omp parallel for schedule(dynamic, 4) num_threads(nthreads_color)
+                for (int j = start; j < end; j++) {
+                    velements[elem_colored[j]]->EleIntLoadResidual_F_gravity_exclusive(R, G_acc, c);
+                }
+            }
+        } else {
+            //// PARALLEL FOR, must use omp atomic to avoid race condition in writing to R
 #pragma omp parallel for schedule(dynamic, 4) num_threads(nthreads)
-        for (int ie = 0; ie < velements.size(); ie++) {
-            velements[ie]->EleIntLoadResidual_F_gravity(R, GetSystem()->GetGravitationalAcceleration(), c);
+            for (int ie = 0; ie < velements.size(); ie++) {
+                velements[ie]->EleIntLoadResidual_F_gravity(R, G_acc, c);
+            }
         }
     }
 
     // nodes gravity forces
-    local_off_v = 0;
     if (automatic_gravity_load && system) {
-        // #pragma omp parallel for schedule(dynamic, 4) num_threads(nthreads)
-        //// PARALLEL FOR, (no need here to use omp atomic to avoid race condition in writing to R)
+        const ChVector3d& G_acc = system->GetGravitationalAcceleration();
+        unsigned int off_w = GetOffset_w();
+        //// PARALLEL FOR, (no need here to use omp atomic: each node writes to its own entries of R)
+#pragma omp parallel for schedule(static) num_threads(nthreads)
         for (int in = 0; in < vnodes.size(); in++) {
             if (!vnodes[in]->IsFixed()) {
+                unsigned int node_off = off + vnodes[in]->NodeGetOffsetVelLevel() - off_w;
                 if (auto mnode = std::dynamic_pointer_cast<ChNodeFEAxyz>(vnodes[in])) {
-                    ChVector3d fg = c * mnode->GetMass() * system->GetGravitationalAcceleration();
-                    R.segment(off + local_off_v, 3) += fg.eigen();
+                    ChVector3d fg = c * mnode->GetMass() * G_acc;
+                    R.segment(node_off, 3) += fg.eigen();
                 }
                 // ChNodeFEAxyzrot is not inherited from ChNodeFEAxyz, so must deal with it too
                 if (auto mnode = std::dynamic_pointer_cast<ChNodeFEAxyzrot>(vnodes[in])) {
-                    ChVector3d fg = c * mnode->GetMass() * system->GetGravitationalAcceleration();
-                    R.segment(off + local_off_v, 3) += fg.eigen();
+                    ChVector3d fg = c * mnode->GetMass() * G_acc;
+                    R.segment(node_off, 3) += fg.eigen();
                 }
-                local_off_v += vnodes[in]->GetNumCoordsVelLevelActive();
             }
         }
     }
@@ -473,12 +606,19 @@ void ChMesh::InjectKRMMatrices(ChSystemDescriptor& descriptor) {
 }
 
 void ChMesh::LoadKRMMatrices(double Kfactor, double Rfactor, double Mfactor) {
+    CH_PROFILE_ZONE("ChMesh::LoadKRMMatrices");
+
     int nthreads = GetSystem()->nthreads_chrono;
 
+    // Each element loads its own KRM block, so no synchronization (or coloring) is needed here
     timer_KRMload.start();
-#pragma omp parallel for num_threads(nthreads)
-    for (int ie = 0; ie < velements.size(); ie++)
-        velements[ie]->LoadKRMMatrices(Kfactor, Rfactor, Mfactor);
+#pragma omp parallel num_threads(nthreads)
+    {
+        CH_PROFILE_ZONE("ChMesh::ElementKRM");
+#pragma omp for nowait
+        for (int ie = 0; ie < velements.size(); ie++)
+            velements[ie]->LoadKRMMatrices(Kfactor, Rfactor, Mfactor);
+    }
     timer_KRMload.stop();
     ncalls_KRMload++;
 }
@@ -44,7 +44,9 @@ class ChApi ChMesh : public ChIndexedNodes {
           automatic_gravity_load(true),
           num_points_gravity(1),
           ncalls_internal_forces(0),
-          ncalls_KRMload(0) {}
+          ncalls_KRMload(0),
+          elem_coloring_valid(false),
+          elem_sequential_color(false) {}
     ChMesh(const ChMesh& other);
     ~ChMesh() {}
 
@@ -104,6 +106,15 @@ class ChApi ChMesh : public ChIndexedNodes {
     /// Get cumulative time for Jacobian load calls.
     double GetTimeJacobianLoad() { return timer_KRMload(); }
 
+    /// Get the number of colors in the element coloring used for multithreaded force assembly.
+    /// When the system uses more than one thread, elements are partitioned in colors such that elements of the same
+    /// color do not share nodes; the elements of a color then add their internal and gravity forces to the system
+    /// residual in parallel, without atomic updates. The coloring is computed at the first force evaluation after a
+    /// change of the mesh topology. Elements that cannot be colored are processed sequentially, as an additional color.
+    unsigned int GetNumElementColors() const {
+        return elem_color_start.empty() ? 0 : (unsigned int)elem_color_start.size() - 1;
+    }
+
     /// Add a contact surface.
     void AddContactSurface(std::shared_ptr<ChContactSurface> m_surf);
 
@@ -276,6 +287,9 @@ class ChApi ChMesh : public ChIndexedNodes {
     /// </pre>
     virtual void SetupInitial() override;
 
+    /// Partition the elements in colors, such that elements of the same color do not share nodes.
+    void UpdateElementColoring();
+
     std::vector<std::shared_ptr<ChNodeFEAbase>> vnodes;     ///<  nodes
     std::vector<std::shared_ptr<ChElementBase>> velements;  ///<  elements
 
@@ -293,6 +307,11 @@ class ChApi ChMesh : public ChIndexedNodes {
     unsigned int ncalls_internal_forces;
     unsigned int ncalls_KRMload;
 
+    bool elem_coloring_valid;                    ///< element coloring is up to date with the mesh topology
+    bool elem_sequential_color;                  ///< the last color contains elements that could not be colored
+    std::vector<unsigned int> elem_color_start;  ///< first entry in elem_colored (size: num. colors + 1)
+    std::vector<unsigned int> elem_colored;      ///< element indices, sorted by color
+
     friend class chrono::ChSystem;
     friend class chrono::ChAssembly;
     friend class chrono::modal::ChModalAssembly;
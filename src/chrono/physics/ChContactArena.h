@@ -0,0 +1,133 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#ifndef CH_CONTACT_ARENA_H
+#define CH_CONTACT_ARENA_H
+
+#include <cassert>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace chrono {
+
+/// Pooled storage for contact objects of a given type, used by the contact containers.
+/// Contacts are stored in fixed-size chunks of contiguous memory, so that contact objects have stable addresses and
+/// stable indices. Contact objects are never destroyed between steps: Rewind() makes all of them available for reuse in
+/// O(1) and new objects are constructed only when the number of contacts exceeds the largest number seen so far.
+/// Memory is released only by Clear().
+template <class Tcont, unsigned int chunk_bits = 7>
+class ChContactArena {
+  public:
+    /// Forward iterator over the contacts currently in use. Dereferencing returns a pointer to the contact object.
+    class iterator {
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Tcont*;
+        using difference_type = std::ptrdiff_t;
+        using pointer = Tcont**;
+        using reference = Tcont*;
+
+        iterator(const ChContactArena* arena, unsigned int index) : m_arena(arena), m_index(index) {}
+        Tcont* operator*() const { return m_arena->Get(m_index); }
+        iterator& operator++() {
+            ++m_index;
+            return *this;
+        }
+        iterator operator++(int) {
+            iterator tmp = *this;
+            ++m_index;
+            return tmp;
+        }
+        bool operator==(const iterator& other) const { return m_index == other.m_index; }
+        bool operator!=(const iterator& other) const { return m_index != other.m_index; }
+
+      private:
+        const ChContactArena* m_arena;
+        unsigned int m_index;
+    };
+
+    ChContactArena() : m_size(0), m_constructed(0) {}
+    ~ChContactArena() { Clear(); }
+
+    // Contact objects hold pointers to their container; an arena is never copied with it.
+    ChContactArena(const ChContactArena&) = delete;
+    ChContactArena& operator=(const ChContactArena&) = delete;
+
+    /// Return the number of contacts currently in use.
+    unsigned int size() const { return m_size; }
+
+    /// Return true if no contact is in use.
+    bool empty() const { return m_size == 0; }
+
+    /// Return the number of contact objects constructed so far (in use or available for reuse).
+    unsigned int capacity() const { return m_constructed; }
+
+    /// Return the contact with given index (0 <= index < size()).
+    Tcont* Get(unsigned int index) const {
+        return reinterpret_cast<Tcont*>(&m_chunks[index >> chunk_bits][index & chunk_mask]);
+    }
+
+    iterator begin() const { return iterator(this, 0); }
+    iterator end() const { return iterator(this, m_size); }
+
+    /// Mark all contacts as unused. Contact objects are kept for later reuse.
+    void Rewind() { m_size = 0; }
+
+    /// Return the next previously constructed contact object and mark it as in use, or nullptr if none is available.
+    /// The caller is responsible for re-initializing the returned object.
+    Tcont* Reuse() {
+        if (m_size == m_constructed)
+            return nullptr;
+        return Get(m_size++);
+    }
+
+    /// Construct a new contact object at the end of the arena and mark it as in use.
+    /// Must only be called if Reuse() returned nullptr.
+    template <typename... Args>
+    Tcont* Emplace(Args&&... args) {
+        assert(m_size == m_constructed);
+        if ((m_constructed >> chunk_bits) == m_chunks.size())
+            m_chunks.emplace_back(new Storage[chunk_size]);
+        Tcont* contact = new (&m_chunks[m_constructed >> chunk_bits][m_constructed & chunk_mask])
+            Tcont(std::forward<Args>(args)...);
+        m_constructed++;
+        m_size++;
+        return contact;
+    }
+
+    /// Destroy all contact objects and release memory.
+    void Clear() {
+        for (unsigned int i = 0; i < m_constructed; i++)
+            Get(i)->~Tcont();
+        m_chunks.clear();
+        m_size = 0;
+        m_constructed = 0;
+    }
+
+  private:
+    static const unsigned int chunk_size = 1u << chunk_bits;
+    static const unsigned int chunk_mask = chunk_size - 1;
+
+    typedef typename std::aligned_storage<sizeof(Tcont), alignof(Tcont)>::type Storage;
+
+    std::vector<std::unique_ptr<Storage[]>> m_chunks;
+    unsigned int m_size;         ///< number of contacts in use
+    unsigned int m_constructed;  ///< number of constructed contact objects
+};
+
+}  // end namespace chrono
+
+#endif
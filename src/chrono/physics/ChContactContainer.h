@@ -40,6 +40,10 @@ class ChApi ChContactContainer : public ChPhysicsItem {
     /// Get the number of added contacts.
     virtual unsigned int GetNumContacts() const = 0;
 
+    /// Report the number of contacts that were matched with a contact from the previous step.
+    /// Only containers that support contact persistence return a non-zero value.
+    virtual unsigned int GetNumContactsMatched() const { return 0; }
+
     /// Remove (delete) all contained contact data.
     virtual void RemoveAllContacts() = 0;
 
@@ -60,10 +64,26 @@ class ChApi ChContactContainer : public ChPhysicsItem {
     /// A composite contact material is created from their material properties.
     virtual void AddContact(const ChCollisionInfo& cinfo) = 0;
 
+    /// Add a batch of contacts between collision shapes, storing them into this container in the given order.
+    /// This is equivalent to calling AddContact(cinfo) for each element of the batch; derived classes may override it
+    /// to amortize the per-contact overhead (e.g., the creation of composite materials).
+    virtual void AddContacts(const std::vector<ChCollisionInfo>& cinfos) {
+        for (const auto& cinfo : cinfos)
+            AddContact(cinfo);
+    }
+
     /// The collision system will call EndAddContact() after adding all contacts (for example with AddContact() or
     /// similar).
     virtual void EndAddContact() {}
 
+    /// Append to the given vector the contact data used to warm-start the contacts found at the next step, if any.
+    /// Used by ChSystem::SaveState.
+    virtual void SaveWarmStartData(std::vector<double>& data) const {}
+
+    /// Remove all contacts and restore the contact data used to warm-start the contacts found at the next step, as
+    /// saved by SaveWarmStartData. Used by ChSystem::RestoreState.
+    virtual void RestoreWarmStartData(const std::vector<double>& data) { RemoveAllContacts(); }
+
     /// Class to be used as a callback interface for some user defined action to be taken
     /// each time a contact is added to the container.
     /// It can be used to modify the composite material properties for the contact pair.
@@ -141,13 +161,14 @@ class ChApi ChContactContainer : public ChPhysicsItem {
     ReportContactCallback* report_contact_callback;
 
     /// Utility function to accumulate contact forces from a specified list of contacts.
-    /// This function is templated by the contact type (assumed to be derived from ChContactTuple).
+    /// This function is templated by the contact list type (a container of pointers to contacts derived from
+    /// ChContactTuple, such as std::list or ChContactArena).
     /// Contact forces are accumulated in a map keyed by the contactable objects.
     /// Derived ChContactContainer classes can use this utility (processing their various lists
     /// of contacts) to cache information used for reporting through GetContactableForce and
     /// GetContactableTorque.
-    template <class Tcont>
-    void SumAllContactForces(std::list<Tcont*>& contactlist,
+    template <class Tcontlist>
+    void SumAllContactForces(Tcontlist& contactlist,
                              std::unordered_map<ChContactable*, ForceTorque>& contactforces) {
         for (auto contact = contactlist.begin(); contact != contactlist.end(); ++contact) {
             // Extract information for current contact (expressed in global frame)
@@ -12,6 +12,9 @@
 // Authors: Alessandro Tasora, Radu Serban
 // =============================================================================
 
+#include <algorithm>
+#include <cstring>
+
 #include "chrono/physics/ChContactContainerNSC.h"
 #include "chrono/physics/ChSystem.h"
 #include "chrono/solver/ChConstraintTwoTuplesContactN.h"
@@ -32,7 +35,11 @@ ChContactContainerNSC::ChContactContainerNSC()
       n_added_666_6(0),
       n_added_666_333(0),
       n_added_666_666(0),
-      n_added_6_6_rolling(0) {}
+      n_added_6_6_rolling(0),
+      persistence(false),
+      persistence_tol(ChCollisionModel::GetDefaultSuggestedEnvelope()),
+      n_matched(0),
+      persistent_restored(false) {}
 
 ChContactContainerNSC::ChContactContainerNSC(const ChContactContainerNSC& other) : ChContactContainer(other) {
     n_added_6_6 = 0;
@@ -46,6 +53,10 @@ ChContactContainerNSC::ChContactContainerNSC(const ChContactContainerNSC& other)
     n_added_666_333 = 0;
     n_added_666_666 = 0;
     n_added_6_6_rolling = 0;
+    persistence = other.persistence;
+    persistence_tol = other.persistence_tol;
+    n_matched = 0;
+    persistent_restored = false;
 }
 
 ChContactContainerNSC::~ChContactContainerNSC() {
@@ -57,120 +68,230 @@ void ChContactContainerNSC::Update(double mytime, bool update_assets) {
     ChContactContainer::Update(mytime, update_assets);
 }
 
-template <class Tcont, class Titer>
-void _RemoveAllContacts(std::list<Tcont*>& contactlist, Titer& lastcontact, int& n_added) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
-    while (itercontact != contactlist.end()) {
-        delete (*itercontact);
-        (*itercontact) = 0;
-        ++itercontact;
-    }
-    contactlist.clear();
-    lastcontact = contactlist.begin();
+template <class Tcont>
+void _RemoveAllContacts(ChContactArena<Tcont>& contactlist, int& n_added) {
+    contactlist.Clear();
     n_added = 0;
 }
 
 void ChContactContainerNSC::RemoveAllContacts() {
-    _RemoveAllContacts(contactlist_6_6, lastcontact_6_6, n_added_6_6);
-    _RemoveAllContacts(contactlist_6_3, lastcontact_6_3, n_added_6_3);
-    _RemoveAllContacts(contactlist_3_3, lastcontact_3_3, n_added_3_3);
-    _RemoveAllContacts(contactlist_333_3, lastcontact_333_3, n_added_333_3);
-    _RemoveAllContacts(contactlist_333_6, lastcontact_333_6, n_added_333_6);
-    _RemoveAllContacts(contactlist_333_333, lastcontact_333_333, n_added_333_333);
-    _RemoveAllContacts(contactlist_666_3, lastcontact_666_3, n_added_666_3);
-    _RemoveAllContacts(contactlist_666_6, lastcontact_666_6, n_added_666_6);
-    _RemoveAllContacts(contactlist_666_333, lastcontact_666_333, n_added_666_333);
-    _RemoveAllContacts(contactlist_666_666, lastcontact_666_666, n_added_666_666);
-    _RemoveAllContacts(contactlist_6_6_rolling, lastcontact_6_6_rolling, n_added_6_6_rolling);
+    _RemoveAllContacts(contactlist_6_6, n_added_6_6);
+    _RemoveAllContacts(contactlist_6_3, n_added_6_3);
+    _RemoveAllContacts(contactlist_3_3, n_added_3_3);
+    _RemoveAllContacts(contactlist_333_3, n_added_333_3);
+    _RemoveAllContacts(contactlist_333_6, n_added_333_6);
+    _RemoveAllContacts(contactlist_333_333, n_added_333_333);
+    _RemoveAllContacts(contactlist_666_3, n_added_666_3);
+    _RemoveAllContacts(contactlist_666_6, n_added_666_6);
+    _RemoveAllContacts(contactlist_666_333, n_added_666_333);
+    _RemoveAllContacts(contactlist_666_666, n_added_666_666);
+    _RemoveAllContacts(contactlist_6_6_rolling, n_added_6_6_rolling);
+
+    persistent_list.clear();
+    n_matched = 0;
+    persistent_restored = false;
+}
+
+void ChContactContainerNSC::EnableContactPersistence(bool val) {
+    persistence = val;
+    if (!persistence) {
+        persistent_list.clear();
+        n_matched = 0;
+    }
+}
+
+template <class Tcont, class Tlist>
+void _StorePersistentContacts(ChContactArena<Tcont>& contactlist, Tlist& persistent_list) {
+    for (auto contact : contactlist)
+        persistent_list.push_back({contact->GetContactKey(), contact->GetContactP1(), contact->GetContactForce()});
+}
+
+void ChContactContainerNSC::StorePersistentContacts() {
+    persistent_list.clear();
+    persistent_list.reserve(GetNumContacts());
+
+    _StorePersistentContacts(contactlist_6_6, persistent_list);
+    _StorePersistentContacts(contactlist_6_3, persistent_list);
+    _StorePersistentContacts(contactlist_3_3, persistent_list);
+    _StorePersistentContacts(contactlist_333_3, persistent_list);
+    _StorePersistentContacts(contactlist_333_6, persistent_list);
+    _StorePersistentContacts(contactlist_333_333, persistent_list);
+    _StorePersistentContacts(contactlist_666_3, persistent_list);
+    _StorePersistentContacts(contactlist_666_6, persistent_list);
+    _StorePersistentContacts(contactlist_666_333, persistent_list);
+    _StorePersistentContacts(contactlist_666_666, persistent_list);
+    _StorePersistentContacts(contactlist_6_6_rolling, persistent_list);
+
+    // Sort by key, preserving the insertion order of contacts with the same key
+    std::stable_sort(persistent_list.begin(), persistent_list.end(),
+                     [](const PersistentContact& a, const PersistentContact& b) { return a.key < b.key; });
+}
+
+template <class Tcont, class Tmatch>
+void _MatchPersistentContacts(ChContactArena<Tcont>& contactlist, Tmatch& match) {
+    ChVector3d force;
+    for (auto contact : contactlist) {
+        if (match(contact->GetContactKey(), contact->GetContactP1(), force))
+            contact->SetContactForce(force);
+    }
+}
+
+void ChContactContainerNSC::MatchPersistentContacts() {
+    persistent_used.assign(persistent_list.size(), 0);
+    n_matched = 0;
+
+    double tol2 = persistence_tol * persistence_tol;
+
+    // Among the unmatched contacts from the previous step with the same key, find the one closest to the given point
+    auto match = [&](std::uint64_t key, const ChVector3d& point, ChVector3d& force) {
+        auto first = std::lower_bound(persistent_list.begin(), persistent_list.end(), key,
+                                      [](const PersistentContact& c, std::uint64_t k) { return c.key < k; });
+        size_t best = persistent_list.size();
+        double best_dist2 = tol2;
+        for (auto it = first; it != persistent_list.end() && it->key == key; ++it) {
+            size_t i = it - persistent_list.begin();
+            if (persistent_used[i])
+                continue;
+            double dist2 = (it->point - point).Length2();
+            if (dist2 <= best_dist2) {
+                best = i;
+                best_dist2 = dist2;
+            }
+        }
+        if (best == persistent_list.size())
+            return false;
+
+        persistent_used[best] = 1;
+        force = persistent_list[best].force;
+        n_matched++;
+        return true;
+    };
+
+    _MatchPersistentContacts(contactlist_6_6, match);
+    _MatchPersistentContacts(contactlist_6_3, match);
+    _MatchPersistentContacts(contactlist_3_3, match);
+    _MatchPersistentContacts(contactlist_333_3, match);
+    _MatchPersistentContacts(contactlist_333_6, match);
+    _MatchPersistentContacts(contactlist_333_333, match);
+    _MatchPersistentContacts(contactlist_666_3, match);
+    _MatchPersistentContacts(contactlist_666_6, match);
+    _MatchPersistentContacts(contactlist_666_333, match);
+    _MatchPersistentContacts(contactlist_666_666, match);
+    _MatchPersistentContacts(contactlist_6_6_rolling, match);
+}
+
+// Each persistent contact is saved as 7 values: key (bitwise), point, and force
+static void _SavePersistentContact(std::uint64_t key,
+                                   const ChVector3d& point,
+                                   const ChVector3d& force,
+                                   std::vector<double>& data) {
+    double key_bits;
+    std::memcpy(&key_bits, &key, sizeof(key_bits));
+    data.insert(data.end(), {key_bits, point.x(), point.y(), point.z(), force.x(), force.y(), force.z()});
+}
+
+template <class Tcont>
+void _SaveWarmStartData(const ChContactArena<Tcont>& contactlist, std::vector<double>& data) {
+    for (auto contact : contactlist)
+        _SavePersistentContact(contact->GetContactKey(), contact->GetContactP1(), contact->GetContactForce(), data);
+}
+
+void ChContactContainerNSC::SaveWarmStartData(std::vector<double>& data) const {
+    if (!persistence)
+        return;
+
+    // If no step was taken since the records were restored, save them as they are
+    if (persistent_restored) {
+        for (const auto& c : persistent_list)
+            _SavePersistentContact(c.key, c.point, c.force, data);
+        return;
+    }
+
+    _SaveWarmStartData(contactlist_6_6, data);
+    _SaveWarmStartData(contactlist_6_3, data);
+    _SaveWarmStartData(contactlist_3_3, data);
+    _SaveWarmStartData(contactlist_333_3, data);
+    _SaveWarmStartData(contactlist_333_6, data);
+    _SaveWarmStartData(contactlist_333_333, data);
+    _SaveWarmStartData(contactlist_666_3, data);
+    _SaveWarmStartData(contactlist_666_6, data);
+    _SaveWarmStartData(contactlist_666_333, data);
+    _SaveWarmStartData(contactlist_666_666, data);
+    _SaveWarmStartData(contactlist_6_6_rolling, data);
+}
+
+void ChContactContainerNSC::RestoreWarmStartData(const std::vector<double>& data) {
+    RemoveAllContacts();
+    if (!persistence)
+        return;
+
+    persistent_list.resize(data.size() / 7);
+    for (size_t i = 0; i < persistent_list.size(); i++) {
+        const double* d = &data[7 * i];
+        std::memcpy(&persistent_list[i].key, &d[0], sizeof(std::uint64_t));
+        persistent_list[i].point = ChVector3d(d[1], d[2], d[3]);
+        persistent_list[i].force = ChVector3d(d[4], d[5], d[6]);
+    }
+
+    // Sort by key, as done when recording the contacts
+    std::stable_sort(persistent_list.begin(), persistent_list.end(),
+                     [](const PersistentContact& a, const PersistentContact& b) { return a.key < b.key; });
+    persistent_restored = true;
 }
 
 void ChContactContainerNSC::BeginAddContact() {
-    lastcontact_6_6 = contactlist_6_6.begin();
+    // Record the contacts from the previous step (with the reactions computed at that step), unless the records were
+    // restored from a state snapshot
+    if (persistence && !persistent_restored)
+        StorePersistentContacts();
+    persistent_restored = false;
+
+    contactlist_6_6.Rewind();
     n_added_6_6 = 0;
 
-    lastcontact_6_3 = contactlist_6_3.begin();
+    contactlist_6_3.Rewind();
     n_added_6_3 = 0;
 
-    lastcontact_3_3 = contactlist_3_3.begin();
+    contactlist_3_3.Rewind();
     n_added_3_3 = 0;
 
-    lastcontact_333_3 = contactlist_333_3.begin();
+    contactlist_333_3.Rewind();
     n_added_333_3 = 0;
 
-    lastcontact_333_6 = contactlist_333_6.begin();
+    contactlist_333_6.Rewind();
     n_added_333_6 = 0;
 
-    lastcontact_333_333 = contactlist_333_333.begin();
+    contactlist_333_333.Rewind();
     n_added_333_333 = 0;
 
-    lastcontact_666_3 = contactlist_666_3.begin();
+    contactlist_666_3.Rewind();
     n_added_666_3 = 0;
 
-    lastcontact_666_6 = contactlist_666_6.begin();
+    contactlist_666_6.Rewind();
     n_added_666_6 = 0;
 
-    lastcontact_666_333 = contactlist_666_333.begin();
+    contactlist_666_333.Rewind();
     n_added_666_333 = 0;
 
-    lastcontact_666_666 = contactlist_666_666.begin();
+    contactlist_666_666.Rewind();
     n_added_666_666 = 0;
 
-    lastcontact_6_6_rolling = contactlist_6_6_rolling.begin();
+    contactlist_6_6_rolling.Rewind();
     n_added_6_6_rolling = 0;
 }
 
 void ChContactContainerNSC::EndAddContact() {
-    // remove contacts that are beyond last contact
-    while (lastcontact_6_6 != contactlist_6_6.end()) {
-        delete (*lastcontact_6_6);
-        lastcontact_6_6 = contactlist_6_6.erase(lastcontact_6_6);
-    }
-    while (lastcontact_6_3 != contactlist_6_3.end()) {
-        delete (*lastcontact_6_3);
-        lastcontact_6_3 = contactlist_6_3.erase(lastcontact_6_3);
-    }
-    while (lastcontact_3_3 != contactlist_3_3.end()) {
-        delete (*lastcontact_3_3);
-        lastcontact_3_3 = contactlist_3_3.erase(lastcontact_3_3);
-    }
-    while (lastcontact_333_3 != contactlist_333_3.end()) {
-        delete (*lastcontact_333_3);
-        lastcontact_333_3 = contactlist_333_3.erase(lastcontact_333_3);
-    }
-    while (lastcontact_333_6 != contactlist_333_6.end()) {
-        delete (*lastcontact_333_6);
-        lastcontact_333_6 = contactlist_333_6.erase(lastcontact_333_6);
-    }
-    while (lastcontact_333_333 != contactlist_333_333.end()) {
-        delete (*lastcontact_333_333);
-        lastcontact_333_333 = contactlist_333_333.erase(lastcontact_333_333);
-    }
-    while (lastcontact_666_3 != contactlist_666_3.end()) {
-        delete (*lastcontact_666_3);
-        lastcontact_666_3 = contactlist_666_3.erase(lastcontact_666_3);
-    }
-    while (lastcontact_666_6 != contactlist_666_6.end()) {
-        delete (*lastcontact_666_6);
-        lastcontact_666_6 = contactlist_666_6.erase(lastcontact_666_6);
-    }
-    while (lastcontact_666_333 != contactlist_666_333.end()) {
-        delete (*lastcontact_666_333);
-        lastcontact_666_333 = contactlist_666_333.erase(lastcontact_666_333);
-    }
-    while (lastcontact_666_666 != contactlist_666_666.end()) {
-        delete (*lastcontact_666_666);
-        lastcontact_666_666 = contactlist_666_666.erase(lastcontact_666_666);
-    }
+    // Note: contact objects beyond the last added contact are kept for reuse at the next step
 
-    while (lastcontact_6_6_rolling != contactlist_6_6_rolling.end()) {
-        delete (*lastcontact_6_6_rolling);
-        lastcontact_6_6_rolling = contactlist_6_6_rolling.erase(lastcontact_6_6_rolling);
-    }
+    // Initialize the reactions of the new contacts from the matching contacts of the previous step
+    if (persistence)
+        MatchPersistentContacts();
+    else
+        n_matched = 0;
 }
 
-template <class Tcont, class Titer, class Ta, class Tb>
-void _OptimalContactInsert(std::list<Tcont*>& contactlist,            // contact list
-                           Titer& lastcontact,                        // last contact acquired
+template <class Tcont, class Ta, class Tb>
+void _OptimalContactInsert(ChContactArena<Tcont>& contactlist,        // contact list
                            int& n_added,                              // number of contacts inserted
                            ChContactContainerNSC* container,          // contact container
                            Ta* objA,                                  // collidable object A
@@ -178,16 +299,17 @@ void _OptimalContactInsert(std::list<Tcont*>& contactlist,            // contact
                            const ChCollisionInfo& cinfo,              // collision information
                            const ChContactMaterialCompositeNSC& cmat  // composite material
 ) {
-    if (lastcontact != contactlist.end()) {
+    Tcont* mc = contactlist.Reuse();
+    if (mc) {
         // reuse old contacts
-        (*lastcontact)->Reset(objA, objB, cinfo, cmat, container->GetMinBounceSpeed());
-        lastcontact++;
+        mc->Reset(objA, objB, cinfo, cmat, container->GetMinBounceSpeed());
     } else {
         // add new contact
-        Tcont* mc = new Tcont(container, objA, objB, cinfo, cmat, container->GetMinBounceSpeed());
-        contactlist.push_back(mc);
-        lastcontact = contactlist.end();
+        mc = contactlist.Emplace(container, objA, objB, cinfo, cmat, container->GetMinBounceSpeed());
     }
+    // The contact key is only needed to match contacts across steps
+    if (container->IsContactPersistenceEnabled())
+        mc->SetContactKey(cinfo.GetKey());
     n_added++;
 }
 
@@ -247,6 +369,46 @@ void ChContactContainerNSC::AddContact(const ChCollisionInfo& cinfo) {
     InsertContact(cinfo, cmat);
 }
 
+void ChContactContainerNSC::AddContacts(const std::vector<ChCollisionInfo>& cinfos) {
+    auto strategy = GetSystem()->composition_strategy.get();
+    auto callback = GetAddContactCallback();
+
+    // Composite material of the last inserted contact and the materials it was created from
+    ChContactMaterialCompositeNSC cmat;
+    ChContactMaterial* matA = nullptr;
+    ChContactMaterial* matB = nullptr;
+
+    for (const auto& cinfo : cinfos) {
+        assert(cinfo.modelA->GetContactable());
+        assert(cinfo.modelB->GetContactable());
+
+        // Do nothing if any of the contactables is not contact-active
+        if (!cinfo.modelA->GetContactable()->IsContactActive() && !cinfo.modelB->GetContactable()->IsContactActive())
+            continue;
+
+        // Check that the two collision models are compatible with complementarity contact.
+        if (cinfo.shapeA->GetContactMethod() != ChContactMethod::NSC ||
+            cinfo.shapeB->GetContactMethod() != ChContactMethod::NSC)
+            continue;
+
+        // Create the composite material, unless it can be reused from the previous contact
+        auto materialA = cinfo.shapeA->GetMaterial();
+        auto materialB = cinfo.shapeB->GetMaterial();
+        if (callback || materialA.get() != matA || materialB.get() != matB) {
+            cmat = ChContactMaterialCompositeNSC(strategy, std::static_pointer_cast<ChContactMaterialNSC>(materialA),
+                                                 std::static_pointer_cast<ChContactMaterialNSC>(materialB));
+            matA = materialA.get();
+            matB = materialB.get();
+
+            // Check for a user-provided callback to modify the material
+            if (callback)
+                callback->OnAddContact(cinfo, &cmat);
+        }
+
+        InsertContact(cinfo, cmat);
+    }
+}
+
 void ChContactContainerNSC::InsertContact(const ChCollisionInfo& cinfo, const ChContactMaterialCompositeNSC& cmat) {
     auto contactableA = cinfo.modelA->GetContactable();
     auto contactableB = cinfo.modelB->GetContactable();
@@ -268,24 +430,24 @@ void ChContactContainerNSC::InsertContact(const ChCollisionInfo& cinfo, const Ch
             if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
                 auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
                 // 3_3
-                _OptimalContactInsert(contactlist_3_3, lastcontact_3_3, n_added_3_3, this, objA, objB, cinfo, cmat);
+                _OptimalContactInsert(contactlist_3_3, n_added_3_3, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
                 auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
                 // 3_6 -> 6_3
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_6_3, lastcontact_6_3, n_added_6_3, this, objB, objA, swapped_cinfo,
+                _OptimalContactInsert(contactlist_6_3, n_added_6_3, this, objB, objA, swapped_cinfo,
                                       cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
                 auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
                 // 3_333 -> 333_3
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_333_3, lastcontact_333_3, n_added_333_3, this, objB, objA,
+                _OptimalContactInsert(contactlist_333_3, n_added_333_3, this, objB, objA,
                                       swapped_cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
                 auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
                 // 3_666 -> 666_3
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_666_3, lastcontact_666_3, n_added_666_3, this, objB, objA,
+                _OptimalContactInsert(contactlist_666_3, n_added_666_3, this, objB, objA,
                                       swapped_cinfo, cmat);
             }
         } break;
@@ -295,27 +457,27 @@ void ChContactContainerNSC::InsertContact(const ChCollisionInfo& cinfo, const Ch
             if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
                 auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
                 // 6_3
-                _OptimalContactInsert(contactlist_6_3, lastcontact_6_3, n_added_6_3, this, objA, objB, cinfo, cmat);
+                _OptimalContactInsert(contactlist_6_3, n_added_6_3, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
                 auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
                 // 6_6    ***NOTE: for body-body one could have rolling friction: ***
                 if (cmat.rolling_friction || cmat.spinning_friction) {
-                    _OptimalContactInsert(contactlist_6_6_rolling, lastcontact_6_6_rolling, n_added_6_6_rolling, this,
+                    _OptimalContactInsert(contactlist_6_6_rolling, n_added_6_6_rolling, this,
                                           objA, objB, cinfo, cmat);
                 } else {
-                    _OptimalContactInsert(contactlist_6_6, lastcontact_6_6, n_added_6_6, this, objA, objB, cinfo, cmat);
+                    _OptimalContactInsert(contactlist_6_6, n_added_6_6, this, objA, objB, cinfo, cmat);
                 }
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
                 auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
                 // 6_333 -> 333_6
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_333_6, lastcontact_333_6, n_added_333_6, this, objB, objA,
+                _OptimalContactInsert(contactlist_333_6, n_added_333_6, this, objB, objA,
                                       swapped_cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
                 auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
                 // 6_666 -> 666_6
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_666_6, lastcontact_666_6, n_added_666_6, this, objB, objA,
+                _OptimalContactInsert(contactlist_666_6, n_added_666_6, this, objB, objA,
                                       swapped_cinfo, cmat);
             }
         } break;
@@ -325,23 +487,23 @@ void ChContactContainerNSC::InsertContact(const ChCollisionInfo& cinfo, const Ch
             if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
                 auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
                 // 333_3
-                _OptimalContactInsert(contactlist_333_3, lastcontact_333_3, n_added_333_3, this, objA, objB, cinfo,
+                _OptimalContactInsert(contactlist_333_3, n_added_333_3, this, objA, objB, cinfo,
                                       cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
                 auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
                 // 333_6
-                _OptimalContactInsert(contactlist_333_6, lastcontact_333_6, n_added_333_6, this, objA, objB, cinfo,
+                _OptimalContactInsert(contactlist_333_6, n_added_333_6, this, objA, objB, cinfo,
                                       cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
                 auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
                 // 333_333
-                _OptimalContactInsert(contactlist_333_333, lastcontact_333_333, n_added_333_333, this, objA, objB,
+                _OptimalContactInsert(contactlist_333_333, n_added_333_333, this, objA, objB,
                                       cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
                 auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
                 // 333_666 -> 666_333
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_666_333, lastcontact_666_333, n_added_666_333, this, objB, objA,
+                _OptimalContactInsert(contactlist_666_333, n_added_666_333, this, objB, objA,
                                       swapped_cinfo, cmat);
             }
         } break;
@@ -351,22 +513,22 @@ void ChContactContainerNSC::InsertContact(const ChCollisionInfo& cinfo, const Ch
             if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
                 auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
                 // 666_3
-                _OptimalContactInsert(contactlist_666_3, lastcontact_666_3, n_added_666_3, this, objA, objB, cinfo,
+                _OptimalContactInsert(contactlist_666_3, n_added_666_3, this, objA, objB, cinfo,
                                       cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
                 auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
                 // 666_6
-                _OptimalContactInsert(contactlist_666_6, lastcontact_666_6, n_added_666_6, this, objA, objB, cinfo,
+                _OptimalContactInsert(contactlist_666_6, n_added_666_6, this, objA, objB, cinfo,
                                       cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
                 auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
                 // 666_333
-                _OptimalContactInsert(contactlist_666_333, lastcontact_666_333, n_added_666_333, this, objA, objB,
+                _OptimalContactInsert(contactlist_666_333, n_added_666_333, this, objA, objB,
                                       cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
                 auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
                 // 666_666
-                _OptimalContactInsert(contactlist_666_666, lastcontact_666_666, n_added_666_666, this, objA, objB,
+                _OptimalContactInsert(contactlist_666_666, n_added_666_666, this, objA, objB,
                                       cinfo, cmat);
             }
         } break;
@@ -410,8 +572,8 @@ ChVector3d ChContactContainerNSC::GetContactableTorque(ChContactable* contactabl
 }
 
 template <class Tcont>
-void _ReportAllContacts(std::list<Tcont*>& contactlist, ChContactContainer::ReportContactCallback* mcallback) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+void _ReportAllContacts(ChContactArena<Tcont>& contactlist, ChContactContainer::ReportContactCallback* mcallback) {
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         bool proceed = mcallback->OnReportContact(
             (*itercontact)->GetContactP1(), (*itercontact)->GetContactP2(), (*itercontact)->GetContactPlane(),
@@ -424,8 +586,8 @@ void _ReportAllContacts(std::list<Tcont*>& contactlist, ChContactContainer::Repo
 }
 
 template <class Tcont>
-void _ReportAllContactsRolling(std::list<Tcont*>& contactlist, ChContactContainer::ReportContactCallback* mcallback) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+void _ReportAllContactsRolling(ChContactArena<Tcont>& contactlist, ChContactContainer::ReportContactCallback* mcallback) {
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         bool proceed = mcallback->OnReportContact(
             (*itercontact)->GetContactP1(), (*itercontact)->GetContactP2(), (*itercontact)->GetContactPlane(),
@@ -453,8 +615,8 @@ void ChContactContainerNSC::ReportAllContacts(std::shared_ptr<ReportContactCallb
 }
 
 template <class Tcont>
-void _ReportAllContactsNSC(std::list<Tcont*>& contactlist, ChContactContainerNSC::ReportContactCallbackNSC* mcallback) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+void _ReportAllContactsNSC(ChContactArena<Tcont>& contactlist, ChContactContainerNSC::ReportContactCallbackNSC* mcallback) {
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         bool proceed = mcallback->OnReportContact(
             (*itercontact)->GetContactP1(), (*itercontact)->GetContactP2(), (*itercontact)->GetContactPlane(),
@@ -468,9 +630,9 @@ void _ReportAllContactsNSC(std::list<Tcont*>& contactlist, ChContactContainerNSC
 }
 
 template <class Tcont>
-void _ReportAllContactsRollingNSC(std::list<Tcont*>& contactlist,
+void _ReportAllContactsRollingNSC(ChContactArena<Tcont>& contactlist,
                                   ChContactContainerNSC::ReportContactCallbackNSC* mcallback) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         bool proceed = mcallback->OnReportContact(
             (*itercontact)->GetContactP1(), (*itercontact)->GetContactP2(), (*itercontact)->GetContactPlane(),
@@ -501,11 +663,11 @@ void ChContactContainerNSC::ReportAllContactsNSC(std::shared_ptr<ReportContactCa
 
 template <class Tcont>
 void _IntStateGatherReactions(unsigned int& coffset,
-                              std::list<Tcont*>& contactlist,
+                              ChContactArena<Tcont>& contactlist,
                               const unsigned int off_L,
                               ChVectorDynamic<>& L,
                               const int stride) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         (*itercontact)->ContIntStateGatherReactions(off_L + coffset, L);
         coffset += stride;
@@ -530,11 +692,11 @@ void ChContactContainerNSC::IntStateGatherReactions(const unsigned int off_L, Ch
 
 template <class Tcont>
 void _IntStateScatterReactions(unsigned int& coffset,
-                               std::list<Tcont*>& contactlist,
+                               ChContactArena<Tcont>& contactlist,
                                const unsigned int off_L,
                                const ChVectorDynamic<>& L,
                                const int stride) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         (*itercontact)->ContIntStateScatterReactions(off_L + coffset, L);
         coffset += stride;
@@ -559,14 +721,14 @@ void ChContactContainerNSC::IntStateScatterReactions(const unsigned int off_L, c
 
 template <class Tcont>
 void _IntLoadResidual_CqL(unsigned int& coffset,           // offset of the contacts
-                          std::list<Tcont*>& contactlist,  // list of contacts
+                          ChContactArena<Tcont>& contactlist,  // list of contacts
                           const unsigned int off_L,        // offset in L multipliers
                           ChVectorDynamic<>& R,            // result: the R residual, R += c*Cq'*L
                           const ChVectorDynamic<>& L,      // the L vector
                           const double c,                  // a scaling factor
                           const int stride                 // stride
 ) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         (*itercontact)->ContIntLoadResidual_CqL(off_L + coffset, R, L, c);
         coffset += stride;
@@ -594,7 +756,7 @@ void ChContactContainerNSC::IntLoadResidual_CqL(const unsigned int off_L,
 
 template <class Tcont>
 void _IntLoadConstraint_C(unsigned int& coffset,           // contact offset
-                          std::list<Tcont*>& contactlist,  // contact list
+                          ChContactArena<Tcont>& contactlist,  // contact list
                           const unsigned int off,          // offset in Qc residual
                           ChVectorDynamic<>& Qc,           // result: the Qc residual, Qc += c*C
                           const double c,                  // a scaling factor
@@ -602,7 +764,7 @@ void _IntLoadConstraint_C(unsigned int& coffset,           // contact offset
                           double recovery_clamp,           // value for min/max clamping of c*C
                           const int stride                 // stride
 ) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         (*itercontact)->ContIntLoadConstraint_C(off + coffset, Qc, c, do_clamp, recovery_clamp);
         coffset += stride;
@@ -631,7 +793,7 @@ void ChContactContainerNSC::IntLoadConstraint_C(const unsigned int off,
 
 template <class Tcont>
 void _IntToDescriptor(unsigned int& coffset,
-                      std::list<Tcont*>& contactlist,
+                      ChContactArena<Tcont>& contactlist,
                       const unsigned int off_v,
                       const ChStateDelta& v,
                       const ChVectorDynamic<>& R,
@@ -639,7 +801,7 @@ void _IntToDescriptor(unsigned int& coffset,
                       const ChVectorDynamic<>& L,
                       const ChVectorDynamic<>& Qc,
                       const int stride) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         (*itercontact)->ContIntToDescriptor(off_L + coffset, L, Qc);
         coffset += stride;
@@ -669,13 +831,13 @@ void ChContactContainerNSC::IntToDescriptor(const unsigned int off_v,
 
 template <class Tcont>
 void _IntFromDescriptor(unsigned int& coffset,
-                        std::list<Tcont*>& contactlist,
+                        ChContactArena<Tcont>& contactlist,
                         const unsigned int off_v,
                         ChStateDelta& v,
                         const unsigned int off_L,
                         ChVectorDynamic<>& L,
                         const int stride) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         (*itercontact)->ContIntFromDescriptor(off_L + coffset, L);
         coffset += stride;
@@ -704,8 +866,8 @@ void ChContactContainerNSC::IntFromDescriptor(const unsigned int off_v,
 // SOLVER INTERFACES
 
 template <class Tcont>
-void _InjectConstraints(std::list<Tcont*>& contactlist, ChSystemDescriptor& descriptor) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+void _InjectConstraints(ChContactArena<Tcont>& contactlist, ChSystemDescriptor& descriptor) {
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         (*itercontact)->InjectConstraints(descriptor);
         ++itercontact;
@@ -727,8 +889,8 @@ void ChContactContainerNSC::InjectConstraints(ChSystemDescriptor& descriptor) {
 }
 
 template <class Tcont>
-void _ConstraintsBiReset(std::list<Tcont*>& contactlist) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+void _ConstraintsBiReset(ChContactArena<Tcont>& contactlist) {
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         (*itercontact)->ConstraintsBiReset();
         ++itercontact;
@@ -750,8 +912,8 @@ void ChContactContainerNSC::ConstraintsBiReset() {
 }
 
 template <class Tcont>
-void _ConstraintsBiLoad_C(std::list<Tcont*>& contactlist, double factor, double recovery_clamp, bool do_clamp) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+void _ConstraintsBiLoad_C(ChContactArena<Tcont>& contactlist, double factor, double recovery_clamp, bool do_clamp) {
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         (*itercontact)->ConstraintsBiLoad_C(factor, recovery_clamp, do_clamp);
         ++itercontact;
@@ -777,9 +939,9 @@ void ChContactContainerNSC::LoadConstraintJacobians() {
 }
 
 template <class Tcont>
-void _ConstraintsFetch_react(std::list<Tcont*>& contactlist, double factor) {
+void _ConstraintsFetch_react(ChContactArena<Tcont>& contactlist, double factor) {
     // From constraints to react vector:
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         (*itercontact)->ConstraintsFetch_react(factor);
         ++itercontact;
@@ -15,8 +15,7 @@
 #ifndef CH_CONTACTCONTAINER_NSC_H
 #define CH_CONTACTCONTAINER_NSC_H
 
-#include <list>
-
+#include "chrono/physics/ChContactArena.h"
 #include "chrono/physics/ChContactContainer.h"
 #include "chrono/physics/ChContactNSC.h"
 #include "chrono/physics/ChContactNSCrolling.h"
@@ -25,9 +24,10 @@
 namespace chrono {
 
 /// Class representing a container of many non-smooth contacts.
-/// Implemented using linked lists of ChContactNSC objects (that is, contacts between two ChContactable objects, with 3
-/// reactions). It might also contain ChContactNSCrolling objects (extended versions of ChContactNSC, with 6 reactions,
-/// that account also for rolling and spinning resistance), but also for '6dof vs 6dof' contactables.
+/// Implemented using pooled arenas (see ChContactArena) of ChContactNSC objects (that is, contacts between two
+/// ChContactable objects, with 3 reactions). It might also contain ChContactNSCrolling objects (extended versions of
+/// ChContactNSC, with 6 reactions, that account also for rolling and spinning resistance), but also for '6dof vs 6dof'
+/// contactables.
 class ChApi ChContactContainerNSC : public ChContactContainer {
   public:
     typedef ChContactNSC<ChContactable_1vars<6>, ChContactable_1vars<6> > ChContactNSC_6_6;
@@ -61,9 +61,8 @@ class ChApi ChContactContainerNSC : public ChContactContainer {
     virtual void RemoveAllContacts() override;
 
     /// The collision system will call BeginAddContact() before adding all contacts (for example with AddContact() or
-    /// similar). Instead of simply deleting all list of the previous contacts, this optimized implementation rewinds
-    /// the link iterator to begin and tries to reuse previous contact objects until possible, to avoid too much
-    /// allocation/deallocation.
+    /// similar). Instead of deleting the previous contacts, this optimized implementation rewinds the contact arenas
+    /// (in O(1)) so that previous contact objects are reused until possible, to avoid allocation/deallocation.
     virtual void BeginAddContact() override;
 
     /// Add a contact between two collision shapes, storing it into this container.
@@ -78,8 +77,13 @@ class ChApi ChContactContainerNSC : public ChContactContainer {
     /// A composite contact material is created from their material properties.
     virtual void AddContact(const ChCollisionInfo& cinfo) override;
 
+    /// Add a batch of contacts between collision shapes, storing them into this container in the given order.
+    /// The composite material is only created once for consecutive contacts between shapes with the same materials
+    /// (unless a callback for modifying composite materials was registered).
+    virtual void AddContacts(const std::vector<ChCollisionInfo>& cinfos) override;
+
     /// The collision system will call BeginAddContact() after adding all contacts (for example with AddContact() or
-    /// similar). This optimized version purges the end of the list of contacts that were not reused (if any).
+    /// similar). Contact objects that were not reused are kept in the contact arenas for subsequent steps.
     virtual void EndAddContact() override;
 
     /// Scan all the contacts and for each contact executes the OnReportContact() function of the provided callback
@@ -127,6 +131,30 @@ class ChApi ChContactContainerNSC : public ChContactContainer {
     /// Objects will rebounce only if their relative colliding speed is above this threshold.
     double GetMinBounceSpeed() const { return min_bounce_speed; }
 
+    /// Enable matching of contacts across time steps (default: false).
+    /// If enabled, each new contact is matched with a contact from the previous step with the same key (same pair of
+    /// collision shapes and features, see ChCollisionInfo::GetKey) and, among those, with the closest contact point
+    /// within the persistence tolerance. The contact force of the matched contact is used to initialize that of the new
+    /// contact, which the solver then uses as initial guess for the Lagrange multipliers (if warm start is enabled, see
+    /// ChIterativeSolver::EnableWarmStart). Rolling and spinning reactions are not carried over.
+    void EnableContactPersistence(bool val);
+
+    /// Return true if contacts are matched across time steps.
+    bool IsContactPersistenceEnabled() const { return persistence; }
+
+    /// Set the maximum distance between the points of two matching contacts in consecutive steps
+    /// (default: ChCollisionModel::GetDefaultSuggestedEnvelope()).
+    void SetPersistenceTolerance(double tol) { persistence_tol = tol; }
+
+    /// Report the number of contacts matched with a contact from the previous step.
+    virtual unsigned int GetNumContactsMatched() const override { return n_matched; }
+
+    /// Append to the given vector key, point, and force of all current contacts (if contact persistence is enabled).
+    virtual void SaveWarmStartData(std::vector<double>& data) const override;
+
+    /// Remove all contacts and restore the contacts to be matched at the next step (if contact persistence is enabled).
+    virtual void RestoreWarmStartData(const std::vector<double>& data) override;
+
     /// Update state of this contact container: compute jacobians, violations, etc.
     /// and store results in inner structures of contacts.
     virtual void Update(double mtime, bool update_assets = true) override;
@@ -182,18 +210,18 @@ class ChApi ChContactContainerNSC : public ChContactContainer {
     virtual void ArchiveIn(ChArchiveIn& archive_in) override;
 
   protected:
-    std::list<ChContactNSC_6_6*> contactlist_6_6;
-    std::list<ChContactNSC_6_3*> contactlist_6_3;
-    std::list<ChContactNSC_3_3*> contactlist_3_3;
-    std::list<ChContactNSC_333_3*> contactlist_333_3;
-    std::list<ChContactNSC_333_6*> contactlist_333_6;
-    std::list<ChContactNSC_333_333*> contactlist_333_333;
-    std::list<ChContactNSC_666_3*> contactlist_666_3;
-    std::list<ChContactNSC_666_6*> contactlist_666_6;
-    std::list<ChContactNSC_666_333*> contactlist_666_333;
-    std::list<ChContactNSC_666_666*> contactlist_666_666;
-
-    std::list<ChContactNSCrolling_6_6*> contactlist_6_6_rolling;
+    ChContactArena<ChContactNSC_6_6> contactlist_6_6;
+    ChContactArena<ChContactNSC_6_3> contactlist_6_3;
+    ChContactArena<ChContactNSC_3_3> contactlist_3_3;
+    ChContactArena<ChContactNSC_333_3> contactlist_333_3;
+    ChContactArena<ChContactNSC_333_6> contactlist_333_6;
+    ChContactArena<ChContactNSC_333_333> contactlist_333_333;
+    ChContactArena<ChContactNSC_666_3> contactlist_666_3;
+    ChContactArena<ChContactNSC_666_6> contactlist_666_6;
+    ChContactArena<ChContactNSC_666_333> contactlist_666_333;
+    ChContactArena<ChContactNSC_666_666> contactlist_666_666;
+
+    ChContactArena<ChContactNSCrolling_6_6> contactlist_6_6_rolling;
 
     int n_added_6_6;
     int n_added_6_3;
@@ -207,26 +235,33 @@ class ChApi ChContactContainerNSC : public ChContactContainer {
     int n_added_666_666;
     int n_added_6_6_rolling;
 
-    std::list<ChContactNSC_6_6*>::iterator lastcontact_6_6;
-    std::list<ChContactNSC_6_3*>::iterator lastcontact_6_3;
-    std::list<ChContactNSC_3_3*>::iterator lastcontact_3_3;
-    std::list<ChContactNSC_333_3*>::iterator lastcontact_333_3;
-    std::list<ChContactNSC_333_6*>::iterator lastcontact_333_6;
-    std::list<ChContactNSC_333_333*>::iterator lastcontact_333_333;
-    std::list<ChContactNSC_666_3*>::iterator lastcontact_666_3;
-    std::list<ChContactNSC_666_6*>::iterator lastcontact_666_6;
-    std::list<ChContactNSC_666_333*>::iterator lastcontact_666_333;
-    std::list<ChContactNSC_666_666*>::iterator lastcontact_666_666;
-
-    std::list<ChContactNSCrolling_6_6*>::iterator lastcontact_6_6_rolling;
-
     std::unordered_map<ChContactable*, ForceTorque> contact_forces;
 
   private:
     void InsertContact(const ChCollisionInfo& cinfo, const ChContactMaterialCompositeNSC& cmat);
 
+    /// Record key, point, and force of all current contacts, before they are replaced by the new ones.
+    void StorePersistentContacts();
+
+    /// Initialize the forces of all current contacts from the matching recorded contacts.
+    void MatchPersistentContacts();
+
+    /// Contact data carried over to the next step.
+    struct PersistentContact {
+        std::uint64_t key;
+        ChVector3d point;
+        ChVector3d force;
+    };
+
     double min_bounce_speed;  ///< minimum speed for rebounce after impacts. Lower speeds are clamped to 0
 
+    bool persistence;                                ///< match contacts across steps
+    double persistence_tol;                          ///< max. distance between points of matching contacts
+    std::vector<PersistentContact> persistent_list;  ///< contacts from the previous step, sorted by key
+    std::vector<char> persistent_used;               ///< contacts from the previous step already matched
+    unsigned int n_matched;                          ///< number of contacts matched in the last step
+    bool persistent_restored;                        ///< persistent_list was restored and replaces current contacts
+
     friend class ChSystemNSC;
 };
 
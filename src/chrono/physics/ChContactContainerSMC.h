@@ -17,8 +17,8 @@
 
 #include <algorithm>
 #include <cmath>
-#include <list>
 
+#include "chrono/physics/ChContactArena.h"
 #include "chrono/physics/ChContactContainer.h"
 #include "chrono/physics/ChContactSMC.h"
 #include "chrono/physics/ChContactable.h"
@@ -26,7 +26,8 @@
 namespace chrono {
 
 /// Class representing a container of many smooth (penalty) contacts.
-/// Implemented using linked lists of ChContactSMC objects (that is, contacts between two ChContactable objects).
+/// Implemented using pooled arenas (see ChContactArena) of ChContactSMC objects (that is, contacts between two
+/// ChContactable objects).
 class ChApi ChContactContainerSMC : public ChContactContainer {
   public:
     typedef ChContactSMC<ChContactable_1vars<3>, ChContactable_1vars<3> > ChContactSMC_3_3;
@@ -41,16 +42,16 @@ class ChApi ChContactContainerSMC : public ChContactContainer {
     typedef ChContactSMC<ChContactable_3vars<6, 6, 6>, ChContactable_3vars<6, 6, 6> > ChContactSMC_666_666;
 
   protected:
-    std::list<ChContactSMC_3_3*> contactlist_3_3;
-    std::list<ChContactSMC_6_3*> contactlist_6_3;
-    std::list<ChContactSMC_6_6*> contactlist_6_6;
-    std::list<ChContactSMC_333_3*> contactlist_333_3;
-    std::list<ChContactSMC_333_6*> contactlist_333_6;
-    std::list<ChContactSMC_333_333*> contactlist_333_333;
-    std::list<ChContactSMC_666_3*> contactlist_666_3;
-    std::list<ChContactSMC_666_6*> contactlist_666_6;
-    std::list<ChContactSMC_666_333*> contactlist_666_333;
-    std::list<ChContactSMC_666_666*> contactlist_666_666;
+    ChContactArena<ChContactSMC_3_3> contactlist_3_3;
+    ChContactArena<ChContactSMC_6_3> contactlist_6_3;
+    ChContactArena<ChContactSMC_6_6> contactlist_6_6;
+    ChContactArena<ChContactSMC_333_3> contactlist_333_3;
+    ChContactArena<ChContactSMC_333_6> contactlist_333_6;
+    ChContactArena<ChContactSMC_333_333> contactlist_333_333;
+    ChContactArena<ChContactSMC_666_3> contactlist_666_3;
+    ChContactArena<ChContactSMC_666_6> contactlist_666_6;
+    ChContactArena<ChContactSMC_666_333> contactlist_666_333;
+    ChContactArena<ChContactSMC_666_666> contactlist_666_666;
 
     int n_added_3_3;
     int n_added_6_3;
@@ -63,17 +64,6 @@ class ChApi ChContactContainerSMC : public ChContactContainer {
     int n_added_666_333;
     int n_added_666_666;
 
-    std::list<ChContactSMC_3_3*>::iterator lastcontact_3_3;
-    std::list<ChContactSMC_6_3*>::iterator lastcontact_6_3;
-    std::list<ChContactSMC_6_6*>::iterator lastcontact_6_6;
-    std::list<ChContactSMC_333_3*>::iterator lastcontact_333_3;
-    std::list<ChContactSMC_333_6*>::iterator lastcontact_333_6;
-    std::list<ChContactSMC_333_333*>::iterator lastcontact_333_333;
-    std::list<ChContactSMC_666_3*>::iterator lastcontact_666_3;
-    std::list<ChContactSMC_666_6*>::iterator lastcontact_666_6;
-    std::list<ChContactSMC_666_333*>::iterator lastcontact_666_333;
-    std::list<ChContactSMC_666_666*>::iterator lastcontact_666_666;
-
     std::unordered_map<ChContactable*, ForceTorque> contact_forces;
 
   public:
@@ -94,9 +84,8 @@ class ChApi ChContactContainerSMC : public ChContactContainer {
     virtual void RemoveAllContacts() override;
 
     /// The collision system will call BeginAddContact() before adding all contacts (for example with AddContact() or
-    /// similar). Instead of simply deleting all list of the previous contacts, this optimized implementation rewinds
-    /// the link iterator to begin and tries to reuse previous contact objects until possible, to avoid too much
-    /// allocation/deallocation.
+    /// similar). Instead of deleting the previous contacts, this optimized implementation rewinds the contact arenas
+    /// (in O(1)) so that previous contact objects are reused until possible, to avoid allocation/deallocation.
     virtual void BeginAddContact() override;
 
     /// Add a contact between two collision shapes, storing it into this container.
@@ -111,8 +100,13 @@ class ChApi ChContactContainerSMC : public ChContactContainer {
     /// A composite contact material is created from their material properties.
     virtual void AddContact(const ChCollisionInfo& cinfo) override;
 
+    /// Add a batch of contacts between collision shapes, storing them into this container in the given order.
+    /// The composite material is only created once for consecutive contacts between shapes with the same materials
+    /// (unless a callback for modifying composite materials was registered).
+    virtual void AddContacts(const std::vector<ChCollisionInfo>& cinfos) override;
+
     /// The collision system will call BeginAddContact() after adding all contacts (for example with AddContact() or
-    /// similar). This optimized version purges the end of the list of contacts that were not reused (if any).
+    /// similar). Contact objects that were not reused are kept in the contact arenas for subsequent steps.
     virtual void EndAddContact() override;
 
     /// Scan all the contacts and for each contact executes the OnReportContact() function of the provided callback
@@ -128,6 +128,11 @@ class ChContactNSC : public ChContactTuple<Ta, Tb> {
     /// Get the contact force, if computed, in contact coordinate system
     virtual ChVector3d GetContactForce() const override { return react_force; }
 
+    /// Set the contact force, in contact coordinate system.
+    /// Used to initialize the reactions of a new contact (e.g., from a matching contact at the previous step); these
+    /// provide the initial guess for the solver (see ChIterativeSolver::EnableWarmStart).
+    void SetContactForce(const ChVector3d& force) { react_force = force; }
+
     /// Get the contact friction coefficient
     virtual double GetFriction() { return Nx.GetFrictionCoefficient(); }
 
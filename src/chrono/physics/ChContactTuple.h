@@ -46,6 +46,8 @@ class ChContactTuple {
     double norm_dist;   ///< penetration distance (negative if going inside) after refining
     double eff_radius;  ///< effective radius of curvature at contact
 
+    std::uint64_t key;  ///< contact pair key (see ChCollisionInfo::GetKey)
+
   public:
     ChContactTuple() {}
 
@@ -74,6 +76,7 @@ class ChContactTuple {
         this->normal = cinfo.vN;
         this->norm_dist = cinfo.distance;
         this->eff_radius = cinfo.eff_radius;
+        this->key = 0;
 
         // Contact plane
         contact_plane.SetFromAxisX(normal, VECT_Y);
@@ -117,6 +120,13 @@ class ChContactTuple {
     /// Get the effective radius of curvature.
     double GetEffectiveCurvatureRadius() const { return eff_radius; }
 
+    /// Get the key of the contact pair, used to match contacts across time steps.
+    /// The key is only set by contact containers which match contacts across steps (0 otherwise).
+    std::uint64_t GetContactKey() const { return key; }
+
+    /// Set the key of the contact pair (see ChCollisionInfo::GetKey).
+    void SetContactKey(std::uint64_t contact_key) { key = contact_key; }
+
     /// Get the contact force, if computed, in contact coordinate system
     virtual ChVector3d GetContactForce() const { return ChVector3d(0); }
 
@@ -13,6 +13,7 @@
 // =============================================================================
 
 #include "chrono/physics/ChLoadContainer.h"
+#include "chrono/physics/ChSystem.h"
 
 namespace chrono {
 
@@ -21,6 +22,7 @@ CH_FACTORY_REGISTER(ChLoadContainer)
 
 ChLoadContainer::ChLoadContainer(const ChLoadContainer& other) : ChPhysicsItem(other) {
     loadlist = other.loadlist;
+    parallel_update = other.parallel_update;
 }
 
 void ChLoadContainer::Add(std::shared_ptr<ChLoadBase> newload) {
@@ -34,7 +36,12 @@ void ChLoadContainer::Add(std::shared_ptr<ChLoadBase> newload) {
 }
 
 void ChLoadContainer::Update(double mytime, bool update_assets) {
-    for (size_t i = 0; i < loadlist.size(); ++i) {
+    // Each load computes its own Q and Jacobians, so the loads can be updated independently
+    int nthreads = (parallel_update && system) ? (int)system->GetNumThreadsChrono() : 1;
+    int nloads = (int)loadlist.size();
+
+#pragma omp parallel for schedule(dynamic) num_threads(nthreads)
+    for (int i = 0; i < nloads; ++i) {
         loadlist[i]->Update(mytime);
     }
     // Overloading of base class:
@@ -78,7 +85,12 @@ void ChLoadContainer::InjectKRMMatrices(ChSystemDescriptor& descriptor) {
 }
 
 void ChLoadContainer::LoadKRMMatrices(double Kfactor, double Rfactor, double Mfactor) {
-    for (size_t i = 0; i < loadlist.size(); ++i) {
+    // Each load only writes in its own KRM block
+    int nthreads = (parallel_update && system) ? (int)system->GetNumThreadsChrono() : 1;
+    int nloads = (int)loadlist.size();
+
+#pragma omp parallel for schedule(static) num_threads(nthreads)
+    for (int i = 0; i < nloads; ++i) {
         loadlist[i]->LoadKRMMatrices(Kfactor, Rfactor, Mfactor);
     }
 }
@@ -25,7 +25,7 @@ namespace chrono {
 /// container, then  the container is added to a ChSystem.
 class ChApi ChLoadContainer : public ChPhysicsItem {
   public:
-    ChLoadContainer() {}
+    ChLoadContainer() : parallel_update(false) {}
     ChLoadContainer(const ChLoadContainer& other);
     ~ChLoadContainer() {}
 
@@ -41,6 +41,15 @@ class ChApi ChLoadContainer : public ChPhysicsItem {
     /// Return the number of loads in this container.
     size_t GetNumLoads() const { return loadlist.size(); }
 
+    /// Enable/disable the multithreaded update of the loads (default: false).
+    /// If enabled, the loads (i.e., their generalized forces and Jacobians) are updated, and their KRM blocks loaded,
+    /// in parallel, using the number of threads set for Chrono in the containing system. This requires that the update of a load does not modify
+    /// data shared with other loads in this container (e.g. loadables that cache state in their load computations).
+    void EnableParallelUpdate(bool val) { parallel_update = val; }
+
+    /// Return true if the loads are updated in parallel.
+    bool IsParallelUpdateEnabled() const { return parallel_update; }
+
     virtual void Setup() override {}
 
     virtual void Update(double mytime, bool update_assets = true) override;
@@ -78,6 +87,7 @@ class ChApi ChLoadContainer : public ChPhysicsItem {
 
   private:
     std::vector<std::shared_ptr<ChLoadBase> > loadlist;
+    bool parallel_update;
 };
 
 CH_CLASS_VERSION(ChLoadContainer, 0)
@@ -34,6 +34,18 @@ class ChLoader {
         ChVectorDynamic<>* state_w   ///< if not null, update state (speed part) to this, then evaluate Q
         ) = 0;
 
+    /// Compute the Jacobians K=-dQ/dx and R=-dQ/dv analytically, at the given state.
+    /// K and R are square matrices of size equal to the number of coordinates of the loadable at the velocity level.
+    /// A derived class that can provide analytical Jacobians should fill K and R and return true. The default
+    /// implementation returns false, in which case the Jacobians of a stiff load are computed by finite differences.
+    virtual bool ComputeJacobian(ChVectorDynamic<>* state_x,  ///< state position to evaluate Jacobians
+                                 ChVectorDynamic<>* state_w,  ///< state speed to evaluate Jacobians
+                                 ChMatrixRef K,               ///< result: K = -dQ/dx
+                                 ChMatrixRef R                ///< result: R = -dQ/dv
+    ) {
+        return false;
+    }
+
     virtual std::shared_ptr<ChLoadable> GetLoadable() = 0;
 
     virtual bool IsStiff() { return false; }
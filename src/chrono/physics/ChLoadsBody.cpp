@@ -16,6 +16,30 @@
 
 namespace chrono {
 
+// Rotation vector (angle in [-pi, pi] times axis) of the given rotation.
+static ChVector3d GetRotationVector(const ChQuaternion<>& rot) {
+    ChVector3d dir_rot;
+    double angle_rot;
+    rot.GetAngleAxis(angle_rot, dir_rot);
+    if (angle_rot > CH_PI)
+        angle_rot -= CH_2PI;
+    if (angle_rot < -CH_PI)
+        angle_rot += CH_2PI;
+    return dir_rot * angle_rot;
+}
+
+// Inverse of the left Jacobian of the rotation vector v, such that a small rotation dphi applied on the left of the
+// rotation exp(v) changes the rotation vector by dv = J^-1 * dphi.
+static ChMatrix33<> GetRotationVectorJacobianInv(const ChVector3d& v) {
+    ChStarMatrix33<> V(v);
+    double angle = v.Length();
+    double c = 1.0 / 12;  // limit for small angles
+    if (angle > 1e-4)
+        c = 1 / (angle * angle) - (1 + std::cos(angle)) / (2 * angle * std::sin(angle));
+    ChMatrix33<> J = ChMatrix33<>::Identity() - 0.5 * V + c * V * V;
+    return J;
+}
+
 // -----------------------------------------------------------------------------
 // ChLoadBodyForce
 // -----------------------------------------------------------------------------
@@ -30,6 +54,7 @@ ChLoadBodyForce::ChLoadBodyForce(std::shared_ptr<ChBody> body,
       m_point(point),
       m_local_force(local_force),
       m_local_point(local_point),
+      m_stiff(false),
       m_scale(1) {
     m_modulation = chrono_types::make_shared<ChFunctionConst>(1.0);
 }
@@ -39,9 +64,17 @@ void ChLoadBodyForce::ComputeQ(ChState* state_x, ChStateDelta* state_w) {
     if (!mbody->Variables().IsActive())
         return;
 
+    ChFrame<> bodycoord;
+    if (state_x) {
+        // the numerical jacobian algo might change state_x
+        bodycoord.SetCoordsys(state_x->segment(0, 7));
+    } else {
+        bodycoord.SetCoordsys(mbody->GetCoordsys());
+    }
+
     ChVector3d abs_force;
     if (m_local_force)
-        abs_force = mbody->TransformDirectionLocalToParent(m_force);
+        abs_force = bodycoord.TransformDirectionLocalToParent(m_force);
     else
         abs_force = m_force;
 
@@ -49,7 +82,7 @@ void ChLoadBodyForce::ComputeQ(ChState* state_x, ChStateDelta* state_w) {
 
     ChVector3d abs_point;
     if (m_local_point)
-        abs_point = mbody->TransformPointLocalToParent(m_point);
+        abs_point = bodycoord.TransformPointLocalToParent(m_point);
     else
         abs_point = m_point;
 
@@ -67,6 +100,36 @@ void ChLoadBodyForce::ComputeQ(ChState* state_x, ChStateDelta* state_w) {
     mbody->ComputeNF(abs_point.x(), abs_point.y(), abs_point.z(), load_Q, detJ, mF, state_x, state_w);
 }
 
+// The generalized load is Q = [F; r x f], with F the absolute force and r, f the application point and the force
+// expressed in the body frame. With the body rotation increments expressed in the body frame, d(R*f)/dtheta = -R*[f]
+// for a body-fixed f, while d(R^T*F)/dtheta = [R^T*F] and d(R^T*(p-x))/dx = -R^T for fixed F and p.
+void ChLoadBodyForce::ComputeJacobian(ChState* state_x, ChStateDelta* state_w) {
+    auto mbody = std::dynamic_pointer_cast<ChBody>(this->loadable);
+    if (!mbody->Variables().IsActive())
+        return;
+
+    ChFrame<> bodycoord;
+    bodycoord.SetCoordsys(state_x->segment(0, 7));
+    const ChMatrix33<>& rot = bodycoord.GetRotMat();
+
+    ChVector3d loc_force = m_local_force ? m_force : bodycoord.TransformDirectionParentToLocal(m_force);
+    ChVector3d loc_point = m_local_point ? m_point : bodycoord.TransformPointParentToLocal(m_point);
+    ChStarMatrix33<> Fstar(loc_force * m_scale);
+
+    m_jacobians->K.setZero();
+    m_jacobians->R.setZero();
+
+    if (m_local_force)
+        m_jacobians->K.block<3, 3>(0, 3) = rot * Fstar;
+    else
+        m_jacobians->K.block<3, 3>(3, 3) = -ChStarMatrix33<>(loc_point) * Fstar;
+
+    if (!m_local_point) {
+        m_jacobians->K.block<3, 3>(3, 0) = -Fstar * rot.transpose();
+        m_jacobians->K.block<3, 3>(3, 3) += Fstar * ChStarMatrix33<>(loc_point);
+    }
+}
+
 void ChLoadBodyForce::Update(double time) {
     if (!std::dynamic_pointer_cast<ChBody>(this->loadable)->Variables().IsActive())
         return;
@@ -95,7 +158,7 @@ ChVector3d ChLoadBodyForce::GetForce() const {
 // -----------------------------------------------------------------------------
 
 ChLoadBodyTorque::ChLoadBodyTorque(std::shared_ptr<ChBody> body, const ChVector3d& torque, bool local_torque)
-    : ChLoadCustom(body), m_torque(torque), m_local_torque(local_torque), m_scale(1) {
+    : ChLoadCustom(body), m_torque(torque), m_local_torque(local_torque), m_stiff(false), m_scale(1) {
     m_modulation = chrono_types::make_shared<ChFunctionConst>(1.0);
 }
 
@@ -104,9 +167,17 @@ void ChLoadBodyTorque::ComputeQ(ChState* state_x, ChStateDelta* state_w) {
     if (!mbody->Variables().IsActive())
         return;
 
+    ChFrame<> bodycoord;
+    if (state_x) {
+        // the numerical jacobian algo might change state_x
+        bodycoord.SetCoordsys(state_x->segment(0, 7));
+    } else {
+        bodycoord.SetCoordsys(mbody->GetCoordsys());
+    }
+
     ChVector3d abs_torque;
     if (m_local_torque)
-        abs_torque = mbody->TransformDirectionLocalToParent(m_torque);
+        abs_torque = bodycoord.TransformDirectionLocalToParent(m_torque);
     else
         abs_torque = m_torque;
 
@@ -126,6 +197,24 @@ void ChLoadBodyTorque::ComputeQ(ChState* state_x, ChStateDelta* state_w) {
     mbody->ComputeNF(0, 0, 0, load_Q, detJ, mF, state_x, state_w);
 }
 
+// The generalized load is the torque expressed in the body frame, which is constant for a body-fixed torque and
+// equal to R^T*T for a fixed absolute torque T, with d(R^T*T)/dtheta = [R^T*T].
+void ChLoadBodyTorque::ComputeJacobian(ChState* state_x, ChStateDelta* state_w) {
+    auto mbody = std::dynamic_pointer_cast<ChBody>(this->loadable);
+    if (!mbody->Variables().IsActive())
+        return;
+
+    m_jacobians->K.setZero();
+    m_jacobians->R.setZero();
+
+    if (!m_local_torque) {
+        ChFrame<> bodycoord;
+        bodycoord.SetCoordsys(state_x->segment(0, 7));
+        ChVector3d loc_torque = bodycoord.TransformDirectionParentToLocal(m_torque);
+        m_jacobians->K.block<3, 3>(3, 3) = -ChStarMatrix33<>(loc_torque * m_scale);
+    }
+}
+
 void ChLoadBodyTorque::Update(double time) {
     if (!std::dynamic_pointer_cast<ChBody>(this->loadable)->Variables().IsActive())
         return;
@@ -353,6 +442,93 @@ void ChLoadBodyBody::ComputeQ(ChState* state_x, ChStateDelta* state_w) {
     load_Q.segment(9, 3) = (loc_ftorque + loc_torque).eigen();
 }
 
+// With the relative position r = RBw^T*(pA-pB) and the small relative rotation phi of frame A with respect to frame
+// Bw (expressed in Bw), the state increments (dxA, dthetaA, dxB, dthetaB) change s = (r, phi) by ds = G*dq, and the
+// relative velocities (r_dt, w_rel) are also G*v. The generalized loads are Q = P*(f, t), with P depending on the body
+// rotations. Hence K = -(dQ/dq at fixed (f,t) + P*(dFT_dpos*G + dFT_dvel*d(G*v)/dq)) and R = -P*dFT_dvel*G.
+void ChLoadBodyBody::ComputeJacobian(ChState* state_x, ChStateDelta* state_w) {
+    // Evaluate forces and frames at the current state
+    ComputeQ(state_x, state_w);
+    ChFrameMoving<> rel_AB = frame_Aw >> frame_Bw.GetInverse();
+
+    ChMatrix66d dFT_dpos;
+    ChMatrix66d dFT_dvel;
+    if (!ComputeBodyBodyForceTorqueJacobian(rel_AB, dFT_dpos, dFT_dvel)) {
+        ChLoadCustomMultiple::ComputeJacobian(state_x, state_w);
+        return;
+    }
+
+    ChFrameMoving<> bodycoordA, bodycoordB;
+    bodycoordA.SetCoordsys(state_x->segment(0, 7));
+    bodycoordB.SetCoordsys(state_x->segment(7, 7));
+    bodycoordA.SetPosDt(state_w->segment(0, 3));
+    bodycoordA.SetAngVelLocal(state_w->segment(3, 3));
+    bodycoordB.SetPosDt(state_w->segment(6, 3));
+    bodycoordB.SetAngVelLocal(state_w->segment(9, 3));
+
+    const ChMatrix33<>& RA = bodycoordA.GetRotMat();
+    const ChMatrix33<>& RB = bodycoordB.GetRotMat();
+    const ChMatrix33<>& Rb = loc_application_B.GetRotMat();
+    const ChMatrix33<>& RBw = frame_Bw.GetRotMat();
+    ChMatrix33<> RBwT = RBw.transpose();
+    ChMatrix33<> RbT = Rb.transpose();
+    ChMatrix33<> RBT = RB.transpose();
+    ChMatrix33<> RBwT_RA = RBwT * RA;
+    ChMatrix33<> RAT_RB = RA.transpose() * RB;
+    const ChVector3d& a = loc_application_A.GetPos();
+    const ChVector3d& b = loc_application_B.GetPos();
+    ChVector3d wA = bodycoordA.GetAngVelLocal();
+    ChVector3d wB = bodycoordB.GetAngVelLocal();
+
+    // relative velocity of the application points, in absolute frame
+    ChVector3d g = frame_Aw.GetPosDt() - frame_Bw.GetPosDt();
+
+    ChVector3d f = locB_force;
+    ChVector3d t = locB_torque;
+
+    // Kinematic Jacobian G and its velocity derivative Gv = d(G*v)/dq
+    ChMatrixNM<double, 6, 12> G;
+    G.setZero();
+    G.block<3, 3>(0, 0) = RBwT;
+    G.block<3, 3>(0, 3) = -RBwT_RA * ChStarMatrix33<>(a);
+    G.block<3, 3>(0, 6) = -RBwT;
+    G.block<3, 3>(0, 9) = RbT * ChStarMatrix33<>(bodycoordB.TransformPointParentToLocal(frame_Aw.GetPos()));
+    G.block<3, 3>(3, 3) = RBwT_RA;
+    G.block<3, 3>(3, 9) = -RbT;
+
+    ChMatrixNM<double, 6, 12> Gv;
+    Gv.setZero();
+    Gv.block<3, 12>(0, 0) = -ChStarMatrix33<>(RbT * wB) * G.block<3, 12>(0, 0);
+    Gv.block<3, 3>(0, 3) += -RBwT_RA * ChStarMatrix33<>(wA % a);
+    Gv.block<3, 3>(0, 9) += RbT * ChStarMatrix33<>(wB % b + RBT * g);
+    Gv.block<3, 3>(3, 3) = -RBwT_RA * ChStarMatrix33<>(wA);
+    Gv.block<3, 3>(3, 9) = RbT * ChStarMatrix33<>(RBT * (RA * wA));
+
+    // Generalized loads Q = P*(f, t)
+    ChMatrix33<> MA = RA.transpose() * RBw;
+    ChMatrixNM<double, 12, 6> P;
+    P.setZero();
+    P.block<3, 3>(0, 0) = -RBw;
+    P.block<3, 3>(3, 0) = -ChStarMatrix33<>(a) * MA;
+    P.block<3, 3>(3, 3) = -MA;
+    P.block<3, 3>(6, 0) = RBw;
+    P.block<3, 3>(9, 0) = ChStarMatrix33<>(b) * Rb;
+    P.block<3, 3>(9, 3) = Rb;
+
+    // Derivatives of Q at fixed (f, t)
+    ChStarMatrix33<> Fstar(Rb * f);
+    ChStarMatrix33<> Tstar(Rb * t);
+    ChMatrixNM<double, 12, 12> Qq;
+    Qq.setZero();
+    Qq.block<3, 3>(0, 9) = RB * Fstar;
+    Qq.block<3, 3>(3, 3) = -ChStarMatrix33<>(a) * ChStarMatrix33<>(MA * f) - ChStarMatrix33<>(MA * t);
+    Qq.block<3, 3>(3, 9) = ChStarMatrix33<>(a) * RAT_RB * Fstar + RAT_RB * Tstar;
+    Qq.block<3, 3>(6, 9) = -RB * Fstar;
+
+    m_jacobians->K = -(Qq + P * (dFT_dpos * G + dFT_dvel * Gv));
+    m_jacobians->R = -(P * dFT_dvel * G);
+}
+
 std::shared_ptr<ChBody> ChLoadBodyBody::GetBodyA() const {
     return std::dynamic_pointer_cast<ChBody>(this->loadables[0]);
 }
@@ -413,6 +589,16 @@ void ChLoadBodyBodyBushingSpherical::ComputeBodyBodyForceTorque(const ChFrameMov
     loc_torque = VNULL;
 }
 
+bool ChLoadBodyBodyBushingSpherical::ComputeBodyBodyForceTorqueJacobian(const ChFrameMoving<>& rel_AB,
+                                                                        ChMatrix66d& dFT_dpos,
+                                                                        ChMatrix66d& dFT_dvel) {
+    dFT_dpos.setZero();
+    dFT_dvel.setZero();
+    dFT_dpos.block<3, 3>(0, 0) = stiffness.eigen().asDiagonal();
+    dFT_dvel.block<3, 3>(0, 0) = damping.eigen().asDiagonal();
+    return true;
+}
+
 // -----------------------------------------------------------------------------
 // ChLoadBodyBodyBushingPlastic
 // -----------------------------------------------------------------------------
@@ -465,6 +651,21 @@ void ChLoadBodyBodyBushingPlastic::ComputeBodyBodyForceTorque(const ChFrameMovin
     loc_torque = VNULL;
 }
 
+bool ChLoadBodyBodyBushingPlastic::ComputeBodyBodyForceTorqueJacobian(const ChFrameMoving<>& rel_AB,
+                                                                      ChMatrix66d& dFT_dpos,
+                                                                      ChMatrix66d& dFT_dvel) {
+    ChLoadBodyBodyBushingSpherical::ComputeBodyBodyForceTorqueJacobian(rel_AB, dFT_dpos, dFT_dvel);
+
+    // force components capped at the plastic yield do not depend on the relative motion
+    for (int i = 0; i < 3; i++) {
+        if (std::abs(locB_force[i]) >= yield[i]) {
+            dFT_dpos.row(i).setZero();
+            dFT_dvel.row(i).setZero();
+        }
+    }
+    return true;
+}
+
 // -----------------------------------------------------------------------------
 // ChLoadBodyBodyBushingMate
 // -----------------------------------------------------------------------------
@@ -487,21 +688,23 @@ void ChLoadBodyBodyBushingMate::ComputeBodyBodyForceTorque(const ChFrameMoving<>
     ChLoadBodyBodyBushingSpherical::ComputeBodyBodyForceTorque(rel_AB, loc_force, loc_torque);
 
     // compute local torque using small rotations:
-    ChQuaternion<> rel_rot = rel_AB.GetRot();
-
-    ChVector3d dir_rot;
-    double angle_rot;
-    rel_rot.GetAngleAxis(angle_rot, dir_rot);
-    if (angle_rot > CH_PI)
-        angle_rot -= CH_2PI;
-    if (angle_rot < -CH_PI)
-        angle_rot += CH_2PI;
-    ChVector3d vect_rot = dir_rot * angle_rot;
+    ChVector3d vect_rot = GetRotationVector(rel_AB.GetRot());
 
     loc_torque = vect_rot * rot_stiffness                   // element-wise product!
                  + rel_AB.GetAngVelParent() * rot_damping;  // element-wise product!
 }
 
+bool ChLoadBodyBodyBushingMate::ComputeBodyBodyForceTorqueJacobian(const ChFrameMoving<>& rel_AB,
+                                                                   ChMatrix66d& dFT_dpos,
+                                                                   ChMatrix66d& dFT_dvel) {
+    ChLoadBodyBodyBushingSpherical::ComputeBodyBodyForceTorqueJacobian(rel_AB, dFT_dpos, dFT_dvel);
+
+    ChVector3d vect_rot = GetRotationVector(rel_AB.GetRot());
+    dFT_dpos.block<3, 3>(3, 3) = rot_stiffness.eigen().asDiagonal() * GetRotationVectorJacobianInv(vect_rot);
+    dFT_dvel.block<3, 3>(3, 3) = rot_damping.eigen().asDiagonal();
+    return true;
+}
+
 // -----------------------------------------------------------------------------
 // ChLoadBodyBodyBushingGeneric
 // -----------------------------------------------------------------------------
@@ -521,15 +724,7 @@ void ChLoadBodyBodyBushingGeneric::ComputeBodyBodyForceTorque(const ChFrameMovin
     ChVectorDynamic<> mS(6);
     ChVectorDynamic<> mSdt(6);
     ChVector3d rel_pos = rel_AB.GetPos() + neutral_displacement.GetPos();
-    ChQuaternion<> rel_rot = rel_AB.GetRot() * neutral_displacement.GetRot();
-    ChVector3d dir_rot;
-    double angle_rot;
-    rel_rot.GetAngleAxis(angle_rot, dir_rot);
-    if (angle_rot > CH_PI)
-        angle_rot -= CH_2PI;
-    if (angle_rot < -CH_PI)
-        angle_rot += CH_2PI;
-    ChVector3d vect_rot = dir_rot * angle_rot;
+    ChVector3d vect_rot = GetRotationVector(rel_AB.GetRot() * neutral_displacement.GetRot());
 
     mS.segment(0, 3) = rel_pos.eigen();
     mS.segment(3, 3) = vect_rot.eigen();
@@ -542,4 +737,14 @@ void ChLoadBodyBodyBushingGeneric::ComputeBodyBodyForceTorque(const ChFrameMovin
     loc_torque = ChVector3d(mF.segment(3, 3)) - neutral_torque;
 }
 
+bool ChLoadBodyBodyBushingGeneric::ComputeBodyBodyForceTorqueJacobian(const ChFrameMoving<>& rel_AB,
+                                                                      ChMatrix66d& dFT_dpos,
+                                                                      ChMatrix66d& dFT_dvel) {
+    ChVector3d vect_rot = GetRotationVector(rel_AB.GetRot() * neutral_displacement.GetRot());
+    dFT_dpos.block<6, 3>(0, 0) = stiffness.block<6, 3>(0, 0);
+    dFT_dpos.block<6, 3>(0, 3) = stiffness.block<6, 3>(0, 3) * GetRotationVectorJacobianInv(vect_rot);
+    dFT_dvel = damping;
+    return true;
+}
+
 }  // end namespace chrono
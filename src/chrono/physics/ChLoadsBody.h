@@ -79,21 +79,32 @@ class ChApi ChLoadBodyForce : public ChLoadCustom {
     /// By default the modulation is a constant function, always returning a value of 1.
     void SetModulationFunction(std::shared_ptr<ChFunction> modulation) { m_modulation = modulation; }
 
+    /// Declare this load as stiff or non-stiff (default: false).
+    /// If set as a stiff load, this enables the computation of the (analytical) Jacobians, which are non-zero if the
+    /// force is expressed in body local coordinates or if the application point is expressed in absolute coordinates.
+    void SetStiff(bool stiff) { m_stiff = stiff; }
+
     /// Compute the generalized load(s).
     virtual void ComputeQ(ChState* state_x,      ///< state position to evaluate Q
                           ChStateDelta* state_w  ///< state speed to evaluate Q
                           ) override;
 
+    /// Compute the analytical Jacobian matrices K=-dQ/dx and R=-dQ/dv.
+    virtual void ComputeJacobian(ChState* state_x,      ///< state position to evaluate Jacobians
+                                 ChStateDelta* state_w  ///< state speed to evaluate Jacobians
+                                 ) override;
+
   private:
     ChVector3d m_force;  ///< base force value
     ChVector3d m_point;  ///< application point
     bool m_local_force;  ///< is force expressed in local frame?
     bool m_local_point;  ///< is application expressed in local frame?
+    bool m_stiff;        ///< is the load stiff?
 
     std::shared_ptr<ChFunction> m_modulation;  ///< modulation function of time
     double m_scale;                            ///< scaling factor (current modulation value)
 
-    virtual bool IsStiff() override { return false; }
+    virtual bool IsStiff() override { return m_stiff; }
 
     virtual void Update(double time) override;
 };
@@ -126,19 +137,30 @@ class ChApi ChLoadBodyTorque : public ChLoadCustom {
     /// By default the modulation is a constant function, always returning a value of 1.
     void SetModulationFunction(std::shared_ptr<ChFunction> modulation) { m_modulation = modulation; }
 
+    /// Declare this load as stiff or non-stiff (default: false).
+    /// If set as a stiff load, this enables the computation of the (analytical) Jacobians, which are non-zero if the
+    /// torque is expressed in absolute coordinates.
+    void SetStiff(bool stiff) { m_stiff = stiff; }
+
     /// Compute the generalized load(s).
     virtual void ComputeQ(ChState* state_x,      ///< state position to evaluate Q
                           ChStateDelta* state_w  ///< state speed to evaluate Q
                           ) override;
 
+    /// Compute the analytical Jacobian matrices K=-dQ/dx and R=-dQ/dv.
+    virtual void ComputeJacobian(ChState* state_x,      ///< state position to evaluate Jacobians
+                                 ChStateDelta* state_w  ///< state speed to evaluate Jacobians
+                                 ) override;
+
   private:
     ChVector3d m_torque;  ///< base torque value
     bool m_local_torque;  ///< is torque expressed in local frame?
+    bool m_stiff;         ///< is the load stiff?
 
     std::shared_ptr<ChFunction> m_modulation;  ///< modulation function of time
     double m_scale;                            ///< scaling factor (current modulation value)
 
-    virtual bool IsStiff() override { return false; }
+    virtual bool IsStiff() override { return m_stiff; }
 
     virtual void Update(double time) override;
 };
@@ -269,8 +291,23 @@ class ChApi ChLoadBodyBody : public ChLoadCustomMultiple {
                                             ChVector3d& loc_force,
                                             ChVector3d& loc_torque) = 0;
 
-    // Optional: inherited classes could implement this to avoid the default fineite difference approximation:
-    //   virtual void ComputeJacobian(...) // see ChLoad
+    /// Compute the derivatives of the local force and torque with respect to the relative position and rotation
+    /// (dFT_dpos) and to the relative linear and angular velocity (dFT_dvel) of rel_AB.
+    /// Relative rotations are small rotations of frame A applied on the left of the rotation of rel_AB and expressed
+    /// in the frame of loc_application_B, like the angular velocity of rel_AB.
+    /// Inherited classes can implement this to avoid the default numerical computation of Jacobians; in that case,
+    /// they must fill both matrices and return true. The default implementation returns false.
+    virtual bool ComputeBodyBodyForceTorqueJacobian(const ChFrameMoving<>& rel_AB,
+                                                    ChMatrix66d& dFT_dpos,
+                                                    ChMatrix66d& dFT_dvel) {
+        return false;
+    }
+
+    /// Compute Jacobian matrices K=-dQ/dx and R=-dQ/dv.
+    /// Uses ComputeBodyBodyForceTorqueJacobian if implemented, and finite differences otherwise.
+    virtual void ComputeJacobian(ChState* state_x,      ///< state position to evaluate Jacobians
+                                 ChStateDelta* state_w  ///< state speed to evaluate Jacobians
+                                 ) override;
 
     /// For diagnosis purposes, this can return the actual last computed value of
     /// the applied force, expressed in coordinate system of loc_application_B, assumed applied to body B
@@ -389,6 +426,11 @@ class ChApi ChLoadBodyBodyBushingSpherical : public ChLoadBodyBody {
     virtual void ComputeBodyBodyForceTorque(const ChFrameMoving<>& rel_AB,
                                             ChVector3d& loc_force,
                                             ChVector3d& loc_torque) override;
+
+    /// Compute the analytical derivatives of the bushing force and torque.
+    virtual bool ComputeBodyBodyForceTorqueJacobian(const ChFrameMoving<>& rel_AB,
+                                                    ChMatrix66d& dFT_dpos,
+                                                    ChMatrix66d& dFT_dvel) override;
 };
 
 //------------------------------------------------------------------------------------------------
@@ -427,6 +469,11 @@ class ChApi ChLoadBodyBodyBushingPlastic : public ChLoadBodyBodyBushingSpherical
     virtual void ComputeBodyBodyForceTorque(const ChFrameMoving<>& rel_AB,
                                             ChVector3d& loc_force,
                                             ChVector3d& loc_torque) override;
+
+    /// Compute the analytical derivatives of the bushing force and torque.
+    virtual bool ComputeBodyBodyForceTorqueJacobian(const ChFrameMoving<>& rel_AB,
+                                                    ChMatrix66d& dFT_dpos,
+                                                    ChMatrix66d& dFT_dvel) override;
 };
 
 //------------------------------------------------------------------------------------------------
@@ -466,6 +513,11 @@ class ChApi ChLoadBodyBodyBushingMate : public ChLoadBodyBodyBushingSpherical {
     virtual void ComputeBodyBodyForceTorque(const ChFrameMoving<>& rel_AB,
                                             ChVector3d& loc_force,
                                             ChVector3d& loc_torque) override;
+
+    /// Compute the analytical derivatives of the bushing force and torque.
+    virtual bool ComputeBodyBodyForceTorqueJacobian(const ChFrameMoving<>& rel_AB,
+                                                    ChMatrix66d& dFT_dpos,
+                                                    ChMatrix66d& dFT_dvel) override;
 };
 
 //------------------------------------------------------------------------------------------------
@@ -534,6 +586,11 @@ class ChApi ChLoadBodyBodyBushingGeneric : public ChLoadBodyBody {
                                             ChVector3d& loc_force,
                                             ChVector3d& loc_torque) override;
 
+    /// Compute the analytical derivatives of the bushing force and torque.
+    virtual bool ComputeBodyBodyForceTorqueJacobian(const ChFrameMoving<>& rel_AB,
+                                                    ChMatrix66d& dFT_dpos,
+                                                    ChMatrix66d& dFT_dvel) override;
+
   public:
     EIGEN_MAKE_ALIGNED_OPERATOR_NEW
 };
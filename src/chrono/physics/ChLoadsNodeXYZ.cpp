@@ -16,6 +16,32 @@
 
 namespace chrono {
 
+// Derivatives of the force of a spring-damper along the line between two points, with relative position rel_pos and
+// relative velocity rel_vel. With L = |rel_pos| and u = rel_pos/L, the force is F = f*u, with
+// f = -K*(L-d0) - R*(v.u). Then dF/dx = u*df/dx^T + f*du/dx, with du/dx = (I - u*u^T)/L and
+// df/dx = -K*u - R*(I - u*u^T)*v/L. Returns false if the two points are coincident.
+static bool ComputeSpringForceJacobian(double K,
+                                       double R,
+                                       double d0,
+                                       const ChVector3d& rel_pos,
+                                       const ChVector3d& rel_vel,
+                                       ChMatrix33<>& dF_dpos,
+                                       ChMatrix33<>& dF_dvel) {
+    double L = rel_pos.Length();
+    if (L < 1e-12)
+        return false;
+
+    ChVector3d u = rel_pos / L;
+    double f = -K * (L - d0) - R * Vdot(rel_vel, u);
+    ChMatrix33<> uu = TensorProduct(u, u);
+    ChMatrix33<> P = ChMatrix33<>::Identity() - uu;
+    ChVector3d Pv = P * rel_vel;
+
+    dF_dpos = -K * uu - (R / L) * TensorProduct(u, Pv) + (f / L) * P;
+    dF_dvel = -R * uu;
+    return true;
+}
+
 // -----------------------------------------------------------------------------
 // ChLoadNodeXYZForce
 // -----------------------------------------------------------------------------
@@ -50,6 +76,22 @@ void ChLoadNodeXYZForce::ComputeQ(ChState* state_x, ChStateDelta* state_w) {
     load_Q.segment(0, 3) = computed_abs_force.eigen();
 }
 
+void ChLoadNodeXYZForce::ComputeJacobian(ChState* state_x, ChStateDelta* state_w) {
+    ChVector3d pos(state_x->segment(0, 3));
+    ChVector3d vel(state_w->segment(0, 3));
+
+    ChMatrix33<> dF_dpos;
+    ChMatrix33<> dF_dvel;
+    if (!ComputeForceJacobian(pos, vel, dF_dpos, dF_dvel)) {
+        ChLoadCustom::ComputeJacobian(state_x, state_w);
+        return;
+    }
+
+    // Q = F(x, v), and K = -dQ/dx, R = -dQ/dv
+    m_jacobians->K = -dF_dpos;
+    m_jacobians->R = -dF_dvel;
+}
+
 void ChLoadNodeXYZForce::Update(double time) {
     ChLoadCustom::Update(time);
 }
@@ -68,6 +110,15 @@ void ChLoadNodeXYZForceAbs::ComputeForce(const ChVector3d& abs_pos, const ChVect
     abs_force = GetForce();
 }
 
+bool ChLoadNodeXYZForceAbs::ComputeForceJacobian(const ChVector3d& abs_pos,
+                                                 const ChVector3d& abs_vel,
+                                                 ChMatrix33<>& dF_dpos,
+                                                 ChMatrix33<>& dF_dvel) {
+    dF_dpos.setZero();
+    dF_dvel.setZero();
+    return true;
+}
+
 void ChLoadNodeXYZForceAbs::Update(double time) {
     m_modulation->Update(time);
     m_scale = m_modulation->GetVal(time);
@@ -125,6 +176,29 @@ void ChLoadNodeXYZNodeXYZ::ComputeQ(ChState* state_x, ChStateDelta* state_w) {
     load_Q.segment(3, 3) = -computed_abs_force.eigen();
 }
 
+void ChLoadNodeXYZNodeXYZ::ComputeJacobian(ChState* state_x, ChStateDelta* state_w) {
+    ChVector3d rel_pos(state_x->segment(0, 3) - state_x->segment(3, 3));
+    ChVector3d rel_vel(state_w->segment(0, 3) - state_w->segment(3, 3));
+
+    ChMatrix33<> dF_dpos;
+    ChMatrix33<> dF_dvel;
+    if (!ComputeForceJacobian(rel_pos, rel_vel, dF_dpos, dF_dvel)) {
+        ChLoadCustomMultiple::ComputeJacobian(state_x, state_w);
+        return;
+    }
+
+    // Q = [F; -F] with F = F(xA - xB, vA - vB), and K = -dQ/dx, R = -dQ/dv
+    m_jacobians->K.block<3, 3>(0, 0) = -dF_dpos;
+    m_jacobians->K.block<3, 3>(0, 3) = dF_dpos;
+    m_jacobians->K.block<3, 3>(3, 0) = dF_dpos;
+    m_jacobians->K.block<3, 3>(3, 3) = -dF_dpos;
+
+    m_jacobians->R.block<3, 3>(0, 0) = -dF_dvel;
+    m_jacobians->R.block<3, 3>(0, 3) = dF_dvel;
+    m_jacobians->R.block<3, 3>(3, 0) = dF_dvel;
+    m_jacobians->R.block<3, 3>(3, 3) = -dF_dvel;
+}
+
 void ChLoadNodeXYZNodeXYZ::Update(double time) {
     ChLoadCustomMultiple::Update(time);
 }
@@ -150,6 +224,13 @@ void ChLoadNodeXYZNodeXYZSpring::ComputeForce(const ChVector3d& rel_pos,
     abs_force = (-K * d - R * d_dt) * BA;
 }
 
+bool ChLoadNodeXYZNodeXYZSpring::ComputeForceJacobian(const ChVector3d& rel_pos,
+                                                      const ChVector3d& rel_vel,
+                                                      ChMatrix33<>& dF_dpos,
+                                                      ChMatrix33<>& dF_dvel) {
+    return ComputeSpringForceJacobian(K, R, d0, rel_pos, rel_vel, dF_dpos, dF_dvel);
+}
+
 // -----------------------------------------------------------------------------
 // ChLoadNodeXYZNodeXYZBushing
 // -----------------------------------------------------------------------------
@@ -171,6 +252,22 @@ void ChLoadNodeXYZNodeXYZBushing::ComputeForce(const ChVector3d& rel_pos,
                            force_dZ->GetVal(rel_pos.z()) - R.z() * rel_vel.z());
 }
 
+bool ChLoadNodeXYZNodeXYZBushing::ComputeForceJacobian(const ChVector3d& rel_pos,
+                                                       const ChVector3d& rel_vel,
+                                                       ChMatrix33<>& dF_dpos,
+                                                       ChMatrix33<>& dF_dvel) {
+    dF_dpos.setZero();
+    dF_dpos(0, 0) = force_dX->GetDer(rel_pos.x());
+    dF_dpos(1, 1) = force_dY->GetDer(rel_pos.y());
+    dF_dpos(2, 2) = force_dZ->GetDer(rel_pos.z());
+
+    dF_dvel.setZero();
+    dF_dvel(0, 0) = -R.x();
+    dF_dvel(1, 1) = -R.y();
+    dF_dvel(2, 2) = -R.z();
+    return true;
+}
+
 // -----------------------------------------------------------------------------
 // ChLoadBodyBody
 // -----------------------------------------------------------------------------
@@ -224,6 +321,65 @@ void ChLoadNodeXYZBody::ComputeQ(ChState* state_x, ChStateDelta* state_w) {
     load_Q.segment(6, 3) = -loc_ftorque.eigen();
 }
 
+// With the relative position r = RBw^T*(xA-pB) of the node in the frame Bw of the application point, the state
+// increments (dxA, dxB, dthetaB) change r by dr = G*dq, and the relative velocity r_dt is also G*v. The generalized
+// loads are Q = [RBw*f; -RBw*f; -[b]*Rb*f], with RBw depending on the body rotation. Hence
+// K = -(dQ/dq at fixed f + P*(dF_dpos*G + dF_dvel*d(G*v)/dq)) and R = -P*dF_dvel*G, with P = dQ/df.
+void ChLoadNodeXYZBody::ComputeJacobian(ChState* state_x, ChStateDelta* state_w) {
+    // Evaluate force and frames at the current state
+    ComputeQ(state_x, state_w);
+    ChFrameMoving<> rel_AB = frame_Aw >> frame_Bw.GetInverse();
+
+    ChMatrix33<> dF_dpos;
+    ChMatrix33<> dF_dvel;
+    if (!ComputeForceJacobian(rel_AB, dF_dpos, dF_dvel)) {
+        ChLoadCustomMultiple::ComputeJacobian(state_x, state_w);
+        return;
+    }
+
+    ChFrameMoving<> bodycoordB;
+    bodycoordB.SetCoordsys(state_x->segment(3, 7));
+    bodycoordB.SetPosDt(state_w->segment(3, 3));
+    bodycoordB.SetAngVelLocal(state_w->segment(6, 3));
+
+    const ChMatrix33<>& RB = bodycoordB.GetRotMat();
+    const ChMatrix33<>& Rb = loc_application_B.GetRotMat();
+    const ChMatrix33<>& RBw = frame_Bw.GetRotMat();
+    ChMatrix33<> RBwT = RBw.transpose();
+    ChMatrix33<> RbT = Rb.transpose();
+    ChMatrix33<> RBT = RB.transpose();
+    const ChVector3d& b = loc_application_B.GetPos();
+    ChVector3d wB = bodycoordB.GetAngVelLocal();
+
+    // relative velocity of node and application point, in absolute frame
+    ChVector3d g = frame_Aw.GetPosDt() - frame_Bw.GetPosDt();
+
+    // Kinematic Jacobian G and its velocity derivative Gv = d(G*v)/dq
+    ChMatrixNM<double, 3, 9> G;
+    G.block<3, 3>(0, 0) = RBwT;
+    G.block<3, 3>(0, 3) = -RBwT;
+    G.block<3, 3>(0, 6) = RbT * ChStarMatrix33<>(bodycoordB.TransformPointParentToLocal(frame_Aw.GetPos()));
+
+    ChMatrixNM<double, 3, 9> Gv = -ChStarMatrix33<>(RbT * wB) * G;
+    Gv.block<3, 3>(0, 6) += RbT * ChStarMatrix33<>(wB % b + RBT * g);
+
+    // Generalized loads Q = P*f
+    ChMatrixNM<double, 9, 3> P;
+    P.block<3, 3>(0, 0) = RBw;
+    P.block<3, 3>(3, 0) = -RBw;
+    P.block<3, 3>(6, 0) = -ChStarMatrix33<>(b) * Rb;
+
+    // Derivatives of Q at fixed f
+    ChStarMatrix33<> Fstar(Rb * computed_loc_force);
+    ChMatrixNM<double, 9, 9> Qq;
+    Qq.setZero();
+    Qq.block<3, 3>(0, 6) = -RB * Fstar;
+    Qq.block<3, 3>(3, 6) = RB * Fstar;
+
+    m_jacobians->K = -(Qq + P * (dF_dpos * G + dF_dvel * Gv));
+    m_jacobians->R = -(P * dF_dvel * G);
+}
+
 std::shared_ptr<ChNodeXYZ> ChLoadNodeXYZBody::GetNode() const {
     return std::dynamic_pointer_cast<ChNodeXYZ>(this->loadables[0]);
 }
@@ -253,6 +409,12 @@ void ChLoadNodeXYZBodySpring::ComputeForce(const ChFrameMoving<>& rel_AB, ChVect
     loc_force = (-K * d - R * d_dt) * BA;
 }
 
+bool ChLoadNodeXYZBodySpring::ComputeForceJacobian(const ChFrameMoving<>& rel_AB,
+                                                   ChMatrix33<>& dF_dpos,
+                                                   ChMatrix33<>& dF_dvel) {
+    return ComputeSpringForceJacobian(K, R, d0, rel_AB.GetPos(), rel_AB.GetPosDt(), dF_dpos, dF_dvel);
+}
+
 // -----------------------------------------------------------------------------
 // ChLoadNodeXYZBodyBushing
 // -----------------------------------------------------------------------------
@@ -271,4 +433,19 @@ void ChLoadNodeXYZBodyBushing::ComputeForce(const ChFrameMoving<>& rel_AB, ChVec
                            force_dZ->GetVal(rel_AB.GetPos().z()) - R.z() * rel_AB.GetPosDt().z());
 }
 
+bool ChLoadNodeXYZBodyBushing::ComputeForceJacobian(const ChFrameMoving<>& rel_AB,
+                                                    ChMatrix33<>& dF_dpos,
+                                                    ChMatrix33<>& dF_dvel) {
+    dF_dpos.setZero();
+    dF_dpos(0, 0) = force_dX->GetDer(rel_AB.GetPos().x());
+    dF_dpos(1, 1) = force_dY->GetDer(rel_AB.GetPos().y());
+    dF_dpos(2, 2) = force_dZ->GetDer(rel_AB.GetPos().z());
+
+    dF_dvel.setZero();
+    dF_dvel(0, 0) = -R.x();
+    dF_dvel(1, 1) = -R.y();
+    dF_dvel(2, 2) = -R.z();
+    return true;
+}
+
 }  // end namespace chrono
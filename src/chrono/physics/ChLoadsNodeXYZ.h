@@ -48,6 +48,16 @@ class ChLoaderNodeXYZ : public ChLoaderUVWatomic {
         F.segment(0, 3) = force.eigen();
     }
 
+    /// Compute the Jacobians of the generalized load; these are zero since the force is constant.
+    virtual bool ComputeJacobian(ChVectorDynamic<>* state_x,
+                                 ChVectorDynamic<>* state_w,
+                                 ChMatrixRef K,
+                                 ChMatrixRef R) override {
+        K.setZero();
+        R.setZero();
+        return true;
+    }
+
     /// Set the applied nodal force, assumed to be constant in space and time.
     void SetForce(const ChVector3d& mf) { force = mf; }
 
@@ -86,9 +96,15 @@ class ChApi ChLoadNodeXYZForce : public ChLoadCustom {
     /// Compute the force on the node, in absolute coordsystem, given position of node as abs_pos.
     virtual void ComputeForce(const ChVector3d& abs_pos, const ChVector3d& abs_vel, ChVector3d& abs_force) = 0;
 
-    // Optional: inherited classes could implement this to avoid the
-    // default numerical computation of Jacobians:
-    //   virtual void ComputeJacobian(...) // see ChLoad
+    /// Compute the derivatives of the force on the node with respect to the node position and velocity.
+    /// Inherited classes can implement this to avoid the default numerical computation of Jacobians; in that case,
+    /// they must fill both matrices and return true. The default implementation returns false.
+    virtual bool ComputeForceJacobian(const ChVector3d& abs_pos,
+                                      const ChVector3d& abs_vel,
+                                      ChMatrix33<>& dF_dpos,
+                                      ChMatrix33<>& dF_dvel) {
+        return false;
+    }
 
     /// Compute Q, the generalized load.
     /// Called automatically at each Update().
@@ -96,6 +112,12 @@ class ChApi ChLoadNodeXYZForce : public ChLoadCustom {
                           ChStateDelta* state_w  ///< state speed to evaluate Q
                           ) override;
 
+    /// Compute Jacobian matrices K=-dQ/dx and R=-dQ/dv.
+    /// Uses ComputeForceJacobian if implemented, and finite differences otherwise.
+    virtual void ComputeJacobian(ChState* state_x,      ///< state position to evaluate Jacobians
+                                 ChStateDelta* state_w  ///< state speed to evaluate Jacobians
+                                 ) override;
+
     /// Return the last computed value of the applied force.
     /// Used primarily for diagnostics, this function returns the force on the node expressed in absolute coordinates.
     ChVector3d GetForce() const { return computed_abs_force; }
@@ -123,6 +145,12 @@ class ChApi ChLoadNodeXYZForceAbs : public ChLoadNodeXYZForce {
     /// Compute the force on the node, in absolute coordsystem, given position of node as abs_pos.
     virtual void ComputeForce(const ChVector3d& abs_pos, const ChVector3d& abs_vel, ChVector3d& abs_force) override;
 
+    /// Compute the derivatives of the force (zero, since the force does not depend on the node state).
+    virtual bool ComputeForceJacobian(const ChVector3d& abs_pos,
+                                      const ChVector3d& abs_vel,
+                                      ChMatrix33<>& dF_dpos,
+                                      ChMatrix33<>& dF_dvel) override;
+
     /// Set the applied force vector (expressed in absolute coordinates).
     /// The force is assumed constant, unless a scaling time function is provided.
     void SetForceBase(const ChVector3d& force);
@@ -163,9 +191,15 @@ class ChApi ChLoadNodeXYZNodeXYZ : public ChLoadCustomMultiple {
     /// Compute the force on the nodeA, in absolute coordsystem, given relative position of nodeA with respect to B.
     virtual void ComputeForce(const ChVector3d& rel_pos, const ChVector3d& rel_vel, ChVector3d& abs_force) = 0;
 
-    // Optional: inherited classes could implement this to avoid the
-    // default numerical computation of Jacobians:
-    //   virtual void ComputeJacobian(...) // see ChLoad
+    /// Compute the derivatives of the force on nodeA with respect to the relative position and relative velocity.
+    /// Inherited classes can implement this to avoid the default numerical computation of Jacobians; in that case,
+    /// they must fill both matrices and return true. The default implementation returns false.
+    virtual bool ComputeForceJacobian(const ChVector3d& rel_pos,
+                                      const ChVector3d& rel_vel,
+                                      ChMatrix33<>& dF_dpos,
+                                      ChMatrix33<>& dF_dvel) {
+        return false;
+    }
 
     /// Compute Q, the generalized load.
     /// Called automatically at each Update().
@@ -173,6 +207,12 @@ class ChApi ChLoadNodeXYZNodeXYZ : public ChLoadCustomMultiple {
                           ChStateDelta* state_w  ///< state speed to evaluate Q
                           ) override;
 
+    /// Compute Jacobian matrices K=-dQ/dx and R=-dQ/dv.
+    /// Uses ComputeForceJacobian if implemented, and finite differences otherwise.
+    virtual void ComputeJacobian(ChState* state_x,      ///< state position to evaluate Jacobians
+                                 ChStateDelta* state_w  ///< state speed to evaluate Jacobians
+                                 ) override;
+
     /// Return the last computed value of the applied force.
     /// Used primarily for diagnostics, this function returns the force on the node expressed in absolute coordinates.
     ChVector3d GetForce() const { return computed_abs_force; }
@@ -203,6 +243,13 @@ class ChApi ChLoadNodeXYZNodeXYZSpring : public ChLoadNodeXYZNodeXYZ {
     /// Compute the force on the nodeA, in absolute coordsystem, given relative position of nodeA with respect to B.
     virtual void ComputeForce(const ChVector3d& rel_pos, const ChVector3d& rel_vel, ChVector3d& abs_force) override;
 
+    /// Compute the analytical derivatives of the spring force.
+    /// Returns false (finite differences are used) if the two nodes are coincident.
+    virtual bool ComputeForceJacobian(const ChVector3d& rel_pos,
+                                      const ChVector3d& rel_vel,
+                                      ChMatrix33<>& dF_dpos,
+                                      ChMatrix33<>& dF_dvel) override;
+
     /// Set stiffness, along direction.
     void SetStiffness(const double stiffness) { K = stiffness; }
     double GetStiffness() const { return K; }
@@ -216,7 +263,7 @@ class ChApi ChLoadNodeXYZNodeXYZSpring : public ChLoadNodeXYZNodeXYZ {
     double GetRestLength() const { return d0; }
 
     /// Declare this load as stiff or non-stiff.
-    /// If set as a stiff load, this enables the automatic computation of the Jacobian through finite differences.
+    /// If set as a stiff load, this enables the computation of the (analytical) Jacobians.
     void SetStiff(bool stiff) { is_stiff = stiff; }
 
   protected:
@@ -242,6 +289,12 @@ class ChApi ChLoadNodeXYZNodeXYZBushing : public ChLoadNodeXYZNodeXYZ {
     /// Compute the force on the nodeA, in absolute coordsystem, given relative position of nodeA with respect to B.
     virtual void ComputeForce(const ChVector3d& rel_pos, const ChVector3d& rel_vel, ChVector3d& abs_force) override;
 
+    /// Compute the analytical derivatives of the bushing force (diagonal matrices).
+    virtual bool ComputeForceJacobian(const ChVector3d& rel_pos,
+                                      const ChVector3d& rel_vel,
+                                      ChMatrix33<>& dF_dpos,
+                                      ChMatrix33<>& dF_dvel) override;
+
     /// Set force as a function of displacement on X (default: constant 0 function).
     void SetFunctionForceX(std::shared_ptr<ChFunction> fx) { force_dX = fx; }
 
@@ -258,7 +311,7 @@ class ChApi ChLoadNodeXYZNodeXYZBushing : public ChLoadNodeXYZNodeXYZ {
     ChVector3d GetDamping() const { return R; }
 
     /// Declare this load as stiff or non-stiff.
-    /// If set as a stiff load, this enables the automatic computation of the Jacobian through finite differences.
+    /// If set as a stiff load, this enables the computation of the (analytical) Jacobians.
     void SetStiff(bool ms) { is_stiff = ms; }
 
   protected:
@@ -291,9 +344,18 @@ class ChApi ChLoadNodeXYZBody : public ChLoadCustomMultiple {
     /// The local coordinate system is that specified with SetApplicationFrameB (the auxiliary frame attached to body).
     virtual void ComputeForce(const ChFrameMoving<>& rel_AB, ChVector3d& loc_force) = 0;
 
-    // Optional: inherited classes could implement this to avoid the
-    // default numerical computation of Jacobians:
-    //   virtual void ComputeJacobian(...) // see ChLoad
+    /// Compute the derivatives of the local force with respect to the position and velocity of rel_AB.
+    /// Inherited classes can implement this to avoid the default numerical computation of Jacobians; in that case,
+    /// they must fill both matrices and return true. The default implementation returns false.
+    virtual bool ComputeForceJacobian(const ChFrameMoving<>& rel_AB, ChMatrix33<>& dF_dpos, ChMatrix33<>& dF_dvel) {
+        return false;
+    }
+
+    /// Compute Jacobian matrices K=-dQ/dx and R=-dQ/dv.
+    /// Uses ComputeForceJacobian if implemented, and finite differences otherwise.
+    virtual void ComputeJacobian(ChState* state_x,      ///< state position to evaluate Jacobians
+                                 ChStateDelta* state_w  ///< state speed to evaluate Jacobians
+                                 ) override;
 
     /// Return the last computed value of the applied force.
     /// Used primarily for diagnostics, this function returns the force on the node expressed in absolute coordinates.
@@ -343,6 +405,12 @@ class ChApi ChLoadNodeXYZBodySpring : public ChLoadNodeXYZBody {
     /// The local coordinate system is that specified with SetApplicationFrameB (the auxiliary frame attached to body).
     virtual void ComputeForce(const ChFrameMoving<>& rel_AB, ChVector3d& loc_force) override;
 
+    /// Compute the analytical derivatives of the spring force.
+    /// Returns false (finite differences are used) if the node is at the application point on the body.
+    virtual bool ComputeForceJacobian(const ChFrameMoving<>& rel_AB,
+                                      ChMatrix33<>& dF_dpos,
+                                      ChMatrix33<>& dF_dvel) override;
+
     /// Set stiffness, along direction.
     void SetStiffness(const double stiffness) { K = stiffness; }
     double GetStiffness() const { return K; }
@@ -356,7 +424,7 @@ class ChApi ChLoadNodeXYZBodySpring : public ChLoadNodeXYZBody {
     double GetRestLength() const { return d0; }
 
     /// Declare this load as stiff or non-stiff.
-    /// If set as a stiff load, this enables the automatic computation of the Jacobian through finite differences.
+    /// If set as a stiff load, this enables the computation of the (analytical) Jacobians.
     void SetStiff(bool ms) { is_stiff = ms; }
 
   protected:
@@ -384,6 +452,11 @@ class ChApi ChLoadNodeXYZBodyBushing : public ChLoadNodeXYZBody {
     /// The local coordinate system is that specified with SetApplicationFrameB (the auxiliary frame attached to body).
     virtual void ComputeForce(const ChFrameMoving<>& rel_AB, ChVector3d& loc_force) override;
 
+    /// Compute the analytical derivatives of the bushing force (diagonal matrices).
+    virtual bool ComputeForceJacobian(const ChFrameMoving<>& rel_AB,
+                                      ChMatrix33<>& dF_dpos,
+                                      ChMatrix33<>& dF_dvel) override;
+
     /// Set force as a function of displacement on X (default: constant 0 function).
     void SetFunctionForceX(std::shared_ptr<ChFunction> fx) { force_dX = fx; }
 
@@ -401,7 +474,7 @@ class ChApi ChLoadNodeXYZBodyBushing : public ChLoadNodeXYZBody {
     ChVector3d GetDamping() const { return R; }
 
     /// Declare this load as stiff or non-stiff (default: false).
-    /// If set as a stiff load, this enables the automatic computation of the Jacobian through finite differences.
+    /// If set as a stiff load, this enables the computation of the (analytical) Jacobians.
     void SetStiff(bool ms) { is_stiff = ms; }
 
   protected:
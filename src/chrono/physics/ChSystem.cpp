@@ -13,8 +13,11 @@
 // =============================================================================
 
 #include <algorithm>
+#include <cstring>
 #include <iomanip>
 #include <fstream>
+#include <numeric>
+#include <unordered_map>
 
 #include "chrono/collision/bullet/ChCollisionSystemBullet.h"
 #ifdef CHRONO_COLLISION
@@ -28,6 +31,8 @@
 #include "chrono/solver/ChSolverPJacobi.h"
 #include "chrono/solver/ChSolverPMINRES.h"
 #include "chrono/solver/ChSolverPSOR.h"
+#include "chrono/solver/ChSolverPSORColored.h"
+#include "chrono/solver/ChSolverPSORIslands.h"
 #include "chrono/solver/ChSolverPSSOR.h"
 #include "chrono/solver/ChIterativeSolverLS.h"
 #include "chrono/solver/ChDirectSolverLS.h"
@@ -66,6 +71,7 @@ ChSystem::ChSystem()
       nthreads_chrono(1),
       nthreads_eigen(1),
       nthreads_collision(1),
+      deterministic(false),
       applied_forces_current(false) {
     assembly.system = this;
 
@@ -99,6 +105,7 @@ ChSystem::ChSystem(const ChSystem& other) : m_RTF(0), collision_system(nullptr),
     nthreads_chrono = other.nthreads_chrono;
     nthreads_eigen = other.nthreads_eigen;
     nthreads_collision = other.nthreads_collision;
+    deterministic = other.deterministic;
     is_initialized = false;
     is_updated = false;
     applied_forces_current = false;
@@ -272,6 +279,12 @@ void ChSystem::SetSolverType(ChSolver::Type type) {
         case ChSolver::Type::APGD:
             solver = chrono_types::make_shared<ChSolverAPGD>();
             break;
+        case ChSolver::Type::PSOR_COLORED:
+            solver = chrono_types::make_shared<ChSolverPSORColored>();
+            break;
+        case ChSolver::Type::PSOR_ISLANDS:
+            solver = chrono_types::make_shared<ChSolverPSORIslands>();
+            break;
         case ChSolver::Type::GMRES:
             solver = chrono_types::make_shared<ChSolverGMRES>();
             break;
@@ -287,8 +300,10 @@ void ChSystem::SetSolverType(ChSolver::Type type) {
         default:
             std::cout << "Unknown solver type. No solver was set." << std::endl;
             std::cout << "Use SetSolver()." << std::endl;
-            break;
+            return;
     }
+
+    solver->SetNumThreads(nthreads_chrono);
 }
 
 void ChSystem::EnableSolverMatrixWrite(bool val, const std::string& out_dir) {
@@ -319,6 +334,7 @@ void ChSystem::SetSystemDescriptor(std::shared_ptr<ChSystemDescriptor> newdescri
 void ChSystem::SetSolver(std::shared_ptr<ChSolver> newsolver) {
     assert(newsolver);
     solver = newsolver;
+    solver->SetNumThreads(nthreads_chrono);
 }
 
 void ChSystem::SetCollisionSystemType(ChCollisionSystem::Type type) {
@@ -377,6 +393,8 @@ void ChSystem::SetNumThreads(int num_threads_chrono, int num_threads_collision,
 
     if (collision_system)
         collision_system->SetNumThreads(nthreads_collision);
+    if (solver)
+        solver->SetNumThreads(nthreads_chrono);
 }
 
 // -----------------------------------------------------------------------------
@@ -476,10 +494,43 @@ bool ChSystem::ManageSleepingBodies() {
     }
 
     // STEP 2:
-    // See if some sleeping or potential sleeping body is touching a non sleeping one; if so, set to no sleep.
+    // Group the bodies in islands, i.e. sets of bodies connected (directly or indirectly) by links or contacts.
+    // Fixed bodies do not connect islands. An island is put to sleep or woken up as a whole: if one of its bodies is
+    // neither sleeping nor a candidate for sleeping, all other bodies in the island stay (or become) awake.
+    // Since fixed bodies never sleep, an island with a body linked to a fixed body (e.g., through a motor driven by a
+    // time-dependent function) is always awake. Contacts with fixed bodies do not keep islands awake.
+
+    std::unordered_map<ChBody*, unsigned int> body_index;
+    body_index.reserve(assembly.bodylist.size());
+    for (auto& body : assembly.bodylist) {
+        if (!body->IsFixed())
+            body_index.emplace(body.get(), (unsigned int)body_index.size());
+    }
+
+    std::vector<unsigned int> parent(body_index.size());
+    std::iota(parent.begin(), parent.end(), 0);
+
+    auto find_root = [&parent](unsigned int i) {
+        while (parent[i] != i) {
+            parent[i] = parent[parent[i]];
+            i = parent[i];
+        }
+        return i;
+    };
+
+    auto join = [&](ChBody* b1, ChBody* b2) {
+        auto i1 = body_index.find(b1);
+        auto i2 = body_index.find(b2);
+        if (i1 == body_index.end() || i2 == body_index.end())
+            return;
+        unsigned int r1 = find_root(i1->second);
+        unsigned int r2 = find_root(i2->second);
+        if (r1 != r2)
+            parent[r2] = r1;
+    };
 
     // Make this class for iterating through contacts
-    class _wakeup_reporter_class : public ChContactContainer::ReportContactCallback {
+    class _island_reporter_class : public ChContactContainer::ReportContactCallback {
       public:
         // Callback, used to report contact points already added to the container.
         // If returns false, the contact scanning will be stopped.
@@ -498,97 +549,74 @@ bool ChSystem::ManageSleepingBodies() {
                 return true;
             ChBody* b1 = dynamic_cast<ChBody*>(contactobjA);
             ChBody* b2 = dynamic_cast<ChBody*>(contactobjB);
-            if (!(b1 && b2))
-                return true;
-            bool sleep1 = b1->IsSleeping();
-            bool sleep2 = b2->IsSleeping();
-            bool could_sleep1 = b1->candidate_sleeping;
-            bool could_sleep2 = b2->candidate_sleeping;
-            bool ground1 = b1->IsFixed();
-            bool ground2 = b2->IsFixed();
-            if (sleep1 && !(sleep2 || could_sleep2) && !ground2) {
-                b1->SetSleeping(false);
-                need_Setup_A = true;
-            }
-            if (sleep2 && !(sleep1 || could_sleep1) && !ground1) {
-                b2->SetSleeping(false);
-                need_Setup_A = true;
-            }
-            if (could_sleep1 && !(sleep2 || could_sleep2) && !ground2) {
-                b1->candidate_sleeping = false;
-            }
-            if (could_sleep2 && !(sleep1 || could_sleep1) && !ground1) {
-                b2->candidate_sleeping = false;
-            }
-            someone_sleeps = someone_sleeps || sleep1 || sleep2;
+            if (b1 && b2)
+                pairs.push_back(std::make_pair(b1, b2));
 
             return true;  // to continue scanning contacts
         }
 
         // Data
-        bool someone_sleeps;
-        bool need_Setup_A;
+        std::vector<std::pair<ChBody*, ChBody*>> pairs;
     };
 
-    auto my_waker = chrono_types::make_shared<_wakeup_reporter_class>();
-    my_waker->need_Setup_A = false;
-
-    bool need_Setup_L = false;
-
-    for (int i = 0; i < 1; i++)  //// TODO  reconfigurable number of wakeup cycles
-    {
-        my_waker->someone_sleeps = false;
-
-        // scan all links and wake connected bodies
-        for (auto& link : assembly.linklist) {
-            if (auto Lpointer = std::dynamic_pointer_cast<ChLink>(link)) {
-                if (Lpointer->IsRequiringWaking()) {
-                    ChBody* b1 = dynamic_cast<ChBody*>(Lpointer->GetBody1());
-                    ChBody* b2 = dynamic_cast<ChBody*>(Lpointer->GetBody2());
-                    if (b1 && b2) {
-                        bool sleep1 = b1->IsSleeping();
-                        bool sleep2 = b2->IsSleeping();
-                        bool could_sleep1 = b1->candidate_sleeping;
-                        bool could_sleep2 = b2->candidate_sleeping;
-                        if (sleep1 && !(sleep2 || could_sleep2)) {
-                            b1->SetSleeping(false);
-                            need_Setup_L = true;
-                        }
-                        if (sleep2 && !(sleep1 || could_sleep1)) {
-                            b2->SetSleeping(false);
-                            need_Setup_L = true;
-                        }
-                        if (could_sleep1 && !(sleep2 || could_sleep2)) {
-                            b1->candidate_sleeping = false;
-                        }
-                        if (could_sleep2 && !(sleep1 || could_sleep1)) {
-                            b2->candidate_sleeping = false;
-                        }
-                    }
-                }
+    // scan all links and join connected bodies; record the bodies linked to fixed bodies
+    std::vector<ChBody*> grounded;
+    for (auto& link : assembly.linklist) {
+        if (auto Lpointer = std::dynamic_pointer_cast<ChLink>(link)) {
+            if (Lpointer->IsRequiringWaking()) {
+                ChBody* b1 = dynamic_cast<ChBody*>(Lpointer->GetBody1());
+                ChBody* b2 = dynamic_cast<ChBody*>(Lpointer->GetBody2());
+                if (!(b1 && b2))
+                    continue;
+                if (b1->IsFixed())
+                    grounded.push_back(b2);
+                else if (b2->IsFixed())
+                    grounded.push_back(b1);
+                else
+                    join(b1, b2);
             }
         }
+    }
 
-        // scan all contacts and wake neighboring bodies
-        contact_container->ReportAllContacts(my_waker);
-
-        // bailout wakeup cycle prematurely, if all bodies are not sleeping
-        if (!my_waker->someone_sleeps)
-            break;
+    // scan all contacts and join neighboring bodies
+    auto my_reporter = chrono_types::make_shared<_island_reporter_class>();
+    contact_container->ReportAllContacts(my_reporter);
+    for (const auto& pair : my_reporter->pairs)
+        join(pair.first, pair.second);
+
+    // An island is awake if any of its bodies is awake and cannot go to sleep, or if it is linked to a fixed body
+    std::vector<char> island_awake(parent.size(), false);
+    for (const auto& b : body_index) {
+        if (!(b.first->IsSleeping() || b.first->candidate_sleeping))
+            island_awake[find_root(b.second)] = true;
+    }
+    for (auto body : grounded) {
+        auto b = body_index.find(body);
+        if (b != body_index.end())
+            island_awake[find_root(b->second)] = true;
     }
 
-    /// If some body still must change from no sleep-> sleep, do it
-    int need_Setup_B = 0;
-    for (auto& body : assembly.bodylist) {
-        if (body->candidate_sleeping) {
+    // STEP 3:
+    // Wake up all bodies in awake islands and put to sleep the candidates in all other islands
+
+    bool need_Setup = false;
+    for (const auto& b : body_index) {
+        ChBody* body = b.first;
+        if (island_awake[find_root(b.second)]) {
+            if (body->IsSleeping()) {
+                body->SetSleeping(false);
+                need_Setup = true;
+            }
+            body->candidate_sleeping = false;
+        } else if (body->candidate_sleeping) {
             body->SetSleeping(true);
-            ++need_Setup_B;
+            need_Setup = true;
         }
     }
 
     // if some body has been activated/deactivated because of sleep state changes,
     // the offsets and DOF counts must be updated:
-    if (my_waker->need_Setup_A || need_Setup_B || need_Setup_L) {
+    if (need_Setup) {
         Setup();
         return true;
     }
@@ -1030,6 +1058,7 @@ bool ChSystem::StateSolveCorrection(
     // If the solver's Setup() must be called or if the solver's Solve() requires it,
     // fill the sparse system structures with information in G and Cq.
     if (force_setup || GetSolver()->SolveRequiresMatrix()) {
+        CH_PROFILE("LoadJacobians");
         timer_jacobian.start();
 
         // Cq  matrix
@@ -1070,6 +1099,7 @@ bool ChSystem::StateSolveCorrection(
     // If indicated, first perform a solver setup.
     // Return 'false' if the setup phase fails.
     if (force_setup) {
+        CH_PROFILE("SolverSetup");
         timer_ls_setup.start();
         bool success = GetSolver()->Setup(*descriptor);
         timer_ls_setup.stop();
@@ -1080,9 +1110,12 @@ bool ChSystem::StateSolveCorrection(
 
     // Solve the problem
     // The solution is scattered in the provided system descriptor
-    timer_ls_solve.start();
-    GetSolver()->Solve(*descriptor);
-    timer_ls_solve.stop();
+    {
+        CH_PROFILE("SolverSolve");
+        timer_ls_solve.start();
+        GetSolver()->Solve(*descriptor);
+        timer_ls_solve.stop();
+    }
 
     // Dv and Dl vectors  <-- sparse solver structures
     IntFromDescriptor(0, Dv, 0, Dl);
@@ -1229,6 +1262,14 @@ unsigned int ChSystem::GetNumContacts() {
     return contact_container->GetNumContacts();
 }
 
+double ChSystem::GetContactMatchRate() const {
+    auto num_contacts = contact_container->GetNumContacts();
+    if (num_contacts == 0)
+        return 0;
+
+    return contact_container->GetNumContactsMatched() / (double)num_contacts;
+}
+
 double ChSystem::ComputeCollisions() {
     CH_PROFILE("ComputeCollisions");
 
@@ -1964,6 +2005,202 @@ bool ChSystem::DoStaticRelaxing(double step_size, int num_iterations) {
     return success;
 }
 
+// -----------------------------------------------------------------------------
+// State snapshots
+// -----------------------------------------------------------------------------
+
+// Snapshot data layout: header, followed by the positions, velocities, accelerations, and Lagrange multipliers of the
+// assembly, the timestepper history, the contact warm-start data, the body rotation derivatives, and the body sleeping
+// flags. The rotation derivatives are stored as quaternions: body angular velocities and accelerations are computed
+// from these, and would not be restored exactly from the velocity and acceleration state vectors.
+struct ChSnapshotHeader {
+    double time;
+    double step;
+    size_t stepcount;
+    unsigned int num_coords_pos;
+    unsigned int num_coords_vel;
+    unsigned int num_constr;
+    unsigned int num_history;
+    unsigned int num_contact_data;
+    unsigned int num_bodies;
+};
+
+template <typename T>
+static char* WriteSnapshotData(char* dst, const T* src, size_t n) {
+    if (n > 0)
+        std::memcpy(dst, src, n * sizeof(T));
+    return dst + n * sizeof(T);
+}
+
+template <typename T>
+static const char* ReadSnapshotData(const char* src, T* dst, size_t n) {
+    if (n > 0)
+        std::memcpy(dst, src, n * sizeof(T));
+    return src + n * sizeof(T);
+}
+
+std::shared_ptr<ChSystemSnapshot> ChSystem::SaveState() {
+    CH_PROFILE("SaveState");
+
+    // Make sure the system is initialized and counts and offsets reflect its current structure
+    Initialize();
+    Setup();
+
+    // Contacts come after the assembly items and are not part of the snapshot: only the assembly multipliers are saved
+    unsigned int n_x = m_num_coords_pos;
+    unsigned int n_v = m_num_coords_vel;
+    unsigned int n_L = assembly.GetNumConstraints();
+
+    ChState x(n_x, this);
+    ChStateDelta v(n_v, this);
+    ChStateDelta a(n_v, this);
+    ChVectorDynamic<> L(m_num_constr);
+    double T;
+    StateGather(x, v, T);
+    StateGatherAcceleration(a);
+    StateGatherReactions(L);
+
+    std::vector<double> history;
+    if (timestepper)
+        timestepper->SaveHistory(history);
+
+    std::vector<double> contact_data;
+    contact_container->SaveWarmStartData(contact_data);
+
+    const auto& bodies = assembly.GetBodies();
+    std::vector<double> rot_derivs(8 * bodies.size());
+    std::vector<char> sleeping(bodies.size());
+    for (size_t i = 0; i < bodies.size(); i++) {
+        const auto& q_dt = bodies[i]->GetRotDt();
+        const auto& q_dtdt = bodies[i]->GetRotDt2();
+        for (int k = 0; k < 4; k++) {
+            rot_derivs[8 * i + k] = q_dt[k];
+            rot_derivs[8 * i + 4 + k] = q_dtdt[k];
+        }
+        sleeping[i] = bodies[i]->IsSleeping() ? 1 : 0;
+    }
+
+    ChSnapshotHeader header = {ch_time,
+                               step,
+                               stepcount,
+                               n_x,
+                               n_v,
+                               n_L,
+                               (unsigned int)history.size(),
+                               (unsigned int)contact_data.size(),
+                               (unsigned int)bodies.size()};
+
+    size_t size = sizeof(header) +
+                  (n_x + 2 * n_v + n_L + history.size() + contact_data.size() + rot_derivs.size()) * sizeof(double) +
+                  sleeping.size();
+    snapshot_buffer.resize(size);
+
+    char* dst = snapshot_buffer.data();
+    dst = WriteSnapshotData(dst, &header, 1);
+    dst = WriteSnapshotData(dst, x.data(), n_x);
+    dst = WriteSnapshotData(dst, v.data(), n_v);
+    dst = WriteSnapshotData(dst, a.data(), n_v);
+    dst = WriteSnapshotData(dst, L.data(), n_L);
+    dst = WriteSnapshotData(dst, history.data(), history.size());
+    dst = WriteSnapshotData(dst, contact_data.data(), contact_data.size());
+    dst = WriteSnapshotData(dst, rot_derivs.data(), rot_derivs.size());
+    dst = WriteSnapshotData(dst, sleeping.data(), sleeping.size());
+
+    // Share unchanged pages with the last snapshot of this system
+    auto snapshot = std::shared_ptr<ChSystemSnapshot>(new ChSystemSnapshot);
+    auto base = last_snapshot.lock();
+    snapshot->Store(ch_time, snapshot_buffer, base.get());
+    last_snapshot = snapshot;
+
+    return snapshot;
+}
+
+void ChSystem::RestoreState(std::shared_ptr<ChSystemSnapshot> snapshot) {
+    CH_PROFILE("RestoreState");
+
+    snapshot->Load(snapshot_buffer);
+
+    // Check the snapshot layout against the system before changing anything
+    ChSnapshotHeader header;
+    if (snapshot_buffer.size() < sizeof(header))
+        throw std::invalid_argument("RestoreState: invalid snapshot");
+    const char* src = ReadSnapshotData(snapshot_buffer.data(), &header, 1);
+
+    size_t num_data = (size_t)header.num_coords_pos + 2 * (size_t)header.num_coords_vel + header.num_constr +
+                      header.num_history + header.num_contact_data + 8 * (size_t)header.num_bodies;
+    if (snapshot_buffer.size() != sizeof(header) + num_data * sizeof(double) + header.num_bodies)
+        throw std::invalid_argument("RestoreState: invalid snapshot");
+
+    const auto& bodies = assembly.GetBodies();
+    std::vector<double> history;
+    if (timestepper)
+        timestepper->SaveHistory(history);
+    if (header.num_bodies != bodies.size() || header.num_history != history.size())
+        throw std::invalid_argument("RestoreState: snapshot does not match the system");
+
+    // The sleeping flags (stored last) determine the number of active coordinates. Set them to check the coordinate
+    // and constraint counts, and revert them if these do not match the snapshot.
+    const char* sleeping = src + num_data * sizeof(double);
+    std::vector<char> sleeping_current(bodies.size());
+    for (size_t i = 0; i < bodies.size(); i++) {
+        sleeping_current[i] = bodies[i]->IsSleeping() ? 1 : 0;
+        bodies[i]->SetSleeping(sleeping[i] != 0);
+    }
+
+    Setup();
+    if (m_num_coords_pos != header.num_coords_pos || m_num_coords_vel != header.num_coords_vel ||
+        assembly.GetNumConstraints() != header.num_constr) {
+        for (size_t i = 0; i < bodies.size(); i++)
+            bodies[i]->SetSleeping(sleeping_current[i] != 0);
+        Setup();
+        throw std::invalid_argument("RestoreState: snapshot does not match the system");
+    }
+
+    // Remove all contacts, so that only the assembly multipliers are in the system state
+    std::vector<double> contact_data(header.num_contact_data);
+    std::vector<double> rot_derivs(8 * bodies.size());
+    const char* src_contact = sleeping - (contact_data.size() + rot_derivs.size()) * sizeof(double);
+    ReadSnapshotData(ReadSnapshotData(src_contact, contact_data.data(), contact_data.size()), rot_derivs.data(),
+                     rot_derivs.size());
+    contact_container->RestoreWarmStartData(contact_data);
+    ncontacts = contact_container->GetNumContacts();
+    if (collision_system)
+        collision_system->ClearContactCache();
+    Setup();
+
+    ChState x(header.num_coords_pos, this);
+    ChStateDelta v(header.num_coords_vel, this);
+    ChStateDelta a(header.num_coords_vel, this);
+    ChVectorDynamic<> L(header.num_constr);
+    src = ReadSnapshotData(src, x.data(), header.num_coords_pos);
+    src = ReadSnapshotData(src, v.data(), header.num_coords_vel);
+    src = ReadSnapshotData(src, a.data(), header.num_coords_vel);
+    src = ReadSnapshotData(src, L.data(), header.num_constr);
+    src = ReadSnapshotData(src, history.data(), header.num_history);
+
+    StateScatter(x, v, header.time, true);
+    StateScatterAcceleration(a);
+    StateScatterReactions(L);
+    if (timestepper)
+        timestepper->RestoreHistory(history);
+    for (size_t i = 0; i < bodies.size(); i++) {
+        const double* q = &rot_derivs[8 * i];
+        bodies[i]->SetRotDt(ChQuaternion<>(q[0], q[1], q[2], q[3]));
+        bodies[i]->SetRotDt2(ChQuaternion<>(q[4], q[5], q[6], q[7]));
+    }
+
+    // Constraint Jacobians are loaded in the solver data structures during a step and are not part of the state.
+    // Reload them at the restored state (the HHT integrator uses them at the beginning of the next step).
+    LoadConstraintJacobians();
+
+    step = header.step;
+    stepcount = header.stepcount;
+    is_updated = false;
+    applied_forces_current = false;
+
+    last_snapshot = snapshot;
+}
+
 // -----------------------------------------------------------------------------
 
 void ChSystem::ArchiveOut(ChArchiveOut& archive_out) {
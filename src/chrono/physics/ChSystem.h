@@ -30,6 +30,7 @@
 #include "chrono/utils/ChOpenMP.h"
 #include "chrono/physics/ChAssembly.h"
 #include "chrono/physics/ChContactContainer.h"
+#include "chrono/physics/ChSystemSnapshot.h"
 #include "chrono/solver/ChSystemDescriptor.h"
 #include "chrono/solver/ChSolver.h"
 #include "chrono/solver/ChIterativeSolver.h"
@@ -250,8 +251,9 @@ class ChApi ChSystem : public ChIntegrableIIorder {
 
     /// Set the number of OpenMP threads used by Chrono itself, Eigen, and the collision detection system.
     /// <pre>
-    ///   num_threads_chrono    - used in FEA (parallel evaluation of internal forces and Jacobians) and
-    ///                           in SCM deformable terrain calculations.
+    ///   num_threads_chrono    - used in FEA (parallel evaluation of internal forces and Jacobians),
+    ///                           in SCM deformable terrain calculations, and by multithreaded solvers
+    ///                           (e.g., ChSolverPSORColored, ChSolverPSORIslands).
     ///   num_threads_collision - used in parallelization of collision detection (if applicable).
     ///                           If passing 0, then num_threads_collision = num_threads_chrono.
     ///   num_threads_eigen     - used in the Eigen sparse direct solvers and a few linear algebra operations.
@@ -270,6 +272,16 @@ class ChApi ChSystem : public ChIntegrableIIorder {
     unsigned int GetNumThreadsCollision() const { return nthreads_collision; }
     unsigned int GetNumThreadsEigen() const { return nthreads_eigen; }
 
+    /// Enable or disable deterministic multithreaded stepping (default: false).
+    /// If enabled, parallel code paths which accumulate or insert data in an order that depends on thread scheduling
+    /// (e.g., FEA residual assembly, SCM ray casting, the Chrono::Multicore SMC force reduction) use a fixed order, so
+    /// that the simulation results are bitwise identical for any number of threads. Code paths that are already
+    /// independent of the number of threads are not affected. This may incur a small performance penalty.
+    virtual void SetDeterministic(bool val) { deterministic = val; }
+
+    /// Return true if deterministic multithreaded stepping is enabled.
+    bool IsDeterministic() const { return deterministic; }
+
     // DATABASE HANDLING
 
     /// Get the underlying assembly containing all physics items.
@@ -479,6 +491,10 @@ class ChApi ChSystem : public ChIntegrableIIorder {
     /// Gets the number of contacts.
     virtual unsigned int GetNumContacts();
 
+    /// Return the fraction of contacts, at the last collision detection, that were matched with a contact from the
+    /// previous step (see ChContactContainerNSC::EnableContactPersistence).
+    double GetContactMatchRate() const;
+
     /// Return the time (in seconds) spent for computing the time step.
     virtual double GetTimerStep() const { return timer_step(); }
     /// Return the time (in seconds) for time integration, within the time step.
@@ -572,6 +588,29 @@ class ChApi ChSystem : public ChIntegrableIIorder {
     /// This is the Jacobian Cq=-dC/dq, where C are constraints (the lower left part of the KKT matrix).
     void GetConstraintJacobianMatrix(ChSparseMatrix& Cq);
 
+    // ---- STATE SNAPSHOTS
+
+    /// Save the current state of the system in memory and return a handle to the snapshot.
+    /// The snapshot includes the simulation time, the positions, velocities, and accelerations of all items, the
+    /// Lagrange multipliers of links and other constraints (used by the solver for warm start), the sleeping flags of
+    /// the bodies, the contact data used for warm start at the next step (if contact persistence is enabled), and the
+    /// history of the timestepper (e.g., the adaptive step size of HHT).
+    /// Data equal to that of the previous snapshot of this system is shared rather than copied (see ChSystemSnapshot).
+    /// Unlike serialization, no object is created or destroyed: a snapshot can only be restored in a system with the
+    /// same structure.
+    /// Note that, as at the beginning of a step, the system is initialized if needed (see Initialize) and its counts
+    /// and offsets are updated (see Setup) before the state is saved.
+    std::shared_ptr<ChSystemSnapshot> SaveState();
+
+    /// Restore the state of the system from a snapshot created with SaveState.
+    /// The snapshot can be taken from this system or from a copy of it; in both cases, the system must have the same
+    /// items, with the same numbers of coordinates and constraints, as when the snapshot was taken. Otherwise, an
+    /// exception is thrown and the system is left unchanged. All current contacts are removed and the contact data
+    /// cached by the collision system is discarded: contacts are recomputed from the restored positions at the next
+    /// step. Contact warm-start data identifies collision shapes by their address: it is only used if the snapshot is
+    /// restored in the system from which it was taken (in a copy, no contact is matched at the next step).
+    void RestoreState(std::shared_ptr<ChSystemSnapshot> snapshot);
+
     // ---- SERIALIZATION
 
     /// Method to allow serialization of transient data to archives.
@@ -780,6 +819,8 @@ class ChApi ChSystem : public ChIntegrableIIorder {
     virtual ChVector3d GetBodyAppliedTorque(ChBody* body);
 
     /// Put bodies to sleep if possible. Also awakens sleeping bodies, if needed.
+    /// Bodies connected by links or contacts form islands, which are put to sleep or woken up as a whole.
+    /// Islands with a body linked to a fixed body are always awake.
     /// Returns true if some body changed from sleep to no sleep or viceversa,
     /// returns false if nothing changed. In the former case also performs Setup()
     /// since the system changed.
@@ -833,6 +874,7 @@ class ChApi ChSystem : public ChIntegrableIIorder {
     int nthreads_chrono;
     int nthreads_eigen;
     int nthreads_collision;
+    bool deterministic;  ///< enforce results independent of the number of threads
 
     // timers for profiling execution speed
     ChTimer timer_step;       ///< timer for integration step
@@ -850,6 +892,9 @@ class ChApi ChSystem : public ChIntegrableIIorder {
     ChVectorDynamic<> applied_forces;  ///< system-wide vector of applied forces (lazy evaluation)
     bool applied_forces_current;       ///< indicates if system-wide vector of forces is up-to-date
 
+    std::weak_ptr<ChSystemSnapshot> last_snapshot;  ///< last snapshot saved or restored (base for page sharing)
+    std::vector<char> snapshot_buffer;              ///< work buffer for state snapshots
+
     // Friend class declarations
 
     friend class ChAssembly;
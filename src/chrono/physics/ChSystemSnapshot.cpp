@@ -0,0 +1,58 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cstring>
+
+#include "chrono/physics/ChSystemSnapshot.h"
+
+namespace chrono {
+
+void ChSystemSnapshot::Store(double time, const std::vector<char>& buffer, const ChSystemSnapshot* base) {
+    m_time = time;
+    m_size = buffer.size();
+    m_num_shared = 0;
+
+    size_t num_pages = (m_size + page_size - 1) / page_size;
+    m_pages.resize(num_pages);
+
+    for (size_t i = 0; i < num_pages; i++) {
+        const char* src = buffer.data() + i * page_size;
+        size_t n = std::min(page_size, m_size - i * page_size);
+
+        // Share the page of the base snapshot if its contents did not change (a partial last page is zero-padded)
+        if (base && i < base->m_pages.size()) {
+            const char* other = base->m_pages[i]->data;
+            if (std::memcmp(src, other, n) == 0 &&
+                std::all_of(other + n, other + page_size, [](char c) { return c == 0; })) {
+                m_pages[i] = base->m_pages[i];
+                m_num_shared++;
+                continue;
+            }
+        }
+
+        auto page = std::make_shared<Page>();
+        std::memcpy(page->data, src, n);
+        std::memset(page->data + n, 0, page_size - n);
+        m_pages[i] = page;
+    }
+}
+
+void ChSystemSnapshot::Load(std::vector<char>& buffer) const {
+    buffer.resize(m_size);
+    for (size_t i = 0; i < m_pages.size(); i++) {
+        size_t n = std::min(page_size, m_size - i * page_size);
+        std::memcpy(buffer.data() + i * page_size, m_pages[i]->data, n);
+    }
+}
+
+}  // end namespace chrono
@@ -0,0 +1,73 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#ifndef CH_SYSTEM_SNAPSHOT_H
+#define CH_SYSTEM_SNAPSHOT_H
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "chrono/core/ChApiCE.h"
+
+namespace chrono {
+
+/// In-memory snapshot of the state of a ChSystem, created with ChSystem::SaveState and restored with
+/// ChSystem::RestoreState.
+/// The snapshot data is a flat binary buffer, stored in fixed-size pages. A page with the same contents as the
+/// corresponding page of the previous snapshot of the same system is shared with it (copy-on-write), so that a long
+/// history of snapshots in which most of the state does not change (e.g., bodies at rest) requires little memory.
+/// A snapshot is immutable and can be restored any number of times, also in a copy of the system it was taken from.
+class ChApi ChSystemSnapshot {
+  public:
+    /// Size of a page of snapshot data (in bytes).
+    static constexpr size_t page_size = 4096;
+
+    /// Return the simulation time at which the snapshot was taken.
+    double GetChTime() const { return m_time; }
+
+    /// Return the size of the snapshot data (in bytes).
+    size_t GetSize() const { return m_size; }
+
+    /// Return the number of pages of snapshot data.
+    size_t GetNumPages() const { return m_pages.size(); }
+
+    /// Return the number of pages shared with the previous snapshot.
+    size_t GetNumSharedPages() const { return m_num_shared; }
+
+    /// Return the memory used by the pages not shared with the previous snapshot (in bytes).
+    size_t GetMemorySize() const { return (m_pages.size() - m_num_shared) * page_size; }
+
+  private:
+    struct Page {
+        char data[page_size];
+    };
+
+    ChSystemSnapshot() : m_time(0), m_size(0), m_num_shared(0) {}
+
+    /// Store the given data, sharing the pages equal to the corresponding pages of the base snapshot (if any).
+    void Store(double time, const std::vector<char>& buffer, const ChSystemSnapshot* base);
+
+    /// Copy the snapshot data into the given buffer.
+    void Load(std::vector<char>& buffer) const;
+
+    double m_time;                                     ///< simulation time
+    size_t m_size;                                     ///< size of snapshot data
+    size_t m_num_shared;                               ///< number of pages shared with the base snapshot
+    std::vector<std::shared_ptr<const Page>> m_pages;  ///< snapshot data
+
+    friend class ChSystem;
+};
+
+}  // end namespace chrono
+
+#endif
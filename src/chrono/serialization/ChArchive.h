@@ -763,6 +763,29 @@ class _wrap_pair {
     std::pair<T, Tv>* _wpair;
 };
 
+/// Traits of types whose arrays can be archived as contiguous blocks of raw data (see ChArchiveOut::out_array_raw).
+/// - value: true if arrays of T can be archived as raw blocks (T trivially copyable, without padding)
+/// - scalar_size: size of the scalars making up T (used for byte-order conversion)
+/// - compound: true if T is made of several scalars, in which case the raw block differs from element-wise output
+/// Specializations are provided for arithmetic types (except bool) and for ChVector3 and ChQuaternion.
+template <class T>
+struct ChArchiveBlockTraits {
+    static const bool value = std::is_arithmetic<T>::value && !std::is_same<T, bool>::value;
+    static const size_t scalar_size = sizeof(T);
+    static const bool compound = false;
+};
+
+/// Return a pointer to the data of a std::vector archived as a raw block, or nullptr if not supported.
+template <class T>
+typename std::enable_if<ChArchiveBlockTraits<T>::value, T*>::type ChArchiveBlockData(std::vector<T>& vec) {
+    return vec.data();
+}
+
+template <class T>
+typename std::enable_if<!ChArchiveBlockTraits<T>::value, T*>::type ChArchiveBlockData(std::vector<T>& vec) {
+    return nullptr;
+}
+
 /// Base class for archives with pointers to shared objects.
 class ChApi ChArchive {
   protected:
@@ -888,6 +911,27 @@ class ChApi ChArchiveOut : public ChArchive {
     virtual void out_array_between(ChValue& bVal, size_t msize) = 0;
     virtual void out_array_end(ChValue& bVal, size_t msize) = 0;
 
+    /// Write an array of 'msize' elements of 'elem_size' bytes each, stored contiguously, as a single raw block.
+    /// This replaces the out_array_pre/between/end sequence for arrays of types with ChArchiveBlockTraits.
+    /// Return false, without writing anything, if the archive does not support raw blocks; the array must then be
+    /// written element by element.
+    virtual bool out_array_raw(ChValue& bVal,
+                               const void* data,
+                               size_t msize,
+                               size_t elem_size,
+                               size_t scalar_size,
+                               bool compound) {
+        return false;
+    }
+
+    /// Write a contiguous array as a single raw block, if supported by the element type and by the archive.
+    template <class T>
+    bool out_array_block(ChValue& bVal, const T* data, size_t msize) {
+        return data && ChArchiveBlockTraits<T>::value &&
+               this->out_array_raw(bVal, data, msize, sizeof(T), ChArchiveBlockTraits<T>::scalar_size,
+                                   ChArchiveBlockTraits<T>::compound);
+    }
+
     //---------------------------------------------------
 
     // trick to wrap enum mappers:
@@ -904,6 +948,8 @@ class ChApi ChArchiveOut : public ChArchive {
         size_t arraysize = sizeof(bVal.value()) / sizeof(T);
         ChValueSpecific<T[N]> specVal(bVal.value(), bVal.name(), bVal.flags(), bVal.GetCausality(),
                                       bVal.GetVariability());
+        if (this->out_array_block(specVal, &bVal.value()[0], arraysize))
+            return;
         this->out_array_pre(specVal, arraysize);
         for (size_t i = 0; i < arraysize; ++i) {
             ChNameValue<T> array_val(std::to_string(i), bVal.value()[i]);
@@ -918,6 +964,8 @@ class ChApi ChArchiveOut : public ChArchive {
     void out(ChNameValue<std::vector<T>> bVal) {
         ChValueSpecific<std::vector<T>> specVal(bVal.value(), bVal.name(), bVal.flags(), bVal.GetCausality(),
                                                 bVal.GetVariability());
+        if (this->out_array_block(specVal, ChArchiveBlockData(bVal.value()), bVal.value().size()))
+            return;
         this->out_array_pre(specVal, bVal.value().size());
         for (size_t i = 0; i < bVal.value().size(); ++i) {
             ChNameValue<T> array_val(std::to_string(i), bVal.value()[i]);
@@ -1175,6 +1223,27 @@ class ChApi ChArchiveIn : public ChArchive {
     virtual void in_array_between(const std::string& name) = 0;
     virtual void in_array_end(const std::string& name) = 0;
 
+    /// Read the elements of an array, after in_array_pre, as a single raw block (see ChArchiveOut::out_array_raw).
+    /// Return false, without reading anything, if the archive does not support raw blocks or if the array was
+    /// written element by element; the array must then be read element by element.
+    virtual bool in_array_raw(const std::string& name,
+                              void* data,
+                              size_t msize,
+                              size_t elem_size,
+                              size_t scalar_size,
+                              bool compound) {
+        return false;
+    }
+
+    /// Read the elements of a contiguous array as a single raw block, if supported by the element type and by the
+    /// archive.
+    template <class T>
+    bool in_array_block(const std::string& name, T* data, size_t msize) {
+        return data && ChArchiveBlockTraits<T>::value &&
+               this->in_array_raw(name, data, msize, sizeof(T), ChArchiveBlockTraits<T>::scalar_size,
+                                  ChArchiveBlockTraits<T>::compound);
+    }
+
     //---------------------------------------------------
 
     // trick to wrap enum mappers:
@@ -1195,6 +1264,10 @@ class ChApi ChArchiveIn : public ChArchive {
             throw std::runtime_error("Size of [] saved array does not match size of receiver array " +
                                      std::string(bVal.name()) + ".");
         }
+        if (this->in_array_block(bVal.name(), &bVal.value()[0], arraysize)) {
+            this->in_array_end(bVal.name());
+            return true;
+        }
         for (size_t i = 0; i < arraysize; ++i) {
             T element;
             ChNameValue<T> array_val(std::to_string(i), element);
@@ -1214,6 +1287,10 @@ class ChApi ChArchiveIn : public ChArchive {
         if (!this->in_array_pre(bVal.name(), arraysize))  // TODO: DARIOM check why it was commented out
             return false;
         bVal.value().resize(arraysize);
+        if (this->in_array_block(bVal.name(), ChArchiveBlockData(bVal.value()), arraysize)) {
+            this->in_array_end(bVal.name());
+            return true;
+        }
         for (size_t i = 0; i < arraysize; ++i) {
             T element;
             ChNameValue<T> array_val(std::to_string(i), element);
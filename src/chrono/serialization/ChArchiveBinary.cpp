@@ -1,7 +1,12 @@
+#include <algorithm>
+
 #include "chrono/serialization/ChArchiveBinary.h"
 
 namespace chrono {
 
+// Flag set in the size of arrays of compound elements written as raw blocks
+static const size_t raw_array_flag = (size_t)1 << (8 * sizeof(size_t) - 1);
+
 ChArchiveOutBinary::ChArchiveOutBinary(std::ostream& stream_out) : m_ostream(stream_out) {}
 
 ChArchiveOutBinary::~ChArchiveOutBinary() {}
@@ -59,6 +64,17 @@ void ChArchiveOutBinary::out_array_between(ChValue& bVal, size_t size) {}
 
 void ChArchiveOutBinary::out_array_end(ChValue& bVal, size_t size) {}
 
+bool ChArchiveOutBinary::out_array_raw(ChValue& bVal,
+                                       const void* data,
+                                       size_t size,
+                                       size_t elem_size,
+                                       size_t scalar_size,
+                                       bool compound) {
+    write(compound ? (size | raw_array_flag) : size);
+    m_ostream.write(static_cast<const char*>(data), size * elem_size);
+    return true;
+}
+
 // for custom c++ objects:
 
 void ChArchiveOutBinary::out(ChValue& bVal, bool tracked, size_t obj_ID) {
@@ -123,7 +139,7 @@ std::ostream& ChArchiveOutBinary::write(const char* val) {
 }
 
 // for wrapping arrays and lists
-ChArchiveInBinary::ChArchiveInBinary(std::istream& stream_in) : m_istream(stream_in) {
+ChArchiveInBinary::ChArchiveInBinary(std::istream& stream_in) : m_istream(stream_in), m_raw_array(false) {
     can_tolerate_missing_tokens = false;
 
     union {
@@ -183,6 +199,30 @@ bool ChArchiveInBinary::in(ChNameValue<unsigned long long> bVal) {
 
 bool ChArchiveInBinary::in_array_pre(const std::string& name, size_t& size) {
     read(size);
+    m_raw_array = (size & raw_array_flag) != 0;
+    size &= ~raw_array_flag;
+    return true;
+}
+
+bool ChArchiveInBinary::in_array_raw(const std::string& name,
+                                     void* data,
+                                     size_t size,
+                                     size_t elem_size,
+                                     size_t scalar_size,
+                                     bool compound) {
+    // Arrays of compound elements may have been written element by element
+    if (compound && !m_raw_array)
+        return false;
+    m_raw_array = false;
+
+    char* bytes = static_cast<char*>(data);
+    m_istream.read(bytes, size * elem_size);
+
+    if (m_big_endian_machine && scalar_size > 1) {
+        for (size_t i = 0; i < size * elem_size; i += scalar_size)
+            std::reverse(bytes + i, bytes + i + scalar_size);
+    }
+
     return true;
 }
 
@@ -45,6 +45,9 @@ inline void StreamSwapBytes(T* ptData) {
 /// \endcode
 /// Remember to set stream mode to `std::ios::binary`.
 /// Data will always be written with little-endianness even in big-endian machines.
+/// Arrays of arithmetic types, ChVector3, and ChQuaternion stored contiguously (std::vector, C arrays, Eigen matrices)
+/// are written as single raw blocks. For arithmetic types, the raw block is identical to element-wise output; for
+/// compound types, the array size is tagged so that archives with element-wise arrays remain readable.
 class ChApi ChArchiveOutBinary : public ChArchiveOut {
   public:
     ChArchiveOutBinary(std::ostream& stream_out);
@@ -68,6 +71,13 @@ class ChApi ChArchiveOutBinary : public ChArchiveOut {
     virtual void out_array_between(ChValue& bVal, size_t size);
     virtual void out_array_end(ChValue& bVal, size_t size);
 
+    virtual bool out_array_raw(ChValue& bVal,
+                               const void* data,
+                               size_t size,
+                               size_t elem_size,
+                               size_t scalar_size,
+                               bool compound);
+
     // for custom c++ objects:
     virtual void out(ChValue& bVal, bool tracked, size_t obj_ID);
 
@@ -128,6 +138,13 @@ class ChApi ChArchiveInBinary : public ChArchiveIn {
     virtual void in_array_between(const std::string& name) override {}
     virtual void in_array_end(const std::string& name) override {}
 
+    virtual bool in_array_raw(const std::string& name,
+                              void* data,
+                              size_t size,
+                              size_t elem_size,
+                              size_t scalar_size,
+                              bool compound) override;
+
     // for custom c++ objects
     virtual bool in(ChNameValue<ChFunctorArchiveIn> bVal) override;
 
@@ -136,6 +153,7 @@ class ChApi ChArchiveInBinary : public ChArchiveIn {
   protected:
     std::istream& m_istream;
     bool m_big_endian_machine;
+    bool m_raw_array;  ///< true if the last array header announced a raw block of compound elements
 
     template <typename T>
     std::istream& read(T& val) {
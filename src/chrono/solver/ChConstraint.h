@@ -21,6 +21,8 @@
 
 namespace chrono {
 
+class ChPackedConstraints;
+
 /// Base class for representing constraints (bilateral or unilateral).
 /// These constraints are used with variational inequality or DAE solvers for problems including equalities,
 /// inequalities, nonlinearities, etc.
@@ -226,6 +228,12 @@ class ChApi ChConstraint {
                                              unsigned int start_row,
                                              unsigned int start_col) const = 0;
 
+    /// Append the Jacobian blocks [Cq_i] and the auxiliary blocks [Eq_i] of this constraint to a packed representation.
+    /// This function is called by ChSystemDescriptor::PackConstraints, after Update_auxiliary(), for active constraints.
+    /// Return false if the constraint does not support packing (default), in which case solvers fall back to the
+    /// virtual interface.
+    virtual bool PackJacobian(ChPackedConstraints& packed) const { return false; }
+
     /// Set offset in global q vector (set automatically by ChSystemDescriptor)
     void SetOffset(unsigned int off) { offset = off; }
 
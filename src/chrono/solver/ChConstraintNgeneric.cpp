@@ -13,6 +13,7 @@
 // =============================================================================
 
 #include "chrono/solver/ChConstraintNgeneric.h"
+#include "chrono/solver/ChPackedConstraints.h"
 
 namespace chrono {
 
@@ -138,6 +139,14 @@ void ChConstraintNgeneric::PasteJacobianTransposedInto(ChSparseMatrix& mat,
     }
 }
 
+bool ChConstraintNgeneric::PackJacobian(ChPackedConstraints& packed) const {
+    for (size_t i = 0; i < variables.size(); ++i) {
+        if (variables[i]->IsActive())
+            packed.AddBlock(variables[i]->GetOffset(), Cq[i], Eq[i]);
+    }
+    return true;
+}
+
 void ChConstraintNgeneric::ArchiveOut(ChArchiveOut& archive_out) {
     // version number
     archive_out.VersionWrite<ChConstraintNgeneric>();
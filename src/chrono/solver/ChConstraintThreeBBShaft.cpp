@@ -13,6 +13,7 @@
 // =============================================================================
 
 #include "chrono/solver/ChConstraintThreeBBShaft.h"
+#include "chrono/solver/ChPackedConstraints.h"
 
 namespace chrono {
 
@@ -185,6 +186,16 @@ void ChConstraintThreeBBShaft::PasteJacobianTransposedInto(ChSparseMatrix& mat,
         PasteMatrix(mat, Cq_c.transpose(), variables_c->GetOffset() + start_row, start_col);
 }
 
+bool ChConstraintThreeBBShaft::PackJacobian(ChPackedConstraints& packed) const {
+    if (variables_a->IsActive())
+        packed.AddBlock(variables_a->GetOffset(), Cq_a, Eq_a);
+    if (variables_b->IsActive())
+        packed.AddBlock(variables_b->GetOffset(), Cq_b, Eq_b);
+    if (variables_c->IsActive())
+        packed.AddBlock(variables_c->GetOffset(), Cq_c, Eq_c);
+    return true;
+}
+
 void ChConstraintThreeBBShaft::ArchiveOut(ChArchiveOut& archive_out) {
     // version number
     archive_out.VersionWrite<ChConstraintThreeBBShaft>();
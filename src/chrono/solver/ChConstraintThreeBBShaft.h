@@ -96,6 +96,9 @@ class ChApi ChConstraintThreeBBShaft : public ChConstraintThree {
                                              unsigned int start_row,
                                              unsigned int start_col) const override;
 
+    /// Append the Jacobian blocks of this constraint to a packed representation.
+    virtual bool PackJacobian(ChPackedConstraints& packed) const override;
+
     /// Method to allow serialization of transient data to archives.
     virtual void ArchiveOut(ChArchiveOut& archive_out) override;
 
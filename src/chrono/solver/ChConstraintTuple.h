@@ -17,6 +17,7 @@
 
 #include "chrono/solver/ChConstraint.h"
 #include "chrono/solver/ChVariables.h"
+#include "chrono/solver/ChPackedConstraints.h"
 
 namespace chrono {
 
@@ -122,6 +123,11 @@ class ChConstraintTuple_1vars {
         if (variables->IsActive())
             PasteMatrix(mat, Cq.transpose(), variables->GetOffset() + start_row, start_col);
     }
+
+    void PackJacobian(ChPackedConstraints& packed) const {
+        if (variables->IsActive())
+            packed.AddBlock(variables->GetOffset(), Cq, Eq);
+    }
 };
 
 /// Case of tuple with reference to 2 ChVariable objects:
@@ -263,6 +269,19 @@ class ChConstraintTuple_2vars {
         if (variables_2->IsActive())
             PasteMatrix(mat, Cq_2.transpose(), variables_2->GetOffset() + start_row, start_col);
     }
+
+    void PackJacobian(ChPackedConstraints& packed) const {
+        // blocks of a tuple are accumulated in a single partial sum (see ComputeJacobianTimesState)
+        bool new_group = true;
+        if (variables_1->IsActive()) {
+            packed.AddBlock(variables_1->GetOffset(), Cq_1, Eq_1, new_group);
+            new_group = false;
+        }
+        if (variables_2->IsActive()) {
+            packed.AddBlock(variables_2->GetOffset(), Cq_2, Eq_2, new_group);
+            new_group = false;
+        }
+    }
 };
 
 /// Case of tuple with reference to 3 ChVariable objects:
@@ -444,6 +463,23 @@ class ChConstraintTuple_3vars {
         if (variables_3->IsActive())
             PasteMatrix(mat, Cq_3.transpose(), variables_3->GetOffset() + start_row, start_col);
     }
+
+    void PackJacobian(ChPackedConstraints& packed) const {
+        // blocks of a tuple are accumulated in a single partial sum (see ComputeJacobianTimesState)
+        bool new_group = true;
+        if (variables_1->IsActive()) {
+            packed.AddBlock(variables_1->GetOffset(), Cq_1, Eq_1, new_group);
+            new_group = false;
+        }
+        if (variables_2->IsActive()) {
+            packed.AddBlock(variables_2->GetOffset(), Cq_2, Eq_2, new_group);
+            new_group = false;
+        }
+        if (variables_3->IsActive()) {
+            packed.AddBlock(variables_3->GetOffset(), Cq_3, Eq_3, new_group);
+            new_group = false;
+        }
+    }
 };
 
 /// Case of tuple with reference to 4 ChVariable objects:
@@ -666,6 +702,27 @@ class ChConstraintTuple_4vars {
         if (variables_4->IsActive())
             PasteMatrix(mat, Cq_4.transpose(), variables_4->GetOffset() + start_row, start_col);
     }
+
+    void PackJacobian(ChPackedConstraints& packed) const {
+        // blocks of a tuple are accumulated in a single partial sum (see ComputeJacobianTimesState)
+        bool new_group = true;
+        if (variables_1->IsActive()) {
+            packed.AddBlock(variables_1->GetOffset(), Cq_1, Eq_1, new_group);
+            new_group = false;
+        }
+        if (variables_2->IsActive()) {
+            packed.AddBlock(variables_2->GetOffset(), Cq_2, Eq_2, new_group);
+            new_group = false;
+        }
+        if (variables_3->IsActive()) {
+            packed.AddBlock(variables_3->GetOffset(), Cq_3, Eq_3, new_group);
+            new_group = false;
+        }
+        if (variables_4->IsActive()) {
+            packed.AddBlock(variables_4->GetOffset(), Cq_4, Eq_4, new_group);
+            new_group = false;
+        }
+    }
 };
 
 /// This is a set of 'helper' classes that make easier to manage the templated
@@ -13,6 +13,7 @@
 // =============================================================================
 
 #include "chrono/solver/ChConstraintTwoBodies.h"
+#include "chrono/solver/ChPackedConstraints.h"
 
 namespace chrono {
 
@@ -155,6 +156,14 @@ void ChConstraintTwoBodies::PasteJacobianTransposedInto(ChSparseMatrix& mat, uns
         PasteMatrix(mat, Cq_b.transpose(), variables_b->GetOffset() + start_row, start_col);
 }
 
+bool ChConstraintTwoBodies::PackJacobian(ChPackedConstraints& packed) const {
+    if (variables_a->IsActive())
+        packed.AddBlock(variables_a->GetOffset(), Cq_a, Eq_a);
+    if (variables_b->IsActive())
+        packed.AddBlock(variables_b->GetOffset(), Cq_b, Eq_b);
+    return true;
+}
+
 void ChConstraintTwoBodies::ArchiveOut(ChArchiveOut& archive_out) {
     // version number
     archive_out.VersionWrite<ChConstraintTwoBodies>();
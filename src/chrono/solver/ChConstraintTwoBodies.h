@@ -92,6 +92,9 @@ class ChApi ChConstraintTwoBodies : public ChConstraintTwo {
                                              unsigned int start_row,
                                              unsigned int start_col) const override;
 
+    /// Append the Jacobian blocks of this constraint to a packed representation.
+    virtual bool PackJacobian(ChPackedConstraints& packed) const override;
+
     /// Method to allow serialization of transient data to archives.
     virtual void ArchiveOut(ChArchiveOut& archive_out) override;
 
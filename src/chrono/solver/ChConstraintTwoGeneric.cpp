@@ -13,6 +13,7 @@
 // =============================================================================
 
 #include "chrono/solver/ChConstraintTwoGeneric.h"
+#include "chrono/solver/ChPackedConstraints.h"
 
 namespace chrono {
 
@@ -151,6 +152,14 @@ void ChConstraintTwoGeneric::PasteJacobianTransposedInto(ChSparseMatrix& mat, un
         PasteMatrix(mat, Cq_b.transpose(), variables_b->GetOffset() + start_row, start_col);
 }
 
+bool ChConstraintTwoGeneric::PackJacobian(ChPackedConstraints& packed) const {
+    if (variables_a->IsActive())
+        packed.AddBlock(variables_a->GetOffset(), Cq_a, Eq_a);
+    if (variables_b->IsActive())
+        packed.AddBlock(variables_b->GetOffset(), Cq_b, Eq_b);
+    return true;
+}
+
 void ChConstraintTwoGeneric::ArchiveOut(ChArchiveOut& archive_out) {
     // version number
     archive_out.VersionWrite<ChConstraintTwoGeneric>();
@@ -72,6 +72,9 @@ class ChApi ChConstraintTwoGenericBoxed : public ChConstraintTwoGeneric {
     /// violation of the constraint, considering inequalities, etc.
     virtual double Violation(double mc_i) override;
 
+    /// Boxed constraints use their own projection, so packing is not supported.
+    virtual bool PackJacobian(ChPackedConstraints& packed) const override { return false; }
+
     /// Method to allow serialization of transient data to archives.
     virtual void ArchiveOut(ChArchiveOut& archive_out) override;
 
@@ -120,6 +120,13 @@ class ChConstraintTwoTuples : public ChConstraint {
         tuple_a.PasteJacobianTransposedInto(mat, start_row, start_col);
         tuple_b.PasteJacobianTransposedInto(mat, start_row, start_col);
     }
+
+    /// Append the Jacobian blocks of this constraint to a packed representation.
+    virtual bool PackJacobian(ChPackedConstraints& packed) const override {
+        tuple_a.PackJacobian(packed);
+        tuple_b.PackJacobian(packed);
+        return true;
+    }
 };
 
 }  // end namespace chrono
@@ -97,6 +97,15 @@ class ChApi ChConstraintTwoTuplesContactN : public ChConstraintTwoTuples<Ta, Tb>
     /// Set pointer to V tangential component
     void SetTangentialConstraintV(ChConstraintTwoTuplesFrictionT<Ta, Tb>* mconstr) { constraint_V = mconstr; }
 
+    /// Append the Jacobian blocks of this constraint to a packed representation.
+    /// The normal component also carries the friction cone projection for the triplet.
+    virtual bool PackJacobian(ChPackedConstraints& packed) const override {
+        ChConstraintTwoTuples<Ta, Tb>::PackJacobian(packed);
+        if (constraint_U && constraint_V)
+            packed.SetFrictionCone(friction, cohesion);
+        return true;
+    }
+
     /// Project the value of a possible 'l_i' value of constraint reaction onto admissible set.
     /// This will also modify the l_i values of the two tangential friction constraints
     /// (projection onto the friction cone, as by Anitescu-Tasora theory).
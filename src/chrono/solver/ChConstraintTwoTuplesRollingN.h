@@ -103,6 +103,9 @@ class ChApi ChConstraintTwoTuplesRollingN : public ChConstraintTwoTuples<Ta, Tb>
     /// Set pointer to normal contact component
     void SetNormalConstraint(ChConstraintTwoTuplesContactN<Ta, Tb>* mconstr) { constraint_N = mconstr; }
 
+    /// Rolling and spinning friction use their own projection, so packing is not supported.
+    virtual bool PackJacobian(ChPackedConstraints& packed) const override { return false; }
+
     /// For iterative solvers: project the value of a possible
     /// 'l_i' value of constraint reaction onto admissible set.
     /// This projection will also modify the l_i values of the two
@@ -59,6 +59,10 @@ class ChApi ChConstraintTwoTuplesRollingT : public ChConstraintTwoTuples<Ta, Tb>
 
     /// The constraint is satisfied?
     virtual double Violation(double mc_i) override { return 0.0; }
+
+    /// Rolling friction components are projected by the companion ChConstraintTwoTuplesRollingN, so packing is not
+    /// supported.
+    virtual bool PackJacobian(ChPackedConstraints& packed) const override { return false; }
 };
 
 }  // end namespace chrono
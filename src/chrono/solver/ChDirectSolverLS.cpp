@@ -26,6 +26,11 @@ ChDirectSolverLS::ChDirectSolverLS()
     : m_lock(false),
       m_use_learner(true),
       m_force_update(true),
+      m_use_pattern_cache(false),
+      m_pattern_changed(true),
+      m_pattern_hash(0),
+      m_pattern_hits(0),
+      m_pattern_misses(0),
       m_null_pivot_detection(false),
       m_use_rhs_sparsity(false),
       m_use_perm(false),
@@ -49,22 +54,28 @@ bool ChDirectSolverLS::Setup(ChSystemDescriptor& sysd) {
     // Note that ChSystemDescriptor::UpdateCountsAndOffsets was already called at the beginning of the step.
     m_dim = sysd.CountActiveVariables() + sysd.CountActiveConstraints();
 
+    // If the sparsity pattern cache is enabled, assemble in the existing matrix structure if:
+    // (a) no explicit update was requested, and
+    // (b) a matrix of the same size was assembled at a previous call
+    bool reuse_pattern = m_use_pattern_cache && !m_force_update && m_setup_call > 0 && m_mat.rows() == m_dim;
+
     // If use of the sparsity pattern learner is enabled, call it if:
     // (a) an explicit update was requested (by default this is true at the first call), or
     // (b) the sparsity pattern is not locked and so has to be re-evaluated at each call
-    bool call_learner = m_use_learner && (m_force_update || !m_lock);
+    bool call_learner = !reuse_pattern && m_use_learner && (m_force_update || !m_lock);
 
     // If use of the sparsity pattern learner is disabled, reserve space for nonzeros,
     // using the current sparsity level estimate, if:
     // (a) this is the first call to setup, or
     // (b) the sparsity pattern is not locked and so has to be re-evaluated at each call
-    bool call_reserve = !m_use_learner && (m_setup_call == 0 || !m_lock);
+    bool call_reserve = !reuse_pattern && !m_use_learner && (m_setup_call == 0 || !m_lock);
 
     if (verbose) {
         std::cout << "Solver setup" << std::endl;
         std::cout << "  call number:    " << m_setup_call << std::endl;
         std::cout << "  use learner?    " << m_use_learner << std::endl;
         std::cout << "  pattern locked? " << m_lock << std::endl;
+        std::cout << "  reuse pattern:  " << reuse_pattern << std::endl;
         std::cout << "  CALL learner:   " << call_learner << std::endl;
         std::cout << "  CALL reserve:   " << call_reserve << std::endl;
     }
@@ -86,6 +97,9 @@ bool ChDirectSolverLS::Setup(ChSystemDescriptor& sysd) {
     // Allow the matrix to be compressed
     m_mat.makeCompressed();
 
+    // Check for changes in the sparsity pattern
+    UpdatePatternFingerprint();
+
     m_timer_setup_assembly.stop();
 
     if (write_matrix)
@@ -101,7 +115,7 @@ bool ChDirectSolverLS::Setup(ChSystemDescriptor& sysd) {
 
     if (verbose) {
         std::cout << " Solver setup [" << m_setup_call << "] n = " << m_dim << "  nnz = " << (int)m_mat.nonZeros()
-                  << std::endl;
+                  << "  pattern changed? " << m_pattern_changed << std::endl;
         std::cout << "  assembly matrix:   " << m_timer_setup_assembly.GetTimeSeconds() << "s\n"
                   << "  analyze+factorize: " << m_timer_setup_solvercall.GetTimeSeconds() << "s"
                   << std::endl;
@@ -165,6 +179,9 @@ bool ChDirectSolverLS::SetupCurrent() {
     // Allow the matrix to be compressed, if not yet compressed
     m_mat.makeCompressed();
 
+    // Check for changes in the sparsity pattern
+    UpdatePatternFingerprint();
+
     m_timer_setup_assembly.stop();
 
     // Let the concrete solver perform the factorization
@@ -220,6 +237,29 @@ double ChDirectSolverLS::SolveCurrent() {
     return result;
 }
 
+void ChDirectSolverLS::UpdatePatternFingerprint() {
+    // FNV-1a hash of the matrix dimensions and of the compressed storage index arrays
+    size_t hash = 14695981039346656037ULL;
+    auto combine = [&hash](size_t val) { hash = (hash ^ val) * 1099511628211ULL; };
+
+    combine(m_mat.rows());
+    combine(m_mat.cols());
+    const int* outer = m_mat.outerIndexPtr();
+    for (int i = 0; i <= m_mat.outerSize(); i++)
+        combine(outer[i]);
+    const int* inner = m_mat.innerIndexPtr();
+    for (int k = 0; k < m_mat.nonZeros(); k++)
+        combine(inner[k]);
+
+    m_pattern_changed = (m_setup_call == 0 || hash != m_pattern_hash);
+    m_pattern_hash = hash;
+
+    if (m_pattern_changed)
+        m_pattern_misses++;
+    else
+        m_pattern_hits++;
+}
+
 // ---------------------------------------------------------------------------
 
 void ChDirectSolverLS::WriteMatrix(const std::string& filename, const ChSparseMatrix& M) {
@@ -275,7 +315,10 @@ void ChDirectSolverLS::ArchiveIn(ChArchiveIn& archive_in) {
 // ---------------------------------------------------------------------------
 
 bool ChSolverSparseLU::FactorizeMatrix() {
-    m_engine.compute(m_mat);
+    // Redo the symbolic analysis (column ordering) only if the sparsity pattern changed
+    if (m_pattern_changed)
+        m_engine.analyzePattern(m_mat);
+    m_engine.factorize(m_mat);
     return (m_engine.info() == Eigen::Success);
 }
 
@@ -304,7 +347,10 @@ void ChSolverSparseLU::PrintErrorMessage() {
 // ---------------------------------------------------------------------------
 
 bool ChSolverSparseQR::FactorizeMatrix() {
-    m_engine.compute(m_mat);
+    // Redo the symbolic analysis (column ordering) only if the sparsity pattern changed
+    if (m_pattern_changed)
+        m_engine.analyzePattern(m_mat);
+    m_engine.factorize(m_mat);
     return (m_engine.info() == Eigen::Success);
 }
 
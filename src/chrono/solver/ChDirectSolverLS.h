@@ -51,6 +51,12 @@ Enabled by default, the sparsity matrix learner identifies the exact matrix spar
 any nonzeros).\n
 See #UseSparsityPatternLearner();
 
+After each assembly, the solver computes a fingerprint of the matrix sparsity pattern. If the pattern is unchanged from
+the previous factorization, concrete solvers which support it skip the symbolic analysis and only perform the numerical
+factorization. With the sparsity pattern \e cache enabled, the matrix structure is also kept from call to call (as long
+as the problem size does not change) and values are assembled in place, without re-learning the pattern.\n
+See #EnableSparsityPatternCache();
+
 A further option allows the user to provide an estimate for the matrix sparsity (a value in [0,1], with 0 corresponding
 to a fully dense matrix). This value is used if the sparsity pattern learner is disabled if/when required to reserve
 space for matrix indices and nonzeros.
@@ -87,6 +93,14 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     /// Disable for smaller problems where the overhead may be too large.
     void UseSparsityPatternLearner(bool val) { m_use_learner = val; }
 
+    /// Enable/disable caching of the matrix sparsity pattern between calls (default: false).\n
+    /// If enabled and the problem size is unchanged, the matrix is assembled in place, in the structure of the previous
+    /// call, without calling the sparsity pattern learner. New nonzeros, if any, are added to the structure (which
+    /// therefore never shrinks while the problem size is unchanged). Unlike #LockSparsityPattern, this option is safe
+    /// for problems with a changing sparsity pattern; it is most effective when the pattern is constant (e.g., FEA
+    /// and joints, without contacts).
+    void EnableSparsityPatternCache(bool val) { m_use_pattern_cache = val; }
+
     /// Force a call to the sparsity pattern learner to update sparsity pattern on the underlying matrix.\n
     /// Such a call may be needed in a situation where the sparsity pattern is locked, but a change in the problem size
     /// or structure occurred. This function has no effect if the sparsity pattern learner is disabled.
@@ -128,6 +142,12 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     /// Return the number of calls to the solver's Setup function.
     unsigned int GetNumSolveCalls() const { return m_solve_call; }
 
+    /// Return the number of factorizations with a sparsity pattern identical to that of the previous factorization.
+    /// For these, concrete solvers which support it reuse the symbolic analysis of the matrix.
+    unsigned int GetNumPatternHits() const { return m_pattern_hits; }
+    /// Return the number of factorizations with a sparsity pattern different from that of the previous factorization.
+    unsigned int GetNumPatternMisses() const { return m_pattern_misses; }
+
     /// Get a handle to the underlying matrix.
     ChSparseMatrix& GetMatrix() { return m_mat; }
 
@@ -187,6 +207,9 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     /// This function is only called if Factorize or Solve returned false.
     virtual void PrintErrorMessage() = 0;
 
+    /// Update the fingerprint of the (compressed) matrix sparsity pattern and the pattern hit/miss counters.
+    void UpdatePatternFingerprint();
+
     /// Indicate whether or not the #Solve() phase requires an up-to-date problem matrix.
     /// Typically, direct solvers only require the matrix for their #Setup() phase.
     virtual bool SolveRequiresMatrix() const override { return false; }
@@ -205,6 +228,12 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     bool m_use_learner;   ///< use the sparsity pattern learner?
     bool m_force_update;  ///< force a call to the sparsity pattern learner?
 
+    bool m_use_pattern_cache;       ///< keep the matrix structure between calls?
+    bool m_pattern_changed;         ///< sparsity pattern changed since the previous factorization?
+    size_t m_pattern_hash;          ///< fingerprint of the current sparsity pattern
+    unsigned int m_pattern_hits;    ///< number of factorizations with unchanged sparsity pattern
+    unsigned int m_pattern_misses;  ///< number of factorizations with changed sparsity pattern
+
     bool m_use_perm;              ///< use of the permutation vector?
     bool m_use_rhs_sparsity;      ///< leverage right-hand side sparsity?
     bool m_null_pivot_detection;  ///< enable detection of zero pivots?
@@ -24,6 +24,7 @@ ChIterativeSolverVI::ChIterativeSolverVI()
     : ChIterativeSolver(50, 0.0, true, false),
       m_omega(1.0),
       m_shlambda(1.0),
+      m_use_packed(false),
       m_iterations(0),
       record_violation_history(false) {}
 
@@ -76,6 +76,17 @@ class ChApi ChIterativeSolverVI : public ChIterativeSolver, public ChSolverVI {
     /// GetViolationHistory).
     void SetRecordViolation(bool mval);
 
+    /// Enable/disable the packed execution mode (default: false).
+    /// If enabled, solvers that support it (PSOR, PSSOR, PJacobi, APGD, BB) flatten the problem data into contiguous
+    /// buffers once per solve (see ChSystemDescriptor::PackConstraints) and run their iterations over these buffers,
+    /// without virtual calls. Results are identical to those obtained in the default mode. If the system contains
+    /// constraints that do not support packing (e.g., rolling friction or boxed constraints), the solver falls back to
+    /// the default mode.
+    void EnablePackedMode(bool val) { m_use_packed = val; }
+
+    /// Return true if the packed execution mode is enabled.
+    bool IsPackedModeEnabled() const { return m_use_packed; }
+
     /// Return the current value of the overrelaxation factor.
     double GetOmega() const { return m_omega; }
 
@@ -119,6 +130,7 @@ class ChApi ChIterativeSolverVI : public ChIterativeSolver, public ChSolverVI {
     int m_iterations;   ///< number of iterations performed by the solver during last call to Solve()
     double m_omega;     ///< over-relaxation factor
     double m_shlambda;  ///< sharpness factor
+    bool m_use_packed;  ///< use packed constraint data
 
     bool record_violation_history;
     std::vector<double> violation_history;
@@ -0,0 +1,148 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#include "chrono/solver/ChPackedConstraints.h"
+#include "chrono/solver/ChVariables.h"
+
+namespace chrono {
+
+ChPackedConstraints::ChPackedConstraints() : m_valid(false) {}
+
+void ChPackedConstraints::Reset() {
+    m_valid = false;
+
+    // Note: clear() preserves the capacity of the buffers, so that repacking does not reallocate
+    m_active.clear();
+    m_mode.clear();
+    m_proj.clear();
+    m_offset.clear();
+    m_b.clear();
+    m_cfm.clear();
+    m_g.clear();
+    m_l.clear();
+    m_mu.clear();
+    m_coh.clear();
+    m_blk_start.clear();
+
+    m_blk_qoffset.clear();
+    m_blk_voffset.clear();
+    m_blk_size.clear();
+    m_blk_fixed.clear();
+    m_blk_newgroup.clear();
+
+    m_Cq.clear();
+    m_Eq.clear();
+}
+
+void ChPackedConstraints::BeginConstraint(const ChConstraint& constraint) {
+    if (m_blk_start.empty())
+        m_blk_start.push_back(0);
+
+    m_active.push_back(constraint.IsActive());
+    m_mode.push_back(constraint.GetMode());
+    m_proj.push_back(constraint.GetMode() == ChConstraint::Mode::UNILATERAL ? Projection::UNILATERAL
+                                                                             : Projection::NONE);
+    m_offset.push_back(constraint.GetOffset());
+    m_b.push_back(constraint.GetRightHandSide());
+    m_cfm.push_back(constraint.GetComplianceTerm());
+    m_g.push_back(constraint.GetSchurComplement());
+    m_l.push_back(constraint.GetLagrangeMultiplier());
+    m_mu.push_back(0);
+    m_coh.push_back(0);
+}
+
+void ChPackedConstraints::SetFrictionCone(double friction, double cohesion) {
+    m_proj.back() = Projection::CONE;
+    m_mu.back() = friction;
+    m_coh.back() = cohesion;
+}
+
+void ChPackedConstraints::EndConstraint() {
+    m_blk_start.push_back((unsigned int)m_blk_qoffset.size());
+}
+
+void ChPackedConstraints::Finalize(const std::vector<ChVariables*>& variables, unsigned int n_q) {
+    if (m_blk_start.empty())
+        m_blk_start.push_back(0);
+
+    m_q.resize(n_q);
+    for (const auto& var : variables) {
+        if (var->IsActive())
+            m_q.segment(var->GetOffset(), var->GetDOF()) = var->State();
+    }
+
+    m_valid = true;
+}
+
+void ChPackedConstraints::ScatterState(std::vector<ChVariables*>& variables) const {
+    for (auto& var : variables) {
+        if (var->IsActive())
+            var->State() = m_q.segment(var->GetOffset(), var->GetDOF());
+    }
+}
+
+void ChPackedConstraints::ScatterMultipliers(std::vector<ChConstraint*>& constraints) const {
+    assert(constraints.size() == m_l.size());
+    for (size_t i = 0; i < constraints.size(); i++)
+        constraints[i]->SetLagrangeMultiplier(m_l[i]);
+}
+
+void ChPackedConstraints::ProjectCone(unsigned int i) {
+    // Anitescu-Tasora projection on cone generator and polar cone
+    // (contractive, but performs correction on three components: normal,u,v)
+    double friction = m_mu[i];
+    double cohesion = m_coh[i];
+
+    double f_n = m_l[i] + cohesion;
+
+    // no friction? project to axis of upper cone
+    if (friction == 0) {
+        m_l[i + 1] = 0;
+        m_l[i + 2] = 0;
+        if (f_n < 0)
+            m_l[i] = 0;
+        return;
+    }
+
+    double f_u = m_l[i + 1];
+    double f_v = m_l[i + 2];
+
+    double mu2 = friction * friction;
+    double f_n2 = f_n * f_n;
+    double f_t2 = (f_v * f_v + f_u * f_u);
+
+    // inside lower cone or close to origin? reset normal, u, v to zero!
+    if ((f_n <= 0 && f_t2 < f_n2 / mu2) || (f_n < 1e-14 && f_n > -1e-14)) {
+        m_l[i] = 0;
+        m_l[i + 1] = 0;
+        m_l[i + 2] = 0;
+        return;
+    }
+
+    // inside upper cone? keep untouched!
+    if (f_t2 < f_n2 * mu2)
+        return;
+
+    // project orthogonally to generator segment of upper cone
+    double f_t = sqrt(f_t2);
+    double f_n_proj = (f_t * friction + f_n) / (mu2 + 1);
+    double f_t_proj = f_n_proj * friction;
+    double tproj_div_t = f_t_proj / f_t;
+    double f_u_proj = tproj_div_t * f_u;
+    double f_v_proj = tproj_div_t * f_v;
+
+    m_l[i] = f_n_proj - cohesion;
+    m_l[i + 1] = f_u_proj;
+    m_l[i + 2] = f_v_proj;
+}
+
+}  // end namespace chrono
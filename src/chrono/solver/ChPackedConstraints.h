@@ -0,0 +1,303 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#ifndef CH_PACKED_CONSTRAINTS_H
+#define CH_PACKED_CONSTRAINTS_H
+
+#include <cmath>
+#include <vector>
+
+#include "chrono/core/ChApiCE.h"
+#include "chrono/core/ChMatrix.h"
+#include "chrono/solver/ChConstraint.h"
+
+namespace chrono {
+
+class ChVariables;
+
+/// @addtogroup chrono_solver
+/// @{
+
+/// Flat, structure-of-arrays representation of the constraints and variable states in a ChSystemDescriptor.
+/// The packed representation is built by ChSystemDescriptor::PackConstraints once per solve (after the constraint
+/// auxiliary data was updated) and allows iterative VI solvers to run their inner loops without virtual calls and
+/// without chasing pointers into the ChVariables objects.
+///
+/// Each scalar constraint i is described by:
+/// - its mode and the projection to be applied to its multiplier,
+/// - the scalar terms b_i, cfm_i, g_i, l_i,
+/// - a list of Jacobian blocks [Cq_i] (one per active variable, stored contiguously) and the corresponding
+///   [Eq_i]=[invM]*[Cq_i]' blocks, together with the offsets of the associated variables in the packed state vector.
+///
+/// All constraints in the descriptor are packed (active or not), so that indices in the packed arrays match indices in
+/// ChSystemDescriptor::GetConstraints(). The kernels reproduce the evaluation order of the corresponding ChConstraint
+/// virtual methods, so that solvers using the packed representation return bit-identical results.
+class ChApi ChPackedConstraints {
+  public:
+    /// Projection applied to a constraint multiplier.
+    enum class Projection : char {
+        NONE,       ///< no projection (bilateral constraints, tangential friction components)
+        UNILATERAL, ///< l_i = max(0, l_i)
+        CONE        ///< friction cone projection on (l_i, l_i+1, l_i+2); applied to the normal component only
+    };
+
+    ChPackedConstraints();
+
+    /// Discard all packed data.
+    void Reset();
+
+    /// Return true if the packed data is valid (i.e. was successfully built).
+    bool IsValid() const { return m_valid; }
+
+    /// Return the number of packed constraints.
+    unsigned int GetNumConstraints() const { return (unsigned int)m_mode.size(); }
+
+    // --------------------------------------------------------------------
+    // Construction (used by ChSystemDescriptor and by the ChConstraint classes)
+
+    /// Begin packing of a constraint (set its scalar data).
+    void BeginConstraint(const ChConstraint& constraint);
+
+    /// Append a Jacobian block for the current constraint.
+    /// If 'new_group' is false, the block dot product is accumulated into the partial sum of the previous block,
+    /// replicating constraints that sum the contributions of a tuple of variables before adding them to the total.
+    template <typename Tcq, typename Teq>
+    void AddBlock(unsigned int var_offset,
+                  const Eigen::MatrixBase<Tcq>& Cq,
+                  const Eigen::MatrixBase<Teq>& Eq,
+                  bool new_group = true) {
+        m_blk_qoffset.push_back(var_offset);
+        m_blk_size.push_back((int)Cq.size());
+        m_blk_fixed.push_back(Tcq::SizeAtCompileTime == Eigen::Dynamic ? 0 : (int)Tcq::SizeAtCompileTime);
+        m_blk_newgroup.push_back(new_group);
+        m_blk_voffset.push_back((unsigned int)m_Cq.size());
+        for (Eigen::Index k = 0; k < Cq.size(); k++)
+            m_Cq.push_back(Cq(k));
+        for (Eigen::Index k = 0; k < Eq.size(); k++)
+            m_Eq.push_back(Eq(k));
+    }
+
+    /// Set the current constraint as the normal component of a friction triplet, with projection onto the friction
+    /// cone. The two tangential components are assumed to be the next two constraints.
+    void SetFrictionCone(double friction, double cohesion);
+
+    /// End packing of the current constraint.
+    void EndConstraint();
+
+    /// Mark packing as complete and gather the states of the active variables into the packed state vector.
+    void Finalize(const std::vector<ChVariables*>& variables, unsigned int n_q);
+
+    /// Copy the packed state vector back into the active variables.
+    void ScatterState(std::vector<ChVariables*>& variables) const;
+
+    /// Copy the packed multipliers back into the constraints.
+    void ScatterMultipliers(std::vector<ChConstraint*>& constraints) const;
+
+    // --------------------------------------------------------------------
+    // Data access
+
+    bool IsActive(unsigned int i) const { return m_active[i] != 0; }
+    ChConstraint::Mode GetMode(unsigned int i) const { return m_mode[i]; }
+    Projection GetProjection(unsigned int i) const { return m_proj[i]; }
+    unsigned int GetOffset(unsigned int i) const { return m_offset[i]; }
+
+    double GetRightHandSide(unsigned int i) const { return m_b[i]; }
+    double GetComplianceTerm(unsigned int i) const { return m_cfm[i]; }
+    double GetSchurComplement(unsigned int i) const { return m_g[i]; }
+    double GetLagrangeMultiplier(unsigned int i) const { return m_l[i]; }
+    void SetLagrangeMultiplier(unsigned int i, double l) { m_l[i] = l; }
+
+    /// Return the index of the first Jacobian block of constraint i.
+    /// The blocks of constraint i are those with indices in [GetFirstBlock(i), GetFirstBlock(i+1)).
+    unsigned int GetFirstBlock(unsigned int i) const { return m_blk_start[i]; }
+
+    /// Return the offset in the packed state vector of the variables associated with Jacobian block k.
+    unsigned int GetBlockOffset(unsigned int k) const { return m_blk_qoffset[k]; }
+
+    /// Access the packed state vector (states of all active variables, ordered by their offsets).
+    ChVectorDynamic<>& State() { return m_q; }
+
+    // --------------------------------------------------------------------
+    // Kernels
+
+    /// Compute [Cq_i]*q, with q the packed state vector.
+    double ComputeJacobianTimesState(unsigned int i) const { return JacobianTimesVector(i, m_q.data()); }
+
+    /// Compute [Cq_i]*v, for a vector v with the same layout as the packed state vector.
+    double JacobianTimesVector(unsigned int i, const double* v) const {
+        double ret = 0;
+        double part = 0;
+        for (unsigned int k = m_blk_start[i]; k < m_blk_start[i + 1]; k++) {
+            if (m_blk_newgroup[k] && k != m_blk_start[i]) {
+                ret += part;
+                part = 0;
+            }
+            part += BlockDot(k, v + m_blk_qoffset[k]);
+        }
+        ret += part;
+        return ret;
+    }
+
+    /// Increment the packed state vector with [Eq_i]*deltal.
+    void IncrementState(unsigned int i, double deltal) { IncrementVector(i, m_q.data(), deltal); }
+
+    /// Increment a vector v (with the same layout as the packed state vector) with [Eq_i]*deltal.
+    void IncrementVector(unsigned int i, double* v, double deltal) const {
+        for (unsigned int k = m_blk_start[i]; k < m_blk_start[i + 1]; k++)
+            BlockIncrement(k, v + m_blk_qoffset[k], deltal);
+    }
+
+    /// Project the multiplier of constraint i (for a friction cone, also the next two multipliers).
+    void Project(unsigned int i) {
+        switch (m_proj[i]) {
+            case Projection::UNILATERAL:
+                if (m_l[i] < 0.)
+                    m_l[i] = 0.;
+                break;
+            case Projection::CONE:
+                ProjectCone(i);
+                break;
+            default:
+                break;
+        }
+    }
+
+    /// Return the constraint violation for the given residual (see ChConstraint::Violation).
+    /// Note that the violation of friction components is evaluated by the solvers directly, per friction triplet.
+    double Violation(unsigned int i, double mc_i) const {
+        if (m_mode[i] == ChConstraint::Mode::UNILATERAL) {
+            if (mc_i > 0.)
+                return 0.;
+        }
+        return mc_i;
+    }
+
+  private:
+    template <int N>
+    double BlockDotN(unsigned int k, const double* v) const {
+        return Eigen::Map<const ChRowVectorN<double, N>>(&m_Cq[m_blk_voffset[k]]) *
+               Eigen::Map<const ChVectorDynamic<double>>(v, N);
+    }
+
+    template <int N>
+    void BlockIncrementN(unsigned int k, double* v, double deltal) const {
+        Eigen::Map<ChVectorDynamic<double>>(v, N) +=
+            Eigen::Map<const ChVectorN<double, N>>(&m_Eq[m_blk_voffset[k]]) * deltal;
+    }
+
+    double BlockDot(unsigned int k, const double* v) const {
+        switch (m_blk_fixed[k]) {
+            case 1:
+                return BlockDotN<1>(k, v);
+            case 3:
+                return BlockDotN<3>(k, v);
+            case 6:
+                return BlockDotN<6>(k, v);
+            case 7:
+                return BlockDotN<7>(k, v);
+            case 9:
+                return BlockDotN<9>(k, v);
+            default:
+                return Eigen::Map<const ChRowVectorDynamic<double>>(&m_Cq[m_blk_voffset[k]], m_blk_size[k]) *
+                       Eigen::Map<const ChVectorDynamic<double>>(v, m_blk_size[k]);
+        }
+    }
+
+    void BlockIncrement(unsigned int k, double* v, double deltal) const {
+        switch (m_blk_fixed[k]) {
+            case 1:
+                BlockIncrementN<1>(k, v, deltal);
+                break;
+            case 3:
+                BlockIncrementN<3>(k, v, deltal);
+                break;
+            case 6:
+                BlockIncrementN<6>(k, v, deltal);
+                break;
+            case 7:
+                BlockIncrementN<7>(k, v, deltal);
+                break;
+            case 9:
+                BlockIncrementN<9>(k, v, deltal);
+                break;
+            default:
+                Eigen::Map<ChVectorDynamic<double>>(v, m_blk_size[k]) +=
+                    Eigen::Map<const ChVectorDynamic<double>>(&m_Eq[m_blk_voffset[k]], m_blk_size[k]) * deltal;
+                break;
+        }
+    }
+
+    /// Anitescu-Tasora projection on the friction cone (see ChConstraintTwoTuplesContactN::Project).
+    void ProjectCone(unsigned int i);
+
+    bool m_valid;
+
+    // Per-constraint data
+    std::vector<char> m_active;
+    std::vector<ChConstraint::Mode> m_mode;
+    std::vector<Projection> m_proj;
+    std::vector<unsigned int> m_offset;
+    std::vector<double> m_b;
+    std::vector<double> m_cfm;
+    std::vector<double> m_g;
+    std::vector<double> m_l;
+    std::vector<double> m_mu;
+    std::vector<double> m_coh;
+    std::vector<unsigned int> m_blk_start;  ///< index of first Jacobian block (size: num. constraints + 1)
+
+    // Per-block data
+    std::vector<unsigned int> m_blk_qoffset;  ///< offset of associated variables in packed state vector
+    std::vector<unsigned int> m_blk_voffset;  ///< offset of block values in m_Cq and m_Eq
+    std::vector<int> m_blk_size;              ///< block size
+    std::vector<int> m_blk_fixed;             ///< block size, if fixed at compile time in the source constraint (or 0)
+    std::vector<char> m_blk_newgroup;         ///< block starts a new partial sum
+
+    // Block values
+    std::vector<double> m_Cq;
+    std::vector<double> m_Eq;
+
+    // Packed states of all active variables
+    ChVectorDynamic<> m_q;
+};
+
+/// Accessor for the (unpacked) constraint objects in a ChSystemDescriptor, with the same per-constraint interface as
+/// ChPackedConstraints. The iteration loops of the iterative VI solvers are templated on the constraint accessor, so
+/// that a single implementation runs on either the constraint objects (through virtual calls) or the packed data.
+class ChUnpackedConstraints {
+  public:
+    ChUnpackedConstraints(std::vector<ChConstraint*>& constraints) : m_constraints(constraints) {}
+
+    unsigned int GetNumConstraints() const { return (unsigned int)m_constraints.size(); }
+
+    bool IsActive(unsigned int i) const { return m_constraints[i]->IsActive(); }
+    ChConstraint::Mode GetMode(unsigned int i) const { return m_constraints[i]->GetMode(); }
+
+    double GetRightHandSide(unsigned int i) const { return m_constraints[i]->GetRightHandSide(); }
+    double GetComplianceTerm(unsigned int i) const { return m_constraints[i]->GetComplianceTerm(); }
+    double GetSchurComplement(unsigned int i) const { return m_constraints[i]->GetSchurComplement(); }
+    double GetLagrangeMultiplier(unsigned int i) const { return m_constraints[i]->GetLagrangeMultiplier(); }
+    void SetLagrangeMultiplier(unsigned int i, double l) { m_constraints[i]->SetLagrangeMultiplier(l); }
+
+    double ComputeJacobianTimesState(unsigned int i) { return m_constraints[i]->ComputeJacobianTimesState(); }
+    void IncrementState(unsigned int i, double deltal) { m_constraints[i]->IncrementState(deltal); }
+    void Project(unsigned int i) { m_constraints[i]->Project(); }
+    double Violation(unsigned int i, double mc_i) { return m_constraints[i]->Violation(mc_i); }
+
+  private:
+    std::vector<ChConstraint*>& m_constraints;
+};
+
+/// @} chrono_solver
+
+}  // end namespace chrono
+
+#endif
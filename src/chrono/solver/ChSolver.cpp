@@ -28,6 +28,8 @@ class ChSolver_Type_enum_mapper : public ChSolver {
     CH_ENUM_VAL(Type::BARZILAIBORWEIN);
     CH_ENUM_VAL(Type::APGD);
     CH_ENUM_VAL(Type::ADMM);
+    CH_ENUM_VAL(Type::PSOR_COLORED);
+    CH_ENUM_VAL(Type::PSOR_ISLANDS);
     CH_ENUM_VAL(Type::SPARSE_LU);
     CH_ENUM_VAL(Type::SPARSE_QR);
     CH_ENUM_VAL(Type::PARDISO_MKL);
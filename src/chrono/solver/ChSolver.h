@@ -44,6 +44,8 @@ class ChApi ChSolver {
         BARZILAIBORWEIN,  ///< Barzilai-Borwein
         APGD,             ///< Accelerated Projected Gradient Descent
         ADMM,             ///< Alternating Direction Method of Multipliers
+        PSOR_COLORED,     ///< Projected SOR with graph-colored, multithreaded sweeps
+        PSOR_ISLANDS,     ///< Projected SOR with concurrent solution of independent islands
         // Direct linear solvers
         SPARSE_LU,    ///< Sparse supernodal LU factorization
         SPARSE_QR,    ///< Sparse left-looking rank-revealing QR factorization
@@ -91,6 +93,10 @@ class ChApi ChSolver {
     /// that it is appropriate to perform the setup phase.
     virtual bool Setup(ChSystemDescriptor& sysd) { return true; }
 
+    /// Set the number of OpenMP threads used by the solver (if supported).
+    /// This function is called automatically by the owning ChSystem, using the value of num_threads_chrono.
+    virtual void SetNumThreads(int nthreads) {}
+
     /// Set verbose output from solver.
     void SetVerbose(bool mv) { verbose = mv; }
 
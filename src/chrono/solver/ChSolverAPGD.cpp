@@ -118,6 +118,10 @@ double ChSolverAPGD::Solve(ChSystemDescriptor& sysd) {
     ChVectorDynamic<> Minvk;
     sysd.FromVariablesToVector(Minvk, true);
 
+    // If so requested, flatten the constraint data for use in the Schur complement products
+    if (m_use_packed)
+        sysd.PackConstraints();
+
     // (1) gamma_0 = zeros(nc,1)
     if (m_warm_start) {
         for (unsigned int ic = 0; ic < mconstraints.size(); ic++)
@@ -232,6 +236,8 @@ double ChSolverAPGD::Solve(ChSystemDescriptor& sysd) {
     if (verbose)
         std::cout << "Residual: " << residual << ", Iter: " << m_iterations << std::endl;
 
+    sysd.ClearPackedConstraints();
+
     // (33) return Value at time step t_(l+1), gamma_(l+1) := gamma_hat
     sysd.FromVectorToConstraints(gamma_hat);
 
@@ -129,6 +129,10 @@ double ChSolverBB::Solve(ChSystemDescriptor& sysd) {
     ChVectorDynamic<> mq;
     sysd.FromVariablesToVector(mq, true);
 
+    // If so requested, flatten the constraint data for use in the Schur complement products
+    if (m_use_packed)
+        sysd.PackConstraints();
+
     // Initialize lambdas
     if (m_warm_start)
         sysd.FromConstraintsToVector(ml);
@@ -325,6 +329,8 @@ double ChSolverBB::Solve(ChSystemDescriptor& sysd) {
     // Fallback to best found solution (might be useful because of nonmonotonicity)
     ml = ml_candidate;
 
+    sysd.ClearPackedConstraints();
+
     // Resulting DUAL variables:
     // store ml temporary vector into ChConstraint 'l_i' multipliers
     sysd.FromVectorToConstraints(ml);
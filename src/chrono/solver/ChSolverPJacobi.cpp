@@ -29,9 +29,6 @@ double ChSolverPJacobi::Solve(ChSystemDescriptor& sysd) {
 
     m_iterations = 0;
     maxviolation = 0;
-    double maxdeltalambda = 0;
-    int i_friction_comp = 0;
-    double old_lambda_friction[3];
 
     // 1)  Update auxiliary data in all constraints before starting,
     //     that is: g_i=[Cq_i]*[invM_i]*[Cq_i]' and  [Eq_i]=[invM_i]*[Cq_i]'
@@ -73,10 +70,37 @@ double ChSolverPJacobi::Solve(ChSystemDescriptor& sysd) {
     }
 
     // 4)  Perform the iteration loops
-    //
+    //     (on the flattened constraint data, if so requested and if supported by all constraints)
+
+    if (m_use_packed && sysd.PackConstraints()) {
+        SolvePacked(sysd.GetPackedConstraints());
+        sysd.UnpackConstraints();
+        return maxviolation;
+    }
+
+    ChUnpackedConstraints constraints(mconstraints);
+    Iterate(constraints);
+
+    return maxviolation;
+}
+
+void ChSolverPJacobi::SolvePacked(ChPackedConstraints& pc) {
+    Iterate(pc);
+}
+
+// Perform the projected Jacobi iterations.
+// The same loop runs on the constraint objects (ChUnpackedConstraints) or on their packed representation
+// (ChPackedConstraints).
+template <class Constraints>
+void ChSolverPJacobi::Iterate(Constraints& constraints) {
+    const unsigned int nConstr = constraints.GetNumConstraints();
+
+    double maxdeltalambda = 0;
+    int i_friction_comp = 0;
+    double old_lambda_friction[3];
 
     std::vector<double> delta_gammas;
-    delta_gammas.resize(mconstraints.size());
+    delta_gammas.resize(nConstr);
 
     for (int iter = 0; iter < m_max_iterations; iter++) {
         // The iteration on all constraints
@@ -85,49 +109,49 @@ double ChSolverPJacobi::Solve(ChSystemDescriptor& sysd) {
         maxviolation = 0;
         maxdeltalambda = 0;
 
-        for (unsigned int ic = 0; ic < mconstraints.size(); ic++) {
+        for (unsigned int ic = 0; ic < nConstr; ic++) {
             // skip computations if constraint not active.
-            if (mconstraints[ic]->IsActive()) {
+            if (constraints.IsActive(ic)) {
                 // compute residual  c_i = [Cq_i]*q + b_i + cfm_i*l_i
-                double mresidual = mconstraints[ic]->ComputeJacobianTimesState() + mconstraints[ic]->GetRightHandSide() +
-                                   mconstraints[ic]->GetComplianceTerm() * mconstraints[ic]->GetLagrangeMultiplier();
+                double mresidual = constraints.ComputeJacobianTimesState(ic) + constraints.GetRightHandSide(ic) +
+                                   constraints.GetComplianceTerm(ic) * constraints.GetLagrangeMultiplier(ic);
 
                 // true constraint violation may be different from 'mresidual' (ex:clamped if unilateral)
-                double candidate_violation = fabs(mconstraints[ic]->Violation(mresidual));
+                double candidate_violation = fabs(constraints.Violation(ic, mresidual));
 
                 // compute:  delta_lambda = -(omega/g_i) * ([Cq_i]*q + b_i + cfm_i*l_i )
-                double deltal = (m_omega / mconstraints[ic]->GetSchurComplement()) * (-mresidual);
+                double deltal = (m_omega / constraints.GetSchurComplement(ic)) * (-mresidual);
 
-                if (mconstraints[ic]->GetMode() == ChConstraint::Mode::FRICTION) {
+                if (constraints.GetMode(ic) == ChConstraint::Mode::FRICTION) {
                     candidate_violation = 0;
 
                     // update:   lambda += delta_lambda;
-                    old_lambda_friction[i_friction_comp] = mconstraints[ic]->GetLagrangeMultiplier();
-                    mconstraints[ic]->SetLagrangeMultiplier(old_lambda_friction[i_friction_comp] + deltal);
+                    old_lambda_friction[i_friction_comp] = constraints.GetLagrangeMultiplier(ic);
+                    constraints.SetLagrangeMultiplier(ic, old_lambda_friction[i_friction_comp] + deltal);
                     i_friction_comp++;
 
                     if (i_friction_comp == 1)
                         candidate_violation = fabs(std::min(0.0, mresidual));
 
                     if (i_friction_comp == 3) {
-                        mconstraints[ic - 2]->Project();  // the N normal component will take care of N,U,V
-                        double new_lambda_0 = mconstraints[ic - 2]->GetLagrangeMultiplier();
-                        double new_lambda_1 = mconstraints[ic - 1]->GetLagrangeMultiplier();
-                        double new_lambda_2 = mconstraints[ic - 0]->GetLagrangeMultiplier();
+                        constraints.Project(ic - 2);  // the N normal component will take care of N,U,V
+                        double new_lambda_0 = constraints.GetLagrangeMultiplier(ic - 2);
+                        double new_lambda_1 = constraints.GetLagrangeMultiplier(ic - 1);
+                        double new_lambda_2 = constraints.GetLagrangeMultiplier(ic - 0);
                         // Apply the smoothing: lambda= sharpness*lambda_new_projected + (1-sharpness)*lambda_old
                         if (m_shlambda != 1.0) {
                             new_lambda_0 = m_shlambda * new_lambda_0 + (1.0 - m_shlambda) * old_lambda_friction[0];
                             new_lambda_1 = m_shlambda * new_lambda_1 + (1.0 - m_shlambda) * old_lambda_friction[1];
                             new_lambda_2 = m_shlambda * new_lambda_2 + (1.0 - m_shlambda) * old_lambda_friction[2];
-                            mconstraints[ic - 2]->SetLagrangeMultiplier(new_lambda_0);
-                            mconstraints[ic - 1]->SetLagrangeMultiplier(new_lambda_1);
-                            mconstraints[ic - 0]->SetLagrangeMultiplier(new_lambda_2);
+                            constraints.SetLagrangeMultiplier(ic - 2, new_lambda_0);
+                            constraints.SetLagrangeMultiplier(ic - 1, new_lambda_1);
+                            constraints.SetLagrangeMultiplier(ic - 0, new_lambda_2);
                         }
                         delta_gammas[ic - 2] = new_lambda_0 - old_lambda_friction[0];
                         delta_gammas[ic - 1] = new_lambda_1 - old_lambda_friction[1];
                         delta_gammas[ic - 0] = new_lambda_2 - old_lambda_friction[2];
                         // Now do NOT update the primal variables , posticipate
-                        // mconstraints[xx]->IncrementState(true_delta_xx);
+                        // constraints.IncrementState(ic - xx, true_delta_xx);
 
                         if (this->record_violation_history) {
                             maxdeltalambda = std::max(maxdeltalambda, fabs(delta_gammas[ic - 2]));
@@ -138,24 +162,24 @@ double ChSolverPJacobi::Solve(ChSystemDescriptor& sysd) {
                     }
                 } else {
                     // update:   lambda += delta_lambda;
-                    double old_lambda = mconstraints[ic]->GetLagrangeMultiplier();
-                    mconstraints[ic]->SetLagrangeMultiplier(old_lambda + deltal);
+                    double old_lambda = constraints.GetLagrangeMultiplier(ic);
+                    constraints.SetLagrangeMultiplier(ic, old_lambda + deltal);
 
                     // If new lagrangian multiplier does not satisfy inequalities, project
                     // it into an admissible orthant (or, in general, onto an admissible set)
-                    mconstraints[ic]->Project();
+                    constraints.Project(ic);
 
                     // After projection, the lambda may have changed a bit..
-                    double new_lambda = mconstraints[ic]->GetLagrangeMultiplier();
+                    double new_lambda = constraints.GetLagrangeMultiplier(ic);
 
                     // Apply the smoothing: lambda= sharpness*lambda_new_projected + (1-sharpness)*lambda_old
                     if (m_shlambda != 1.0) {
                         new_lambda = m_shlambda * new_lambda + (1.0 - m_shlambda) * old_lambda;
-                        mconstraints[ic]->SetLagrangeMultiplier(new_lambda);
+                        constraints.SetLagrangeMultiplier(ic, new_lambda);
                     }
 
                     // Now do NOT update the primal variables , posticipate
-                    // mconstraints[ic]->IncrementState(true_delta_xx);
+                    // constraints.IncrementState(ic, true_delta);
                     delta_gammas[ic] = new_lambda - old_lambda;
 
                     if (this->record_violation_history)
@@ -167,9 +191,9 @@ double ChSolverPJacobi::Solve(ChSystemDescriptor& sysd) {
         }
 
         // Now, after all deltas are updated, sweep through all constraints and increment  q += [invM][Cq]'* delta_l
-        for (unsigned int ic = 0; ic < mconstraints.size(); ic++) {
-            if (mconstraints[ic]->IsActive())
-                mconstraints[ic]->IncrementState(delta_gammas[ic]);
+        for (unsigned int ic = 0; ic < nConstr; ic++) {
+            if (constraints.IsActive(ic))
+                constraints.IncrementState(ic, delta_gammas[ic]);
         }
 
         // For recording into violation history, if debugging
@@ -182,8 +206,6 @@ double ChSolverPJacobi::Solve(ChSystemDescriptor& sysd) {
         if (maxviolation < m_tolerance)
             break;
     }
-
-    return maxviolation;
 }
 
 }  // end namespace chrono
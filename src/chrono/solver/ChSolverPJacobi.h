@@ -45,6 +45,13 @@ class ChApi ChSolverPJacobi : public ChIterativeSolverVI {
     virtual double GetError() const override { return maxviolation; }
 
   private:
+    /// Perform the projected Jacobi iterations on the packed constraint data.
+    void SolvePacked(ChPackedConstraints& pc);
+
+    /// Perform the solver iterations on the given constraints (ChUnpackedConstraints or ChPackedConstraints).
+    template <class Constraints>
+    void Iterate(Constraints& constraints);
+
     double maxviolation;
 };
 
@@ -28,9 +28,6 @@ double ChSolverPSOR::Solve(ChSystemDescriptor& sysd) {
 
     m_iterations = 0;
     maxviolation = 0;
-    double maxdeltalambda = 0.;
-    int i_friction_comp = 0;
-    double old_lambda_friction[3];
 
     // 1)  Update auxiliary data in all constraints before starting,
     //     that is: g_i=[Cq_i]*[invM_i]*[Cq_i]' and  [Eq_i]=[invM_i]*[Cq_i]'
@@ -76,119 +73,142 @@ double ChSolverPSOR::Solve(ChSystemDescriptor& sysd) {
     }
 
     // 4)  Perform the iteration loops
-    //
+    //     (on the flattened constraint data, if so requested and if supported by all constraints)
 
-    for (int iter = 0; iter < m_max_iterations; iter++) {
-        // The iteration on all constraints
-        //
+    if (m_use_packed && sysd.PackConstraints()) {
+        SolvePacked(sysd.GetPackedConstraints());
+        sysd.UnpackConstraints();
+        return maxviolation;
+    }
+
+    ChUnpackedConstraints constraints(mconstraints);
+    Iterate(constraints);
+
+    return maxviolation;
+}
 
+void ChSolverPSOR::SolvePacked(ChPackedConstraints& pc) {
+    Iterate(pc);
+}
+
+// Perform the PSOR iterations.
+// The same loop runs on the constraint objects (ChUnpackedConstraints) or on their packed representation
+// (ChPackedConstraints).
+template <class Constraints>
+void ChSolverPSOR::Iterate(Constraints& constraints) {
+    const unsigned int nConstr = constraints.GetNumConstraints();
+
+    double maxdeltalambda = 0.;
+    int i_friction_comp = 0;
+    double old_lambda_friction[3];
+
+    for (int iter = 0; iter < m_max_iterations; iter++) {
         maxviolation = 0;
         maxdeltalambda = 0;
         i_friction_comp = 0;
 
-        for (unsigned int ic = 0; ic < mconstraints.size(); ic++) {
+        for (unsigned int ic = 0; ic < nConstr; ic++) {
             // skip computations if constraint not active.
-            if (mconstraints[ic]->IsActive()) {
-                // compute residual  c_i = [Cq_i]*q + b_i + cfm_i*l_i
-                double mresidual = mconstraints[ic]->ComputeJacobianTimesState() + mconstraints[ic]->GetRightHandSide() +
-                                   mconstraints[ic]->GetComplianceTerm() * mconstraints[ic]->GetLagrangeMultiplier();
-
-                // true constraint violation may be different from 'mresidual' (ex:clamped if unilateral)
-                double candidate_violation = fabs(mconstraints[ic]->Violation(mresidual));
-
-                // compute:  delta_lambda = -(omega/g_i) * ([Cq_i]*q + b_i + cfm_i*l_i )
-                double deltal = (m_omega / mconstraints[ic]->GetSchurComplement()) * (-mresidual);
-
-                if (mconstraints[ic]->GetMode() == ChConstraint::Mode::FRICTION) {
-                    candidate_violation = 0;
-
-                    // update:   lambda += delta_lambda;
-                    old_lambda_friction[i_friction_comp] = mconstraints[ic]->GetLagrangeMultiplier();
-                    mconstraints[ic]->SetLagrangeMultiplier(old_lambda_friction[i_friction_comp] + deltal);
-                    i_friction_comp++;
-
-                    if (i_friction_comp == 1)
-                        candidate_violation = fabs(std::min(0.0, mresidual));
-
-                    if (i_friction_comp == 3) {
-                        mconstraints[ic - 2]->Project();  // the N normal component will take care of N,U,V
-                        double new_lambda_0 = mconstraints[ic - 2]->GetLagrangeMultiplier();
-                        double new_lambda_1 = mconstraints[ic - 1]->GetLagrangeMultiplier();
-                        double new_lambda_2 = mconstraints[ic - 0]->GetLagrangeMultiplier();
-                        // Apply the smoothing: lambda= sharpness*lambda_new_projected + (1-sharpness)*lambda_old
-                        if (m_shlambda != 1.0) {
-                            new_lambda_0 = m_shlambda * new_lambda_0 + (1.0 - m_shlambda) * old_lambda_friction[0];
-                            new_lambda_1 = m_shlambda * new_lambda_1 + (1.0 - m_shlambda) * old_lambda_friction[1];
-                            new_lambda_2 = m_shlambda * new_lambda_2 + (1.0 - m_shlambda) * old_lambda_friction[2];
-                            mconstraints[ic - 2]->SetLagrangeMultiplier(new_lambda_0);
-                            mconstraints[ic - 1]->SetLagrangeMultiplier(new_lambda_1);
-                            mconstraints[ic - 0]->SetLagrangeMultiplier(new_lambda_2);
-                        }
-                        double true_delta_0 = new_lambda_0 - old_lambda_friction[0];
-                        double true_delta_1 = new_lambda_1 - old_lambda_friction[1];
-                        double true_delta_2 = new_lambda_2 - old_lambda_friction[2];
-                        mconstraints[ic - 2]->IncrementState(true_delta_0);
-                        mconstraints[ic - 1]->IncrementState(true_delta_1);
-                        mconstraints[ic - 0]->IncrementState(true_delta_2);
-
-                        if (this->record_violation_history) {
-                            maxdeltalambda = std::max(maxdeltalambda, fabs(true_delta_0));
-                            maxdeltalambda = std::max(maxdeltalambda, fabs(true_delta_1));
-                            maxdeltalambda = std::max(maxdeltalambda, fabs(true_delta_2));
-                        }
-                        i_friction_comp = 0;
-                    }
-                } else if (mconstraints[ic]->GetMode() == ChConstraint::Mode::UNILATERAL) {
-                    // update:   lambda += delta_lambda;
-                    old_lambda_friction[0] = mconstraints[ic]->GetLagrangeMultiplier();
-                    mconstraints[ic]->SetLagrangeMultiplier(old_lambda_friction[0] + deltal);
+            if (!constraints.IsActive(ic))
+                continue;
+
+            // compute residual  c_i = [Cq_i]*q + b_i + cfm_i*l_i
+            double mresidual = constraints.ComputeJacobianTimesState(ic) + constraints.GetRightHandSide(ic) +
+                               constraints.GetComplianceTerm(ic) * constraints.GetLagrangeMultiplier(ic);
 
+            // true constraint violation may be different from 'mresidual' (ex:clamped if unilateral)
+            double candidate_violation = fabs(constraints.Violation(ic, mresidual));
+
+            // compute:  delta_lambda = -(omega/g_i) * ([Cq_i]*q + b_i + cfm_i*l_i )
+            double deltal = (m_omega / constraints.GetSchurComplement(ic)) * (-mresidual);
+
+            if (constraints.GetMode(ic) == ChConstraint::Mode::FRICTION) {
+                candidate_violation = 0;
+
+                // update:   lambda += delta_lambda;
+                old_lambda_friction[i_friction_comp] = constraints.GetLagrangeMultiplier(ic);
+                constraints.SetLagrangeMultiplier(ic, old_lambda_friction[i_friction_comp] + deltal);
+                i_friction_comp++;
+
+                if (i_friction_comp == 1)
                     candidate_violation = fabs(std::min(0.0, mresidual));
-                    mconstraints[ic]->Project();
-                    double new_lambda_0 = mconstraints[ic]->GetLagrangeMultiplier();
+
+                if (i_friction_comp == 3) {
+                    constraints.Project(ic - 2);  // the N normal component will take care of N,U,V
+                    double new_lambda_0 = constraints.GetLagrangeMultiplier(ic - 2);
+                    double new_lambda_1 = constraints.GetLagrangeMultiplier(ic - 1);
+                    double new_lambda_2 = constraints.GetLagrangeMultiplier(ic - 0);
+                    // Apply the smoothing: lambda= sharpness*lambda_new_projected + (1-sharpness)*lambda_old
                     if (m_shlambda != 1.0) {
                         new_lambda_0 = m_shlambda * new_lambda_0 + (1.0 - m_shlambda) * old_lambda_friction[0];
-                        mconstraints[ic]->SetLagrangeMultiplier(new_lambda_0);
+                        new_lambda_1 = m_shlambda * new_lambda_1 + (1.0 - m_shlambda) * old_lambda_friction[1];
+                        new_lambda_2 = m_shlambda * new_lambda_2 + (1.0 - m_shlambda) * old_lambda_friction[2];
+                        constraints.SetLagrangeMultiplier(ic - 2, new_lambda_0);
+                        constraints.SetLagrangeMultiplier(ic - 1, new_lambda_1);
+                        constraints.SetLagrangeMultiplier(ic - 0, new_lambda_2);
                     }
-
                     double true_delta_0 = new_lambda_0 - old_lambda_friction[0];
-                    mconstraints[ic]->IncrementState(true_delta_0);
+                    double true_delta_1 = new_lambda_1 - old_lambda_friction[1];
+                    double true_delta_2 = new_lambda_2 - old_lambda_friction[2];
+                    constraints.IncrementState(ic - 2, true_delta_0);
+                    constraints.IncrementState(ic - 1, true_delta_1);
+                    constraints.IncrementState(ic - 0, true_delta_2);
 
                     if (this->record_violation_history) {
                         maxdeltalambda = std::max(maxdeltalambda, fabs(true_delta_0));
+                        maxdeltalambda = std::max(maxdeltalambda, fabs(true_delta_1));
+                        maxdeltalambda = std::max(maxdeltalambda, fabs(true_delta_2));
                     }
+                    i_friction_comp = 0;
+                }
+            } else if (constraints.GetMode(ic) == ChConstraint::Mode::UNILATERAL) {
+                // update:   lambda += delta_lambda;
+                old_lambda_friction[0] = constraints.GetLagrangeMultiplier(ic);
+                constraints.SetLagrangeMultiplier(ic, old_lambda_friction[0] + deltal);
+
+                candidate_violation = fabs(std::min(0.0, mresidual));
+                constraints.Project(ic);
+                double new_lambda_0 = constraints.GetLagrangeMultiplier(ic);
+                if (m_shlambda != 1.0) {
+                    new_lambda_0 = m_shlambda * new_lambda_0 + (1.0 - m_shlambda) * old_lambda_friction[0];
+                    constraints.SetLagrangeMultiplier(ic, new_lambda_0);
+                }
 
-                } else {
-                    // update:   lambda += delta_lambda;
-                    double old_lambda = mconstraints[ic]->GetLagrangeMultiplier();
-                    mconstraints[ic]->SetLagrangeMultiplier(old_lambda + deltal);
-
-                    // If new lagrangian multiplier does not satisfy inequalities, project
-                    // it into an admissible orthant (or, in general, onto an admissible set)
-                    mconstraints[ic]->Project();
+                double true_delta_0 = new_lambda_0 - old_lambda_friction[0];
+                constraints.IncrementState(ic, true_delta_0);
 
-                    // After projection, the lambda may have changed a bit..
-                    double new_lambda = mconstraints[ic]->GetLagrangeMultiplier();
+                if (this->record_violation_history) {
+                    maxdeltalambda = std::max(maxdeltalambda, fabs(true_delta_0));
+                }
 
-                    // Apply the smoothing: lambda= sharpness*lambda_new_projected + (1-sharpness)*lambda_old
-                    if (m_shlambda != 1.0) {
-                        new_lambda = m_shlambda * new_lambda + (1.0 - m_shlambda) * old_lambda;
-                        mconstraints[ic]->SetLagrangeMultiplier(new_lambda);
-                    }
+            } else {
+                // update:   lambda += delta_lambda;
+                double old_lambda = constraints.GetLagrangeMultiplier(ic);
+                constraints.SetLagrangeMultiplier(ic, old_lambda + deltal);
 
-                    double true_delta = new_lambda - old_lambda;
+                // If new lagrangian multiplier does not satisfy inequalities, project
+                // it into an admissible orthant (or, in general, onto an admissible set)
+                constraints.Project(ic);
 
-                    // For all items with variables, add the effect of incremented
-                    // (and projected) lagrangian reactions:
-                    mconstraints[ic]->IncrementState(true_delta);
+                // After projection, the lambda may have changed a bit..
+                double new_lambda = constraints.GetLagrangeMultiplier(ic);
 
-                    if (this->record_violation_history)
-                        maxdeltalambda = std::max(maxdeltalambda, fabs(true_delta));
+                // Apply the smoothing: lambda= sharpness*lambda_new_projected + (1-sharpness)*lambda_old
+                if (m_shlambda != 1.0) {
+                    new_lambda = m_shlambda * new_lambda + (1.0 - m_shlambda) * old_lambda;
+                    constraints.SetLagrangeMultiplier(ic, new_lambda);
                 }
 
-                maxviolation = std::max(maxviolation, fabs(candidate_violation));
+                double true_delta = new_lambda - old_lambda;
 
-            }  // end IsActive()
+                // Add the effect of incremented (and projected) lagrangian reactions
+                constraints.IncrementState(ic, true_delta);
+
+                if (this->record_violation_history)
+                    maxdeltalambda = std::max(maxdeltalambda, fabs(true_delta));
+            }
+
+            maxviolation = std::max(maxviolation, fabs(candidate_violation));
 
         }  // end loop on constraints
 
@@ -203,8 +223,6 @@ double ChSolverPSOR::Solve(ChSystemDescriptor& sysd) {
             break;
 
     }  // end iteration loop
-
-    return maxviolation;
 }
 
 }  // end namespace chrono
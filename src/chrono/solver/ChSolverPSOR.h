@@ -44,7 +44,14 @@ class ChApi ChSolverPSOR : public ChIterativeSolverVI {
     /// For the PSOR solver, this is the maximum constraint violation.
     virtual double GetError() const override { return maxviolation; }
 
-  private:
+  protected:
+    /// Perform the PSOR iterations on the packed constraint data.
+    virtual void SolvePacked(ChPackedConstraints& pc);
+
+    /// Perform the solver iterations on the given constraints (ChUnpackedConstraints or ChPackedConstraints).
+    template <class Constraints>
+    void Iterate(Constraints& constraints);
+
     double maxviolation;
 };
 
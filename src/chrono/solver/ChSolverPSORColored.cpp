@@ -0,0 +1,275 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#include <algorithm>
+
+#include "chrono/solver/ChSolverPSORColored.h"
+#include "chrono/utils/ChOpenMP.h"
+
+namespace chrono {
+
+// Register into the object factory, to enable run-time dynamic creation and persistence
+CH_FACTORY_REGISTER(ChSolverPSORColored)
+CH_UPCASTING(ChSolverPSORColored, ChSolverPSOR)
+
+// Maximum number of colors assigned to units. Units that cannot be colored are processed sequentially.
+static const int max_colors = 64;
+
+ChSolverPSORColored::ChSolverPSORColored()
+    : m_nthreads(1), m_num_colors(0), m_sequential_color(false), m_coloring_reused(false) {
+    m_use_packed = true;
+}
+
+void ChSolverPSORColored::SetNumThreads(int nthreads) {
+    m_nthreads = std::max(1, nthreads);
+}
+
+bool ChSolverPSORColored::BuildUnits(const ChPackedConstraints& pc) {
+    const unsigned int nConstr = pc.GetNumConstraints();
+
+    m_unit_constr.clear();
+    m_unit_triplet.clear();
+    m_unit_vars.clear();
+    m_unit_var_start.clear();
+    m_unit_var_start.push_back(0);
+
+    for (unsigned int ic = 0; ic < nConstr; ic++) {
+        if (!pc.IsActive(ic))
+            continue;
+
+        // The three components of a friction contact are coupled by the cone projection and form a single unit
+        bool triplet = false;
+        if (pc.GetMode(ic) == ChConstraint::Mode::FRICTION) {
+            if (pc.GetProjection(ic) != ChPackedConstraints::Projection::CONE || ic + 2 >= nConstr ||
+                !pc.IsActive(ic + 1) || !pc.IsActive(ic + 2) ||
+                pc.GetMode(ic + 1) != ChConstraint::Mode::FRICTION ||
+                pc.GetMode(ic + 2) != ChConstraint::Mode::FRICTION)
+                return false;
+            triplet = true;
+        }
+        unsigned int ic_last = triplet ? ic + 2 : ic;
+
+        m_unit_constr.push_back(ic);
+        m_unit_triplet.push_back(triplet);
+
+        auto first_var = m_unit_vars.size();
+        for (unsigned int k = pc.GetFirstBlock(ic); k < pc.GetFirstBlock(ic_last + 1); k++) {
+            unsigned int offset = pc.GetBlockOffset(k);
+            if (std::find(m_unit_vars.begin() + first_var, m_unit_vars.end(), offset) == m_unit_vars.end())
+                m_unit_vars.push_back(offset);
+        }
+        m_unit_var_start.push_back((unsigned int)m_unit_vars.size());
+
+        ic = ic_last;
+    }
+
+    return true;
+}
+
+void ChSolverPSORColored::UpdateColoring(unsigned int n_q) {
+    // Nothing to do if all units act on the same variables as in the previous solve
+    m_coloring_reused = (m_unit_var_start == m_prev_unit_var_start && m_unit_vars == m_prev_unit_vars);
+    if (m_coloring_reused)
+        return;
+
+    const unsigned int nUnits = (unsigned int)m_unit_constr.size();
+
+    std::unordered_map<std::uint64_t, int> colors;
+    colors.reserve(nUnits);
+
+    m_var_colors.assign(n_q, 0);
+    m_unit_color.resize(nUnits);
+
+    std::vector<unsigned int> color_count(max_colors + 1, 0);
+
+    for (unsigned int u = 0; u < nUnits; u++) {
+        // Collect the colors already used by units acting on the same variables
+        std::uint64_t used = 0;
+        std::uint64_t key = 14695981039346656037ULL;
+        for (unsigned int j = m_unit_var_start[u]; j < m_unit_var_start[u + 1]; j++) {
+            used |= m_var_colors[m_unit_vars[j]];
+            key = (key ^ m_unit_vars[j]) * 1099511628211ULL;
+        }
+
+        // Keep the previous color of this unit, if still available; otherwise pick the first available color
+        int color = max_colors;
+        auto prev = m_prev_colors.find(key);
+        if (prev != m_prev_colors.end() && prev->second < max_colors && !(used & (std::uint64_t(1) << prev->second))) {
+            color = prev->second;
+        } else {
+            for (int c = 0; c < max_colors; c++) {
+                if (!(used & (std::uint64_t(1) << c))) {
+                    color = c;
+                    break;
+                }
+            }
+        }
+
+        if (color < max_colors) {
+            for (unsigned int j = m_unit_var_start[u]; j < m_unit_var_start[u + 1]; j++)
+                m_var_colors[m_unit_vars[j]] |= (std::uint64_t(1) << color);
+        }
+
+        m_unit_color[u] = color;
+        color_count[color]++;
+        colors.emplace(key, color);
+    }
+
+    // Sort units by color (preserving the constraint order within a color), skipping unused colors
+    std::vector<unsigned int> color_pos(max_colors + 1, 0);
+    m_color_start.clear();
+    m_color_start.push_back(0);
+    unsigned int pos = 0;
+    for (int c = 0; c <= max_colors; c++) {
+        color_pos[c] = pos;
+        if (color_count[c] > 0) {
+            pos += color_count[c];
+            m_color_start.push_back(pos);
+        }
+    }
+    m_num_colors = (unsigned int)m_color_start.size() - 1;
+    m_sequential_color = color_count[max_colors] > 0;
+
+    m_color_units.resize(nUnits);
+    for (unsigned int u = 0; u < nUnits; u++)
+        m_color_units[color_pos[m_unit_color[u]]++] = u;
+
+    m_prev_unit_var_start = m_unit_var_start;
+    m_prev_unit_vars = m_unit_vars;
+    m_prev_colors.swap(colors);
+}
+
+void ChSolverPSORColored::SolveUnit(ChPackedConstraints& pc,
+                                    unsigned int u,
+                                    double& violation,
+                                    double& deltalambda) const {
+    unsigned int ic = m_unit_constr[u];
+
+    if (m_unit_triplet[u]) {
+        // Update all three components before projecting on the friction cone
+        double old_lambda[3];
+        double residual_n = 0;
+        for (unsigned int k = 0; k < 3; k++) {
+            // compute residual  c_i = [Cq_i]*q + b_i + cfm_i*l_i
+            double mresidual = pc.ComputeJacobianTimesState(ic + k) + pc.GetRightHandSide(ic + k) +
+                               pc.GetComplianceTerm(ic + k) * pc.GetLagrangeMultiplier(ic + k);
+            if (k == 0)
+                residual_n = mresidual;
+
+            // compute:  delta_lambda = -(omega/g_i) * ([Cq_i]*q + b_i + cfm_i*l_i )
+            double deltal = (m_omega / pc.GetSchurComplement(ic + k)) * (-mresidual);
+
+            // update:   lambda += delta_lambda;
+            old_lambda[k] = pc.GetLagrangeMultiplier(ic + k);
+            pc.SetLagrangeMultiplier(ic + k, old_lambda[k] + deltal);
+        }
+
+        pc.Project(ic);  // the N normal component will take care of N,U,V
+
+        for (unsigned int k = 0; k < 3; k++) {
+            double new_lambda = pc.GetLagrangeMultiplier(ic + k);
+            // Apply the smoothing: lambda= sharpness*lambda_new_projected + (1-sharpness)*lambda_old
+            if (m_shlambda != 1.0) {
+                new_lambda = m_shlambda * new_lambda + (1.0 - m_shlambda) * old_lambda[k];
+                pc.SetLagrangeMultiplier(ic + k, new_lambda);
+            }
+            double true_delta = new_lambda - old_lambda[k];
+            pc.IncrementState(ic + k, true_delta);
+
+            if (this->record_violation_history)
+                deltalambda = std::max(deltalambda, fabs(true_delta));
+        }
+
+        violation = std::max(violation, fabs(std::min(0.0, residual_n)));
+        return;
+    }
+
+    // compute residual  c_i = [Cq_i]*q + b_i + cfm_i*l_i
+    double mresidual =
+        pc.ComputeJacobianTimesState(ic) + pc.GetRightHandSide(ic) + pc.GetComplianceTerm(ic) * pc.GetLagrangeMultiplier(ic);
+
+    // compute:  delta_lambda = -(omega/g_i) * ([Cq_i]*q + b_i + cfm_i*l_i )
+    double deltal = (m_omega / pc.GetSchurComplement(ic)) * (-mresidual);
+
+    // update:   lambda += delta_lambda;
+    double old_lambda = pc.GetLagrangeMultiplier(ic);
+    pc.SetLagrangeMultiplier(ic, old_lambda + deltal);
+
+    // If new lagrangian multiplier does not satisfy inequalities, project it into an admissible orthant
+    pc.Project(ic);
+
+    double new_lambda = pc.GetLagrangeMultiplier(ic);
+
+    // Apply the smoothing: lambda= sharpness*lambda_new_projected + (1-sharpness)*lambda_old
+    if (m_shlambda != 1.0) {
+        new_lambda = m_shlambda * new_lambda + (1.0 - m_shlambda) * old_lambda;
+        pc.SetLagrangeMultiplier(ic, new_lambda);
+    }
+
+    double true_delta = new_lambda - old_lambda;
+    pc.IncrementState(ic, true_delta);
+
+    if (this->record_violation_history)
+        deltalambda = std::max(deltalambda, fabs(true_delta));
+
+    // true constraint violation may be different from 'mresidual' (ex:clamped if unilateral)
+    violation = std::max(violation, fabs(pc.Violation(ic, mresidual)));
+}
+
+void ChSolverPSORColored::SolvePacked(ChPackedConstraints& pc) {
+    // Fall back to sequential sweeps if the constraints cannot be partitioned in units
+    if (!BuildUnits(pc)) {
+        m_num_colors = 0;
+        m_prev_unit_var_start.clear();
+        m_prev_unit_vars.clear();
+        ChSolverPSOR::SolvePacked(pc);
+        return;
+    }
+
+    UpdateColoring((unsigned int)pc.State().size());
+
+    m_thread_violation.resize(m_nthreads);
+    m_thread_deltalambda.resize(m_nthreads);
+
+    for (int iter = 0; iter < m_max_iterations; iter++) {
+        std::fill(m_thread_violation.begin(), m_thread_violation.end(), 0.0);
+        std::fill(m_thread_deltalambda.begin(), m_thread_deltalambda.end(), 0.0);
+
+        // Sweep the colors in sequence; units of the same color do not share variables and are updated in parallel
+        for (unsigned int c = 0; c < m_num_colors; c++) {
+            int start = (int)m_color_start[c];
+            int end = (int)m_color_start[c + 1];
+            int nthreads = (m_sequential_color && c == m_num_colors - 1) ? 1 : m_nthreads;
+
+#pragma omp parallel for schedule(static) num_threads(nthreads)
+            for (int j = start; j < end; j++) {
+                int t = ChOMP::GetThreadNum();
+                SolveUnit(pc, m_color_units[j], m_thread_violation[t], m_thread_deltalambda[t]);
+            }
+        }
+
+        maxviolation = *std::max_element(m_thread_violation.begin(), m_thread_violation.end());
+        double maxdeltalambda = *std::max_element(m_thread_deltalambda.begin(), m_thread_deltalambda.end());
+
+        // For recording into violation history, if debugging
+        if (this->record_violation_history)
+            AtIterationEnd(maxviolation, maxdeltalambda, iter);
+
+        m_iterations++;
+
+        // Terminate the loop if violation in constraints has been successfully limited.
+        if (maxviolation < m_tolerance)
+            break;
+    }
+}
+
+}  // end namespace chrono
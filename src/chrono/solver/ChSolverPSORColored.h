@@ -0,0 +1,104 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#ifndef CHSOLVER_PSOR_COLORED_H
+#define CHSOLVER_PSOR_COLORED_H
+
+#include <cstdint>
+#include <unordered_map>
+
+#include "chrono/solver/ChSolverPSOR.h"
+
+namespace chrono {
+
+/// @addtogroup chrono_solver
+/// @{
+
+/// Multithreaded variant of the projected SOR solver, based on graph coloring.\n
+/// Constraints are grouped in units (single constraints, or N-U-V friction triplets which are projected together) and
+/// units are colored so that no two units of the same color act on the same ChVariables. Each iteration then sweeps
+/// the colors in sequence, processing all units of a color in parallel. The coloring is rebuilt only when the
+/// structure of the constraint set changes and, in that case, units that were already present keep their color
+/// whenever possible.
+///
+/// This solver always operates on the packed constraint data (see ChSystemDescriptor::PackConstraints). If the system
+/// contains constraints that do not support packing, it reverts to the sequential PSOR algorithm.
+/// Because of the different sweep order, results differ from those of ChSolverPSOR, but do not depend on the number
+/// of threads.
+///
+/// See ChSystemDescriptor for more information about the problem formulation and the data structures passed to the
+/// solver.
+class ChApi ChSolverPSORColored : public ChSolverPSOR {
+  public:
+    ChSolverPSORColored();
+
+    ~ChSolverPSORColored() {}
+
+    virtual Type GetType() const override { return Type::PSOR_COLORED; }
+
+    /// Set the number of OpenMP threads used for the colored sweeps (default: 1).
+    virtual void SetNumThreads(int nthreads) override;
+
+    /// Return the number of OpenMP threads used for the colored sweeps.
+    int GetNumThreads() const { return m_nthreads; }
+
+    /// Return the number of colors used in the last solve.
+    /// Units that could not be colored (because they act on variables shared by too many other units) are processed
+    /// sequentially, as an additional color.
+    unsigned int GetNumColors() const { return m_num_colors; }
+
+    /// Return true if the coloring from the previous solve was reused as-is during the last solve.
+    bool IsColoringReused() const { return m_coloring_reused; }
+
+  protected:
+    /// Perform the colored PSOR iterations on the packed constraint data.
+    virtual void SolvePacked(ChPackedConstraints& pc) override;
+
+    /// Partition the active constraints in units and record the variables each unit acts on.
+    /// Return false if the constraints cannot be partitioned (e.g., incomplete friction triplets).
+    bool BuildUnits(const ChPackedConstraints& pc);
+
+    /// Perform the PSOR update for unit u.
+    void SolveUnit(ChPackedConstraints& pc, unsigned int u, double& violation, double& deltalambda) const;
+
+    int m_nthreads;
+
+    std::vector<unsigned int> m_unit_constr;     ///< first constraint in unit
+    std::vector<char> m_unit_triplet;            ///< unit is a friction triplet
+    std::vector<unsigned int> m_unit_var_start;  ///< first entry in m_unit_vars (size: num. units + 1)
+    std::vector<unsigned int> m_unit_vars;       ///< offsets of variables acted upon by each unit
+
+  private:
+    /// Color the units, reusing the previous coloring where possible.
+    void UpdateColoring(unsigned int n_q);
+
+    std::vector<unsigned int> m_prev_unit_var_start;
+    std::vector<unsigned int> m_prev_unit_vars;
+    std::unordered_map<std::uint64_t, int> m_prev_colors;  ///< unit key -> color in previous coloring
+
+    std::vector<int> m_unit_color;              ///< color of each unit
+    std::vector<std::uint64_t> m_var_colors;    ///< colors used by units acting on each variable (bitmask)
+    std::vector<unsigned int> m_color_start;    ///< first entry in m_color_units (size: num. colors + 1)
+    std::vector<unsigned int> m_color_units;    ///< units, sorted by color
+    unsigned int m_num_colors;                  ///< number of colors (including the sequential one, if present)
+    bool m_sequential_color;                    ///< the last color contains units that could not be colored
+    bool m_coloring_reused;
+
+    std::vector<double> m_thread_violation;
+    std::vector<double> m_thread_deltalambda;
+};
+
+/// @} chrono_solver
+
+}  // end namespace chrono
+
+#endif
@@ -0,0 +1,149 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <numeric>
+
+#include "chrono/solver/ChSolverPSORIslands.h"
+
+namespace chrono {
+
+// Register into the object factory, to enable run-time dynamic creation and persistence
+CH_FACTORY_REGISTER(ChSolverPSORIslands)
+CH_UPCASTING(ChSolverPSORIslands, ChSolverPSORColored)
+
+ChSolverPSORIslands::ChSolverPSORIslands() {
+    m_island_start.push_back(0);
+}
+
+int ChSolverPSORIslands::GetTotalIslandIterations() const {
+    return std::accumulate(m_island_iterations.begin(), m_island_iterations.end(), 0);
+}
+
+unsigned int ChSolverPSORIslands::FindRoot(unsigned int v) {
+    while (m_var_parent[v] != v) {
+        m_var_parent[v] = m_var_parent[m_var_parent[v]];
+        v = m_var_parent[v];
+    }
+    return v;
+}
+
+void ChSolverPSORIslands::BuildIslands(unsigned int n_q) {
+    const unsigned int nUnits = (unsigned int)m_unit_constr.size();
+
+    // Join the variables acted upon by each unit
+    m_var_parent.resize(n_q);
+    std::iota(m_var_parent.begin(), m_var_parent.end(), 0);
+
+    for (unsigned int u = 0; u < nUnits; u++) {
+        if (m_unit_var_start[u] == m_unit_var_start[u + 1])
+            continue;
+        unsigned int root = FindRoot(m_unit_vars[m_unit_var_start[u]]);
+        for (unsigned int j = m_unit_var_start[u] + 1; j < m_unit_var_start[u + 1]; j++) {
+            unsigned int other = FindRoot(m_unit_vars[j]);
+            if (other != root)
+                m_var_parent[other] = root;
+        }
+    }
+
+    // Number the islands in order of first appearance and count their units.
+    // Units that do not act on any variable form islands of their own.
+    std::vector<int> root_island(n_q, -1);
+    std::vector<unsigned int> unit_island(nUnits);
+    std::vector<unsigned int> island_count;
+    for (unsigned int u = 0; u < nUnits; u++) {
+        int island = -1;
+        if (m_unit_var_start[u] != m_unit_var_start[u + 1]) {
+            unsigned int root = FindRoot(m_unit_vars[m_unit_var_start[u]]);
+            if (root_island[root] < 0) {
+                root_island[root] = (int)island_count.size();
+                island_count.push_back(0);
+            }
+            island = root_island[root];
+        } else {
+            island = (int)island_count.size();
+            island_count.push_back(0);
+        }
+        unit_island[u] = (unsigned int)island;
+        island_count[island]++;
+    }
+
+    // Order islands by decreasing size, so that the largest ones are scheduled first
+    const unsigned int nIslands = (unsigned int)island_count.size();
+    std::vector<unsigned int> order(nIslands);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(),
+                     [&island_count](unsigned int a, unsigned int b) { return island_count[a] > island_count[b]; });
+
+    std::vector<unsigned int> island_pos(nIslands);
+    m_island_start.resize(nIslands + 1);
+    m_island_start[0] = 0;
+    for (unsigned int k = 0; k < nIslands; k++) {
+        island_pos[order[k]] = m_island_start[k];
+        m_island_start[k + 1] = m_island_start[k] + island_count[order[k]];
+    }
+
+    // Sort units by island, preserving the constraint order within an island
+    m_island_units.resize(nUnits);
+    for (unsigned int u = 0; u < nUnits; u++)
+        m_island_units[island_pos[unit_island[u]]++] = u;
+}
+
+void ChSolverPSORIslands::SolvePacked(ChPackedConstraints& pc) {
+    // Fall back to sequential sweeps if the constraints cannot be partitioned in units
+    if (!BuildUnits(pc)) {
+        m_island_start.assign(1, 0);
+        m_island_iterations.clear();
+        ChSolverPSOR::SolvePacked(pc);
+        return;
+    }
+
+    BuildIslands((unsigned int)pc.State().size());
+
+    const int nIslands = (int)GetNumIslands();
+    m_island_iterations.assign(nIslands, 0);
+    m_island_violation.assign(nIslands, 0.0);
+    m_island_deltalambda.assign(nIslands, 0.0);
+
+    // Islands do not share variables: each one is swept sequentially by a single thread, until its own violation is
+    // below tolerance
+#pragma omp parallel for schedule(dynamic, 1) num_threads(m_nthreads)
+    for (int i = 0; i < nIslands; i++) {
+        for (int iter = 0; iter < m_max_iterations; iter++) {
+            double violation = 0;
+            double deltalambda = 0;
+            for (unsigned int j = m_island_start[i]; j < m_island_start[i + 1]; j++)
+                SolveUnit(pc, m_island_units[j], violation, deltalambda);
+
+            m_island_iterations[i]++;
+            m_island_violation[i] = violation;
+            m_island_deltalambda[i] = deltalambda;
+
+            if (violation < m_tolerance)
+                break;
+        }
+    }
+
+    maxviolation = 0;
+    double maxdeltalambda = 0;
+    for (int i = 0; i < nIslands; i++) {
+        m_iterations = std::max(m_iterations, m_island_iterations[i]);
+        maxviolation = std::max(maxviolation, m_island_violation[i]);
+        maxdeltalambda = std::max(maxdeltalambda, m_island_deltalambda[i]);
+    }
+
+    // Islands iterate independently; only the final state is recorded into the violation history
+    if (this->record_violation_history && m_iterations > 0)
+        AtIterationEnd(maxviolation, maxdeltalambda, m_iterations - 1);
+}
+
+}  // end namespace chrono
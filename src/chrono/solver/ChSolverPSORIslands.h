@@ -0,0 +1,87 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#ifndef CHSOLVER_PSOR_ISLANDS_H
+#define CHSOLVER_PSOR_ISLANDS_H
+
+#include "chrono/solver/ChSolverPSORColored.h"
+
+namespace chrono {
+
+/// @addtogroup chrono_solver
+/// @{
+
+/// Multithreaded variant of the projected SOR solver, based on a decomposition of the problem in islands.\n
+/// An island is a set of ChVariables connected (directly or indirectly) by active constraints; variables of fixed
+/// bodies are not part of the problem and therefore do not connect islands. Islands are independent sub-problems:
+/// they are solved concurrently, each with sequential PSOR sweeps over its own constraints, and each island iterates
+/// only until its own constraint violation falls below the tolerance (or the maximum number of iterations is reached).
+/// Small or quiescent islands therefore stop early, while the iteration budget is spent on the islands that need it.
+///
+/// The island decomposition is recomputed at each solve, with a union-find pass over the variables acted upon by the
+/// constraints (linear in the number of constraints).
+///
+/// This solver always operates on the packed constraint data (see ChSystemDescriptor::PackConstraints). If the system
+/// contains constraints that do not support packing, it reverts to the sequential PSOR algorithm.
+/// Within an island, constraints are swept in the same order as in ChSolverPSOR; results do not depend on the number
+/// of threads.
+///
+/// See ChSystemDescriptor for more information about the problem formulation and the data structures passed to the
+/// solver.
+class ChApi ChSolverPSORIslands : public ChSolverPSORColored {
+  public:
+    ChSolverPSORIslands();
+
+    ~ChSolverPSORIslands() {}
+
+    virtual Type GetType() const override { return Type::PSOR_ISLANDS; }
+
+    /// Return the number of islands in the last solve.
+    unsigned int GetNumIslands() const { return (unsigned int)m_island_start.size() - 1; }
+
+    /// Return the number of constraint units (single constraints or friction triplets) in the given island.
+    unsigned int GetIslandSize(unsigned int island) const {
+        return m_island_start[island + 1] - m_island_start[island];
+    }
+
+    /// Return the number of iterations performed on the given island during the last solve.
+    int GetIslandIterations(unsigned int island) const { return m_island_iterations[island]; }
+
+    /// Return the total number of island iterations during the last solve (sum over all islands).
+    /// Note that GetIterations() returns the largest number of iterations performed on any single island.
+    int GetTotalIslandIterations() const;
+
+  protected:
+    /// Perform the PSOR iterations on the packed constraint data, concurrently over islands.
+    virtual void SolvePacked(ChPackedConstraints& pc) override;
+
+  private:
+    /// Partition the units in islands, with a union-find pass over the variables they act upon.
+    /// Islands are ordered by decreasing size; units keep their constraint order within an island.
+    void BuildIslands(unsigned int n_q);
+
+    /// Return the representative of the set containing variable offset v (with path halving).
+    unsigned int FindRoot(unsigned int v);
+
+    std::vector<unsigned int> m_var_parent;    ///< union-find forest over variable offsets
+    std::vector<unsigned int> m_island_start;  ///< first entry in m_island_units (size: num. islands + 1)
+    std::vector<unsigned int> m_island_units;  ///< units, sorted by island
+    std::vector<int> m_island_iterations;      ///< iterations performed on each island
+    std::vector<double> m_island_violation;    ///< constraint violation of each island
+    std::vector<double> m_island_deltalambda;  ///< max. change of multipliers in last iteration of each island
+};
+
+/// @} chrono_solver
+
+}  // end namespace chrono
+
+#endif
@@ -26,9 +26,6 @@ double ChSolverPSSOR::Solve(ChSystemDescriptor& sysd) {
     std::vector<ChVariables*>& mvariables = sysd.GetVariables();
 
     maxviolation = 0;
-    double maxdeltalambda = 0.;
-    int i_friction_comp = 0;
-    double old_lambda_friction[3];
     const unsigned int nConstr = (unsigned int)mconstraints.size();
     const unsigned int nVars = (unsigned int)mvariables.size();
 
@@ -73,6 +70,34 @@ double ChSolverPSSOR::Solve(ChSystemDescriptor& sysd) {
     }
 
     // 4)  Perform the iteration loops
+    //     (on the flattened constraint data, if so requested and if supported by all constraints)
+    if (m_use_packed && sysd.PackConstraints()) {
+        SolvePacked(sysd.GetPackedConstraints());
+        sysd.UnpackConstraints();
+        return maxviolation;
+    }
+
+    ChUnpackedConstraints constraints(mconstraints);
+    Iterate(constraints);
+
+    return maxviolation;
+}
+
+void ChSolverPSSOR::SolvePacked(ChPackedConstraints& pc) {
+    Iterate(pc);
+}
+
+// Perform the PSSOR iterations (alternating forward and backward sweeps).
+// The same loop runs on the constraint objects (ChUnpackedConstraints) or on their packed representation
+// (ChPackedConstraints).
+template <class Constraints>
+void ChSolverPSSOR::Iterate(Constraints& constraints) {
+    const unsigned int nConstr = constraints.GetNumConstraints();
+
+    double maxdeltalambda = 0.;
+    int i_friction_comp = 0;
+    double old_lambda_friction[3];
+
     for (int iter = 0; iter < m_max_iterations;) {
         //
         // Forward sweep, for symmetric SOR
@@ -80,51 +105,50 @@ double ChSolverPSSOR::Solve(ChSystemDescriptor& sysd) {
         maxviolation = 0;
         maxdeltalambda = 0;
         i_friction_comp = 0;
-        size_t dummy = mconstraints.size();
-        for (size_t ic = 0; ic < dummy; ic++) {
+        for (unsigned int ic = 0; ic < nConstr; ic++) {
             // skip computations if constraint not active.
-            if (mconstraints[ic]->IsActive()) {
+            if (constraints.IsActive(ic)) {
                 // compute residual  c_i = [Cq_i]*q + b_i + cfm_i*l_i
-                double mresidual = mconstraints[ic]->ComputeJacobianTimesState() + mconstraints[ic]->GetRightHandSide() +
-                                   mconstraints[ic]->GetComplianceTerm() * mconstraints[ic]->GetLagrangeMultiplier();
+                double mresidual = constraints.ComputeJacobianTimesState(ic) + constraints.GetRightHandSide(ic) +
+                                   constraints.GetComplianceTerm(ic) * constraints.GetLagrangeMultiplier(ic);
 
                 // true constraint violation may be different from 'mresidual' (ex:clamped if unilateral)
-                double candidate_violation = fabs(mconstraints[ic]->Violation(mresidual));
+                double candidate_violation = fabs(constraints.Violation(ic, mresidual));
 
                 // compute:  delta_lambda = -(omega/g_i) * ([Cq_i]*q + b_i + cfm_i*l_i )
-                double deltal = (m_omega / mconstraints[ic]->GetSchurComplement()) * (-mresidual);
+                double deltal = (m_omega / constraints.GetSchurComplement(ic)) * (-mresidual);
 
-                if (mconstraints[ic]->GetMode() == ChConstraint::Mode::FRICTION) {
+                if (constraints.GetMode(ic) == ChConstraint::Mode::FRICTION) {
                     candidate_violation = 0;
                     // update:   lambda += delta_lambda;
-                    old_lambda_friction[i_friction_comp] = mconstraints[ic]->GetLagrangeMultiplier();
-                    mconstraints[ic]->SetLagrangeMultiplier(old_lambda_friction[i_friction_comp] + deltal);
+                    old_lambda_friction[i_friction_comp] = constraints.GetLagrangeMultiplier(ic);
+                    constraints.SetLagrangeMultiplier(ic, old_lambda_friction[i_friction_comp] + deltal);
                     i_friction_comp++;
 
                     if (i_friction_comp == 1)
                         candidate_violation = fabs(std::min(0.0, mresidual));
 
                     if (i_friction_comp == 3) {
-                        mconstraints[ic - 2]->Project();  // the N normal component will take care of N,U,V
+                        constraints.Project(ic - 2);  // the N normal component will take care of N,U,V
 
-                        double new_lambda_0 = mconstraints[ic - 2]->GetLagrangeMultiplier();
-                        double new_lambda_1 = mconstraints[ic - 1]->GetLagrangeMultiplier();
-                        double new_lambda_2 = mconstraints[ic - 0]->GetLagrangeMultiplier();
+                        double new_lambda_0 = constraints.GetLagrangeMultiplier(ic - 2);
+                        double new_lambda_1 = constraints.GetLagrangeMultiplier(ic - 1);
+                        double new_lambda_2 = constraints.GetLagrangeMultiplier(ic - 0);
                         // Apply the smoothing: lambda= sharpness*lambda_new_projected + (1-sharpness)*lambda_old
                         if (m_shlambda != 1.0) {
                             new_lambda_0 = m_shlambda * new_lambda_0 + (1.0 - m_shlambda) * old_lambda_friction[0];
                             new_lambda_1 = m_shlambda * new_lambda_1 + (1.0 - m_shlambda) * old_lambda_friction[1];
                             new_lambda_2 = m_shlambda * new_lambda_2 + (1.0 - m_shlambda) * old_lambda_friction[2];
-                            mconstraints[ic - 2]->SetLagrangeMultiplier(new_lambda_0);
-                            mconstraints[ic - 1]->SetLagrangeMultiplier(new_lambda_1);
-                            mconstraints[ic - 0]->SetLagrangeMultiplier(new_lambda_2);
+                            constraints.SetLagrangeMultiplier(ic - 2, new_lambda_0);
+                            constraints.SetLagrangeMultiplier(ic - 1, new_lambda_1);
+                            constraints.SetLagrangeMultiplier(ic - 0, new_lambda_2);
                         }
                         double true_delta_0 = new_lambda_0 - old_lambda_friction[0];
                         double true_delta_1 = new_lambda_1 - old_lambda_friction[1];
                         double true_delta_2 = new_lambda_2 - old_lambda_friction[2];
-                        mconstraints[ic - 2]->IncrementState(true_delta_0);
-                        mconstraints[ic - 1]->IncrementState(true_delta_1);
-                        mconstraints[ic - 0]->IncrementState(true_delta_2);
+                        constraints.IncrementState(ic - 2, true_delta_0);
+                        constraints.IncrementState(ic - 1, true_delta_1);
+                        constraints.IncrementState(ic - 0, true_delta_2);
 
                         if (this->record_violation_history) {
                             maxdeltalambda = std::max(maxdeltalambda, fabs(true_delta_0));
@@ -135,27 +159,27 @@ double ChSolverPSSOR::Solve(ChSystemDescriptor& sysd) {
                     }
                 } else {
                     // update:   lambda += delta_lambda;
-                    double old_lambda = mconstraints[ic]->GetLagrangeMultiplier();
-                    mconstraints[ic]->SetLagrangeMultiplier(old_lambda + deltal);
+                    double old_lambda = constraints.GetLagrangeMultiplier(ic);
+                    constraints.SetLagrangeMultiplier(ic, old_lambda + deltal);
 
                     // If new lagrangian multiplier does not satisfy inequalities, project
                     // it into an admissible orthant (or, in general, onto an admissible set)
-                    mconstraints[ic]->Project();
+                    constraints.Project(ic);
 
                     // After projection, the lambda may have changed a bit..
-                    double new_lambda = mconstraints[ic]->GetLagrangeMultiplier();
+                    double new_lambda = constraints.GetLagrangeMultiplier(ic);
 
                     // Apply the smoothing: lambda= sharpness*lambda_new_projected + (1-sharpness)*lambda_old
                     if (m_shlambda != 1.0) {
                         new_lambda = m_shlambda * new_lambda + (1.0 - m_shlambda) * old_lambda;
-                        mconstraints[ic]->SetLagrangeMultiplier(new_lambda);
+                        constraints.SetLagrangeMultiplier(ic, new_lambda);
                     }
 
                     double true_delta = new_lambda - old_lambda;
 
                     // For all items with variables, add the effect of incremented
                     // (and projected) lagrangian reactions:
-                    mconstraints[ic]->IncrementState(true_delta);
+                    constraints.IncrementState(ic, true_delta);
 
                     if (this->record_violation_history)
                         maxdeltalambda = std::max(maxdeltalambda, fabs(true_delta));
@@ -188,44 +212,44 @@ double ChSolverPSSOR::Solve(ChSystemDescriptor& sysd) {
 
         for (int ic = (nConstr - 1); ic >= 0; ic--) {
             // skip computations if constraint not active.
-            if (mconstraints[ic]->IsActive()) {
+            if (constraints.IsActive(ic)) {
                 // compute residual  c_i = [Cq_i]*q + b_i + cfm_i*l_i
-                double mresidual = mconstraints[ic]->ComputeJacobianTimesState() + mconstraints[ic]->GetRightHandSide() +
-                                   mconstraints[ic]->GetComplianceTerm() * mconstraints[ic]->GetLagrangeMultiplier();
+                double mresidual = constraints.ComputeJacobianTimesState(ic) + constraints.GetRightHandSide(ic) +
+                                   constraints.GetComplianceTerm(ic) * constraints.GetLagrangeMultiplier(ic);
 
                 // true constraint violation may be different from 'mresidual' (ex:clamped if unilateral)
-                double candidate_violation = fabs(mconstraints[ic]->Violation(mresidual));
+                double candidate_violation = fabs(constraints.Violation(ic, mresidual));
 
                 // compute:  delta_lambda = -(omega/g_i) * ([Cq_i]*q + b_i + cfm_i*l_i )
-                double deltal = (m_omega / mconstraints[ic]->GetSchurComplement()) * (-mresidual);
+                double deltal = (m_omega / constraints.GetSchurComplement(ic)) * (-mresidual);
 
-                if (mconstraints[ic]->GetMode() == ChConstraint::Mode::FRICTION) {
+                if (constraints.GetMode(ic) == ChConstraint::Mode::FRICTION) {
                     candidate_violation = 0;
                     // update:   lambda += delta_lambda;
-                    old_lambda_friction[i_friction_comp] = mconstraints[ic]->GetLagrangeMultiplier();
-                    mconstraints[ic]->SetLagrangeMultiplier(old_lambda_friction[i_friction_comp] + deltal);
+                    old_lambda_friction[i_friction_comp] = constraints.GetLagrangeMultiplier(ic);
+                    constraints.SetLagrangeMultiplier(ic, old_lambda_friction[i_friction_comp] + deltal);
                     i_friction_comp++;
                     if (i_friction_comp == 3) {
-                        mconstraints[ic]->Project();  // the N normal component will take care of N,U,V
+                        constraints.Project(ic);  // the N normal component will take care of N,U,V
 
-                        double new_lambda_0 = mconstraints[ic + 2]->GetLagrangeMultiplier();
-                        double new_lambda_1 = mconstraints[ic + 1]->GetLagrangeMultiplier();
-                        double new_lambda_2 = mconstraints[ic + 0]->GetLagrangeMultiplier();
+                        double new_lambda_0 = constraints.GetLagrangeMultiplier(ic + 2);
+                        double new_lambda_1 = constraints.GetLagrangeMultiplier(ic + 1);
+                        double new_lambda_2 = constraints.GetLagrangeMultiplier(ic + 0);
                         // Apply the smoothing: lambda= sharpness*lambda_new_projected + (1-sharpness)*lambda_old
                         if (m_shlambda != 1.0) {
                             new_lambda_0 = m_shlambda * new_lambda_0 + (1.0 - m_shlambda) * old_lambda_friction[0];
                             new_lambda_1 = m_shlambda * new_lambda_1 + (1.0 - m_shlambda) * old_lambda_friction[1];
                             new_lambda_2 = m_shlambda * new_lambda_2 + (1.0 - m_shlambda) * old_lambda_friction[2];
-                            mconstraints[ic + 2]->SetLagrangeMultiplier(new_lambda_0);
-                            mconstraints[ic + 1]->SetLagrangeMultiplier(new_lambda_1);
-                            mconstraints[ic + 0]->SetLagrangeMultiplier(new_lambda_2);
+                            constraints.SetLagrangeMultiplier(ic + 2, new_lambda_0);
+                            constraints.SetLagrangeMultiplier(ic + 1, new_lambda_1);
+                            constraints.SetLagrangeMultiplier(ic + 0, new_lambda_2);
                         }
                         double true_delta_0 = new_lambda_0 - old_lambda_friction[0];
                         double true_delta_1 = new_lambda_1 - old_lambda_friction[1];
                         double true_delta_2 = new_lambda_2 - old_lambda_friction[2];
-                        mconstraints[ic + 2]->IncrementState(true_delta_0);
-                        mconstraints[ic + 1]->IncrementState(true_delta_1);
-                        mconstraints[ic + 0]->IncrementState(true_delta_2);
+                        constraints.IncrementState(ic + 2, true_delta_0);
+                        constraints.IncrementState(ic + 1, true_delta_1);
+                        constraints.IncrementState(ic + 0, true_delta_2);
 
                         candidate_violation = fabs(std::min(0.0, mresidual));
 
@@ -238,27 +262,27 @@ double ChSolverPSSOR::Solve(ChSystemDescriptor& sysd) {
                     }
                 } else {
                     // update:   lambda += delta_lambda;
-                    double old_lambda = mconstraints[ic]->GetLagrangeMultiplier();
-                    mconstraints[ic]->SetLagrangeMultiplier(old_lambda + deltal);
+                    double old_lambda = constraints.GetLagrangeMultiplier(ic);
+                    constraints.SetLagrangeMultiplier(ic, old_lambda + deltal);
 
                     // If new lagrangian multiplier does not satisfy inequalities, project
                     // it into an admissible orthant (or, in general, onto an admissible set)
-                    mconstraints[ic]->Project();
+                    constraints.Project(ic);
 
                     // After projection, the lambda may have changed a bit..
-                    double new_lambda = mconstraints[ic]->GetLagrangeMultiplier();
+                    double new_lambda = constraints.GetLagrangeMultiplier(ic);
 
                     // Apply the smoothing: lambda= sharpness*lambda_new_projected + (1-sharpness)*lambda_old
                     if (m_shlambda != 1.0) {
                         new_lambda = m_shlambda * new_lambda + (1.0 - m_shlambda) * old_lambda;
-                        mconstraints[ic]->SetLagrangeMultiplier(new_lambda);
+                        constraints.SetLagrangeMultiplier(ic, new_lambda);
                     }
 
                     double true_delta = new_lambda - old_lambda;
 
                     // For all items with variables, add the effect of incremented
                     // (and projected) lagrangian reactions:
-                    mconstraints[ic]->IncrementState(true_delta);
+                    constraints.IncrementState(ic, true_delta);
 
                     if (this->record_violation_history)
                         maxdeltalambda = std::max(maxdeltalambda, fabs(true_delta));
@@ -280,8 +304,6 @@ double ChSolverPSSOR::Solve(ChSystemDescriptor& sysd) {
 
         iter++;
     }
-
-    return maxviolation;
 }
 
 }  // end namespace chrono
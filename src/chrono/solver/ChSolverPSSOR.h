@@ -50,6 +50,13 @@ CH_DEPRECATED("deprecated. Use ChSolverPSOR, ChSolverBB, or ChSolverAPGD instead
     virtual double GetError() const override { return maxviolation; }
 
   private:
+    /// Perform the PSSOR iterations on the packed constraint data.
+    void SolvePacked(ChPackedConstraints& pc);
+
+    /// Perform the solver iterations on the given constraints (ChUnpackedConstraints or ChPackedConstraints).
+    template <class Constraints>
+    void Iterate(Constraints& constraints);
+
     double maxviolation;
 };
 
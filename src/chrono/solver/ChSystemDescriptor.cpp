@@ -369,6 +369,36 @@ unsigned int ChSystemDescriptor::FromVectorToUnknowns(const ChVectorDynamic<>& m
     return n_q + n_c;
 }
 
+bool ChSystemDescriptor::PackConstraints() {
+    m_packed.Reset();
+
+    // Make sure the offsets of variables and constraints are up-to-date
+    unsigned int nq = CountActiveVariables();
+    CountActiveConstraints();
+
+    for (const auto& constr : m_constraints) {
+        m_packed.BeginConstraint(*constr);
+        if (constr->IsActive() && !constr->PackJacobian(m_packed)) {
+            m_packed.Reset();
+            return false;
+        }
+        m_packed.EndConstraint();
+    }
+
+    m_packed.Finalize(m_variables, nq);
+
+    return true;
+}
+
+void ChSystemDescriptor::UnpackConstraints() {
+    if (!m_packed.IsValid())
+        return;
+
+    m_packed.ScatterMultipliers(m_constraints);
+    m_packed.ScatterState(m_variables);
+    m_packed.Reset();
+}
+
 void ChSystemDescriptor::SchurComplementProduct(ChVectorDynamic<>& result,
                                                 const ChVectorDynamic<>& lvector,
                                                 std::vector<bool>* enabled) {
@@ -378,6 +408,36 @@ void ChSystemDescriptor::SchurComplementProduct(ChVectorDynamic<>& result,
 
     result.setZero(n_c);
 
+    // If available, use the packed constraint data (same operations as below, without virtual calls).
+    // Note that in this case the states of the ChVariables objects are not modified.
+    if (m_packed.IsValid()) {
+        m_packed_q.setZero(n_q);
+        unsigned int nconstr = m_packed.GetNumConstraints();
+
+        for (unsigned int ic = 0; ic < nconstr; ic++) {
+            if (m_packed.IsActive(ic)) {
+                int s_c = m_packed.GetOffset(ic);
+                if ((!enabled) || (*enabled)[s_c]) {
+                    double li = lvector(s_c);
+                    m_packed.IncrementVector(ic, m_packed_q.data(), li);
+                    result(s_c) = m_packed.GetComplianceTerm(ic) * li;
+                }
+            }
+        }
+
+        for (unsigned int ic = 0; ic < nconstr; ic++) {
+            if (m_packed.IsActive(ic)) {
+                int s_c = m_packed.GetOffset(ic);
+                if ((!enabled) || (*enabled)[s_c])
+                    result(s_c) += m_packed.JacobianTimesVector(ic, m_packed_q.data());
+                else
+                    result(s_c) = 0;
+            }
+        }
+
+        return;
+    }
+
     // Performs the sparse product    result = [N]*l = [ [Cq][M^(-1)][Cq'] - [E] ] *l
     // in different phases:
 
@@ -19,6 +19,7 @@
 
 #include "chrono/solver/ChConstraint.h"
 #include "chrono/solver/ChKRMBlock.h"
+#include "chrono/solver/ChPackedConstraints.h"
 #include "chrono/solver/ChVariables.h"
 
 namespace chrono {
@@ -88,6 +89,7 @@ class ChApi ChSystemDescriptor {
         m_constraints.clear();
         m_variables.clear();
         m_KRMblocks.clear();
+        m_packed.Reset();
     }
 
     /// Insert reference to a ChConstraint object.
@@ -277,6 +279,29 @@ class ChApi ChSystemDescriptor {
         double& resulting_feasability    ///< gets the max feasability as max |l*c| , for unilateral only
     );
 
+    // PACKED REPRESENTATION
+
+    /// Flatten the constraint Jacobians, the auxiliary [Eq] blocks, the scalar constraint data (b_i, cfm_i, g_i, l_i),
+    /// and the states of all active variables into contiguous buffers (see ChPackedConstraints).
+    /// This function must be called after the constraint auxiliary data was updated (see
+    /// ChConstraint::Update_auxiliary) and is typically invoked once per solve by iterative VI solvers. While the packed
+    /// data is valid, SchurComplementProduct() uses it instead of the constraint virtual methods.
+    /// Return false (and leave the packed data invalid) if any of the active constraints does not support packing.
+    virtual bool PackConstraints();
+
+    /// Copy the multipliers and the variable states from the packed buffers back into the constraint and variable
+    /// objects, then discard the packed data.
+    virtual void UnpackConstraints();
+
+    /// Discard the packed data (without updating constraints and variables).
+    void ClearPackedConstraints() { m_packed.Reset(); }
+
+    /// Return true if packed constraint data is available.
+    bool HasPackedConstraints() const { return m_packed.IsValid(); }
+
+    /// Access the packed constraint data.
+    ChPackedConstraints& GetPackedConstraints() { return m_packed; }
+
     // LOGGING/OUTPUT/ETC.
 
     /// Paste the stiffness, damping or mass matrix of the system into a sparse matrix.
@@ -371,6 +396,9 @@ class ChApi ChSystemDescriptor {
 
     double c_a;  ///< coefficient form M mass matrices in m_variables
 
+    ChPackedConstraints m_packed;  ///< packed (flat) representation of constraints and variable states
+    ChVectorDynamic<> m_packed_q;  ///< scratch state vector for products with packed constraints
+
   private:
     mutable unsigned int n_q;  ///< number of active variables
     mutable unsigned int n_c;  ///< number of active constraints
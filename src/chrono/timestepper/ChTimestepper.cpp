@@ -15,6 +15,7 @@
 #include <cmath>
 
 #include "chrono/timestepper/ChTimestepper.h"
+#include "chrono/utils/ChProfiler.h"
 
 namespace chrono {
 
@@ -446,6 +447,8 @@ void ChTimestepperEulerImplicit::Advance(const double dt) {
     numsolves = 0;
 
     for (int i = 0; i < this->GetMaxIters(); ++i) {
+        CH_PROFILE("NewtonIteration");
+
         mintegrable->StateScatter(Xnew, Vnew, T + dt, false);  // state -> system
         R.setZero();
         Qc.setZero();
@@ -764,6 +767,8 @@ void ChTimestepperTrapezoidal::Advance(const double dt) {
     numsolves = 0;
 
     for (int i = 0; i < this->GetMaxIters(); ++i) {
+        CH_PROFILE("NewtonIteration");
+
         mintegrable->StateScatter(Xnew, Vnew, T + dt, false);  // state -> system
         R = Rold;
         Qc.setZero();
@@ -1080,6 +1085,8 @@ void ChTimestepperNewmark::Advance(const double dt) {
     bool call_setup = true;
 
     for (int i = 0; i < this->GetMaxIters(); ++i) {
+        CH_PROFILE("NewtonIteration");
+
         mintegrable->StateScatter(Xnew, Vnew, T + dt, false);  // state -> system
 
         R.setZero(mintegrable->GetNumCoordsVelLevel());
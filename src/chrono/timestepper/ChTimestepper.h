@@ -80,6 +80,15 @@ class ChApi ChTimestepper {
     /// Turn on/off logging of messages.
     void SetVerbose(bool verb) { verbose = verb; }
 
+    /// Append to the given vector the internal data carried over from one step to the next, if any.
+    /// Used by ChSystem::SaveState. Note that states, accelerations, and multipliers are gathered from the integrable
+    /// object at the beginning of each step and are therefore not part of the history.
+    virtual void SaveHistory(std::vector<double>& data) const {}
+
+    /// Restore the internal data carried over from one step to the next, as saved by SaveHistory.
+    /// Used by ChSystem::RestoreState.
+    virtual void RestoreHistory(const std::vector<double>& data) {}
+
     /// Method to allow serialization of transient data to archives.
     virtual void ArchiveOut(ChArchiveOut& archive);
 
@@ -15,6 +15,7 @@
 #include <cmath>
 
 #include "chrono/timestepper/ChTimestepperHHT.h"
+#include "chrono/utils/ChProfiler.h"
 
 namespace chrono {
 
@@ -48,6 +49,18 @@ void ChTimestepperHHT::SetAlpha(double val) {
     beta = pow((1.0 - alpha), 2) / 4.0;
 }
 
+void ChTimestepperHHT::SaveHistory(std::vector<double>& data) const {
+    data.push_back(h);
+    data.push_back(num_successful_steps);
+}
+
+void ChTimestepperHHT::RestoreHistory(const std::vector<double>& data) {
+    if (data.size() != 2)
+        return;
+    h = data[0];
+    num_successful_steps = (unsigned int)data[1];
+}
+
 // Performs a step of HHT (generalized alpha) implicit for II order systems
 void ChTimestepperHHT::Advance(const double dt) {
     // Downcast
@@ -117,6 +130,8 @@ void ChTimestepperHHT::Advance(const double dt) {
         unsigned int it;
 
         for (it = 0; it < maxiters; it++) {
+            CH_PROFILE("NewtonIteration");
+
             if (verbose && modified_Newton && call_setup)
                 std::cout << " HHT call Setup." << std::endl;
 
@@ -78,6 +78,12 @@ class ChApi ChTimestepperHHT : public ChTimestepperIIorder, public ChImplicitIte
     /// Perform an integration timestep, by advancing the state by the specified time step.
     virtual void Advance(const double dt) override;
 
+    /// Save the internal step size and the number of successive successful steps (used for step size control).
+    virtual void SaveHistory(std::vector<double>& data) const override;
+
+    /// Restore the internal step size and the number of successive successful steps.
+    virtual void RestoreHistory(const std::vector<double>& data) override;
+
     /// Get the last estimated convergence rate for the internal Newton solver.
     /// Note that an estimate can only be calculated after the 3rd iteration. For the first 2 iterations, the
     /// convergence rate estimate is set to 1.
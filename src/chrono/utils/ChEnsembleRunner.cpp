@@ -0,0 +1,77 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <exception>
+
+#include "chrono/utils/ChEnsembleRunner.h"
+#include "chrono/utils/ChOpenMP.h"
+
+namespace chrono {
+namespace utils {
+
+ChEnsembleRunner::ChEnsembleRunner(SystemFactory factory, int num_workers) : m_output_interval(1) {
+    num_workers = std::max(1, num_workers);
+    for (int w = 0; w < num_workers; w++)
+        m_systems.push_back(factory());
+    m_initial.resize(num_workers);
+    m_worker_members.assign(num_workers, 0);
+}
+
+void ChEnsembleRunner::Run(unsigned int num_members,
+                           unsigned int num_steps,
+                           double step_size,
+                           MemberCallback& callback) {
+    const int num_workers = GetNumWorkers();
+
+    // Record the initial state of each instance when first running an ensemble
+    for (int w = 0; w < num_workers; w++) {
+        if (!m_initial[w])
+            m_initial[w] = m_systems[w]->SaveState();
+    }
+
+    m_member_success.assign(num_members, 0);
+    m_worker_members.assign(num_workers, 0);
+
+    m_timer.reset();
+    m_timer.start();
+
+    // Each member is simulated by the first available worker, on the instance of that worker
+#pragma omp parallel for schedule(dynamic, 1) num_threads(num_workers)
+    for (int m = 0; m < (int)num_members; m++) {
+        int w = ChOMP::GetThreadNum();
+        ChSystem& sys = *m_systems[w];
+        bool success = true;
+
+        try {
+            sys.RestoreState(m_initial[w]);
+            callback.OnSetup(m, sys);
+            for (unsigned int s = 1; s <= num_steps; s++) {
+                if (!sys.DoStepDynamics(step_size))
+                    success = false;
+                if (s % m_output_interval == 0)
+                    callback.OnOutput(m, sys);
+            }
+            callback.OnFinish(m, sys);
+        } catch (const std::exception&) {
+            success = false;
+        }
+
+        m_member_success[m] = success ? 1 : 0;
+        m_worker_members[w]++;
+    }
+
+    m_timer.stop();
+}
+
+}  // end namespace utils
+}  // end namespace chrono
@@ -0,0 +1,111 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#ifndef CH_ENSEMBLE_RUNNER_H
+#define CH_ENSEMBLE_RUNNER_H
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "chrono/core/ChApiCE.h"
+#include "chrono/core/ChTimer.h"
+#include "chrono/physics/ChSystem.h"
+
+namespace chrono {
+namespace utils {
+
+/// @addtogroup chrono_utils
+/// @{
+
+/// Runner for ensembles of simulations of variants of the same model (e.g., Monte Carlo studies or design sweeps).
+///
+/// The model is instantiated only once per worker thread, with the provided factory function, and all members of the
+/// ensemble are simulated on these instances. Before each member, the system of the worker is reset to its initial
+/// state (see ChSystem::RestoreState); the member callback then applies the changes specific to that member and
+/// collects its output. The setup cost of the model is therefore paid once per worker rather than once per member,
+/// and all members simulated by a worker share the same immutable data (collision shapes, meshes, visual models, FEA
+/// element precomputations). The factory can also share such data across workers, by passing the same shared objects
+/// (e.g., ChTriangleMeshConnected or ChVisualModel) to all the instances it creates.
+///
+/// Members are assigned dynamically to workers (each worker picks the next member as soon as it is done with the
+/// previous one), so that members with different costs are balanced across threads. Each instance is stepped by a
+/// single worker thread; the factory should therefore create systems set up to use a single thread.
+/// Only the members simulated on the calling thread are accounted for in the ChProfileManager tree; use ChProfileTrace
+/// to profile all workers.
+class ChApi ChEnsembleRunner {
+  public:
+    /// Function creating a new instance of the model.
+    typedef std::function<std::shared_ptr<ChSystem>()> SystemFactory;
+
+    /// Interface for the operations specific to each member of the ensemble.
+    /// Callbacks for different members are invoked concurrently from different threads: an implementation should only
+    /// modify data associated with the given member (e.g., its slot in a pre-allocated output array).
+    class ChApi MemberCallback {
+      public:
+        virtual ~MemberCallback() {}
+
+        /// Apply the changes specific to the given member (model parameters, initial conditions, etc.).
+        /// Called after the system was reset to its initial state. Since only the state of the system is reset between
+        /// members, any parameter modified for some member must be set for all members. Items must not be added to or
+        /// removed from the system.
+        virtual void OnSetup(unsigned int member, ChSystem& sys) {}
+
+        /// Collect the output of the given member. Called at each output step (see SetOutputInterval).
+        virtual void OnOutput(unsigned int member, ChSystem& sys) {}
+
+        /// Called at the end of the simulation of the given member.
+        virtual void OnFinish(unsigned int member, ChSystem& sys) {}
+    };
+
+    /// Create a runner with the specified number of workers.
+    /// The model is instantiated once per worker (sequentially, in the calling thread) with the provided factory.
+    ChEnsembleRunner(SystemFactory factory, int num_workers);
+
+    /// Return the number of workers.
+    int GetNumWorkers() const { return (int)m_systems.size(); }
+
+    /// Return the model instance of the specified worker.
+    ChSystem& GetSystem(int worker) const { return *m_systems[worker]; }
+
+    /// Set the number of steps between calls to MemberCallback::OnOutput (default: 1).
+    void SetOutputInterval(unsigned int num_steps) { m_output_interval = num_steps > 0 ? num_steps : 1; }
+
+    /// Simulate the specified number of members, each over the given number of steps, starting from the initial state
+    /// of the model instances (their state when first running an ensemble).
+    void Run(unsigned int num_members, unsigned int num_steps, double step_size, MemberCallback& callback);
+
+    /// Return true if the simulation of the given member in the last ensemble was successful.
+    /// A member fails if a step fails or if an exception is thrown while simulating it.
+    bool IsMemberSuccessful(unsigned int member) const { return m_member_success[member] != 0; }
+
+    /// Return the number of members simulated by the given worker in the last ensemble.
+    unsigned int GetNumMembers(int worker) const { return m_worker_members[worker]; }
+
+    /// Return the wall clock time (in seconds) of the last ensemble.
+    double GetTimerRun() const { return m_timer(); }
+
+  private:
+    std::vector<std::shared_ptr<ChSystem>> m_systems;          ///< model instances, one per worker
+    std::vector<std::shared_ptr<ChSystemSnapshot>> m_initial;  ///< initial state of each instance
+    unsigned int m_output_interval;                            ///< number of steps between output calls
+    std::vector<char> m_member_success;                        ///< success flags of members in last ensemble
+    std::vector<unsigned int> m_worker_members;                ///< number of members per worker in last ensemble
+    ChTimer m_timer;                                           ///< timer for the last ensemble
+};
+
+/// @} chrono_utils
+
+}  // end namespace utils
+}  // end namespace chrono
+
+#endif
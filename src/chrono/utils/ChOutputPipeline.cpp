@@ -0,0 +1,209 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+
+#include "chrono/utils/ChOutputPipeline.h"
+#include "chrono/utils/ChUtilsInputOutput.h"
+
+namespace chrono {
+namespace utils {
+
+ChOutputPipeline::ChOutputPipeline(unsigned int num_slots, int num_workers)
+    : m_num_frames(0), m_next_frame(0), m_num_processed(0), m_stop(false) {
+    m_slots.resize(std::max(1u, num_slots));
+    for (auto& slot : m_slots)
+        slot.busy = false;
+
+    num_workers = std::max(1, num_workers);
+    for (int w = 0; w < num_workers; w++)
+        m_workers.push_back(std::thread(&ChOutputPipeline::WorkerLoop, this));
+}
+
+ChOutputPipeline::~ChOutputPipeline() {
+    try {
+        Close();
+    } catch (const std::exception&) {
+    }
+}
+
+void ChOutputPipeline::AddSink(std::shared_ptr<Sink> sink) {
+    if (m_num_frames > 0)
+        throw std::runtime_error("Output sinks must be added before writing the first frame");
+    m_sinks.push_back(sink);
+}
+
+void ChOutputPipeline::CheckError() {
+    std::exception_ptr error;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        std::swap(error, m_error);
+    }
+    if (error)
+        std::rethrow_exception(error);
+}
+
+void ChOutputPipeline::WriteFrame(ChSystem& sys) {
+    if (m_workers.empty())
+        throw std::runtime_error("Output pipeline already closed");
+    CheckError();
+
+    // Wait for the slot of this frame to be released by the workers
+    Slot& slot = m_slots[m_num_frames % m_slots.size()];
+    m_timer_wait.start();
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cv_slots.wait(lock, [&slot]() { return !slot.busy; });
+    }
+    m_timer_wait.stop();
+
+    // Capture the data of all sinks (the slot is not accessed by the workers until it is marked busy)
+    m_timer_capture.start();
+    slot.frames.resize(m_sinks.size());
+    for (size_t i = 0; i < m_sinks.size(); i++) {
+        slot.frames[i].index = m_num_frames;
+        slot.frames[i].time = sys.GetChTime();
+        m_sinks[i]->Capture(sys, slot.frames[i]);
+    }
+    m_timer_capture.stop();
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        slot.busy = true;
+        m_num_frames++;
+    }
+    m_cv_workers.notify_one();
+}
+
+void ChOutputPipeline::Flush() {
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cv_slots.wait(lock, [this]() { return m_num_processed == m_num_frames; });
+    }
+    CheckError();
+}
+
+void ChOutputPipeline::Close() {
+    if (m_workers.empty())
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_cv_workers.notify_all();
+    for (auto& worker : m_workers)
+        worker.join();
+    m_workers.clear();
+
+    for (auto& sink : m_sinks)
+        sink->Finalize();
+
+    CheckError();
+}
+
+void ChOutputPipeline::WorkerLoop() {
+    while (true) {
+        unsigned int k;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_cv_workers.wait(lock, [this]() { return m_next_frame < m_num_frames || m_stop; });
+            // Terminate only after all queued frames were picked up
+            if (m_next_frame == m_num_frames)
+                break;
+            k = m_next_frame++;
+        }
+
+        Slot& slot = m_slots[k % m_slots.size()];
+        try {
+            for (size_t i = 0; i < m_sinks.size(); i++)
+                m_sinks[i]->Process(slot.frames[i]);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (!m_error)
+                m_error = std::current_exception();
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            slot.busy = false;
+            m_num_processed++;
+        }
+        m_cv_slots.notify_all();
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+static std::string FrameFilename(const std::string& prefix, unsigned int index) {
+    std::ostringstream filename;
+    filename << prefix << std::setw(5) << std::setfill('0') << index << ".csv";
+    return filename.str();
+}
+
+ChOutputSinkBodies::ChOutputSinkBodies(const std::string& prefix,
+                                       bool active_only,
+                                       bool dump_vel,
+                                       const std::string& delim)
+    : m_prefix(prefix), m_active_only(active_only), m_dump_vel(dump_vel), m_delim(delim) {}
+
+void ChOutputSinkBodies::Capture(ChSystem& sys, ChOutputPipeline::Frame& frame) {
+    frame.values.clear();
+    for (const auto& body : sys.GetBodies()) {
+        if (m_active_only && !body->IsActive())
+            continue;
+        const auto& pos = body->GetPos();
+        const auto& rot = body->GetRot();
+        frame.values.insert(frame.values.end(), {pos.x(), pos.y(), pos.z(), rot.e0(), rot.e1(), rot.e2(), rot.e3()});
+        if (m_dump_vel) {
+            const auto& vel = body->GetPosDt();
+            auto angvel = body->GetAngVelLocal();
+            frame.values.insert(frame.values.end(), {vel.x(), vel.y(), vel.z(), angvel.x(), angvel.y(), angvel.z()});
+        }
+    }
+}
+
+void ChOutputSinkBodies::Process(const ChOutputPipeline::Frame& frame) {
+    const size_t stride = m_dump_vel ? 13 : 7;
+    ChWriterCSV csv(m_delim);
+    for (size_t i = 0; i + stride <= frame.values.size(); i += stride) {
+        for (size_t k = 0; k < stride; k++)
+            csv << frame.values[i + k];
+        csv << std::endl;
+    }
+    csv.WriteToFile(FrameFilename(m_prefix, frame.index));
+}
+
+ChOutputSinkVisualizationAssets::ChOutputSinkVisualizationAssets(const std::string& prefix,
+                                                                 bool body_info,
+                                                                 const std::string& delim)
+    : m_prefix(prefix), m_body_info(body_info), m_delim(delim), m_selector([](const ChBody&) { return true; }) {}
+
+void ChOutputSinkVisualizationAssets::Capture(ChSystem& sys, ChOutputPipeline::Frame& frame) {
+    std::ostringstream out;
+    WriteVisualizationAssets(&sys, out, m_selector, m_body_info, m_delim);
+    frame.text = out.str();
+}
+
+void ChOutputSinkVisualizationAssets::Process(const ChOutputPipeline::Frame& frame) {
+    std::ofstream ofile(FrameFilename(m_prefix, frame.index));
+    ofile << frame.text;
+    if (!ofile)
+        throw std::runtime_error("Error writing output file " + FrameFilename(m_prefix, frame.index));
+}
+
+}  // end namespace utils
+}  // end namespace chrono
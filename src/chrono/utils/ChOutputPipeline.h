@@ -0,0 +1,171 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#ifndef CH_OUTPUT_PIPELINE_H
+#define CH_OUTPUT_PIPELINE_H
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "chrono/core/ChApiCE.h"
+#include "chrono/core/ChTimer.h"
+#include "chrono/physics/ChSystem.h"
+
+namespace chrono {
+namespace utils {
+
+/// @addtogroup chrono_utils
+/// @{
+
+/// Asynchronous output pipeline.
+/// At each output frame, the state required by the registered sinks is captured into a slot of a ring buffer, on the
+/// simulation thread. Formatting and writing of the captured data is done by worker threads, decoupled from the
+/// simulation. If all slots of the ring buffer are in use, WriteFrame blocks until the oldest frame is processed
+/// (back-pressure), so that memory use remains bounded.
+class ChApi ChOutputPipeline {
+  public:
+    /// Data captured by a sink at an output frame.
+    /// Frame objects are reused across frames; Capture should only clear (not release) the data containers.
+    struct Frame {
+        unsigned int index;          ///< frame number
+        double time;                 ///< simulation time
+        std::vector<double> values;  ///< numeric data captured by the sink
+        std::string text;            ///< text data captured by the sink
+    };
+
+    /// Interface for output sinks.
+    class ChApi Sink {
+      public:
+        virtual ~Sink() {}
+
+        /// Capture the data needed for output from the current state of the system.
+        /// Called on the simulation thread; this function should only copy data and defer any expensive processing.
+        virtual void Capture(ChSystem& sys, Frame& frame) = 0;
+
+        /// Format and write the data captured at a frame.
+        /// Called on a worker thread. With more than one worker, this function may be called concurrently for
+        /// different frames; sinks writing all frames to a single stream should be used with a single worker.
+        virtual void Process(const Frame& frame) = 0;
+
+        /// Called after all frames were processed, when the pipeline is closed.
+        virtual void Finalize() {}
+    };
+
+    /// Create an output pipeline with the specified number of slots and worker threads.
+    ChOutputPipeline(unsigned int num_slots = 8, int num_workers = 1);
+
+    /// Process all pending frames and terminate the worker threads.
+    ~ChOutputPipeline();
+
+    /// Add an output sink. Must be called before writing the first frame.
+    void AddSink(std::shared_ptr<Sink> sink);
+
+    /// Capture the current state of the system for all sinks and queue the frame for processing.
+    /// Blocks if all slots of the ring buffer are in use. If processing of an earlier frame failed, the exception
+    /// thrown by the sink is rethrown here.
+    void WriteFrame(ChSystem& sys);
+
+    /// Wait until all queued frames are processed.
+    /// If processing of a frame failed, the exception thrown by the sink is rethrown.
+    void Flush();
+
+    /// Process all queued frames, terminate the worker threads, and finalize the sinks.
+    void Close();
+
+    /// Return the number of frames written so far.
+    unsigned int GetNumFrames() const { return m_num_frames; }
+
+    /// Return the time (in seconds) spent in WriteFrame capturing data.
+    double GetTimerCapture() const { return m_timer_capture(); }
+
+    /// Return the time (in seconds) spent in WriteFrame waiting for a free slot.
+    double GetTimerWait() const { return m_timer_wait(); }
+
+  private:
+    struct Slot {
+        std::vector<Frame> frames;  ///< captured data, one per sink
+        bool busy;                  ///< true if the slot holds a frame not yet processed
+    };
+
+    void WorkerLoop();
+    void CheckError();
+
+    std::vector<std::shared_ptr<Sink>> m_sinks;
+    std::vector<Slot> m_slots;
+    std::vector<std::thread> m_workers;
+    unsigned int m_num_frames;     ///< number of frames submitted
+    unsigned int m_next_frame;     ///< next frame to be picked up by a worker
+    unsigned int m_num_processed;  ///< number of frames processed
+    bool m_stop;                   ///< request termination of the worker threads
+    std::exception_ptr m_error;    ///< first exception thrown by a sink
+    std::mutex m_mutex;
+    std::condition_variable m_cv_slots;    ///< signaled when a slot becomes free
+    std::condition_variable m_cv_workers;  ///< signaled when a frame is queued
+    ChTimer m_timer_capture;
+    ChTimer m_timer_wait;
+};
+
+/// Output sink writing the states of the bodies in the system to a CSV file for each frame.
+/// The output is the same as that of WriteBodies; output files are named [prefix]NNNNN.csv, with NNNNN the frame number.
+class ChApi ChOutputSinkBodies : public ChOutputPipeline::Sink {
+  public:
+    ChOutputSinkBodies(const std::string& prefix,       ///< prefix of output file names (including path)
+                       bool active_only = false,        ///< only output active bodies
+                       bool dump_vel = false,           ///< also output linear and angular velocities
+                       const std::string& delim = ","  ///< CSV delimitator
+    );
+
+    virtual void Capture(ChSystem& sys, ChOutputPipeline::Frame& frame) override;
+    virtual void Process(const ChOutputPipeline::Frame& frame) override;
+
+  private:
+    std::string m_prefix;
+    bool m_active_only;
+    bool m_dump_vel;
+    std::string m_delim;
+};
+
+/// Output sink writing body and asset information for off-line visualization to a CSV file for each frame.
+/// The output is the same as that of WriteVisualizationAssets; output files are named [prefix]NNNNN.csv, with NNNNN the
+/// frame number. The CSV data is generated on the simulation thread, while the file is written on a worker thread.
+class ChApi ChOutputSinkVisualizationAssets : public ChOutputPipeline::Sink {
+  public:
+    ChOutputSinkVisualizationAssets(const std::string& prefix,       ///< prefix of output file names (including path)
+                                    bool body_info = true,           ///< include body state information
+                                    const std::string& delim = ","  ///< CSV delimitator
+    );
+
+    /// Set a function to select the bodies (and their assets) included in the output (default: all bodies).
+    void SetSelector(std::function<bool(const ChBody&)> selector) { m_selector = selector; }
+
+    virtual void Capture(ChSystem& sys, ChOutputPipeline::Frame& frame) override;
+    virtual void Process(const ChOutputPipeline::Frame& frame) override;
+
+  private:
+    std::string m_prefix;
+    bool m_body_info;
+    std::string m_delim;
+    std::function<bool(const ChBody&)> m_selector;
+};
+
+/// @} chrono_utils
+
+}  // end namespace utils
+}  // end namespace chrono
+
+#endif
@@ -27,6 +27,12 @@
 #include <ratio>
 #include <chrono>
 #include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 namespace chrono {
 namespace utils {
@@ -193,6 +199,13 @@ ChProfileNode* ChProfileManager::CurrentNode = &ChProfileManager::Root;
 int ChProfileManager::FrameCounter = 0;
 unsigned long int ChProfileManager::ResetTime = 0;
 
+// Thread that owns the profile tree (the thread that loaded the library, normally the main thread)
+static const std::thread::id gProfileOwnerThread = std::this_thread::get_id();
+
+bool ChProfileManager::Is_Owner_Thread(void) {
+    return std::this_thread::get_id() == gProfileOwnerThread;
+}
+
 /***********************************************************************************************
  * ChProfileManager::Start_Profile -- Begin a named profile                                    *
  *                                                                                             *
@@ -207,6 +220,10 @@ unsigned long int ChProfileManager::ResetTime = 0;
  * the profiling code for efficiency.                                                          *
  *=============================================================================================*/
 void ChProfileManager::Start_Profile(const char* name) {
+    // The profile tree is not thread safe: ignore calls from other threads
+    if (!Is_Owner_Thread())
+        return;
+
     if (name != CurrentNode->Get_Name()) {
         CurrentNode = CurrentNode->Get_Sub_Node(name);
     }
@@ -218,6 +235,9 @@ void ChProfileManager::Start_Profile(const char* name) {
  * ChProfileManager::Stop_Profile -- Stop timing and record the results.                       *
  *=============================================================================================*/
 void ChProfileManager::Stop_Profile(void) {
+    if (!Is_Owner_Thread())
+        return;
+
     // Return will indicate whether we should back up to our parent (we may
     // be profiling a recursive function)
     if (CurrentNode->Return()) {
@@ -314,6 +334,124 @@ void ChProfileManager::dumpAll() {
     ChProfileManager::Release_Iterator(profileIterator);
 }
 
+/***************************************************************************************************
+**
+** ChProfileTrace
+**
+***************************************************************************************************/
+
+// A zone recorded in the trace
+struct ChTraceZone {
+    const char* name;
+    double start;
+    double end;
+};
+
+// Buffer of zones recorded by one thread.
+// The owning thread locks the buffer when it records a zone; this is uncontended unless another thread reads the
+// buffer at the same time (e.g., when writing the trace while recording is still in progress).
+struct ChTraceBuffer {
+    int thread_id;
+    std::mutex mutex;
+    std::vector<ChTraceZone> zones;
+};
+
+std::atomic<bool> ChProfileTrace::Enabled(false);
+
+static std::mutex gTraceMutex;                                      // protects the list of thread buffers
+static std::vector<std::unique_ptr<ChTraceBuffer>> gTraceBuffers;  // one buffer per recording thread
+static thread_local ChTraceBuffer* gThreadTraceBuffer = nullptr;   // buffer of the calling thread
+static std::chrono::steady_clock::time_point gTraceOrigin = std::chrono::steady_clock::now();  // trace time origin
+
+void ChProfileTrace::Enable(bool val) {
+    Enabled.store(val, std::memory_order_relaxed);
+}
+
+void ChProfileTrace::Reset() {
+    std::lock_guard<std::mutex> lock(gTraceMutex);
+    for (auto& buffer : gTraceBuffers) {
+        std::lock_guard<std::mutex> buffer_lock(buffer->mutex);
+        buffer->zones.clear();
+    }
+    gTraceOrigin = std::chrono::steady_clock::now();
+}
+
+size_t ChProfileTrace::GetNumZones() {
+    std::lock_guard<std::mutex> lock(gTraceMutex);
+    size_t num_zones = 0;
+    for (const auto& buffer : gTraceBuffers) {
+        std::lock_guard<std::mutex> buffer_lock(buffer->mutex);
+        num_zones += buffer->zones.size();
+    }
+    return num_zones;
+}
+
+double ChProfileTrace::GetTime() {
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - gTraceOrigin).count();
+}
+
+void ChProfileTrace::Record(const char* name, double start, double end) {
+    // Register a new buffer the first time a thread records a zone
+    if (!gThreadTraceBuffer) {
+        std::lock_guard<std::mutex> lock(gTraceMutex);
+        gTraceBuffers.push_back(std::unique_ptr<ChTraceBuffer>(new ChTraceBuffer));
+        gTraceBuffers.back()->thread_id = (int)gTraceBuffers.size() - 1;
+        gThreadTraceBuffer = gTraceBuffers.back().get();
+    }
+    std::lock_guard<std::mutex> buffer_lock(gThreadTraceBuffer->mutex);
+    gThreadTraceBuffer->zones.push_back({name, start, end});
+}
+
+// Write a string as a JSON string literal
+static void WriteJSONString(std::ostream& os, const char* str) {
+    os << '"';
+    for (const char* c = str; *c; c++) {
+        if (*c == '"' || *c == '\\')
+            os << '\\';
+        os << *c;
+    }
+    os << '"';
+}
+
+bool ChProfileTrace::WriteChromeTrace(const std::string& filename) {
+    std::ofstream file(filename);
+    if (!file.is_open())
+        return false;
+
+    std::lock_guard<std::mutex> lock(gTraceMutex);
+
+    file << std::fixed << std::setprecision(3);
+    file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    bool first = true;
+    std::vector<ChTraceZone> zones;
+    for (const auto& buffer : gTraceBuffers) {
+        // Take a snapshot of the zones, so that the owning thread may keep recording while the file is written
+        {
+            std::lock_guard<std::mutex> buffer_lock(buffer->mutex);
+            zones = buffer->zones;
+        }
+        if (zones.empty())
+            continue;
+
+        // Thread name metadata
+        file << (first ? "\n" : ",\n");
+        first = false;
+        file << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << buffer->thread_id
+             << ",\"args\":{\"name\":\"Thread " << buffer->thread_id << "\"}}";
+
+        // Complete events
+        for (const auto& zone : zones) {
+            file << ",\n{\"name\":";
+            WriteJSONString(file, zone.name);
+            file << ",\"ph\":\"X\",\"pid\":0,\"tid\":" << buffer->thread_id << ",\"ts\":" << zone.start
+                 << ",\"dur\":" << zone.end - zone.start << "}";
+        }
+    }
+    file << "\n]}\n";
+
+    return file.good();
+}
+
 #endif  // CH_NO_PROFILE
 
 }  // end namespace utils
@@ -27,8 +27,10 @@
 
 #ifndef CH_NO_PROFILE
 
+    #include <atomic>
     #include <cstdio>
     #include <new>
+    #include <string>
     #include <cfloat>
     #include <cfloat>
     #include <ctime>
@@ -104,11 +106,17 @@ class ChApi ChProfileIterator {
 };
 
 /// The Manager for the Profile system.
+/// The profile tree is not thread safe and is only updated from the thread that owns it (the thread that loaded the
+/// library, normally the main thread). Calls to Start_Profile and Stop_Profile from any other thread (e.g., systems
+/// simulated concurrently in worker threads) are ignored; use ChProfileTrace to profile those threads.
 class ChApi ChProfileManager {
   public:
     static void Start_Profile(const char* name);
     static void Stop_Profile(void);
 
+    /// Return true if the calling thread owns the profile tree.
+    static bool Is_Owner_Thread(void);
+
     static void CleanupMemory(void) { Root.CleanupMemory(); }
 
     static void Reset(void);
@@ -130,22 +138,85 @@ class ChApi ChProfileManager {
     static unsigned long int ResetTime;
 };
 
+/// Collector of timed zones, for export in the Chrome trace event format (chrome://tracing or Perfetto).
+/// Unlike the profile tree of ChProfileManager, zones can be recorded concurrently from any thread (including from
+/// within OpenMP parallel regions): each thread appends its completed zones to its own buffer. Recording is disabled by
+/// default and can be toggled at run time; when disabled, a zone only costs the check of a flag.
+class ChApi ChProfileTrace {
+  public:
+    /// Enable/disable recording of zones.
+    static void Enable(bool val);
+
+    /// Return true if zones are currently recorded.
+    static bool IsEnabled() { return Enabled.load(std::memory_order_relaxed); }
+
+    /// Discard all recorded zones and reset the trace time origin.
+    /// Must not be called while other threads record zones.
+    static void Reset();
+
+    /// Return the number of recorded zones (over all threads).
+    static size_t GetNumZones();
+
+    /// Write all recorded zones to the specified file, in the Chrome trace event (JSON) format.
+    /// Each thread that recorded zones appears as a separate track. Return false if the file cannot be opened.
+    /// This function can be called while other threads record zones; zones recorded after the buffer of a thread was
+    /// read are not included in the output.
+    static bool WriteChromeTrace(const std::string& filename);
+
+    /// Return the time (in microseconds) since the trace time origin.
+    static double GetTime();
+
+    /// Record a zone with given name and start/end times (in microseconds) in the buffer of the calling thread.
+    /// The name is assumed to be a static string; only the pointer is stored.
+    static void Record(const char* name, double start, double end);
+
+  private:
+    static std::atomic<bool> Enabled;
+};
+
+/// Simple way to record a scope as a zone in the trace collected by ChProfileTrace.
+class ChApi ChProfileZone {
+  public:
+    ChProfileZone(const char* name) : Name(ChProfileTrace::IsEnabled() ? name : nullptr), StartTime(0) {
+        if (Name)
+            StartTime = ChProfileTrace::GetTime();
+    }
+
+    ~ChProfileZone(void) {
+        if (Name)
+            ChProfileTrace::Record(Name, StartTime, ChProfileTrace::GetTime());
+    }
+
+  private:
+    const char* Name;
+    double StartTime;
+};
+
 /// Simple way to profile a function's scope.
+/// The scope is also recorded as a zone in the trace collected by ChProfileTrace.
 class ChApi ChProfileSample {
   public:
-    ChProfileSample(const char* name) { ChProfileManager::Start_Profile(name); }
+    ChProfileSample(const char* name) : Zone(name) { ChProfileManager::Start_Profile(name); }
 
     ~ChProfileSample(void) { ChProfileManager::Stop_Profile(); }
+
+  private:
+    ChProfileZone Zone;
 };
 
 }  // end namespace utils
 }  // end namespace chrono
 
+    // Profile a scope in the profile tree (owner thread only) and in the trace (any thread)
     #define CH_PROFILE(name) chrono::utils::ChProfileSample __ch_profile(name)
 
+    // Profile a scope in the trace only (thread safe)
+    #define CH_PROFILE_ZONE(name) chrono::utils::ChProfileZone __ch_profile_zone(name)
+
 #else
 
     #define CH_PROFILE(name)
+    #define CH_PROFILE_ZONE(name)
 
 #endif  // #ifndef CH_NO_PROFILE
 
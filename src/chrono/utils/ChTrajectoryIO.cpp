@@ -0,0 +1,638 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// File layout:
+//   file header (magic, version, channel mask, frames per chunk)
+//   sequence of chunks, each with a chunk header followed by its payload
+//   (padded to a multiple of 8 bytes). For each group of frames, a time chunk
+//   is written first, followed by one chunk for each enabled channel.
+//
+// Chunk payloads (before compression):
+//   time chunk:    frame times (n doubles)
+//   channel chunk: row offsets (n+1 uint64), then all rows of each column
+//                  (num_columns x num_rows doubles)
+//
+// Compressed payloads are byte-shuffled (byte k of all 8-byte words grouped
+// together) and encoded with a simple LZ77-type codec.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <stdexcept>
+
+#ifndef _WIN32
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+#include "chrono/utils/ChTrajectoryIO.h"
+#include "chrono/physics/ChContactContainer.h"
+#include "chrono/physics/ChLinkBase.h"
+#include "chrono/physics/ChShaft.h"
+
+namespace chrono {
+namespace utils {
+
+// -----------------------------------------------------------------------------
+
+static const char trajectory_magic[8] = {'C', 'H', 'T', 'R', 'A', 'J', 0, 0};
+static const std::uint32_t trajectory_version = 1;
+static const std::uint32_t time_channel = (std::uint32_t)TrajectoryChannel::NUM_CHANNELS;
+
+struct TrajectoryFileHeader {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t channel_mask;
+    std::uint32_t frames_per_chunk;
+    std::uint32_t reserved;
+};
+
+struct TrajectoryChunkHeader {
+    std::uint32_t channel;
+    std::uint32_t compressed;
+    std::uint64_t first_frame;
+    std::uint64_t num_frames;
+    std::uint64_t raw_size;
+    std::uint64_t stored_size;
+};
+
+static_assert(sizeof(TrajectoryFileHeader) % 8 == 0, "unexpected file header size");
+static_assert(sizeof(TrajectoryChunkHeader) % 8 == 0, "unexpected chunk header size");
+
+const std::vector<std::string>& GetTrajectoryColumns(TrajectoryChannel channel) {
+    static const std::vector<std::string> columns[] = {
+        {"id", "pos_x", "pos_y", "pos_z", "rot_e0", "rot_e1", "rot_e2", "rot_e3", "vel_x", "vel_y", "vel_z",
+         "angvel_x", "angvel_y", "angvel_z", "acc_x", "acc_y", "acc_z", "angacc_x", "angacc_y", "angacc_z"},
+        {"id", "pos_x", "pos_y", "pos_z", "force_x", "force_y", "force_z", "torque_x", "torque_y", "torque_z"},
+        {"id", "pos", "vel", "acc", "load"},
+        {"idA", "idB", "pos_x", "pos_y", "pos_z", "normal_x", "normal_y", "normal_z", "force_x", "force_y", "force_z",
+         "torque_x", "torque_y", "torque_z"}};
+    return columns[(int)channel];
+}
+
+// -----------------------------------------------------------------------------
+// Compression
+// -----------------------------------------------------------------------------
+
+static void WriteVarint(std::vector<char>& out, size_t val) {
+    while (val >= 0x80) {
+        out.push_back((char)((val & 0x7f) | 0x80));
+        val >>= 7;
+    }
+    out.push_back((char)val);
+}
+
+static bool ReadVarint(const unsigned char*& p, const unsigned char* end, size_t& val) {
+    val = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        if (p == end)
+            return false;
+        unsigned char b = *p++;
+        val |= (size_t)(b & 0x7f) << shift;
+        if (!(b & 0x80))
+            return true;
+    }
+    return false;
+}
+
+// Encode the input as a sequence of (literal length, literals, match length - 4, match offset) records.
+// The last record only contains literals.
+static void CompressLZ(const char* src, size_t size, std::vector<char>& out) {
+    const int hash_bits = 14;
+    const size_t no_pos = std::numeric_limits<size_t>::max();
+    std::vector<size_t> table((size_t)1 << hash_bits, no_pos);
+
+    out.clear();
+    size_t anchor = 0;
+    size_t i = 0;
+    while (i + 4 <= size) {
+        std::uint32_t seq;
+        std::memcpy(&seq, src + i, 4);
+        std::uint32_t h = (seq * 2654435761u) >> (32 - hash_bits);
+        size_t candidate = table[h];
+        table[h] = i;
+        if (candidate == no_pos || std::memcmp(src + candidate, src + i, 4) != 0) {
+            i++;
+            continue;
+        }
+        size_t len = 4;
+        while (i + len < size && src[candidate + len] == src[i + len])
+            len++;
+        WriteVarint(out, i - anchor);
+        out.insert(out.end(), src + anchor, src + i);
+        WriteVarint(out, len - 4);
+        WriteVarint(out, i - candidate);
+        i += len;
+        anchor = i;
+    }
+    WriteVarint(out, size - anchor);
+    out.insert(out.end(), src + anchor, src + size);
+}
+
+static bool DecompressLZ(const char* src, size_t size, char* dst, size_t raw_size) {
+    const unsigned char* p = reinterpret_cast<const unsigned char*>(src);
+    const unsigned char* end = p + size;
+    size_t o = 0;
+    while (true) {
+        size_t num_literals;
+        if (!ReadVarint(p, end, num_literals) || num_literals > (size_t)(end - p) || num_literals > raw_size - o)
+            return false;
+        std::memcpy(dst + o, p, num_literals);
+        p += num_literals;
+        o += num_literals;
+        if (o == raw_size)
+            return p == end;
+        size_t len, offset;
+        if (!ReadVarint(p, end, len) || !ReadVarint(p, end, offset))
+            return false;
+        len += 4;
+        if (offset == 0 || offset > o || len > raw_size - o)
+            return false;
+        // Matches may overlap the output being produced; copy byte by byte
+        for (size_t k = 0; k < len; k++, o++)
+            dst[o] = dst[o - offset];
+    }
+}
+
+// Group byte k of all 8-byte words of the input.
+static void Shuffle(const char* src, size_t size, char* dst) {
+    size_t n = size / 8;
+    for (size_t w = 0; w < n; w++)
+        for (size_t b = 0; b < 8; b++)
+            dst[b * n + w] = src[w * 8 + b];
+}
+
+static void Unshuffle(const char* src, size_t size, char* dst) {
+    size_t n = size / 8;
+    for (size_t w = 0; w < n; w++)
+        for (size_t b = 0; b < 8; b++)
+            dst[w * 8 + b] = src[b * n + w];
+}
+
+// -----------------------------------------------------------------------------
+// ChWriterTrajectory
+// -----------------------------------------------------------------------------
+
+void ChWriterTrajectory::ChunkBuffer::Clear() {
+    times.clear();
+    for (auto& channel : channels) {
+        channel.offsets.clear();
+        for (auto& column : channel.columns)
+            column.clear();
+    }
+}
+
+ChWriterTrajectory::ChWriterTrajectory(const std::string& filename, unsigned int frames_per_chunk, bool compress)
+    : m_frames_per_chunk(std::max(1u, frames_per_chunk)),
+      m_compress(compress),
+      m_channel_mask(1u << (int)TrajectoryChannel::BODIES),
+      m_num_frames(0),
+      m_num_bytes(0),
+      m_front(0),
+      m_pending(false),
+      m_stop(false),
+      m_failed(false) {
+    m_file = std::fopen(filename.c_str(), "wb");
+    if (!m_file)
+        throw std::runtime_error("Cannot open trajectory file " + filename);
+
+    for (auto& buffer : m_buffers) {
+        buffer.first_frame = 0;
+        for (int c = 0; c < (int)TrajectoryChannel::NUM_CHANNELS; c++)
+            buffer.channels[c].columns.resize(GetTrajectoryColumns((TrajectoryChannel)c).size());
+    }
+
+    m_thread = std::thread(&ChWriterTrajectory::WriterLoop, this);
+}
+
+ChWriterTrajectory::~ChWriterTrajectory() {
+    try {
+        Close();
+    } catch (const std::exception&) {
+    }
+}
+
+void ChWriterTrajectory::EnableChannel(TrajectoryChannel channel, bool val) {
+    if (m_num_frames > 0)
+        throw std::runtime_error("Trajectory channels must be set before writing the first frame");
+    if (val)
+        m_channel_mask |= 1u << (int)channel;
+    else
+        m_channel_mask &= ~(1u << (int)channel);
+}
+
+size_t ChWriterTrajectory::GetNumBytes() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_num_bytes;
+}
+
+void ChWriterTrajectory::AddRow(ChannelBuffer& buffer, std::initializer_list<double> values) {
+    auto column = buffer.columns.begin();
+    for (double val : values)
+        (column++)->push_back(val);
+}
+
+// Report contacts in absolute coordinates, identifying the contactables by their physics item.
+class TrajectoryContactReporter : public ChContactContainer::ReportContactCallback {
+  public:
+    TrajectoryContactReporter(std::vector<std::vector<double>>& columns) : m_columns(columns) {}
+
+    virtual bool OnReportContact(const ChVector3d& pA,
+                                 const ChVector3d& pB,
+                                 const ChMatrix33<>& plane_coord,
+                                 const double& distance,
+                                 const double& eff_radius,
+                                 const ChVector3d& react_forces,
+                                 const ChVector3d& react_torques,
+                                 ChContactable* contactobjA,
+                                 ChContactable* contactobjB) override {
+        ChVector3d normal = plane_coord.GetAxisX();
+        ChVector3d force = plane_coord * react_forces;
+        ChVector3d torque = plane_coord * react_torques;
+        double values[] = {GetId(contactobjA), GetId(contactobjB), pA.x(),     pA.y(),     pA.z(),
+                           normal.x(),         normal.y(),         normal.z(), force.x(),  force.y(),
+                           force.z(),          torque.x(),         torque.y(), torque.z()};
+        for (size_t c = 0; c < m_columns.size(); c++)
+            m_columns[c].push_back(values[c]);
+        return true;
+    }
+
+  private:
+    static double GetId(ChContactable* obj) {
+        return (obj && obj->GetPhysicsItem()) ? obj->GetPhysicsItem()->GetIdentifier() : -1;
+    }
+
+    std::vector<std::vector<double>>& m_columns;
+};
+
+// The file header is written by the calling thread, before any chunk is handed over to the writer thread.
+void ChWriterTrajectory::WriteHeader() {
+    TrajectoryFileHeader header = {};
+    std::memcpy(header.magic, trajectory_magic, sizeof(header.magic));
+    header.version = trajectory_version;
+    header.channel_mask = m_channel_mask;
+    header.frames_per_chunk = m_frames_per_chunk;
+    bool ok = std::fwrite(&header, sizeof(header), 1, m_file) == 1;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_num_bytes += sizeof(header);
+    if (!ok)
+        m_failed = true;
+}
+
+void ChWriterTrajectory::WriteFrame(ChSystem& sys) {
+    if (!m_thread.joinable())
+        throw std::runtime_error("Trajectory file already closed");
+    if (m_num_frames == 0)
+        WriteHeader();
+
+    ChunkBuffer& buffer = m_buffers[m_front];
+    if (buffer.times.empty())
+        buffer.first_frame = m_num_frames;
+    buffer.times.push_back(sys.GetChTime());
+
+    for (int c = 0; c < (int)TrajectoryChannel::NUM_CHANNELS; c++) {
+        if (!(m_channel_mask & (1u << c)))
+            continue;
+        auto& channel = buffer.channels[c];
+        if (channel.offsets.empty())
+            channel.offsets.push_back(0);
+
+        switch ((TrajectoryChannel)c) {
+            case TrajectoryChannel::BODIES:
+                for (const auto& body : sys.GetBodies()) {
+                    const auto& pos = body->GetPos();
+                    const auto& rot = body->GetRot();
+                    const auto& vel = body->GetPosDt();
+                    auto angvel = body->GetAngVelParent();
+                    const auto& acc = body->GetPosDt2();
+                    auto angacc = body->GetAngAccParent();
+                    AddRow(channel, {(double)body->GetIdentifier(), pos.x(), pos.y(), pos.z(), rot.e0(), rot.e1(),
+                                     rot.e2(), rot.e3(), vel.x(), vel.y(), vel.z(), angvel.x(), angvel.y(),
+                                     angvel.z(), acc.x(), acc.y(), acc.z(), angacc.x(), angacc.y(), angacc.z()});
+                }
+                break;
+            case TrajectoryChannel::LINKS:
+                for (const auto& link : sys.GetLinks()) {
+                    auto pos = link->GetFrame2Abs().GetPos();
+                    auto reaction = link->GetReaction2();
+                    AddRow(channel, {(double)link->GetIdentifier(), pos.x(), pos.y(), pos.z(), reaction.force.x(),
+                                     reaction.force.y(), reaction.force.z(), reaction.torque.x(),
+                                     reaction.torque.y(), reaction.torque.z()});
+                }
+                break;
+            case TrajectoryChannel::SHAFTS:
+                for (const auto& shaft : sys.GetShafts()) {
+                    AddRow(channel, {(double)shaft->GetIdentifier(), shaft->GetPos(), shaft->GetPosDt(),
+                                     shaft->GetPosDt2(), shaft->GetAppliedLoad()});
+                }
+                break;
+            case TrajectoryChannel::CONTACTS:
+                sys.GetContactContainer()->ReportAllContacts(
+                    chrono_types::make_shared<TrajectoryContactReporter>(channel.columns));
+                break;
+            default:
+                break;
+        }
+
+        channel.offsets.push_back(channel.columns[0].size());
+    }
+
+    m_num_frames++;
+    if (buffer.times.size() == m_frames_per_chunk)
+        Submit();
+}
+
+// Hand over the front buffer to the writer thread, waiting for the previous chunk to be written.
+void ChWriterTrajectory::Submit() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_cv.wait(lock, [this]() { return !m_pending; });
+    m_pending = true;
+    m_front = 1 - m_front;
+    m_cv.notify_all();
+}
+
+void ChWriterTrajectory::Close() {
+    if (!m_thread.joinable())
+        return;
+
+    if (m_num_frames == 0)
+        WriteHeader();
+    if (!m_buffers[m_front].times.empty())
+        Submit();
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_cv.notify_all();
+    m_thread.join();
+
+    if (std::fclose(m_file) != 0)
+        m_failed = true;
+    m_file = nullptr;
+
+    if (m_failed)
+        throw std::runtime_error("Error writing trajectory file");
+}
+
+void ChWriterTrajectory::WriteChunk(std::uint32_t channel,
+                                    size_t first_frame,
+                                    size_t num_frames,
+                                    const std::vector<char>& raw) {
+    TrajectoryChunkHeader header = {};
+    header.channel = channel;
+    header.first_frame = first_frame;
+    header.num_frames = num_frames;
+    header.raw_size = raw.size();
+
+    const std::vector<char>* payload = &raw;
+    if (m_compress) {
+        std::vector<char> shuffled(raw.size());
+        Shuffle(raw.data(), raw.size(), shuffled.data());
+        CompressLZ(shuffled.data(), shuffled.size(), m_encoded);
+        if (m_encoded.size() < raw.size()) {
+            header.compressed = 1;
+            payload = &m_encoded;
+        }
+    }
+    header.stored_size = payload->size();
+
+    static const char padding[8] = {};
+    size_t num_padding = (8 - payload->size() % 8) % 8;
+
+    bool ok = std::fwrite(&header, sizeof(header), 1, m_file) == 1;
+    if (!payload->empty())
+        ok = ok && std::fwrite(payload->data(), payload->size(), 1, m_file) == 1;
+    if (num_padding > 0)
+        ok = ok && std::fwrite(padding, num_padding, 1, m_file) == 1;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_num_bytes += sizeof(header) + payload->size() + num_padding;
+    if (!ok)
+        m_failed = true;
+}
+
+void ChWriterTrajectory::WriterLoop() {
+    while (true) {
+        int back;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_cv.wait(lock, [this]() { return m_pending || m_stop; });
+            if (!m_pending)
+                break;
+            back = 1 - m_front;
+        }
+
+        ChunkBuffer& buffer = m_buffers[back];
+        size_t num_frames = buffer.times.size();
+
+        m_raw.resize(num_frames * sizeof(double));
+        std::memcpy(m_raw.data(), buffer.times.data(), m_raw.size());
+        WriteChunk(time_channel, buffer.first_frame, num_frames, m_raw);
+
+        for (int c = 0; c < (int)TrajectoryChannel::NUM_CHANNELS; c++) {
+            if (!(m_channel_mask & (1u << c)))
+                continue;
+            const auto& channel = buffer.channels[c];
+            size_t offsets_size = channel.offsets.size() * sizeof(std::uint64_t);
+            size_t column_size = channel.columns[0].size() * sizeof(double);
+            m_raw.resize(offsets_size + channel.columns.size() * column_size);
+            std::memcpy(m_raw.data(), channel.offsets.data(), offsets_size);
+            for (size_t k = 0; k < channel.columns.size(); k++)
+                std::memcpy(m_raw.data() + offsets_size + k * column_size, channel.columns[k].data(), column_size);
+            WriteChunk((std::uint32_t)c, buffer.first_frame, num_frames, m_raw);
+        }
+
+        buffer.Clear();
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_pending = false;
+        }
+        m_cv.notify_all();
+    }
+}
+
+// -----------------------------------------------------------------------------
+// ChReaderTrajectory
+// -----------------------------------------------------------------------------
+
+ChReaderTrajectory::ChReaderTrajectory(const std::string& filename)
+    : m_data(nullptr), m_size(0), m_channel_mask(0), m_num_frames(0) {
+#ifndef _WIN32
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0)
+        throw std::runtime_error("Cannot open trajectory file " + filename);
+    struct stat st;
+    if (fstat(fd, &st) == 0 && st.st_size > 0) {
+        void* addr = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (addr != MAP_FAILED) {
+            m_data = static_cast<const char*>(addr);
+            m_size = (size_t)st.st_size;
+        }
+    }
+    close(fd);
+#endif
+
+    // Read the entire file if it could not be memory-mapped
+    if (!m_data) {
+        std::ifstream ifile(filename, std::ios::binary | std::ios::ate);
+        if (!ifile)
+            throw std::runtime_error("Cannot open trajectory file " + filename);
+        m_size = (size_t)ifile.tellg();
+        m_contents.resize((m_size + sizeof(double) - 1) / sizeof(double));
+        ifile.seekg(0);
+        ifile.read(reinterpret_cast<char*>(m_contents.data()), m_size);
+        m_data = reinterpret_cast<const char*>(m_contents.data());
+    }
+
+    // Build the chunk index
+    try {
+        TrajectoryFileHeader header;
+        if (m_size < sizeof(header))
+            throw std::runtime_error("Invalid trajectory file " + filename);
+        std::memcpy(&header, m_data, sizeof(header));
+        if (std::memcmp(header.magic, trajectory_magic, sizeof(header.magic)) != 0 ||
+            header.version != trajectory_version)
+            throw std::runtime_error("Invalid trajectory file " + filename);
+        m_channel_mask = header.channel_mask;
+
+        size_t pos = sizeof(header);
+        while (pos + sizeof(TrajectoryChunkHeader) <= m_size) {
+            TrajectoryChunkHeader chunk_header;
+            std::memcpy(&chunk_header, m_data + pos, sizeof(chunk_header));
+            pos += sizeof(chunk_header);
+            if (chunk_header.channel > time_channel || chunk_header.stored_size > m_size - pos ||
+                chunk_header.raw_size % 8 != 0)
+                throw std::runtime_error("Corrupted trajectory file " + filename);
+
+            Chunk chunk;
+            chunk.first_frame = (size_t)chunk_header.first_frame;
+            chunk.num_frames = (size_t)chunk_header.num_frames;
+            chunk.data = m_data + pos;
+            chunk.stored_size = (size_t)chunk_header.stored_size;
+            chunk.raw_size = (size_t)chunk_header.raw_size;
+            chunk.compressed = chunk_header.compressed != 0;
+            m_chunks[chunk_header.channel].push_back(std::move(chunk));
+
+            pos += (size_t)((chunk_header.stored_size + 7) / 8 * 8);
+        }
+
+        if (!m_chunks[time_channel].empty()) {
+            const auto& last = m_chunks[time_channel].back();
+            m_num_frames = last.first_frame + last.num_frames;
+        }
+    } catch (const std::exception&) {
+#ifndef _WIN32
+        if (m_contents.empty())
+            munmap(const_cast<char*>(m_data), m_size);
+#endif
+        throw;
+    }
+}
+
+ChReaderTrajectory::~ChReaderTrajectory() {
+#ifndef _WIN32
+    if (m_contents.empty() && m_data)
+        munmap(const_cast<char*>(m_data), m_size);
+#endif
+}
+
+bool ChReaderTrajectory::HasChannel(TrajectoryChannel channel) const {
+    return (m_channel_mask & (1u << (int)channel)) != 0;
+}
+
+const ChReaderTrajectory::Chunk& ChReaderTrajectory::FindChunk(int channel, size_t frame) const {
+    const auto& chunks = m_chunks[channel];
+    auto it = std::upper_bound(chunks.begin(), chunks.end(), frame,
+                               [](size_t f, const Chunk& chunk) { return f < chunk.first_frame; });
+    if (it == chunks.begin() || frame >= (it - 1)->first_frame + (it - 1)->num_frames)
+        throw std::out_of_range("Trajectory frame not available");
+    return *(it - 1);
+}
+
+const double* ChReaderTrajectory::GetChunkData(const Chunk& chunk) const {
+    if (!chunk.compressed)
+        return reinterpret_cast<const double*>(chunk.data);
+
+    if (chunk.decoded.empty() && chunk.raw_size > 0) {
+        std::vector<char> shuffled(chunk.raw_size);
+        if (!DecompressLZ(chunk.data, chunk.stored_size, shuffled.data(), chunk.raw_size))
+            throw std::runtime_error("Corrupted trajectory chunk");
+        chunk.decoded.resize(chunk.raw_size / sizeof(double));
+        Unshuffle(shuffled.data(), chunk.raw_size, reinterpret_cast<char*>(chunk.decoded.data()));
+    }
+    return chunk.decoded.data();
+}
+
+double ChReaderTrajectory::GetTime(size_t frame) const {
+    const Chunk& chunk = FindChunk(time_channel, frame);
+    return GetChunkData(chunk)[frame - chunk.first_frame];
+}
+
+size_t ChReaderTrajectory::GetNumRows(TrajectoryChannel channel, size_t frame) const {
+    const Chunk& chunk = FindChunk((int)channel, frame);
+    const std::uint64_t* offsets = reinterpret_cast<const std::uint64_t*>(GetChunkData(chunk));
+    size_t f = frame - chunk.first_frame;
+    return (size_t)(offsets[f + 1] - offsets[f]);
+}
+
+const double* ChReaderTrajectory::GetColumn(TrajectoryChannel channel, size_t frame, unsigned int column) const {
+    const Chunk& chunk = FindChunk((int)channel, frame);
+    const double* data = GetChunkData(chunk);
+    const std::uint64_t* offsets = reinterpret_cast<const std::uint64_t*>(data);
+    size_t num_rows = (size_t)offsets[chunk.num_frames];
+    size_t f = frame - chunk.first_frame;
+    return data + (chunk.num_frames + 1) + column * num_rows + offsets[f];
+}
+
+void ChReaderTrajectory::ConvertToCSV(TrajectoryChannel channel,
+                                      const std::string& filename,
+                                      const std::string& delim) const {
+    std::ofstream ofile(filename);
+    if (!ofile)
+        throw std::runtime_error("Cannot open output file " + filename);
+    ofile << std::setprecision(std::numeric_limits<double>::max_digits10);
+
+    const auto& names = GetTrajectoryColumns(channel);
+    ofile << "time";
+    for (const auto& name : names)
+        ofile << delim << name;
+    ofile << "\n";
+
+    if (!HasChannel(channel))
+        return;
+
+    std::vector<const double*> columns(names.size());
+    for (size_t frame = 0; frame < m_num_frames; frame++) {
+        double time = GetTime(frame);
+        size_t num_rows = GetNumRows(channel, frame);
+        for (unsigned int c = 0; c < (unsigned int)names.size(); c++)
+            columns[c] = GetColumn(channel, frame, c);
+        for (size_t r = 0; r < num_rows; r++) {
+            ofile << time;
+            for (const double* column : columns)
+                ofile << delim << column[r];
+            ofile << "\n";
+        }
+    }
+}
+
+}  // end namespace utils
+}  // end namespace chrono
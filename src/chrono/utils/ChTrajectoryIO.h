@@ -0,0 +1,194 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Binary columnar trajectory files.
+//
+// ChWriterTrajectory
+//  writes the state of the bodies, links, shafts, and contacts of a system at
+//  successive frames, in chunks of frames stored column by column, optionally
+//  compressed. Chunks are encoded and written by a background thread.
+//
+// ChReaderTrajectory
+//  memory-maps a trajectory file and provides direct access to its columns;
+//  trajectory channels can be converted to CSV files.
+//
+// =============================================================================
+
+#ifndef CH_TRAJECTORY_IO_H
+#define CH_TRAJECTORY_IO_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <initializer_list>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "chrono/core/ChApiCE.h"
+#include "chrono/physics/ChSystem.h"
+
+namespace chrono {
+namespace utils {
+
+/// @addtogroup chrono_utils
+/// @{
+
+/// Data channels of a trajectory file.
+/// Each channel has a fixed schema (see GetTrajectoryColumns); all values are stored as doubles and each frame holds
+/// a variable number of rows per channel (one per body, link, shaft, or contact).
+enum class TrajectoryChannel {
+    BODIES,    ///< body identifier, position, orientation, linear and angular velocity and acceleration (absolute)
+    LINKS,     ///< link identifier, position of link frame 2, reaction force and torque on body 2 (in link frame 2)
+    SHAFTS,    ///< shaft identifier, angle, angular velocity, angular acceleration, applied load
+    CONTACTS,  ///< identifiers of the two items, contact point on A, normal, contact force and torque (absolute)
+    NUM_CHANNELS
+};
+
+/// Return the names of the columns of the specified channel.
+ChApi const std::vector<std::string>& GetTrajectoryColumns(TrajectoryChannel channel);
+
+/// Writer of binary trajectory files.
+/// Frames are accumulated in memory, column by column, and written in chunks of a fixed number of frames. Two chunk
+/// buffers are used: while the simulation thread fills one of them, the other one is encoded (optionally compressed)
+/// and written to disk by a background thread. WriteFrame blocks only if the previous chunk is not yet written when
+/// the current one is complete.
+/// The file uses the native byte order of the writing machine.
+class ChApi ChWriterTrajectory {
+  public:
+    /// Create a trajectory writer and open the specified output file.
+    /// An exception is thrown if the file cannot be opened.
+    ChWriterTrajectory(const std::string& filename,  ///< name of output file
+                       unsigned int frames_per_chunk = 64,  ///< number of frames per chunk
+                       bool compress = false                ///< compress chunks with a fast LZ-type codec
+    );
+
+    /// Write any pending frames and close the file.
+    ~ChWriterTrajectory();
+
+    /// Enable/disable output of the specified channel (default: only BODIES enabled).
+    /// Must be called before writing the first frame.
+    void EnableChannel(TrajectoryChannel channel, bool val);
+
+    /// Append a frame with the current state of the given system.
+    void WriteFrame(ChSystem& sys);
+
+    /// Write any pending frames and close the file.
+    /// An exception is thrown if writing to the file failed.
+    void Close();
+
+    /// Return the number of frames written so far.
+    size_t GetNumFrames() const { return m_num_frames; }
+
+    /// Return the number of bytes written to the file so far.
+    /// Only includes chunks already processed by the background thread.
+    size_t GetNumBytes();
+
+  private:
+    struct ChannelBuffer {
+        std::vector<std::uint64_t> offsets;        ///< offset of the first row of each frame (plus end offset)
+        std::vector<std::vector<double>> columns;  ///< column data
+    };
+
+    struct ChunkBuffer {
+        size_t first_frame;
+        std::vector<double> times;
+        ChannelBuffer channels[(int)TrajectoryChannel::NUM_CHANNELS];
+        void Clear();
+    };
+
+    void WriteHeader();
+    void AddRow(ChannelBuffer& buffer, std::initializer_list<double> values);
+    void Submit();
+    void WriteChunk(std::uint32_t channel, size_t first_frame, size_t num_frames, const std::vector<char>& raw);
+    void WriterLoop();
+
+    std::FILE* m_file;
+    unsigned int m_frames_per_chunk;
+    bool m_compress;
+    std::uint32_t m_channel_mask;
+    size_t m_num_frames;
+    size_t m_num_bytes;
+
+    ChunkBuffer m_buffers[2];  ///< double-buffered chunks
+    int m_front;               ///< buffer currently being filled
+    bool m_pending;            ///< true if the back buffer is waiting to be written
+    bool m_stop;               ///< request termination of the writer thread
+    bool m_failed;             ///< true if writing to the file failed
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::thread m_thread;
+    std::vector<char> m_raw;      ///< encoding buffer (writer thread)
+    std::vector<char> m_encoded;  ///< compression buffer (writer thread)
+};
+
+/// Reader of binary trajectory files.
+/// The file is memory-mapped and column data of uncompressed chunks is accessed in place, without copies. Compressed
+/// chunks are decompressed on first access and cached. A reader object must not be accessed concurrently from
+/// multiple threads.
+class ChApi ChReaderTrajectory {
+  public:
+    /// Open the specified trajectory file.
+    /// An exception is thrown if the file cannot be opened or is not a valid trajectory file.
+    ChReaderTrajectory(const std::string& filename);
+
+    ~ChReaderTrajectory();
+
+    /// Return true if the specified channel was written to the file.
+    bool HasChannel(TrajectoryChannel channel) const;
+
+    /// Return the number of frames in the file.
+    size_t GetNumFrames() const { return m_num_frames; }
+
+    /// Return the time of the specified frame.
+    double GetTime(size_t frame) const;
+
+    /// Return the number of rows of the specified channel at the given frame.
+    size_t GetNumRows(TrajectoryChannel channel, size_t frame) const;
+
+    /// Return the values of the specified column of a channel at the given frame.
+    /// The returned array has GetNumRows(channel, frame) entries and remains valid for the lifetime of the reader.
+    const double* GetColumn(TrajectoryChannel channel, size_t frame, unsigned int column) const;
+
+    /// Write the data of the specified channel to a CSV file, one line per row of each frame.
+    /// Each line starts with the frame time; a header line with the column names is written first.
+    void ConvertToCSV(TrajectoryChannel channel, const std::string& filename, const std::string& delim = ",") const;
+
+  private:
+    struct Chunk {
+        size_t first_frame;                   ///< index of first frame in chunk
+        size_t num_frames;                    ///< number of frames in chunk
+        const char* data;                     ///< stored chunk payload
+        size_t stored_size;                   ///< size of stored payload
+        size_t raw_size;                      ///< size of decoded payload
+        bool compressed;                      ///< true if the stored payload is compressed
+        mutable std::vector<double> decoded;  ///< decoded payload of a compressed chunk
+    };
+
+    const Chunk& FindChunk(int channel, size_t frame) const;
+    const double* GetChunkData(const Chunk& chunk) const;
+
+    const char* m_data;              ///< file contents
+    size_t m_size;                   ///< file size
+    std::vector<double> m_contents;  ///< file contents, if not memory-mapped
+    std::uint32_t m_channel_mask;
+    size_t m_num_frames;
+    std::vector<Chunk> m_chunks[(int)TrajectoryChannel::NUM_CHANNELS + 1];  ///< chunks per channel (last: times)
+};
+
+/// @} chrono_utils
+
+}  // end namespace utils
+}  // end namespace chrono
+
+#endif
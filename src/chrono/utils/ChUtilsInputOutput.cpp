@@ -419,6 +419,15 @@ void WriteVisualizationAssets(ChSystem* system,
                               std::function<bool(const ChBody&)> selector,
                               bool body_info,
                               const std::string& delim) {
+    std::ofstream ofile(filename);
+    WriteVisualizationAssets(system, ofile, selector, body_info, delim);
+}
+
+void WriteVisualizationAssets(ChSystem* system,
+                              std::ostream& out,
+                              std::function<bool(const ChBody&)> selector,
+                              bool body_info,
+                              const std::string& delim) {
     ChWriterCSV csv(delim);
 
     // If requested, Loop over all bodies and write out their position and
@@ -579,12 +588,10 @@ void WriteVisualizationAssets(ChSystem* system,
         }
     }
 
-    // Write the output file, including a first line with number of bodies, visual
+    // Write the output, including a first line with number of bodies, visual
     // assets, links, and TSDA assets.
-    std::stringstream header;
-    header << b_count << delim << a_count << delim << l_count << delim << la_count << delim << std::endl;
-
-    csv.WriteToFile(filename, header.str());
+    out << b_count << delim << a_count << delim << l_count << delim << la_count << delim << std::endl << std::endl;
+    out << csv.Stream().str();
 }
 
 // -----------------------------------------------------------------------------
@@ -195,6 +195,15 @@ ChApi void WriteVisualizationAssets(ChSystem* system,
                                     const std::string& delim = ","                ///< CSV delimitator
 );
 
+/// Write body and asset information for off-line visualization to the specified output stream.
+/// The output has the same format as the CSV file generated by the above functions.
+ChApi void WriteVisualizationAssets(ChSystem* system,                             ///< containg system
+                                    std::ostream& out,                            ///< output stream
+                                    std::function<bool(const ChBody&)> selector,  ///< select bodies
+                                    bool body_info = true,                        ///< include body state information
+                                    const std::string& delim = ","                ///< CSV delimitator
+);
+
 /// Write the specified mesh as a macro in a PovRay include file. The output file will be "[out_dir]/[mesh_name].inc".
 /// The mesh vertices will be transformed to the frame with specified offset and orientation.
 ChApi void WriteMeshPovray(ChTriangleMeshConnected& trimesh,
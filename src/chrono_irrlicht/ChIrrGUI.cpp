@@ -509,6 +509,8 @@ void ChIrrGUI::Render() {
     str += m_system->GetNumBodiesSleeping();
     str += "\nNum. contacts:  ";
     str += m_system->GetNumContacts();
+    str += "\nContact match rate:  ";
+    str += m_system->GetContactMatchRate();
     str += "\nNum. coords:  ";
     str += m_system->GetNumCoordsVelLevel();
     str += "\nNum. constr:  ";
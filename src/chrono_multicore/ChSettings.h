@@ -42,6 +42,7 @@ class collision_settings {
           bins_per_axis(vec3(10, 10, 10)),
           bin_size(real3(1, 1, 1)),
           grid_density(5),
+          grid_level_ratio(4),
           broadphase_grid(ChBroadphase::GridType::FIXED_RESOLUTION),
           narrowphase_algorithm(ChNarrowphase::Algorithm::HYBRID) {}
 
@@ -79,6 +80,10 @@ class collision_settings {
     /// `broadphase_grid` type is set to FIXED_DENSITY.
     real grid_density;
 
+    /// Size ratio of coarse-level shapes to fine-level bins. This value is used to assign shapes to the two levels of
+    /// the broadphase collision grid if the `broadphase_grid` type is set to ADAPTIVE.
+    real grid_level_ratio;
+
     /// Algorithm for narrowphase collision detection phase.
     /// The Chrono collision detection system provides several analytical collision detection algorithms, for particular
     /// pairs of shapes (see ChNarrowphasePRIMS). For general convex shapes, the collision system relies on the
@@ -228,6 +233,7 @@ class settings_container {
         perform_thread_tuning = false;
         system_type = SystemType::SYSTEM_NSC;
         step_size = 0.01;
+        deterministic = false;
     }
 
     collision_settings collision;  ///< settings for collision detection
@@ -236,6 +242,8 @@ class settings_container {
     real step_size;  ///< current integration step size
     real3 gravity;   ///< gravitational acceleration vector
 
+    bool deterministic;  ///< use reduction orders independent of the number of threads (see ChSystem::SetDeterministic)
+
   private:
     bool perform_thread_tuning;  ///< dynamically tune number of threads
     int min_threads;             ///< lower bound for number of threads (if dynamic tuning)
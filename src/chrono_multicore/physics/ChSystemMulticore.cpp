@@ -693,6 +693,11 @@ settings_container* ChSystemMulticore::GetSettings() {
 
 // -------------------------------------------------------------
 
+void ChSystemMulticore::SetDeterministic(bool val) {
+    ChSystem::SetDeterministic(val);
+    data_manager->settings.deterministic = val;
+}
+
 void ChSystemMulticore::SetNumThreads(int num_threads_chrono, int num_threads_collision, int num_threads_eigen) {
     ChSystem::SetNumThreads(num_threads_chrono, num_threads_chrono, num_threads_eigen);
 
@@ -180,6 +180,11 @@ class CH_MULTICORE_API ChSystemMulticore : public ChSystem {
                                int num_threads_collision = 0,
                                int num_threads_eigen = 0) override;
 
+    /// Enable or disable deterministic multithreaded stepping.
+    /// If enabled, the SMC contact forces are reduced per body in contact order, independently of the number of
+    /// threads.
+    virtual void SetDeterministic(bool val) override;
+
     /// Enable dynamic adjustment of number of threads between the specified limits.
     /// The initial number of threads is set to min_threads.
     void EnableThreadTuning(int min_threads, int max_threads);
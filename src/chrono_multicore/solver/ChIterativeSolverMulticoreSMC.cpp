@@ -696,8 +696,15 @@ void ChIterativeSolverMulticoreSMC::ProcessContacts() {
     //    involved in at least one contact, by reducing the contact forces and
     //    torques from all contacts these bodies are involved in. The number of
     //    bodies that experience at least one contact is 'ct_body_count'.
-    thrust::sort_by_key(THRUST_PAR ct_bid.begin(), ct_bid.end(),
-                        thrust::make_zip_iterator(thrust::make_tuple(ct_force.begin(), ct_torque.begin())));
+    //    In deterministic mode, the contacts of each body are kept in contact order (stable sort) and their forces
+    //    are summed sequentially, so that the result does not depend on the number of threads.
+    bool deterministic = data_manager->settings.deterministic;
+    if (deterministic)
+        thrust::stable_sort_by_key(THRUST_PAR ct_bid.begin(), ct_bid.end(),
+                                   thrust::make_zip_iterator(thrust::make_tuple(ct_force.begin(), ct_torque.begin())));
+    else
+        thrust::sort_by_key(THRUST_PAR ct_bid.begin(), ct_bid.end(),
+                            thrust::make_zip_iterator(thrust::make_tuple(ct_force.begin(), ct_torque.begin())));
 
     custom_vector<int> ct_body_id(data_manager->num_rigid_bodies);
     custom_vector<real3>& ct_body_force = data_manager->host_data.ct_body_force;
@@ -706,21 +713,36 @@ void ChIterativeSolverMulticoreSMC::ProcessContacts() {
     ct_body_force.resize(data_manager->num_rigid_bodies);
     ct_body_torque.resize(data_manager->num_rigid_bodies);
 
-    // Reduce contact forces from all contacts and count bodies currently involved
-    // in contact. We do this simultaneously for contact forces and torques, using
-    // zip iterators.
-    auto end_range = thrust::reduce_by_key(
-        THRUST_PAR ct_bid.begin(), ct_bid.end(),
-        thrust::make_zip_iterator(thrust::make_tuple(ct_force.begin(), ct_torque.begin())), ct_body_id.begin(),
-        thrust::make_zip_iterator(thrust::make_tuple(ct_body_force.begin(), ct_body_torque.begin())),
+    uint ct_body_count = 0;
+    if (deterministic) {
+        for (size_t i = 0; i < ct_bid.size(); i++) {
+            if (i == 0 || ct_bid[i] != ct_bid[i - 1]) {
+                ct_body_id[ct_body_count] = ct_bid[i];
+                ct_body_force[ct_body_count] = ct_force[i];
+                ct_body_torque[ct_body_count] = ct_torque[i];
+                ct_body_count++;
+            } else {
+                ct_body_force[ct_body_count - 1] += ct_force[i];
+                ct_body_torque[ct_body_count - 1] += ct_torque[i];
+            }
+        }
+    } else {
+        // Reduce contact forces from all contacts and count bodies currently involved
+        // in contact. We do this simultaneously for contact forces and torques, using
+        // zip iterators.
+        auto end_range = thrust::reduce_by_key(
+            THRUST_PAR ct_bid.begin(), ct_bid.end(),
+            thrust::make_zip_iterator(thrust::make_tuple(ct_force.begin(), ct_torque.begin())), ct_body_id.begin(),
+            thrust::make_zip_iterator(thrust::make_tuple(ct_body_force.begin(), ct_body_torque.begin())),
 #if defined _WIN32
-        thrust::equal_to<int64_t>(), sum_tuples()  // Windows compilers require an explicit-width type
+            thrust::equal_to<int64_t>(), sum_tuples()  // Windows compilers require an explicit-width type
 #else
-        thrust::equal_to<int>(), sum_tuples()
+            thrust::equal_to<int>(), sum_tuples()
 #endif
-    );
+        );
 
-    uint ct_body_count = (uint)(end_range.first - ct_body_id.begin());
+        ct_body_count = (uint)(end_range.first - ct_body_id.begin());
+    }
 
     ct_body_force.resize(ct_body_count);
     ct_body_torque.resize(ct_body_count);
@@ -22,7 +22,10 @@ ChSolverPardisoMKL::ChSolverPardisoMKL(unsigned int num_threads) {
 }
 
 bool ChSolverPardisoMKL::FactorizeMatrix() {
-    m_engine.compute(m_mat);
+    // Redo the symbolic analysis (reordering and symbolic factorization) only if the sparsity pattern changed
+    if (m_pattern_changed)
+        m_engine.analyzePattern(m_mat);
+    m_engine.factorize(m_mat);
     return (m_engine.info() == Eigen::Success);
 }
 
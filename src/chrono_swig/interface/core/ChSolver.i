@@ -60,6 +60,8 @@ Type GetType() const { return chrono::ChSolver::Type::CUSTOM; }
 #include "chrono/solver/ChSolverBB.h"
 #include "chrono/solver/ChSolverAPGD.h"
 #include "chrono/solver/ChSolverPSOR.h"
+#include "chrono/solver/ChSolverPSORColored.h"
+#include "chrono/solver/ChSolverPSORIslands.h"
 #include "chrono/solver/ChSolverPJacobi.h"
 #include "chrono/solver/ChSolverADMM.h"
 
@@ -80,6 +82,8 @@ using namespace chrono;
 %shared_ptr(chrono::ChSolverBB)
 %shared_ptr(chrono::ChSolverAPGD)
 %shared_ptr(chrono::ChSolverPSOR)
+%shared_ptr(chrono::ChSolverPSORColored)
+%shared_ptr(chrono::ChSolverPSORIslands)
 %shared_ptr(chrono::ChSolverPJacobi)
 %shared_ptr(chrono::ChSolverSparseLU)
 %shared_ptr(chrono::ChSolverSparseQR)
@@ -97,6 +101,8 @@ using namespace chrono;
 %include "../../../chrono/solver/ChSolverBB.h"
 %include "../../../chrono/solver/ChSolverAPGD.h"
 %include "../../../chrono/solver/ChSolverPSOR.h"
+%include "../../../chrono/solver/ChSolverPSORColored.h"
+%include "../../../chrono/solver/ChSolverPSORIslands.h"
 %include "../../../chrono/solver/ChSolverPJacobi.h"
 %include "../../../chrono/solver/ChSolverADMM.h"
 
@@ -110,6 +116,8 @@ using namespace chrono;
 %DefSharedPtrDynamicCast(chrono, ChIterativeSolverVI, ChSolverAPGD)
 %DefSharedPtrDynamicCast(chrono, ChIterativeSolverVI, ChSolverBB)
 %DefSharedPtrDynamicCast(chrono, ChIterativeSolverVI, ChSolverPSOR)
+%DefSharedPtrDynamicCast(chrono, ChIterativeSolverVI, ChSolverPSORColored)
+%DefSharedPtrDynamicCast(chrono, ChIterativeSolverVI, ChSolverPSORIslands)
 
 %DefSharedPtrDynamicCast(chrono, ChIterativeSolverLS, ChSolverGMRES)
 %DefSharedPtrDynamicCast(chrono, ChIterativeSolverLS, ChSolverMINRES)
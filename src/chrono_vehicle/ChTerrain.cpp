@@ -42,5 +42,22 @@ void ChTerrain::GetProperties(const ChVector3d& loc, double& height, ChVector3d&
     friction = GetCoefficientFriction(loc);
 }
 
+void ChTerrain::GetProperties(const std::vector<ChVector3d>& locs,
+                              std::vector<double>& heights,
+                              std::vector<ChVector3d>& normals,
+                              std::vector<float>& friction) const {
+    heights.resize(locs.size());
+    normals.resize(locs.size());
+    friction.resize(locs.size());
+    for (size_t i = 0; i < locs.size(); i++)
+        GetProperties(locs[i], heights[i], normals[i], friction[i]);
+}
+
+void ChTerrain::GetHeights(const std::vector<ChVector3d>& locs, std::vector<double>& heights) const {
+    heights.resize(locs.size());
+    for (size_t i = 0; i < locs.size(); i++)
+        heights[i] = GetHeight(locs[i]);
+}
+
 }  // end namespace vehicle
 }  // end namespace chrono
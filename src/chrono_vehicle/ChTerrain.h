@@ -19,6 +19,8 @@
 #ifndef CH_TERRAIN_H
 #define CH_TERRAIN_H
 
+#include <vector>
+
 #include "chrono/core/ChVector3.h"
 
 #include "chrono_vehicle/ChApiVehicle.h"
@@ -57,6 +59,21 @@ class CH_VEHICLE_API ChTerrain {
     /// Get all terrain characteristics at the point below the specified location.
     virtual void GetProperties(const ChVector3d& loc, double& height, ChVector3d& normal, float& friction) const;
 
+    /// Get all terrain characteristics at the points below the specified locations.
+    /// On return, the output vectors are resized to the number of query locations and their i-th entries hold the
+    /// terrain height, normal, and coefficient of friction below locs[i]. This default implementation calls the
+    /// single-point GetProperties for each location; derived classes may share work across the batch.
+    virtual void GetProperties(const std::vector<ChVector3d>& locs,
+                               std::vector<double>& heights,
+                               std::vector<ChVector3d>& normals,
+                               std::vector<float>& friction) const;
+
+    /// Get the terrain heights below the specified locations.
+    /// On return, the output vector is resized to the number of query locations. This default implementation calls
+    /// GetHeight for each location; derived classes may share work across the batch. Use this function instead of the
+    /// batched GetProperties if only heights are needed (normals and coefficients of friction are not evaluated).
+    virtual void GetHeights(const std::vector<ChVector3d>& locs, std::vector<double>& heights) const;
+
     /// Class to be used as a functor interface for location-dependent terrain height.
     class CH_VEHICLE_API HeightFunctor {
       public:
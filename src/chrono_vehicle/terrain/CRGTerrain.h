@@ -93,6 +93,15 @@ class CH_VEHICLE_API CRGTerrain : public ChTerrain {
     /// Otherwise, it returns the constant value specified at construction.
     virtual float GetCoefficientFriction(const ChVector3d& loc) const override;
 
+    using ChTerrain::GetProperties;
+
+    /// Get all terrain characteristics at the points below the specified locations.
+    /// The terrain height at each location is evaluated only once and reused for the normal calculation.
+    virtual void GetProperties(const std::vector<ChVector3d>& locs,
+                               std::vector<double>& heights,
+                               std::vector<ChVector3d>& normals,
+                               std::vector<float>& friction) const override;
+
     /// Get the road center line as a Bezier curve.
     std::shared_ptr<ChBezierCurve> GetRoadCenterLine();
 
@@ -150,6 +159,9 @@ class CH_VEHICLE_API CRGTerrain : public ChTerrain {
     void GenerateCurves();
     void SetRoadsidePosts();
 
+    /// Calculate the terrain normal below the specified location, given the terrain height z0 at that location.
+    ChVector3d CalcNormal(const ChVector3d& loc, double z0) const;
+
     double m_post_distance;  // 0 means no posts
     std::string m_diffuse_texture_filename;
     bool m_use_diffuseTexture;  // if set, use a textured mesh
@@ -18,8 +18,12 @@
 
 #include <limits>
 #include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <cstdint>
 #include <cstdio>
+#include <cstring>
+#include <mutex>
 
 #include "chrono/assets/ChVisualSystem.h"
 #include "chrono/assets/ChVisualShapeBox.h"
@@ -1006,6 +1010,343 @@ void RigidTerrain::RemovePatch(std::shared_ptr<Patch> patch) {
     }
 }
 
+// -----------------------------------------------------------------------------
+// Height cache for mesh patches.
+// The mesh surface is sampled at the nodes of a regular grid in the horizontal plane of the ISO frame, by intersecting
+// vertical lines with the mesh triangles. At each node, the height and normal of the top surface are stored, as well
+// as flags indicating whether the line hit the mesh and whether it crossed multiple layers (overhangs). Nodes are
+// grouped in tiles of m_cells x m_cells cells (tiles share their boundary nodes), generated when first accessed.
+// -----------------------------------------------------------------------------
+
+class RigidTerrain::MeshPatch::HeightCache {
+  public:
+    HeightCache(const MeshPatch& patch, double resolution, int tile_cells);
+
+    /// Find the terrain point below the given location, if it can be resolved from the cache.
+    /// Return false if the query must be resolved by ray casting.
+    bool Lookup(const ChVector3d& loc, double& height, ChVector3d& normal, bool& hit) const;
+
+    bool Save(const std::string& filename) const;
+    bool Load(const std::string& filename);
+
+  private:
+    struct Node {
+        double height;         ///< height of top surface
+        float normal[3];       ///< normal of top surface (ISO frame)
+        std::uint32_t flags;   ///< combination of NodeFlags
+    };
+
+    enum NodeFlags : std::uint32_t {
+        NODE_HIT = 1,      ///< the vertical line through the node intersects the mesh
+        NODE_LAYERED = 2,  ///< the vertical line through the node intersects multiple mesh layers
+    };
+
+    typedef std::vector<Node> Tile;
+
+    const Node& GetNode(int i, int j) const;
+    const Tile& GetTile(int t) const;
+    void GenerateTile(int t, Tile& tile) const;
+
+    double m_res;                // grid resolution
+    int m_cells;                 // number of cells per tile side
+    double m_x0;                 // ISO x coordinate of grid origin
+    double m_y0;                 // ISO y coordinate of grid origin
+    int m_nx;                    // number of grid cells in x direction
+    int m_ny;                    // number of grid cells in y direction
+    int m_ntx;                   // number of tiles in x direction
+    int m_nty;                   // number of tiles in y direction
+    std::uint64_t m_signature;   // hash of mesh vertices (ISO frame), faces, and grid parameters
+
+    std::vector<ChVector3d> m_vertices;          // mesh vertices (ISO frame)
+    std::vector<ChVector3i> m_faces;             // mesh faces
+    std::vector<std::vector<int>> m_tile_faces;  // faces overlapping each tile
+
+    mutable std::mutex m_mutex;                                  // protects tile generation
+    mutable std::vector<std::unique_ptr<Tile>> m_tiles;          // generated tiles
+    mutable std::unique_ptr<std::atomic<const Tile*>[]> m_ptrs;  // tile pointers (null if not yet generated)
+};
+
+static const char height_cache_magic[8] = {'C', 'H', 'R', 'T', 'H', 'C', 0, 0};
+static const std::uint32_t height_cache_version = 1;
+
+static void HashBytes(std::uint64_t& hash, const void* data, size_t size) {
+    // FNV-1a
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= 1099511628211ULL;
+    }
+}
+
+RigidTerrain::MeshPatch::HeightCache::HeightCache(const MeshPatch& patch, double resolution, int tile_cells)
+    : m_res(resolution), m_cells(std::max(1, tile_cells)), m_x0(0), m_y0(0), m_nx(0), m_ny(0), m_ntx(0), m_nty(0) {
+    // Express the mesh vertices in the ISO frame and find the horizontal extent of the mesh
+    double xmin = std::numeric_limits<double>::max();
+    double ymin = std::numeric_limits<double>::max();
+    double xmax = std::numeric_limits<double>::lowest();
+    double ymax = std::numeric_limits<double>::lowest();
+    for (const auto& v : patch.m_trimesh->GetCoordsVertices()) {
+        auto p = ChWorldFrame::ToISO(patch.m_body->TransformPointLocalToParent(v));
+        m_vertices.push_back(p);
+        xmin = std::min(xmin, p.x());
+        ymin = std::min(ymin, p.y());
+        xmax = std::max(xmax, p.x());
+        ymax = std::max(ymax, p.y());
+    }
+    m_faces = patch.m_trimesh->GetIndicesVertexes();
+
+    m_signature = 14695981039346656037ULL;
+    HashBytes(m_signature, m_vertices.data(), m_vertices.size() * sizeof(ChVector3d));
+    HashBytes(m_signature, m_faces.data(), m_faces.size() * sizeof(ChVector3i));
+    HashBytes(m_signature, &m_res, sizeof(m_res));
+    HashBytes(m_signature, &m_cells, sizeof(m_cells));
+
+    if (m_vertices.empty() || m_faces.empty())
+        return;
+
+    m_x0 = xmin;
+    m_y0 = ymin;
+    m_nx = std::max(1, (int)std::ceil((xmax - xmin) / m_res));
+    m_ny = std::max(1, (int)std::ceil((ymax - ymin) / m_res));
+    m_ntx = (m_nx + m_cells - 1) / m_cells;
+    m_nty = (m_ny + m_cells - 1) / m_cells;
+
+    // Assign faces to all tiles overlapping their bounding box (slightly inflated, to include faces touching nodes on
+    // the tile boundaries)
+    double tile_size = m_cells * m_res;
+    double eps = 1e-6 * m_res;
+    m_tile_faces.resize(m_ntx * m_nty);
+    for (int f = 0; f < (int)m_faces.size(); f++) {
+        const auto& a = m_vertices[m_faces[f][0]];
+        const auto& b = m_vertices[m_faces[f][1]];
+        const auto& c = m_vertices[m_faces[f][2]];
+        double fxmin = std::min({a.x(), b.x(), c.x()}) - eps - m_x0;
+        double fxmax = std::max({a.x(), b.x(), c.x()}) + eps - m_x0;
+        double fymin = std::min({a.y(), b.y(), c.y()}) - eps - m_y0;
+        double fymax = std::max({a.y(), b.y(), c.y()}) + eps - m_y0;
+        int tx1 = std::max(0, (int)std::floor(fxmin / tile_size));
+        int tx2 = std::min(m_ntx - 1, (int)std::floor(fxmax / tile_size));
+        int ty1 = std::max(0, (int)std::floor(fymin / tile_size));
+        int ty2 = std::min(m_nty - 1, (int)std::floor(fymax / tile_size));
+        for (int ty = ty1; ty <= ty2; ty++)
+            for (int tx = tx1; tx <= tx2; tx++)
+                m_tile_faces[ty * m_ntx + tx].push_back(f);
+    }
+
+    m_tiles.resize(m_ntx * m_nty);
+    m_ptrs.reset(new std::atomic<const Tile*>[m_ntx * m_nty]);
+    for (int t = 0; t < m_ntx * m_nty; t++)
+        m_ptrs[t].store(nullptr);
+}
+
+void RigidTerrain::MeshPatch::HeightCache::GenerateTile(int t, Tile& tile) const {
+    int tx = t % m_ntx;
+    int ty = t / m_ntx;
+    double tol = 1e-3 * m_res;
+
+    tile.resize((m_cells + 1) * (m_cells + 1));
+    for (int j = 0; j <= m_cells; j++) {
+        for (int i = 0; i <= m_cells; i++) {
+            double x = m_x0 + (tx * m_cells + i) * m_res;
+            double y = m_y0 + (ty * m_cells + j) * m_res;
+
+            Node& node = tile[j * (m_cells + 1) + i];
+            node.height = std::numeric_limits<double>::lowest();
+            node.normal[0] = 0;
+            node.normal[1] = 0;
+            node.normal[2] = 1;
+            node.flags = 0;
+
+            double zmin = std::numeric_limits<double>::max();
+            for (auto f : m_tile_faces[t]) {
+                const auto& a = m_vertices[m_faces[f][0]];
+                const auto& b = m_vertices[m_faces[f][1]];
+                const auto& c = m_vertices[m_faces[f][2]];
+
+                // Barycentric coordinates of the node in the horizontal projection of the face (skip vertical faces)
+                double det = (b.x() - a.x()) * (c.y() - a.y()) - (c.x() - a.x()) * (b.y() - a.y());
+                if (std::abs(det) < 1e-12 * m_res * m_res)
+                    continue;
+                double w1 = ((x - a.x()) * (c.y() - a.y()) - (c.x() - a.x()) * (y - a.y())) / det;
+                double w2 = ((b.x() - a.x()) * (y - a.y()) - (x - a.x()) * (b.y() - a.y())) / det;
+                double w0 = 1 - w1 - w2;
+                if (w0 < -1e-9 || w1 < -1e-9 || w2 < -1e-9)
+                    continue;
+
+                double z = w0 * a.z() + w1 * b.z() + w2 * c.z();
+                zmin = std::min(zmin, z);
+                if (z > node.height) {
+                    auto n = Vcross(b - a, c - a);
+                    if (n.z() < 0)
+                        n = -n;
+                    n.Normalize();
+                    node.height = z;
+                    node.normal[0] = (float)n.x();
+                    node.normal[1] = (float)n.y();
+                    node.normal[2] = (float)n.z();
+                }
+                node.flags |= NODE_HIT;
+            }
+
+            if ((node.flags & NODE_HIT) && zmin < node.height - tol)
+                node.flags |= NODE_LAYERED;
+        }
+    }
+}
+
+const RigidTerrain::MeshPatch::HeightCache::Tile& RigidTerrain::MeshPatch::HeightCache::GetTile(int t) const {
+    const Tile* tile = m_ptrs[t].load(std::memory_order_acquire);
+    if (tile)
+        return *tile;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    tile = m_ptrs[t].load(std::memory_order_relaxed);
+    if (!tile) {
+        m_tiles[t] = std::unique_ptr<Tile>(new Tile);
+        GenerateTile(t, *m_tiles[t]);
+        tile = m_tiles[t].get();
+        m_ptrs[t].store(tile, std::memory_order_release);
+    }
+    return *tile;
+}
+
+const RigidTerrain::MeshPatch::HeightCache::Node& RigidTerrain::MeshPatch::HeightCache::GetNode(int i, int j) const {
+    // Nodes on a tile boundary are shared; the last node in each direction belongs to the last tile
+    int tx = std::min(i / m_cells, m_ntx - 1);
+    int ty = std::min(j / m_cells, m_nty - 1);
+    const Tile& tile = GetTile(ty * m_ntx + tx);
+    return tile[(j - ty * m_cells) * (m_cells + 1) + (i - tx * m_cells)];
+}
+
+bool RigidTerrain::MeshPatch::HeightCache::Lookup(const ChVector3d& loc,
+                                                  double& height,
+                                                  ChVector3d& normal,
+                                                  bool& hit) const {
+    if (m_nx == 0)
+        return false;
+
+    // Points outside the horizontal extent of the mesh cannot hit it
+    auto p = ChWorldFrame::ToISO(loc);
+    double u = (p.x() - m_x0) / m_res;
+    double v = (p.y() - m_y0) / m_res;
+    if (u < 0 || v < 0 || u > m_nx || v > m_ny) {
+        hit = false;
+        return true;
+    }
+
+    int i = std::min((int)u, m_nx - 1);
+    int j = std::min((int)v, m_ny - 1);
+    double fu = u - i;
+    double fv = v - j;
+
+    const Node* nodes[4] = {&GetNode(i, j), &GetNode(i + 1, j), &GetNode(i, j + 1), &GetNode(i + 1, j + 1)};
+    double weights[4] = {(1 - fu) * (1 - fv), fu * (1 - fv), (1 - fu) * fv, fu * fv};
+
+    // Fall back to ray casting for cells at the mesh boundary, with overhangs, with steep steps, or with sharp creases
+    // (where interpolated normals would blend different faces), as well as for query points below the cached surface
+    double hmin = std::numeric_limits<double>::max();
+    double hmax = std::numeric_limits<double>::lowest();
+    const float* n0 = nodes[0]->normal;
+    for (int k = 0; k < 4; k++) {
+        const float* nk = nodes[k]->normal;
+        if (nodes[k]->flags != NODE_HIT || n0[0] * nk[0] + n0[1] * nk[1] + n0[2] * nk[2] < 0.99f)
+            return false;
+        hmin = std::min(hmin, nodes[k]->height);
+        hmax = std::max(hmax, nodes[k]->height);
+    }
+    if (hmax - hmin > 2 * m_res || p.z() < hmax)
+        return false;
+
+    // Bilinear interpolation of heights and normals
+    double h = 0;
+    ChVector3d n(0, 0, 0);
+    for (int k = 0; k < 4; k++) {
+        h += weights[k] * nodes[k]->height;
+        n += weights[k] * ChVector3d(nodes[k]->normal[0], nodes[k]->normal[1], nodes[k]->normal[2]);
+    }
+
+    height = h;
+    normal = ChWorldFrame::FromISO(n.GetNormalized());
+    hit = true;
+    return true;
+}
+
+bool RigidTerrain::MeshPatch::HeightCache::Save(const std::string& filename) const {
+    std::FILE* file = std::fopen(filename.c_str(), "wb");
+    if (!file)
+        return false;
+
+    std::uint32_t cells = m_cells;
+    bool ok = std::fwrite(height_cache_magic, 1, 8, file) == 8;
+    ok = ok && std::fwrite(&height_cache_version, sizeof(std::uint32_t), 1, file) == 1;
+    ok = ok && std::fwrite(&cells, sizeof(std::uint32_t), 1, file) == 1;
+    ok = ok && std::fwrite(&m_signature, sizeof(std::uint64_t), 1, file) == 1;
+    ok = ok && std::fwrite(&m_res, sizeof(double), 1, file) == 1;
+    for (int t = 0; ok && t < m_ntx * m_nty; t++) {
+        const Tile& tile = GetTile(t);
+        ok = std::fwrite(tile.data(), sizeof(Node), tile.size(), file) == tile.size();
+    }
+
+    ok = (std::fclose(file) == 0) && ok;
+    return ok;
+}
+
+bool RigidTerrain::MeshPatch::HeightCache::Load(const std::string& filename) {
+    std::FILE* file = std::fopen(filename.c_str(), "rb");
+    if (!file)
+        return false;
+
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t cells;
+    std::uint64_t signature;
+    double res;
+    bool ok = std::fread(magic, 1, 8, file) == 8 && std::memcmp(magic, height_cache_magic, 8) == 0;
+    ok = ok && std::fread(&version, sizeof(std::uint32_t), 1, file) == 1 && version == height_cache_version;
+    ok = ok && std::fread(&cells, sizeof(std::uint32_t), 1, file) == 1 && (int)cells == m_cells;
+    ok = ok && std::fread(&signature, sizeof(std::uint64_t), 1, file) == 1 && signature == m_signature;
+    ok = ok && std::fread(&res, sizeof(double), 1, file) == 1 && res == m_res;
+
+    std::vector<std::unique_ptr<Tile>> tiles(m_ntx * m_nty);
+    for (int t = 0; ok && t < m_ntx * m_nty; t++) {
+        tiles[t] = std::unique_ptr<Tile>(new Tile((m_cells + 1) * (m_cells + 1)));
+        ok = std::fread(tiles[t]->data(), sizeof(Node), tiles[t]->size(), file) == tiles[t]->size();
+    }
+    std::fclose(file);
+    if (!ok)
+        return false;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (int t = 0; t < m_ntx * m_nty; t++) {
+        m_tiles[t] = std::move(tiles[t]);
+        m_ptrs[t].store(m_tiles[t].get(), std::memory_order_release);
+    }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+
+RigidTerrain::MeshPatch::~MeshPatch() {}
+
+void RigidTerrain::MeshPatch::EnableHeightCache(double resolution, int tile_cells) {
+    m_cache = std::unique_ptr<HeightCache>(new HeightCache(*this, resolution, tile_cells));
+}
+
+bool RigidTerrain::MeshPatch::IsHeightCached(const ChVector3d& loc) const {
+    double height;
+    ChVector3d normal;
+    bool hit;
+    return m_cache && m_cache->Lookup(loc, height, normal, hit);
+}
+
+bool RigidTerrain::MeshPatch::SaveHeightCache(const std::string& filename) {
+    return m_cache && m_cache->Save(filename);
+}
+
+bool RigidTerrain::MeshPatch::LoadHeightCache(const std::string& filename) {
+    return m_cache && m_cache->Load(filename);
+}
+
 // -----------------------------------------------------------------------------
 // Functions for obtaining the terrain height, normal, and coefficient of
 // friction  at the specified location.
@@ -1075,6 +1416,77 @@ void RigidTerrain::GetProperties(const ChVector3d& loc, double& height, ChVector
         friction = (*m_friction_fun)(loc);
 }
 
+void RigidTerrain::GetProperties(const std::vector<ChVector3d>& locs,
+                                 std::vector<double>& heights,
+                                 std::vector<ChVector3d>& normals,
+                                 std::vector<float>& friction) const {
+    size_t n = locs.size();
+    heights.assign(n, 0.0);
+    normals.assign(n, ChWorldFrame::Vertical());
+    friction.assign(n, 0.8f);
+
+    if (!(m_height_fun && m_normal_fun && m_friction_fun)) {
+        // Keep, for each location, the highest point found over all patches
+        std::vector<char> hit(n, 0);
+        for (const auto& patch : m_patches) {
+            for (size_t i = 0; i < n; i++) {
+                double pheight;
+                ChVector3d pnormal;
+                bool phit = patch->FindPoint(locs[i], pheight, pnormal);
+                if (phit && (!hit[i] || pheight > heights[i])) {
+                    hit[i] = 1;
+                    heights[i] = pheight;
+                    normals[i] = pnormal;
+                    friction[i] = patch->m_friction;
+                }
+            }
+        }
+    }
+
+    if (m_height_fun) {
+        for (size_t i = 0; i < n; i++)
+            heights[i] = (*m_height_fun)(locs[i]);
+    }
+
+    if (m_normal_fun) {
+        for (size_t i = 0; i < n; i++)
+            normals[i] = (*m_normal_fun)(locs[i]);
+    }
+
+    if (m_friction_fun) {
+        for (size_t i = 0; i < n; i++)
+            friction[i] = (*m_friction_fun)(locs[i]);
+    }
+}
+
+void RigidTerrain::GetHeights(const std::vector<ChVector3d>& locs, std::vector<double>& heights) const {
+    size_t n = locs.size();
+
+    if (m_height_fun) {
+        heights.resize(n);
+        for (size_t i = 0; i < n; i++)
+            heights[i] = (*m_height_fun)(locs[i]);
+        return;
+    }
+
+    // Keep, for each location, the highest point found over all patches (zero height if no patch was hit)
+    const double no_hit = std::numeric_limits<double>::lowest();
+    heights.assign(n, no_hit);
+    for (const auto& patch : m_patches) {
+        for (size_t i = 0; i < n; i++) {
+            double pheight;
+            ChVector3d pnormal;
+            bool phit = patch->FindPoint(locs[i], pheight, pnormal);
+            if (phit && pheight > heights[i])
+                heights[i] = pheight;
+        }
+    }
+    for (size_t i = 0; i < n; i++) {
+        if (heights[i] == no_hit)
+            heights[i] = 0.0;
+    }
+}
+
 bool RigidTerrain::FindPoint(const ChVector3d loc, double& height, ChVector3d& normal, float& friction) const {
     bool hit = false;
     height = std::numeric_limits<double>::lowest();
@@ -1113,6 +1525,10 @@ bool RigidTerrain::BoxPatch::FindPoint(const ChVector3d& loc, double& height, Ch
 }
 
 bool RigidTerrain::MeshPatch::FindPoint(const ChVector3d& loc, double& height, ChVector3d& normal) const {
+    bool hit;
+    if (m_cache && m_cache->Lookup(loc, height, normal, hit))
+        return hit;
+
     ChVector3d from = loc;
     ChVector3d to = loc - (m_radius + 1000) * ChWorldFrame::Vertical();
 
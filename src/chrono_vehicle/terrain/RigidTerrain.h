@@ -19,6 +19,7 @@
 #ifndef RIGID_TERRAIN_H
 #define RIGID_TERRAIN_H
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -72,6 +73,29 @@ class CH_VEHICLE_API RigidTerrain : public ChTerrain {
 
         virtual void Initialize() = 0;
 
+        /// Enable a raster cache for height and normal queries on this patch (mesh patches only).
+        /// The patch surface is sampled on a regular grid with the given resolution in the horizontal plane of the
+        /// world frame. The grid is divided into square tiles of the given number of cells, each generated the first
+        /// time it is accessed. Queries are answered by bilinear interpolation of the cached heights and normals;
+        /// queries in cells with overhangs, steep steps or sharp creases, at the boundary of the mesh, or from below
+        /// the cached surface fall back to ray casting. Must be called after the patch was added; the patch must remain
+        /// fixed.
+        virtual void EnableHeightCache(double resolution, int tile_cells = 32) {}
+
+        /// Return true if a height or normal query at the given location is answered from the height cache.
+        /// Return false if the height cache is not enabled or if the query falls back to ray casting.
+        virtual bool IsHeightCached(const ChVector3d& loc) const { return false; }
+
+        /// Generate all tiles of the height cache and save them to a binary file.
+        /// Return false if the height cache is not enabled or the file cannot be written.
+        virtual bool SaveHeightCache(const std::string& filename) { return false; }
+
+        /// Load the height cache from a binary file created with SaveHeightCache.
+        /// Return false if the height cache is not enabled, if the file cannot be read, or if it was generated for a
+        /// different mesh, patch position, or grid. In that case, tiles are generated as needed. Must be called before
+        /// the terrain is queried.
+        virtual bool LoadHeightCache(const std::string& filename) { return false; }
+
       protected:
         Patch();
 
@@ -217,6 +241,19 @@ class CH_VEHICLE_API RigidTerrain : public ChTerrain {
                                ChVector3d& normal,
                                float& friction) const override;
 
+    /// Get all terrain characteristics at the points below the specified locations.
+    /// Each patch is queried for all locations in turn, and user-provided functors are applied afterwards. The results
+    /// are identical to calling the single-point GetProperties for each location.
+    virtual void GetProperties(const std::vector<ChVector3d>& locs,
+                               std::vector<double>& heights,
+                               std::vector<ChVector3d>& normals,
+                               std::vector<float>& friction) const override;
+
+    /// Get the terrain heights below the specified locations.
+    /// Each patch is queried for all locations in turn; if a height functor was provided, the patches are not queried.
+    /// The results are identical to calling GetHeight for each location.
+    virtual void GetHeights(const std::vector<ChVector3d>& locs, std::vector<double>& heights) const override;
+
     /// Export all patch meshes as macros in PovRay include files.
     void ExportMeshPovray(const std::string& out_dir, bool smoothed = false);
 
@@ -247,10 +284,17 @@ class CH_VEHICLE_API RigidTerrain : public ChTerrain {
 
     /// Patch represented as a mesh.
     struct CH_VEHICLE_API MeshPatch : public Patch {
+        class HeightCache;
         std::shared_ptr<ChTriangleMeshConnected> m_trimesh;  ///< associated mesh (contact and visualization)
         std::shared_ptr<ChTriangleMeshSoup> m_trimesh_s;     ///< associated contact mesh soup
         std::string m_mesh_name;                             ///< name of associated mesh
+        std::unique_ptr<HeightCache> m_cache;                ///< optional raster of the patch surface
+        ~MeshPatch();
         virtual void Initialize() override;
+        virtual void EnableHeightCache(double resolution, int tile_cells = 32) override;
+        virtual bool IsHeightCached(const ChVector3d& loc) const override;
+        virtual bool SaveHeightCache(const std::string& filename) override;
+        virtual bool LoadHeightCache(const std::string& filename) override;
         virtual bool FindPoint(const ChVector3d& loc, double& height, ChVector3d& normal) const override;
         virtual void ExportMeshPovray(const std::string& out_dir, bool smoothed = false) override;
         virtual void ExportMeshWavefront(const std::string& out_dir) override;
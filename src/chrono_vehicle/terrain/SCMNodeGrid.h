@@ -0,0 +1,255 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Storage for records attached to the nodes of the (unbounded) SCM grid.
+//
+// =============================================================================
+
+#ifndef SCM_NODE_GRID_H
+#define SCM_NODE_GRID_H
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+#include "chrono/core/ChVector2.h"
+
+namespace chrono {
+namespace vehicle {
+
+/// @addtogroup vehicle_terrain
+/// @{
+
+/// Storage type for the records of modified SCM grid nodes.
+enum class SCMGridStorage {
+    HASH_MAP,  ///< hash map keyed by grid coordinates (memory proportional to the number of records)
+    TILED      ///< sparse set of dense square tiles, allocated on first touch (array access within a tile)
+};
+
+/// Records attached to nodes of the SCM grid, indexed by integer grid coordinates.
+/// With TILED storage, the grid is partitioned in square tiles of 2^tile_bits x 2^tile_bits nodes. A tile is allocated
+/// the first time one of its nodes is recorded and tiles are located through a hash map keyed by tile coordinates, so
+/// that finding a record requires a single lookup per tile (memory proportional to the number of allocated tiles).
+/// With both storage types, references to records remain valid until the record is removed.
+template <typename T, int tile_bits = 6>
+class SCMNodeGrid {
+  public:
+    static const int tile_size = 1 << tile_bits;         ///< number of nodes along each tile side
+    static const int tile_nodes = tile_size * tile_size;  ///< number of nodes in a tile
+
+    SCMNodeGrid() : m_storage(SCMGridStorage::HASH_MAP), m_size(0) {}
+
+    /// Set the storage type. All existing records are removed.
+    void SetStorage(SCMGridStorage storage) {
+        Clear();
+        m_storage = storage;
+    }
+
+    /// Return the storage type.
+    SCMGridStorage GetStorage() const { return m_storage; }
+
+    /// Return the number of records.
+    size_t size() const { return m_storage == SCMGridStorage::HASH_MAP ? m_map.size() : m_size; }
+
+    /// Return a pointer to the record at the given grid node, or nullptr if the node is not recorded.
+    T* Find(const ChVector2i& ij) {
+        if (m_storage == SCMGridStorage::HASH_MAP) {
+            auto p = m_map.find(ij);
+            return p == m_map.end() ? nullptr : &p->second;
+        }
+        int it = GetTileIndex(TileCoord(ij.x()), TileCoord(ij.y()));
+        if (it < 0)
+            return nullptr;
+        Tile& tile = *m_tiles[it];
+        int lx = ij.x() - tile.coords.x() * tile_size;
+        int ly = ij.y() - tile.coords.y() * tile_size;
+        if (!(tile.mask[ly] & (std::uint64_t(1) << lx)))
+            return nullptr;
+        return &tile.records[ly * tile_size + lx];
+    }
+
+    /// Return a pointer to the record at the given grid node, or nullptr if the node is not recorded.
+    const T* Find(const ChVector2i& ij) const { return const_cast<SCMNodeGrid*>(this)->Find(ij); }
+
+    /// Return the record at the given grid node.
+    /// Throws std::out_of_range if the node is not recorded.
+    T& At(const ChVector2i& ij) {
+        T* rec = Find(ij);
+        if (!rec)
+            throw std::out_of_range("SCMNodeGrid::At: grid node not recorded");
+        return *rec;
+    }
+
+    /// Return the record at the given grid node.
+    /// Throws std::out_of_range if the node is not recorded.
+    const T& At(const ChVector2i& ij) const { return const_cast<SCMNodeGrid*>(this)->At(ij); }
+
+    /// Add a record at the given grid node, if not already present, and return the record at that node.
+    /// An existing record is not modified.
+    T& Insert(const ChVector2i& ij, const T& rec) {
+        if (m_storage == SCMGridStorage::HASH_MAP)
+            return m_map.insert(std::make_pair(ij, rec)).first->second;
+
+        Tile& tile = GetOrCreateTile(TileCoord(ij.x()), TileCoord(ij.y()));
+        int lx = ij.x() - tile.coords.x() * tile_size;
+        int ly = ij.y() - tile.coords.y() * tile_size;
+        T& tile_rec = tile.records[ly * tile_size + lx];
+        if (!(tile.mask[ly] & (std::uint64_t(1) << lx))) {
+            tile.mask[ly] |= (std::uint64_t(1) << lx);
+            tile_rec = rec;
+            tile.count++;
+            m_size++;
+        }
+        return tile_rec;
+    }
+
+    /// Return the record at the given grid node, inserting a default one if not present.
+    T& operator[](const ChVector2i& ij) { return Insert(ij, T()); }
+
+    /// Invoke the specified function f(ij, rec) for all records.
+    template <typename F>
+    void ForEach(F f) {
+        if (m_storage == SCMGridStorage::HASH_MAP) {
+            for (auto& p : m_map)
+                f(p.first, p.second);
+            return;
+        }
+        for (auto& tile : m_tiles) {
+            for (int ly = 0; ly < tile_size; ly++) {
+                std::uint64_t mask = tile->mask[ly];
+                for (int lx = 0; mask; lx++, mask >>= 1) {
+                    if (mask & 1) {
+                        ChVector2i ij(tile->coords.x() * tile_size + lx, tile->coords.y() * tile_size + ly);
+                        f(ij, tile->records[ly * tile_size + lx]);
+                    }
+                }
+            }
+        }
+    }
+
+    /// Invoke the specified function f(ij, rec) for all records.
+    template <typename F>
+    void ForEach(F f) const {
+        const_cast<SCMNodeGrid*>(this)->ForEach([&f](const ChVector2i& ij, const T& rec) { f(ij, rec); });
+    }
+
+    /// Remove all records and release all memory.
+    void Clear() {
+        m_map.clear();
+        m_tiles.clear();
+        m_dir.clear();
+        m_size = 0;
+    }
+
+    /// Remove all records.
+    /// With TILED storage, tiles which held records are kept for reuse and tiles that were empty are released.
+    void Reset() {
+        if (m_storage == SCMGridStorage::HASH_MAP) {
+            m_map.clear();
+            return;
+        }
+        // Only directory entries of released or moved tiles are updated
+        size_t num_kept = 0;
+        for (size_t it = 0; it < m_tiles.size(); it++) {
+            Tile& tile = *m_tiles[it];
+            if (tile.count == 0) {
+                m_dir.erase(tile.coords);
+                continue;
+            }
+            std::memset(tile.mask, 0, sizeof(tile.mask));
+            tile.count = 0;
+            if (num_kept != it) {
+                m_dir[tile.coords] = (int)num_kept;
+                m_tiles[num_kept] = std::move(m_tiles[it]);
+            }
+            num_kept++;
+        }
+        m_tiles.resize(num_kept);
+        m_size = 0;
+    }
+
+    /// Return the number of allocated tiles (TILED storage only).
+    size_t GetNumTiles() const { return m_tiles.size(); }
+
+    /// Return the memory size of a tile (in bytes).
+    static size_t GetTileMemorySize() { return sizeof(Tile); }
+
+    /// Return an estimate of the memory used by this grid (in bytes).
+    size_t GetMemorySize() const {
+        if (m_storage == SCMGridStorage::HASH_MAP) {
+            return m_map.size() * (sizeof(typename std::unordered_map<ChVector2i, T, CoordHash>::value_type) +
+                                   2 * sizeof(void*)) +
+                   m_map.bucket_count() * sizeof(void*);
+        }
+        return m_tiles.size() * (sizeof(Tile) + sizeof(std::unique_ptr<Tile>)) +
+               m_dir.size() * (sizeof(typename std::unordered_map<ChVector2i, int, CoordHash>::value_type) +
+                               2 * sizeof(void*)) +
+               m_dir.bucket_count() * sizeof(void*);
+    }
+
+  private:
+    struct CoordHash {
+        std::size_t operator()(const ChVector2i& p) const { return p.x() * 31 + p.y(); }
+    };
+
+    struct Tile {
+        ChVector2i coords;                // tile coordinates
+        int count;                        // number of records in this tile
+        std::uint64_t mask[tile_size];    // record flags, one word per tile row
+        T records[tile_nodes];            // node records (row-major)
+    };
+
+    static_assert(tile_bits <= 6, "SCMNodeGrid: a tile row must fit in a 64-bit mask");
+
+    // Tile coordinate for the given node coordinate (rounded towards negative infinity).
+    static int TileCoord(int i) { return i >= 0 ? i / tile_size : -((-i - 1) / tile_size) - 1; }
+
+    // Index in m_tiles of the tile with given coordinates, or -1 if not allocated.
+    int GetTileIndex(int tx, int ty) const {
+        auto p = m_dir.find(ChVector2i(tx, ty));
+        return p == m_dir.end() ? -1 : p->second;
+    }
+
+    Tile& GetOrCreateTile(int tx, int ty) {
+        auto p = m_dir.insert(std::make_pair(ChVector2i(tx, ty), (int)m_tiles.size()));
+        if (!p.second)
+            return *m_tiles[p.first->second];
+
+        auto tile = std::unique_ptr<Tile>(new Tile);
+        tile->coords = ChVector2i(tx, ty);
+        tile->count = 0;
+        std::memset(tile->mask, 0, sizeof(tile->mask));
+        m_tiles.push_back(std::move(tile));
+        return *m_tiles.back();
+    }
+
+    SCMGridStorage m_storage;
+
+    // HASH_MAP storage
+    std::unordered_map<ChVector2i, T, CoordHash> m_map;
+
+    // TILED storage
+    std::vector<std::unique_ptr<Tile>> m_tiles;            // allocated tiles
+    std::unordered_map<ChVector2i, int, CoordHash> m_dir;  // tile directory (tile coordinates to index in m_tiles)
+    size_t m_size;                                         // number of records
+};
+
+/// @} vehicle_terrain
+
+}  // end namespace vehicle
+}  // end namespace chrono
+
+#endif
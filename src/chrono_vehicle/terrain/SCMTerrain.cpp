@@ -33,6 +33,7 @@
 #include "chrono/assets/ChTexture.h"
 #include "chrono/assets/ChVisualShapeBox.h"
 #include "chrono/utils/ChConvexHull.h"
+#include "chrono/utils/ChProfiler.h"
 #include "chrono/utils/ChUtils.h"
 
 #include "chrono_vehicle/ChVehicleModelData.h"
@@ -83,6 +84,20 @@ float SCMTerrain::GetCoefficientFriction(const ChVector3d& loc) const {
     return m_friction_fun ? (*m_friction_fun)(loc) : 0.8f;
 }
 
+// Return the terrain height, normal, and coefficient of friction at the specified locations.
+void SCMTerrain::GetProperties(const std::vector<ChVector3d>& locs,
+                               std::vector<double>& heights,
+                               std::vector<ChVector3d>& normals,
+                               std::vector<float>& friction) const {
+    heights.resize(locs.size());
+    normals.resize(locs.size());
+    friction.resize(locs.size());
+    for (size_t i = 0; i < locs.size(); i++) {
+        m_loader->GetHeightNormal(locs[i], heights[i], normals[i]);
+        friction[i] = m_friction_fun ? (*m_friction_fun)(locs[i]) : 0.8f;
+    }
+}
+
 // Get SCM information at the node closest to the specified location.
 SCMTerrain::NodeInfo SCMTerrain::GetNodeInfo(const ChVector3d& loc) const {
     return m_loader->GetNodeInfo(loc);
@@ -187,6 +202,17 @@ double SCMTerrain::GetTestHeight() const {
     return m_loader->m_test_offset_up;
 }
 
+// Set the storage type for modified grid nodes.
+void SCMTerrain::SetGridStorage(SCMGridStorage storage) {
+    m_loader->m_grid_map.SetStorage(storage);
+    m_loader->m_hits.SetStorage(storage);
+}
+
+// Return the storage type for modified grid nodes.
+SCMGridStorage SCMTerrain::GetGridStorage() const {
+    return m_loader->m_grid_map.GetStorage();
+}
+
 // Set the color plot type.
 void SCMTerrain::SetPlotType(DataPlotType plot_type, double min_val, double max_val) {
     m_loader->m_plot_type = plot_type;
@@ -293,6 +319,21 @@ int SCMTerrain::GetNumErosionNodes() const {
     return m_loader->m_num_erosion_nodes;
 }
 
+// Return the number of modified grid nodes.
+int SCMTerrain::GetNumGridNodes() const {
+    return (int)m_loader->m_grid_map.size();
+}
+
+// Return the number of allocated grid tiles.
+int SCMTerrain::GetNumGridTiles() const {
+    return (int)(m_loader->m_grid_map.GetNumTiles() + m_loader->m_hits.GetNumTiles());
+}
+
+// Return an estimate of the memory used for grid node and ray hit records.
+size_t SCMTerrain::GetGridMemorySize() const {
+    return m_loader->m_grid_map.GetMemorySize() + m_loader->m_hits.GetMemorySize();
+}
+
 // Timer information
 double SCMTerrain::GetTimerMovingPatches() const {
     return 1e3 * m_loader->m_timer_moving_patches();
@@ -339,6 +380,13 @@ void SCMTerrain::PrintStepStatistics(std::ostream& os) const {
     os << "   Number ray hits:         " << m_loader->m_num_ray_hits << std::endl;
     os << "   Number contact patches:  " << m_loader->m_num_contact_patches << std::endl;
     os << "   Number erosion nodes:    " << m_loader->m_num_erosion_nodes << std::endl;
+
+    bool tiled = m_loader->m_grid_map.GetStorage() == SCMGridStorage::TILED;
+    os << " Grid storage:              " << (tiled ? "TILED" : "HASH_MAP") << std::endl;
+    os << "   Number grid nodes:       " << GetNumGridNodes() << std::endl;
+    if (tiled)
+        os << "   Number grid tiles:       " << GetNumGridTiles() << std::endl;
+    os << "   Memory (kB):             " << GetGridMemorySize() / 1024 << std::endl;
 }
 
 // -----------------------------------------------------------------------------
@@ -720,16 +768,15 @@ SCMTerrain::NodeInfo SCMLoader::GetNodeInfo(const ChVector3d& loc) const {
     int j = static_cast<int>(std::round(loc_loc.y() / m_delta));
     ChVector2i ij(i, j);
 
-    // First query the hash-map
-    auto p = m_grid_map.find(ij);
-    if (p != m_grid_map.end()) {
-        ni.sinkage = p->second.sinkage;
-        ni.sinkage_plastic = p->second.sinkage_plastic;
-        ni.sinkage_elastic = p->second.sinkage_elastic;
-        ni.sigma = p->second.sigma;
-        ni.sigma_yield = p->second.sigma_yield;
-        ni.kshear = p->second.kshear;
-        ni.tau = p->second.tau;
+    // First query the grid map
+    if (const auto* nr = m_grid_map.Find(ij)) {
+        ni.sinkage = nr->sinkage;
+        ni.sinkage_plastic = nr->sinkage_plastic;
+        ni.sinkage_elastic = nr->sinkage_elastic;
+        ni.sigma = nr->sigma;
+        ni.sigma_yield = nr->sigma_yield;
+        ni.kshear = nr->kshear;
+        ni.tau = nr->tau;
         return ni;
     }
 
@@ -813,10 +860,9 @@ ChVector3d SCMLoader::GetInitNormal(const ChVector2i& loc) const {
 
 // Get the terrain height (relative to the SCM plane) at the specified grid vertex.
 double SCMLoader::GetHeight(const ChVector2i& loc) const {
-    // First query the hash-map
-    auto p = m_grid_map.find(loc);
-    if (p != m_grid_map.end())
-        return p->second.level;
+    // First query the grid map
+    if (const auto* nr = m_grid_map.Find(loc))
+        return nr->level;
 
     // Else return undeformed height
     return GetInitHeight(loc);
@@ -900,6 +946,22 @@ ChVector3d SCMLoader::GetNormal(const ChVector3d& loc) const {
     return ChWorldFrame::FromISO(nrm_abs);
 }
 
+// Get the terrain height and normal at the point below the specified location.
+void SCMLoader::GetHeightNormal(const ChVector3d& loc, double& height, ChVector3d& normal) const {
+    // Express location in the SCM frame
+    ChVector3d loc_loc = m_plane.TransformPointParentToLocal(loc);
+
+    // Get height and normal (relative to SCM plane) at closest grid vertex (approximation)
+    int i = static_cast<int>(std::round(loc_loc.x() / m_delta));
+    int j = static_cast<int>(std::round(loc_loc.y() / m_delta));
+    loc_loc.z() = GetHeight(ChVector2i(i, j));
+    auto nrm_loc = GetNormal(ChVector2i(i, j));
+
+    // Express in global frame
+    height = ChWorldFrame::Height(m_plane.TransformPointLocalToParent(loc_loc));
+    normal = ChWorldFrame::FromISO(m_plane.TransformDirectionLocalToParent(nrm_loc));
+}
+
 // Synchronize information for a moving patch
 void SCMLoader::UpdateMovingPatch(MovingPatchInfo& p, const ChVector3d& Z) {
     ChVector2d p_min(+std::numeric_limits<double>::max());
@@ -1037,6 +1099,8 @@ static const std::vector<ChVector2i> neighbors4{
 
 // Reset the list of forces, and fills it with forces from a soil contact model.
 void SCMLoader::ComputeInternalForces() {
+    CH_PROFILE_ZONE("SCMLoader::ComputeInternalForces");
+
     // Initialize list of modified visualization mesh vertices (use any externally modified vertices)
     std::vector<int> modified_vertices = m_external_modified_vertices;
     m_external_modified_vertices.clear();
@@ -1044,7 +1108,7 @@ void SCMLoader::ComputeInternalForces() {
     // Reset quantities at grid nodes modified over previous step
     // (required for bulldozing effects and for proper visualization coloring)
     for (const auto& ij : m_modified_nodes) {
-        auto& nr = m_grid_map.at(ij);
+        auto& nr = m_grid_map.At(ij);
         nr.sigma = 0;
         nr.sinkage_elastic = 0;
         nr.step_plastic_flow = 0;
@@ -1099,15 +1163,8 @@ void SCMLoader::ComputeInternalForces() {
     // Perform ray casting tests
     // -------------------------
 
-    // Information of vertices with ray-cast hits
-    struct HitRecord {
-        ChContactable* contactable;  // pointer to hit object
-        ChVector3d abs_point;        // hit point, expressed in global frame
-        int patch_id;                // index of associated patch id
-    };
-
-    // Hash-map for vertices with ray-cast hits
-    std::unordered_map<ChVector2i, HitRecord, CoordHash> hits;
+    // Clear the vertices with ray-cast hits at previous step
+    m_hits.Reset();
 
     m_num_ray_casts = 0;
     m_num_ray_hits = 0;
@@ -1116,7 +1173,8 @@ void SCMLoader::ComputeInternalForces() {
 
 #ifdef RAY_CASTING_WITH_CRITICAL_SECTION
 
-    int nthreads = GetSystem()->GetNumThreadsChrono();
+    // Hits are recorded in the order they are found; in deterministic mode, cast rays sequentially
+    int nthreads = GetSystem()->IsDeterministic() ? 1 : GetSystem()->GetNumThreadsChrono();
 
     // Loop through all moving patches (user-defined or default one)
     for (auto& p : m_patches) {
@@ -1152,13 +1210,13 @@ void SCMLoader::ComputeInternalForces() {
     #pragma omp critical(SCM_ray_casting)
                 {
                     // If this is the first hit from this node, initialize the node record
-                    if (m_grid_map.find(ij) == m_grid_map.end()) {
-                        m_grid_map.insert(std::make_pair(ij, NodeRecord(z, z, GetInitNormal(ij))));
+                    if (!m_grid_map.Find(ij)) {
+                        m_grid_map.Insert(ij, NodeRecord(z, z, GetInitNormal(ij)));
                     }
 
                     // Add to our map of hits to process
                     HitRecord record = {mrayhit_result.hitModel->GetContactable(), mrayhit_result.abs_hitPoint, -1};
-                    hits.insert(std::make_pair(ij, record));
+                    m_hits.Insert(ij, record);
                     m_num_ray_hits++;
                 }
             }
@@ -1168,20 +1226,20 @@ void SCMLoader::ComputeInternalForces() {
 
 #else
 
-    // Map-reduce approach (to eliminate critical section)
+    // Batched ray casting (rays are generated in parallel and tested in a single batch per patch)
 
     const int nthreads = GetSystem()->GetNumThreadsChrono();
-    std::vector<std::unordered_map<ChVector2i, HitRecord, CoordHash>> t_hits(nthreads);
 
     // Loop through all moving patches (user-defined or default one)
     for (auto& p : m_patches) {
         m_timer_ray_testing.start();
 
-        // Loop through all vertices in the patch range
-        int num_ray_casts = 0;
-    #pragma omp parallel for num_threads(nthreads) reduction(+ : num_ray_casts)
-        for (int k = 0; k < p.m_range.size(); k++) {
-            int t_num = ChOMP::GetThreadNum();
+        // Create rays at all vertices in the patch range
+        int num_vertices = (int)p.m_range.size();
+        std::vector<ChCollisionSystem::ChRay> p_rays(num_vertices);
+        std::vector<char> p_cast(num_vertices);
+    #pragma omp parallel for num_threads(nthreads)
+        for (int k = 0; k < num_vertices; k++) {
             ChVector2i ij = p.m_range[k];
 
             // Move from (i, j) to (x, y, z) representation in the world frame
@@ -1192,44 +1250,49 @@ void SCMLoader::ComputeInternalForces() {
             ChVector3d vertex_abs = m_plane.TransformPointLocalToParent(ChVector3d(x, y, z));
 
             // Create ray at current grid location
-            ChCollisionSystem::ChRayhitResult mrayhit_result;
-            ChVector3d to = vertex_abs + m_Z * m_test_offset_up;
-            ChVector3d from = to - m_Z * m_test_offset_down;
+            p_rays[k].to = vertex_abs + m_Z * m_test_offset_up;
+            p_rays[k].from = p_rays[k].to - m_Z * m_test_offset_down;
 
             // Ray-OBB test (quick rejection)
-            if (m_moving_patch && !RayOBBtest(p, from, m_Z))
-                continue;
-
-            // Cast ray into collision system
-            GetSystem()->GetCollisionSystem()->RayHit(from, to, mrayhit_result);
-            num_ray_casts++;
+            p_cast[k] = !m_moving_patch || RayOBBtest(p, p_rays[k].from, m_Z);
+        }
 
-            if (mrayhit_result.hit) {
-                // Add to our map of hits to process
-                HitRecord record = {mrayhit_result.hitModel->GetContactable(), mrayhit_result.abs_hitPoint, -1};
-                t_hits[t_num].insert(std::make_pair(ij, record));
+        // Collect the rays that must be cast into the collision system
+        std::vector<ChCollisionSystem::ChRay> rays;
+        std::vector<ChVector2i> ray_nodes;
+        rays.reserve(num_vertices);
+        ray_nodes.reserve(num_vertices);
+        for (int k = 0; k < num_vertices; k++) {
+            if (p_cast[k]) {
+                rays.push_back(p_rays[k]);
+                ray_nodes.push_back(p.m_range[k]);
             }
         }
 
+        // Cast all rays into collision system
+        std::vector<ChCollisionSystem::ChRayhitResult> results;
+        GetSystem()->GetCollisionSystem()->RayHitBatch(rays, results, nthreads);
+
         m_timer_ray_testing.stop();
 
-        m_num_ray_casts += num_ray_casts;
+        m_num_ray_casts += (int)rays.size();
 
-        // Sequential insertion in global hits
-        for (int t_num = 0; t_num < nthreads; t_num++) {
-            for (auto& h : t_hits[t_num]) {
-                // If this is the first hit from this node, initialize the node record
-                if (m_grid_map.find(h.first) == m_grid_map.end()) {
-                    double z = GetInitHeight(h.first);
-                    m_grid_map.insert(std::make_pair(h.first, NodeRecord(z, z, GetInitNormal(h.first))));
-                }
-                ////hits.insert(h);
+        for (size_t k = 0; k < rays.size(); k++) {
+            if (!results[k].hit)
+                continue;
+
+            // If this is the first hit from this node, initialize the node record
+            const ChVector2i& ij = ray_nodes[k];
+            if (!m_grid_map.Find(ij)) {
+                double z = GetInitHeight(ij);
+                m_grid_map.Insert(ij, NodeRecord(z, z, GetInitNormal(ij)));
             }
 
-            hits.insert(t_hits[t_num].begin(), t_hits[t_num].end());
-            t_hits[t_num].clear();
+            // Add to our map of hits to process
+            HitRecord record = {results[k].hitModel->GetContactable(), results[k].abs_hitPoint, -1};
+            m_hits.Insert(ij, record);
         }
-        m_num_ray_hits = (int)hits.size();
+        m_num_ray_hits = (int)m_hits.size();
     }
 
 #endif
@@ -1255,14 +1318,12 @@ void SCMLoader::ComputeInternalForces() {
     // Loop through all hit nodes and determine to which contact patch they belong.
     // Use a queue-based flood-filling algorithm based on the neighbors of each hit node.
     m_num_contact_patches = 0;
-    for (auto& h : hits) {
-        if (h.second.patch_id != -1)
-            continue;
-
-        ChVector2i ij = h.first;
+    m_hits.ForEach([&](const ChVector2i& ij, HitRecord& h) {
+        if (h.patch_id != -1)
+            return;
 
         // Make a new contact patch and add this hit node to it
-        h.second.patch_id = m_num_contact_patches++;
+        h.patch_id = m_num_contact_patches++;
         ContactPatchRecord patch;
         patch.nodes.push_back(ij);
         patch.points.push_back(ChVector2d(m_delta * ij.x(), m_delta * ij.y()));
@@ -1272,24 +1333,22 @@ void SCMLoader::ComputeInternalForces() {
         todo.push(ij);
 
         while (!todo.empty()) {
-            auto crt = hits.find(todo.front());  // Current hit node is first element in queue
-            todo.pop();                          // Remove first element from queue
-
-            ChVector2i crt_ij = crt->first;
-            int crt_patch = crt->second.patch_id;
+            ChVector2i crt_ij = todo.front();             // Current hit node is first element in queue
+            todo.pop();                                   // Remove first element from queue
+            int crt_patch = m_hits.At(crt_ij).patch_id;  // Contact patch of current hit node
 
             // Loop through the neighbors of the current hit node
             for (int k = 0; k < 4; k++) {
                 ChVector2i nbr_ij = crt_ij + neighbors4[k];
                 // If neighbor is not a hit node, move on
-                auto nbr = hits.find(nbr_ij);
-                if (nbr == hits.end())
+                auto nbr = m_hits.Find(nbr_ij);
+                if (!nbr)
                     continue;
                 // If neighbor already assigned to a contact patch, move on
-                if (nbr->second.patch_id != -1)
+                if (nbr->patch_id != -1)
                     continue;
                 // Assign neighbor to the same contact patch
-                nbr->second.patch_id = crt_patch;
+                nbr->patch_id = crt_patch;
                 // Add neighbor point to patch lists
                 patch.nodes.push_back(nbr_ij);
                 patch.points.push_back(ChVector2d(m_delta * nbr_ij.x(), m_delta * nbr_ij.y()));
@@ -1298,7 +1357,7 @@ void SCMLoader::ComputeInternalForces() {
             }
         }
         contact_patches.push_back(patch);
-    }
+    });
 
     // Calculate area and perimeter of each contact patch.
     // Calculate approximation to Beker term 1/b.
@@ -1332,15 +1391,13 @@ void SCMLoader::ComputeInternalForces() {
     double damping_R = m_damping_R;
 
     // Process only hit nodes
-    for (auto& h : hits) {
-        ChVector2d ij = h.first;
-
-        auto& nr = m_grid_map.at(ij);      // node record
+    m_hits.ForEach([&](const ChVector2i& ij, const HitRecord& h) {
+        auto& nr = m_grid_map.At(ij);      // node record
         const double& ca = nr.normal.z();  // cosine of angle between local normal and SCM plane vertical
 
-        ChContactable* contactable = h.second.contactable;
-        const ChVector3d& hit_point_abs = h.second.abs_point;
-        int patch_id = h.second.patch_id;
+        ChContactable* contactable = h.contactable;
+        const ChVector3d& hit_point_abs = h.abs_point;
+        int patch_id = h.patch_id;
 
         auto hit_point_loc = m_plane.TransformPointParentToLocal(hit_point_abs);
 
@@ -1360,7 +1417,7 @@ void SCMLoader::ComputeInternalForces() {
         // Handle unilaterality
         if (nr.sigma < 0) {
             nr.sigma = 0;
-            continue;
+            return;
         }
 
         // Mark current node as modified
@@ -1480,7 +1537,7 @@ void SCMLoader::ComputeInternalForces() {
         // Update grid node height (in local SCM frame, along SCM z axis)
         nr.level = nr.level_initial - nr.sinkage / ca;
 
-    }  // end loop on ray hits
+    });  // end loop on ray hits
 
     // Create loads for bodies and nodes to apply the accumulated terrain force/torque for each of them
     if (!m_cosim_mode) {
@@ -1526,7 +1583,7 @@ void SCMLoader::ComputeInternalForces() {
             // Calculate the displaced material from all touched nodes and identify boundary
             double tot_step_flow = 0;
             for (const auto& ij : p.nodes) {                 // for each node in contact patch
-                const auto& nr = m_grid_map.at(ij);          //   get node record
+                const auto& nr = m_grid_map.At(ij);          //   get node record
                 if (nr.sigma <= 0)                           //   if node not touched
                     continue;                                //     skip (not in effective patch)
                 tot_step_flow += nr.step_plastic_flow;       //   accumulate displaced material
@@ -1534,9 +1591,10 @@ void SCMLoader::ComputeInternalForces() {
                     ChVector2i nbr_ij = ij + neighbors4[k];  //     neighbor node coordinates
                     ////if (!CheckMeshBounds(nbr_ij))                     //     if neighbor out of bounds
                     ////    continue;                                     //       skip neighbor
-                    if (m_grid_map.find(nbr_ij) == m_grid_map.end())  //     if neighbor not yet recorded
+                    auto nbr_nr = m_grid_map.Find(nbr_ij);            //     neighbor record
+                    if (!nbr_nr)                                      //     if neighbor not yet recorded
                         p_boundary.insert(nbr_ij);                    //       set neighbor as boundary
-                    else if (m_grid_map.at(nbr_ij).sigma <= 0)        //     if neighbor not touched
+                    else if (nbr_nr->sigma <= 0)                      //     if neighbor not touched
                         p_boundary.insert(nbr_ij);                    //       set neighbor as boundary
                 }
             }
@@ -1548,13 +1606,13 @@ void SCMLoader::ComputeInternalForces() {
             // Raise boundary (create a sharp spike which will be later smoothed out with erosion)
             for (const auto& ij : p_boundary) {                                  // for each node in bndry
                 m_modified_nodes.push_back(ij);                                  //   mark as modified
-                if (m_grid_map.find(ij) == m_grid_map.end()) {                   //   if not yet recorded
+                if (!m_grid_map.Find(ij)) {                                      //   if not yet recorded
                     double z = GetInitHeight(ij);                                //     undeformed height
                     const ChVector3d& n = GetInitNormal(ij);                     //     terrain normal
-                    m_grid_map.insert(std::make_pair(ij, NodeRecord(z, z, n)));  //     add new node record
+                    m_grid_map.Insert(ij, NodeRecord(z, z, n));                  //     add new node record
                     m_modified_nodes.push_back(ij);                              //     mark as modified
                 }                                                                //
-                auto& nr = m_grid_map.at(ij);                                    //   node record
+                auto& nr = m_grid_map.At(ij);                                    //   node record
                 nr.erosion = true;                                               //   add to erosion domain
                 AddMaterialToNode(diff, nr);                                     //   add raise amount
             }
@@ -1578,16 +1636,16 @@ void SCMLoader::ComputeInternalForces() {
                     ChVector2i nbr_ij = ij + neighbors4[k];  //   neighbor node coordinates
                     ////if (!CheckMeshBounds(nbr_ij))                       //   if out of bounds
                     ////    continue;                                       //     ignore neighbor
-                    if (m_grid_map.find(nbr_ij) == m_grid_map.end()) {  //   if neighbor not yet recorded
+                    if (!m_grid_map.Find(nbr_ij)) {                     //   if neighbor not yet recorded
                         double z = GetInitHeight(nbr_ij);               //     undeformed height at neighbor location
                         const ChVector3d& n = GetInitNormal(nbr_ij);    //     terrain normal at neighbor location
                         NodeRecord nr(z, z, n);                         //     create new record
                         nr.erosion = true;                              //     include in erosion domain
-                        m_grid_map.insert(std::make_pair(nbr_ij, nr));  //     add new node record
+                        m_grid_map.Insert(nbr_ij, nr);                  //     add new node record
                         front.insert(nbr_ij);                           //     add neighbor to new front
                         m_modified_nodes.push_back(nbr_ij);             //     mark as modified
                     } else {                                            //   if neighbor previously recorded
-                        NodeRecord& nr = m_grid_map.at(nbr_ij);         //     get existing record
+                        NodeRecord& nr = m_grid_map.At(nbr_ij);         //     get existing record
                         if (!nr.erosion && nr.sigma <= 0) {             //     if neighbor not touched
                             nr.erosion = true;                          //       include in erosion domain
                             front.insert(nbr_ij);                       //       add neighbor to new front
@@ -1608,13 +1666,13 @@ void SCMLoader::ComputeInternalForces() {
 
         for (int iter = 0; iter < m_erosion_iterations; iter++) {
             for (const auto& ij : erosion_domain) {
-                auto& nr = m_grid_map.at(ij);
+                auto& nr = m_grid_map.At(ij);
                 for (int k = 0; k < 4; k++) {
                     ChVector2i nbr_ij = ij + neighbors4[k];
-                    auto rec = m_grid_map.find(nbr_ij);
-                    if (rec == m_grid_map.end())
+                    auto rec = m_grid_map.Find(nbr_ij);
+                    if (!rec)
                         continue;
-                    auto& nbr_nr = rec->second;
+                    auto& nbr_nr = *rec;
 
                     // (3.1) Flow remaining material to neighbor
                     double diff = 0.5 * (nr.massremainder - nbr_nr.massremainder) / 4;  //// TODO: rethink this!
@@ -1659,7 +1717,7 @@ void SCMLoader::ComputeInternalForces() {
         for (const auto& ij : m_modified_nodes) {
             if (!CheckMeshBounds(ij))                 // if node outside mesh
                 continue;                             //   do nothing
-            const auto& nr = m_grid_map.at(ij);       // grid node record
+            const auto& nr = m_grid_map.At(ij);       // grid node record
             int iv = GetMeshVertexIndex(ij);          // mesh vertex index
             UpdateMeshVertexCoordinates(ij, iv, nr);  // update vertex coordinates and color
             modified_vertices.push_back(iv);          // cache in list of modified mesh vertices
@@ -1782,14 +1840,12 @@ void SCMLoader::UpdateMeshVertexNormal(const ChVector2i ij, int iv) {
 std::vector<SCMTerrain::NodeLevel> SCMLoader::GetModifiedNodes(bool all_nodes) const {
     std::vector<SCMTerrain::NodeLevel> nodes;
     if (all_nodes) {
-        for (const auto& nr : m_grid_map) {
-            nodes.push_back(std::make_pair(nr.first, nr.second.level));
-        }
+        m_grid_map.ForEach(
+            [&nodes](const ChVector2i& ij, const NodeRecord& nr) { nodes.push_back(std::make_pair(ij, nr.level)); });
     } else {
         for (const auto& ij : m_modified_nodes) {
-            auto rec = m_grid_map.find(ij);
-            assert(rec != m_grid_map.end());
-            nodes.push_back(std::make_pair(ij, rec->second.level));
+            const auto& nr = m_grid_map.At(ij);
+            nodes.push_back(std::make_pair(ij, nr.level));
         }
     }
     return nodes;
@@ -1810,7 +1866,7 @@ void SCMLoader::SetModifiedNodes(const std::vector<SCMTerrain::NodeLevel>& nodes
             auto ij = n.first;                           // grid location
             if (!CheckMeshBounds(ij))                    // if outside mesh
                 continue;                                //   do nothing
-            const auto& nr = m_grid_map.at(ij);          // grid node record
+            const auto& nr = m_grid_map.At(ij);          // grid node record
             int iv = GetMeshVertexIndex(ij);             // mesh vertex index
             UpdateMeshVertexCoordinates(ij, iv, nr);     // update vertex coordinates and color
             if (!m_trimesh_shape->IsWireframe())         // if not in wireframe mode
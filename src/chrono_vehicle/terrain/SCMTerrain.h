@@ -37,6 +37,7 @@
 #include "chrono_vehicle/ChSubsysDefs.h"
 #include "chrono_vehicle/ChTerrain.h"
 #include "chrono_vehicle/ChWorldFrame.h"
+#include "chrono_vehicle/terrain/SCMNodeGrid.h"
 
 namespace chrono {
 namespace vehicle {
@@ -125,6 +126,15 @@ class CH_VEHICLE_API SCMTerrain : public ChTerrain {
         int erosion_propagations = 10  ///< number of concentric vertex selections subject to erosion
     );
 
+    /// Set the storage type for the records of modified grid nodes (default: SCMGridStorage::HASH_MAP).
+    /// With SCMGridStorage::TILED, node records are stored in dense square tiles allocated on first touch, which
+    /// provides faster access at the cost of a larger memory footprint for sparsely modified terrains.
+    /// This function must be called before Initialize.
+    void SetGridStorage(SCMGridStorage storage);
+
+    /// Return the storage type for the records of modified grid nodes.
+    SCMGridStorage GetGridStorage() const;
+
     /// Set the vertical level up to which collision is tested (relative to the reference level at the sample point).
     /// Since the contact is unilateral, this could be zero. However, when computing bulldozing flow, one might also
     /// need to know if in the surrounding there is some potential future contact: so it might be better to use a
@@ -204,6 +214,15 @@ class CH_VEHICLE_API SCMTerrain : public ChTerrain {
     /// Otherwise, it returns the constant value of 0.8.
     virtual float GetCoefficientFriction(const ChVector3d& loc) const override;
 
+    using ChTerrain::GetProperties;
+
+    /// Get all terrain characteristics at the points below the specified locations.
+    /// The location of each query point in the SCM grid is calculated only once for both height and normal.
+    virtual void GetProperties(const std::vector<ChVector3d>& locs,
+                               std::vector<double>& heights,
+                               std::vector<ChVector3d>& normals,
+                               std::vector<float>& friction) const override;
+
     /// Get SCM information at the node closest to the specified location.
     NodeInfo GetNodeInfo(const ChVector3d& loc) const;
 
@@ -296,6 +315,12 @@ class CH_VEHICLE_API SCMTerrain : public ChTerrain {
     int GetNumContactPatches() const;
     /// Return the number of nodes in the erosion domain at last step (bulldosing effects).
     int GetNumErosionNodes() const;
+    /// Return the number of modified grid nodes.
+    int GetNumGridNodes() const;
+    /// Return the number of allocated tiles for node and ray hit records (SCMGridStorage::TILED only).
+    int GetNumGridTiles() const;
+    /// Return an estimate of the memory used for storing modified grid nodes and ray hits (in bytes).
+    size_t GetGridMemorySize() const;
 
     /// Return time for updating moving patches at last step (ms).
     double GetTimerMovingPatches() const;
@@ -430,6 +455,13 @@ class CH_VEHICLE_API SCMLoader : public ChLoadContainer {
               step_plastic_flow(0) {}
     };
 
+    // Information of vertices with ray-cast hits
+    struct HitRecord {
+        ChContactable* contactable;  // pointer to hit object
+        ChVector3d abs_point;        // hit point, expressed in global frame
+        int patch_id;                // index of associated patch id
+    };
+
     // Hash function for a pair of integer grid coordinates
     struct CoordHash {
       public:
@@ -464,6 +496,9 @@ class CH_VEHICLE_API SCMLoader : public ChLoadContainer {
     // Get the terrain normal (expressed in World frame) at the point below the specified location.
     ChVector3d GetNormal(const ChVector3d& loc) const;
 
+    // Get the terrain height and normal (expressed in World frame) at the point below the specified location.
+    void GetHeightNormal(const ChVector3d& loc, double& height, ChVector3d& normal) const;
+
     // Get index of trimesh vertex corresponding to the specified grid node.
     int GetMeshVertexIndex(const ChVector2i& loc);
 
@@ -546,8 +581,9 @@ class CH_VEHICLE_API SCMLoader : public ChLoadContainer {
     ChMatrixDynamic<> m_heights;  ///< (base) grid heights (when initializing from height-field map)
     double m_base_height;         ///< default height for vertices outside the projection of input mesh
 
-    std::unordered_map<ChVector2i, NodeRecord, CoordHash> m_grid_map;  ///< modified grid nodes (persistent)
-    std::vector<ChVector2i> m_modified_nodes;                          ///< modified grid nodes (current)
+    SCMNodeGrid<NodeRecord> m_grid_map;        ///< modified grid nodes (persistent)
+    SCMNodeGrid<HitRecord> m_hits;             ///< grid nodes with ray-cast hits (current)
+    std::vector<ChVector2i> m_modified_nodes;  ///< modified grid nodes (current)
 
     std::vector<MovingPatchInfo> m_patches;  ///< set of active moving patches
     bool m_moving_patch;                     ///< user-specified moving patches?
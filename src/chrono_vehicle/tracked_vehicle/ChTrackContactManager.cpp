@@ -16,11 +16,19 @@
 //
 // =============================================================================
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "chrono/collision/ChCollisionShapeBox.h"
+#include "chrono/collision/ChCollisionShapeCylinder.h"
 #include "chrono/physics/ChLoadsBody.h"
+#include "chrono/utils/ChUtils.h"
 
 #include "chrono_vehicle/tracked_vehicle/ChTrackContactManager.h"
 #include "chrono_vehicle/tracked_vehicle/ChTrackedVehicle.h"
 #include "chrono_vehicle/tracked_vehicle/test_rig/ChTrackTestRig.h"
+#include "chrono_vehicle/tracked_vehicle/track_shoe/ChTrackShoeSegmented.h"
 
 namespace chrono {
 namespace vehicle {
@@ -550,6 +558,348 @@ bool ChTrackCollisionManager::OnNarrowphase(ChCollisionInfo& contactinfo) {
 
 // -----------------------------------------------------------------------------
 
+ChTrackWheelContactGenerator::ChTrackWheelContactGenerator(ChTrackedVehicle* vehicle) : m_vehicle(vehicle) {}
+
+bool ChTrackWheelContactGenerator::GetWheelShapes(std::shared_ptr<ChBody> body, BodyShapes<CylinderShape>& wheel) {
+    auto model = body->GetCollisionModel();
+    if (!model || model->GetShapeInstances().empty())
+        return false;
+
+    wheel.body = body;
+    wheel.radius = 0;
+    for (const auto& s : model->GetShapeInstances()) {
+        if (s.first->GetType() != ChCollisionShape::Type::CYLINDER)
+            return false;
+        auto cyl = std::static_pointer_cast<ChCollisionShapeCylinder>(s.first);
+        double radius = cyl->GetRadius();
+        double hlen = cyl->GetHeight() / 2;
+        wheel.shapes.push_back({cyl.get(), cyl->GetMaterial(), s.second, radius, hlen});
+        wheel.radius = std::max(wheel.radius, s.second.GetPos().Length() + std::sqrt(radius * radius + hlen * hlen));
+    }
+
+    return true;
+}
+
+bool ChTrackWheelContactGenerator::GetShoeShapes(std::shared_ptr<ChBody> body, BodyShapes<BoxShape>& shoe) {
+    auto model = body->GetCollisionModel();
+    if (!model || model->GetShapeInstances().empty())
+        return false;
+
+    shoe.body = body;
+    shoe.radius = 0;
+    for (const auto& s : model->GetShapeInstances()) {
+        if (s.first->GetType() != ChCollisionShape::Type::BOX)
+            return false;
+        auto box = std::static_pointer_cast<ChCollisionShapeBox>(s.first);
+        const auto& hdims = box->GetHalflengths();
+        shoe.shapes.push_back({box.get(), box->GetMaterial(), s.second, hdims});
+        shoe.radius = std::max(shoe.radius, s.second.GetPos().Length() + hdims.Length());
+    }
+
+    return true;
+}
+
+bool ChTrackWheelContactGenerator::Initialize() {
+    m_tracks.clear();
+
+    for (auto side : {LEFT, RIGHT}) {
+        auto track = m_vehicle->GetTrackAssembly(side);
+        TrackData data;
+
+        // All track shoes must be segmented, with only box collision shapes on the shoe body.
+        // Note that connector bodies of double-pin track shoes do not have collision shapes.
+        bool shoes_ok = track->GetNumTrackShoes() > 0;
+        for (size_t i = 0; shoes_ok && i < track->GetNumTrackShoes(); ++i) {
+            auto shoe = std::dynamic_pointer_cast<ChTrackShoeSegmented>(track->GetTrackShoe(i));
+            BodyShapes<BoxShape> shoe_shapes;
+            shoes_ok = shoe && GetShoeShapes(shoe->GetShoeBody(), shoe_shapes);
+            data.shoes.push_back(shoe_shapes);
+        }
+        if (!shoes_ok)
+            continue;
+
+        // Collect the track wheels with only cylindrical collision shapes which collide with the track shoes
+        std::vector<std::shared_ptr<ChTrackWheel>> wheels;
+        for (size_t i = 0; i < track->GetNumTrackSuspensions(); ++i)
+            wheels.push_back(track->GetRoadWheel(i));
+        wheels.push_back(track->GetIdlerWheel());
+        for (size_t i = 0; i < track->GetNumRollers(); ++i)
+            wheels.push_back(track->GetRoller(i));
+
+        for (const auto& wheel : wheels) {
+            BodyShapes<CylinderShape> wheel_shapes;
+            if (GetWheelShapes(wheel->GetBody(), wheel_shapes) &&
+                wheel->GetBody()->GetCollisionModel()->CollidesWith(TrackedCollisionFamily::SHOES))
+                data.wheels.push_back(wheel_shapes);
+        }
+        if (data.wheels.empty())
+            continue;
+
+        // Exclude wheel-shoe collisions from the underlying collision system
+        for (auto& wheel : data.wheels)
+            wheel.body->GetCollisionModel()->DisallowCollisionsWith(TrackedCollisionFamily::SHOES);
+
+        // Track shoe sizes and spacing, used to find the shoes near each wheel
+        size_t num_shoes = data.shoes.size();
+        data.shoe_radius = 0;
+        data.pitch = std::numeric_limits<double>::max();
+        for (size_t i = 0; i < num_shoes; ++i) {
+            const auto& pos = data.shoes[i].body->GetPos();
+            const auto& pos_next = data.shoes[(i + 1) % num_shoes].body->GetPos();
+            data.shoe_radius = std::max(data.shoe_radius, data.shoes[i].radius);
+            data.pitch = std::min(data.pitch, (pos_next - pos).Length());
+        }
+        data.anchors.resize(data.wheels.size());
+        data.num_calls = 0;
+
+        m_tracks.push_back(std::move(data));
+    }
+
+    return !m_tracks.empty();
+}
+
+void ChTrackWheelContactGenerator::Release() {
+    for (auto& track : m_tracks) {
+        for (auto& wheel : track.wheels)
+            wheel.body->GetCollisionModel()->AllowCollisionsWith(TrackedCollisionFamily::SHOES);
+    }
+    m_tracks.clear();
+}
+
+// Number of collision calls between searches for nearby track shoes over all shoes of a track
+static const int shoe_search_interval = 10;
+
+void ChTrackWheelContactGenerator::FindAnchors(TrackData& track, size_t iw, double max_dist) {
+    const auto& wheel_pos = track.wheels[iw].body->GetPos();
+    int num_shoes = (int)track.shoes.size();
+
+    std::vector<double> dist2(num_shoes);
+    for (int i = 0; i < num_shoes; i++)
+        dist2[i] = (track.shoes[i].body->GetPos() - wheel_pos).Length2();
+
+    auto& anchors = track.anchors[iw];
+    anchors.clear();
+    for (int i = 0; i < num_shoes; i++) {
+        int prev = (i + num_shoes - 1) % num_shoes;
+        int next = (i + 1) % num_shoes;
+        if (dist2[i] <= max_dist * max_dist && dist2[i] <= dist2[prev] && dist2[i] <= dist2[next])
+            anchors.push_back(i);
+    }
+}
+
+void ChTrackWheelContactGenerator::UpdateAnchors(TrackData& track,
+                                                 size_t iw,
+                                                 double max_dist,
+                                                 int half_window,
+                                                 std::vector<int>& indices) {
+    const auto& wheel_pos = track.wheels[iw].body->GetPos();
+    int num_shoes = (int)track.shoes.size();
+    auto dist2 = [&](int i) { return (track.shoes[i].body->GetPos() - wheel_pos).Length2(); };
+
+    auto& anchors = track.anchors[iw];
+    size_t num_anchors = 0;
+    indices.clear();
+    for (size_t ia = 0; ia < anchors.size(); ia++) {
+        // Move along the track to the closest shoe (the track may have advanced by several shoes since the last call)
+        int anchor = anchors[ia];
+        double d2 = dist2(anchor);
+        for (int k = 0; k < num_shoes; k++) {
+            int prev = (anchor + num_shoes - 1) % num_shoes;
+            int next = (anchor + 1) % num_shoes;
+            double d2_prev = dist2(prev);
+            double d2_next = dist2(next);
+            if (d2_prev < d2 && d2_prev <= d2_next) {
+                anchor = prev;
+                d2 = d2_prev;
+            } else if (d2_next < d2) {
+                anchor = next;
+                d2 = d2_next;
+            } else {
+                break;
+            }
+        }
+
+        // Drop track sections which moved away from the wheel
+        if (d2 > max_dist * max_dist)
+            continue;
+
+        anchors[num_anchors++] = anchor;
+        for (int k = -half_window; k <= half_window; k++)
+            indices.push_back(((anchor + k) % num_shoes + num_shoes) % num_shoes);
+    }
+    anchors.resize(num_anchors);
+
+    // Anchors may have moved to the same shoe and windows may overlap
+    std::sort(anchors.begin(), anchors.end());
+    anchors.erase(std::unique(anchors.begin(), anchors.end()), anchors.end());
+    std::sort(indices.begin(), indices.end());
+    indices.erase(std::unique(indices.begin(), indices.end()), indices.end());
+}
+
+void ChTrackWheelContactGenerator::OnCustomCollision(ChSystem* system) {
+    std::vector<int> indices;
+
+    for (auto& track : m_tracks) {
+        // Skip this track if collision disabled on its track shoes
+        if (!track.shoes[0].body->IsCollisionEnabled())
+            continue;
+
+        bool search = (track.num_calls++ % shoe_search_interval == 0);
+        int num_shoes = (int)track.shoes.size();
+        double shoe_envelope = track.shoes[0].body->GetCollisionModel()->GetEnvelope();
+
+        for (size_t iw = 0; iw < track.wheels.size(); iw++) {
+            const auto& wheel = track.wheels[iw];
+            if (!wheel.body->IsCollisionEnabled())
+                continue;
+
+            const ChFrame<>& wheel_frame = wheel.body->GetFrameRefToAbs();
+            double wheel_envelope = wheel.body->GetCollisionModel()->GetEnvelope();
+
+            // Track shoes farther than 'range' from the wheel cannot collide with it. Track sections within twice
+            // this distance are followed between searches, so that sections approaching the wheel are not missed.
+            // A shoe within range is at most 2 * range away from the closest shoe of its section along the track.
+            double range = wheel.radius + track.shoe_radius + wheel_envelope + shoe_envelope;
+            int half_window = (int)std::min(std::ceil(2 * range / track.pitch) + 1, (double)(num_shoes / 2));
+            if (search)
+                FindAnchors(track, iw, 2 * range);
+            UpdateAnchors(track, iw, 2 * range, half_window, indices);
+
+            for (int is : indices) {
+                const auto& shoe = track.shoes[is];
+                const ChFrame<>& shoe_frame = shoe.body->GetFrameRefToAbs();
+                double envelope = wheel_envelope + shoe.body->GetCollisionModel()->GetEnvelope();
+
+                // Broadphase collision test: bounding spheres of the wheel and shoe collision models
+                double dist = wheel.radius + shoe.radius + envelope;
+                if ((shoe_frame.GetPos() - wheel_frame.GetPos()).Length2() > dist * dist)
+                    continue;
+
+                // Narrowphase collision test for all pairs of wheel cylinders and shoe boxes
+                for (const auto& cyl : wheel.shapes) {
+                    auto cyl_abs = wheel_frame * cyl.frame;
+                    for (const auto& box : shoe.shapes) {
+                        auto box_abs = shoe_frame * box.frame;
+                        Collide(wheel, cyl, cyl_abs, shoe, box, box_abs, envelope, system);
+                    }
+                }
+            }
+        }
+    }
+}
+
+// Cylinder-box collision test, performed in the cylinder frame (with the cylinder axis along Z).
+// The test uses two separating directions: the cylinder axis (contact with one of the cylinder faces) and the radial
+// direction towards the point of the box cross-section closest to the cylinder axis (contact with the cylinder side).
+// The box cross-section is the rectangle spanned by the two box axes most orthogonal to the cylinder axis, which is
+// exact for track shoes parallel to the wheel axis. Contacts are generated along the direction of minimum penetration:
+// a single contact for a cylinder face, and one contact at each end of the axial overlap for the cylinder side (a line
+// contact), so that the contact also resists rotations tilting the cylinder axis with respect to the box surface.
+int ChTrackWheelContactGenerator::CollideCylinderBox(double radius,
+                                                     double hlen,
+                                                     const ChFrame<>& cyl_abs,
+                                                     const ChVector3d& hdims,
+                                                     const ChFrame<>& box_abs,
+                                                     double envelope,
+                                                     std::array<ChCollisionInfo, 2>& cinfo) {
+    // Box center and box axes, expressed in the cylinder frame
+    ChVector3d c = cyl_abs.TransformPointParentToLocal(box_abs.GetPos());
+    ChMatrix33<> A = cyl_abs.GetRotMat().transpose() * box_abs.GetRotMat();
+
+    // Axial test: half-extent of the box along the cylinder axis and penetration into the closest cylinder face
+    double ez = std::abs(A(2, 0)) * hdims.x() + std::abs(A(2, 1)) * hdims.y() + std::abs(A(2, 2)) * hdims.z();
+    double side = (c.z() < 0) ? -1 : +1;
+    double depth_ax = hlen + ez - side * c.z();
+    if (depth_ax < -envelope)
+        return 0;
+
+    // Radial test: closest point of the box cross-section to the cylinder axis
+    int k = 0;
+    for (int j = 1; j < 3; j++) {
+        if (std::abs(A(2, j)) > std::abs(A(2, k)))
+            k = j;
+    }
+    int j1 = (k + 1) % 3;
+    int j2 = (k + 2) % 3;
+    ChVector2d u1(A(0, j1), A(1, j1));
+    ChVector2d u2(A(0, j2), A(1, j2));
+    u1.Normalize();
+    u2.Normalize();
+    ChVector2d c2(c.x(), c.y());
+    double s1 = ChClamp(-c2.Dot(u1), -hdims[j1], hdims[j1]);
+    double s2 = ChClamp(-c2.Dot(u2), -hdims[j2], hdims[j2]);
+    ChVector2d q = c2 + u1 * s1 + u2 * s2;
+    double dist_q = q.Length();
+
+    // Ignore degenerate configurations (cylinder axis inside the box)
+    if (dist_q < 1e-10)
+        return 0;
+
+    double depth_rad = radius - dist_q;
+    if (depth_rad < -envelope)
+        return 0;
+
+    if (depth_rad <= depth_ax) {
+        // Contact with the cylinder side, at both ends of the axial overlap (a single contact at the middle of the
+        // overlap if its length is negligible)
+        double z1 = std::max(-hlen, c.z() - ez);
+        double z2 = std::min(hlen, c.z() + ez);
+        if (z2 - z1 < 1e-6 * hlen) {
+            z1 = 0.5 * (z1 + z2);
+            z2 = z1;
+        }
+        int num_contacts = (z2 > z1) ? 2 : 1;
+
+        ChVector2d n2 = q / dist_q;
+        ChVector3d nrm = cyl_abs.TransformDirectionLocalToParent(ChVector3d(n2.x(), n2.y(), 0));
+        double z[2] = {z1, z2};
+        for (int i = 0; i < num_contacts; i++) {
+            cinfo[i].vN = nrm;
+            cinfo[i].vpA = cyl_abs.TransformPointLocalToParent(ChVector3d(radius * n2.x(), radius * n2.y(), z[i]));
+            cinfo[i].vpB = cyl_abs.TransformPointLocalToParent(ChVector3d(q.x(), q.y(), z[i]));
+            cinfo[i].distance = -depth_rad;
+            cinfo[i].eff_radius = radius;
+        }
+        return num_contacts;
+    }
+
+    // Contact with the cylinder face closest to the box
+    cinfo[0].vN = cyl_abs.TransformDirectionLocalToParent(ChVector3d(0, 0, side));
+    cinfo[0].vpA = cyl_abs.TransformPointLocalToParent(ChVector3d(q.x(), q.y(), side * hlen));
+    cinfo[0].vpB = cyl_abs.TransformPointLocalToParent(ChVector3d(q.x(), q.y(), c.z() - side * ez));
+    cinfo[0].distance = -depth_ax;
+    cinfo[0].eff_radius = ChCollisionInfo::GetDefaultEffectiveCurvatureRadius();
+    return 1;
+}
+
+void ChTrackWheelContactGenerator::Collide(const BodyShapes<CylinderShape>& wheel,
+                                           const CylinderShape& cyl,
+                                           const ChFrame<>& cyl_abs,
+                                           const BodyShapes<BoxShape>& shoe,
+                                           const BoxShape& box,
+                                           const ChFrame<>& box_abs,
+                                           double envelope,
+                                           ChSystem* system) {
+    std::array<ChCollisionInfo, 2> cinfo;
+    int num_contacts = CollideCylinderBox(cyl.radius, cyl.hlen, cyl_abs, box.hdims, box_abs, envelope, cinfo);
+
+    auto& collision_manager = m_vehicle->m_collision_manager;
+    for (int i = 0; i < num_contacts; i++) {
+        cinfo[i].modelA = wheel.body->GetCollisionModel().get();
+        cinfo[i].modelB = shoe.body->GetCollisionModel().get();
+        cinfo[i].shapeA = cyl.shape;
+        cinfo[i].shapeB = box.shape;
+
+        // If user-defined custom contact is enabled, let the collision manager intercept this collision
+        if (collision_manager && !collision_manager->OnNarrowphase(cinfo[i]))
+            continue;
+
+        system->GetContactContainer()->AddContact(cinfo[i], cyl.material, box.material);
+    }
+}
+
+// -----------------------------------------------------------------------------
+
 void ChTrackCustomContact::Setup() {
     // Calculate contact forces for all current wheel-shoe collisions, calling the user-supplied callback
     ApplyForces();
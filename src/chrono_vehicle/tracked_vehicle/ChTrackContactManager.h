@@ -19,10 +19,12 @@
 #ifndef CH_TRACK_CONTACT_MANAGER
 #define CH_TRACK_CONTACT_MANAGER
 
-#include <list>
+#include <array>
+#include <vector>
 
 #include "chrono/physics/ChContactContainer.h"
 #include "chrono/physics/ChLoadContainer.h"
+#include "chrono/physics/ChSystem.h"
 #include "chrono/collision/ChCollisionSystem.h"
 #include "chrono/utils/ChUtilsInputOutput.h"
 
@@ -41,6 +43,7 @@ namespace vehicle {
 
 class ChTrackedVehicle;
 class ChTrackTestRig;
+class ChTrackAssembly;
 
 // -----------------------------------------------------------------------------
 
@@ -113,13 +116,13 @@ class CH_VEHICLE_API ChTrackContactManager : public ChContactContainer::ReportCo
     size_t m_shoe_index_L;  ///< index of monitored track shoe on left track
     size_t m_shoe_index_R;  ///< index of monitored track shoe on right track
 
-    std::list<ContactInfo> m_chassis_contacts;     ///< list of contacts on chassis
-    std::list<ContactInfo> m_sprocket_L_contacts;  ///< list of contacts on left sprocket gear
-    std::list<ContactInfo> m_sprocket_R_contacts;  ///< list of contacts on right sprocket gear
-    std::list<ContactInfo> m_shoe_L_contacts;      ///< list of contacts on left track shoe
-    std::list<ContactInfo> m_shoe_R_contacts;      ///< list of contacts on right track shoe
-    std::list<ContactInfo> m_idler_L_contacts;     ///< list of contacts on left idler wheel
-    std::list<ContactInfo> m_idler_R_contacts;     ///< list of contacts on right idler wheel
+    std::vector<ContactInfo> m_chassis_contacts;     ///< list of contacts on chassis
+    std::vector<ContactInfo> m_sprocket_L_contacts;  ///< list of contacts on left sprocket gear
+    std::vector<ContactInfo> m_sprocket_R_contacts;  ///< list of contacts on right sprocket gear
+    std::vector<ContactInfo> m_shoe_L_contacts;      ///< list of contacts on left track shoe
+    std::vector<ContactInfo> m_shoe_R_contacts;      ///< list of contacts on right track shoe
+    std::vector<ContactInfo> m_idler_L_contacts;     ///< list of contacts on left idler wheel
+    std::vector<ContactInfo> m_idler_R_contacts;     ///< list of contacts on right idler wheel
 
     friend class ChTrackedVehicleVisualSystemIrrlicht;
     friend class ChTrackTestRigVisualSystemIrrlicht;
@@ -148,6 +151,115 @@ class CH_VEHICLE_API ChTrackCollisionManager : public ChCollisionSystem::Narrowp
 
     friend class ChTrackedVehicle;
     friend class ChTrackCustomContact;
+    friend class ChTrackWheelContactGenerator;
+};
+
+// -----------------------------------------------------------------------------
+
+// Custom collision callback for analytic contact between track wheels and track shoes.
+// This private class is only used by ChTrackedVehicle.
+// For each track assembly with segmented track shoes, collisions between the cylindrical shapes of road wheels, idler
+// wheel, and rollers and the box shapes of the track shoe bodies are removed from the general collision detection.
+// Instead, each wheel is only tested against nearby shoes of its own track (bounding sphere check followed by an
+// analytic cylinder-box test) and the resulting contacts are added directly to the system contact container.
+// Nearby shoes are found in the track topology: for each wheel, the shoes closest to the wheel in each section of the
+// track passing by it are followed along the shoe sequence from step to step, and only the shoes within a window of
+// consecutive shoes around them are tested. A search over all shoes of the track is performed periodically.
+class CH_VEHICLE_API ChTrackWheelContactGenerator : public ChSystem::CustomCollisionCallback {
+  public:
+    /// Analytic collision test between a cylinder (with its axis along the Z axis of the frame 'cyl_abs') and a box.
+    /// Return the number of contacts: 0 if the two shapes are separated by more than 'envelope', 1 for contact with a
+    /// cylinder face, and 2 for contact with the cylinder side (one at each end of the axial overlap). For each
+    /// contact, set the contact normal (from the cylinder to the box), the contact points on the cylinder and on the
+    /// box, the signed distance (negative for penetration), and the effective curvature radius in 'cinfo', all
+    /// expressed in the absolute frame.
+    static int CollideCylinderBox(double radius,
+                                  double hlen,
+                                  const ChFrame<>& cyl_abs,
+                                  const ChVector3d& hdims,
+                                  const ChFrame<>& box_abs,
+                                  double envelope,
+                                  std::array<ChCollisionInfo, 2>& cinfo);
+
+  private:
+    ChTrackWheelContactGenerator(ChTrackedVehicle* vehicle);
+
+    /// Collect the wheels and track shoes that can be processed analytically and disable their collision through the
+    /// underlying collision system. Return false if no track assembly can be processed.
+    bool Initialize();
+
+    /// Re-enable collision through the underlying collision system for all processed wheels.
+    void Release();
+
+    /// Generate contacts between track wheels and track shoes.
+    virtual void OnCustomCollision(ChSystem* system) override;
+
+    /// Cylindrical collision shape of a track wheel.
+    struct CylinderShape {
+        ChCollisionShape* shape;                      ///< collision shape
+        std::shared_ptr<ChContactMaterial> material;  ///< contact material
+        ChFrame<> frame;                              ///< shape frame in collision model (Z axis along cylinder axis)
+        double radius;                                ///< cylinder radius
+        double hlen;                                  ///< cylinder half-length
+    };
+
+    /// Box collision shape of a track shoe.
+    struct BoxShape {
+        ChCollisionShape* shape;                      ///< collision shape
+        std::shared_ptr<ChContactMaterial> material;  ///< contact material
+        ChFrame<> frame;                              ///< shape frame in collision model
+        ChVector3d hdims;                             ///< box half-dimensions
+    };
+
+    /// Track wheel or track shoe body and its collision shapes.
+    template <typename T>
+    struct BodyShapes {
+        std::shared_ptr<ChBody> body;  ///< wheel or shoe body
+        std::vector<T> shapes;         ///< collision shapes
+        double radius;                 ///< radius of bounding sphere, centered at collision model origin
+    };
+
+    /// Wheels and track shoes of a track assembly.
+    struct TrackData {
+        std::vector<BodyShapes<CylinderShape>> wheels;
+        std::vector<BodyShapes<BoxShape>> shoes;
+        std::vector<std::vector<int>> anchors;  ///< for each wheel, indices of the closest shoes in nearby track sections
+        double shoe_radius;                     ///< largest bounding sphere radius of the track shoes
+        double pitch;                           ///< smallest distance between consecutive track shoes
+        int num_calls;                          ///< number of collision calls since initialization
+    };
+
+    /// Find the shoes closest to the given wheel in each section of the track within the specified distance.
+    /// These are the local minima of the wheel-shoe distance along the sequence of track shoes.
+    static void FindAnchors(TrackData& track, size_t iw, double max_dist);
+
+    /// Move each anchor of the given wheel to the closest shoe in its neighborhood and collect the indices of all
+    /// shoes within the specified number of shoes of an anchor. Anchors farther than the specified distance are removed.
+    static void UpdateAnchors(TrackData& track, size_t iw, double max_dist, int half_window, std::vector<int>& indices);
+
+    /// Collect the collision shapes of a track wheel.
+    /// Return false if the wheel has no collision shapes or if any of its shapes is not a cylinder.
+    static bool GetWheelShapes(std::shared_ptr<ChBody> body, BodyShapes<CylinderShape>& wheel);
+
+    /// Collect the collision shapes of a track shoe.
+    /// Return false if the shoe has no collision shapes or if any of its shapes is not a box.
+    static bool GetShoeShapes(std::shared_ptr<ChBody> body, BodyShapes<BoxShape>& shoe);
+
+    /// Test the given wheel cylinder against the given shoe box and add a contact to the system if they collide.
+    /// The contact is passed through the track collision manager if custom contact is enabled.
+    void Collide(const BodyShapes<CylinderShape>& wheel,
+                 const CylinderShape& cyl,
+                 const ChFrame<>& cyl_abs,
+                 const BodyShapes<BoxShape>& shoe,
+                 const BoxShape& box,
+                 const ChFrame<>& box_abs,
+                 double envelope,
+                 ChSystem* system);
+
+    ChTrackedVehicle* m_vehicle;      ///< associated vehicle
+    std::vector<TrackData> m_tracks;  ///< track assemblies processed analytically
+
+    friend class ChTrackedVehicle;
 };
 
 /// Callback interface for user-defined custom contact between road wheels and track shoes.
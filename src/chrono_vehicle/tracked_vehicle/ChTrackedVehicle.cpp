@@ -19,6 +19,8 @@
 //
 // =============================================================================
 
+#include "chrono/utils/ChProfiler.h"
+
 #include "chrono_vehicle/ChSubsysDefs.h"
 #include "chrono_vehicle/tracked_vehicle/ChTrackedVehicle.h"
 
@@ -71,6 +73,8 @@ void ChTrackedVehicle::Initialize(const ChCoordsys<>& chassisPos, double chassis
 // reference frame).
 // -----------------------------------------------------------------------------
 void ChTrackedVehicle::Synchronize(double time, const DriverInputs& driver_inputs) {
+    CH_PROFILE_ZONE("ChTrackedVehicle::Synchronize");
+
     // Let the driveline combine driver inputs if needed
     double braking_left = 0;
     double braking_right = 0;
@@ -112,6 +116,8 @@ void ChTrackedVehicle::Synchronize(double time,
                                    const DriverInputs& driver_inputs,
                                    const TerrainForces& shoe_forces_left,
                                    const TerrainForces& shoe_forces_right) {
+    CH_PROFILE_ZONE("ChTrackedVehicle::Synchronize");
+
     // Let the driveline combine driver inputs if needed
     double braking_left = 0;
     double braking_right = 0;
@@ -153,6 +159,8 @@ void ChTrackedVehicle::Synchronize(double time,
 // Advance the state of this vehicle by the specified time step.
 // -----------------------------------------------------------------------------
 void ChTrackedVehicle::Advance(double step) {
+    CH_PROFILE_ZONE("ChTrackedVehicle::Advance");
+
     // Advance state of the associated powertrain (if one is attached)
     if (m_powertrain_assembly) {
         m_powertrain_assembly->Advance(step);
@@ -340,6 +348,33 @@ void ChTrackedVehicle::EnableCustomContact(std::shared_ptr<ChTrackCustomContact>
     m_system->Add(callback);
 }
 
+// -----------------------------------------------------------------------------
+// Enable/disable analytic collision detection between track wheels and track
+// shoes (replacing the wheel-shoe collisions of the underlying collision system).
+// -----------------------------------------------------------------------------
+bool ChTrackedVehicle::EnableAnalyticWheelContact(bool val) {
+    if (val == (m_wheel_contact != nullptr))
+        return val;
+
+    if (val) {
+        auto generator = std::shared_ptr<ChTrackWheelContactGenerator>(new ChTrackWheelContactGenerator(this));
+        if (!generator->Initialize()) {
+            std::cerr << "WARNING: analytic wheel contact not enabled (no track assembly with segmented track shoes and "
+                         "cylindrical wheel collision shapes)"
+                      << std::endl;
+            return false;
+        }
+        m_wheel_contact = generator;
+        m_system->RegisterCustomCollisionCallback(m_wheel_contact);
+        return true;
+    }
+
+    m_system->UnregisterCustomCollisionCallback(m_wheel_contact);
+    m_wheel_contact->Release();
+    m_wheel_contact = nullptr;
+    return false;
+}
+
 // -----------------------------------------------------------------------------
 // Calculate the total vehicle mass
 // -----------------------------------------------------------------------------
@@ -127,6 +127,17 @@ class CH_VEHICLE_API ChTrackedVehicle : public ChVehicle {
     /// user-supplied callback which must compute the contact force for each individual collision.
     void EnableCustomContact(std::shared_ptr<ChTrackCustomContact> callback);
 
+    /// Enable/disable analytic contact between track wheels and track shoes.
+    /// If enabled, collisions between the cylindrical collision shapes of road wheels, idler wheels, and rollers and the
+    /// box collision shapes of segmented (single-pin or double-pin) track shoes are not processed by the underlying
+    /// collision system. Instead, each wheel is only tested against the shoes of its own track assembly which are near
+    /// it along the track, using an analytic cylinder-box test, and the resulting contacts are added directly to the
+    /// system contact container.
+    /// Track assemblies with other types of track shoes and wheels with other collision shapes are not affected.
+    /// This function must be called after Initialize(). Disabled by default.
+    /// Return true if analytic contact is enabled, i.e. false if disabled or if no track assembly can be processed.
+    bool EnableAnalyticWheelContact(bool val);
+
     /// Set contacts to be monitored.
     /// Contact information will be tracked for the specified subsystems.
     void MonitorContacts(int flags) { m_contact_manager->MonitorContacts(flags); }
@@ -231,10 +242,12 @@ class CH_VEHICLE_API ChTrackedVehicle : public ChVehicle {
     std::shared_ptr<ChTrackAssembly> m_tracks[2];  ///< track assemblies (left/right)
     std::shared_ptr<ChDrivelineTV> m_driveline;    ///< driveline subsystem
 
-    std::shared_ptr<ChTrackCollisionManager> m_collision_manager;  ///< manager for internal collisions
-    std::shared_ptr<ChTrackContactManager> m_contact_manager;      ///< manager for internal contacts
+    std::shared_ptr<ChTrackCollisionManager> m_collision_manager;   ///< manager for internal collisions
+    std::shared_ptr<ChTrackContactManager> m_contact_manager;       ///< manager for internal contacts
+    std::shared_ptr<ChTrackWheelContactGenerator> m_wheel_contact;  ///< analytic wheel-shoe contact generator
 
     friend class ChTrackedVehicleVisualSystemIrrlicht;
+    friend class ChTrackWheelContactGenerator;
 };
 
 /// @} vehicle_tracked
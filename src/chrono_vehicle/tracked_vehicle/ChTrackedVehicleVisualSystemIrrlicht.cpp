@@ -171,7 +171,7 @@ void ChTrackedVehicleVisualSystemIrrlicht::renderOtherGraphics() {
 }
 
 // Render normal for all contacts in the specified list, using the given color.
-void ChTrackedVehicleVisualSystemIrrlicht::renderContacts(const std::list<ChTrackContactManager::ContactInfo>& lst,
+void ChTrackedVehicleVisualSystemIrrlicht::renderContacts(const std::vector<ChTrackContactManager::ContactInfo>& lst,
                                                           const ChColor& col,
                                                           bool normals,
                                                           bool forces,
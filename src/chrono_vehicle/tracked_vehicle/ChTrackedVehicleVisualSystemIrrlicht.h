@@ -52,7 +52,7 @@ class CH_VEHICLE_API ChTrackedVehicleVisualSystemIrrlicht : public ChVehicleVisu
   private:
     virtual void renderOtherGraphics() override;
     virtual void renderOtherStats(int left, int top) override;
-    void renderContacts(const std::list<ChTrackContactManager::ContactInfo>& lst,
+    void renderContacts(const std::vector<ChTrackContactManager::ContactInfo>& lst,
                         const ChColor& col,
                         bool normals,
                         bool forces,
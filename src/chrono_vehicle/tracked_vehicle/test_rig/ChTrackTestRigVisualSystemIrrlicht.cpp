@@ -123,7 +123,7 @@ void ChTrackTestRigVisualSystemIrrlicht::renderOtherGraphics() {
 }
 
 // Render normal for all contacts in the specified list, using the given color.
-void ChTrackTestRigVisualSystemIrrlicht::renderContacts(const std::list<ChTrackContactManager::ContactInfo>& lst,
+void ChTrackTestRigVisualSystemIrrlicht::renderContacts(const std::vector<ChTrackContactManager::ContactInfo>& lst,
                                                         const ChColor& col,
                                                         bool normals,
                                                         bool forces,
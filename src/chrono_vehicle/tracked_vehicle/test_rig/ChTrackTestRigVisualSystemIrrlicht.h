@@ -51,7 +51,7 @@ class CH_VEHICLE_API ChTrackTestRigVisualSystemIrrlicht : public ChVehicleVisual
 
   private:
     virtual void renderOtherGraphics() override;
-    void renderContacts(const std::list<ChTrackContactManager::ContactInfo>& lst,
+    void renderContacts(const std::vector<ChTrackContactManager::ContactInfo>& lst,
                         const ChColor& col,
                         bool normals,
                         bool forces,
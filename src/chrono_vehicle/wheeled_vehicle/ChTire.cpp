@@ -269,26 +269,25 @@ bool ChTire::DiscTerrainCollision4pt(
     longitudinal.Normalize();
     ChVector3d lateral = Vcross(normal, longitudinal);
 
-    // Calculate four contact points in the contact patch
-    ChVector3d ptQ1 = wheel_bottom_location + dx * longitudinal;
-    double hQ1 = terrain.GetHeight(ptQ1 + voffset);
-    double ptQ1_height = ChWorldFrame::Height(ptQ1);
-    ptQ1 = ptQ1 - (ptQ1_height - hQ1) * ChWorldFrame::Vertical();
-
-    ChVector3d ptQ2 = wheel_bottom_location - dx * longitudinal;
-    double hQ2 = terrain.GetHeight(ptQ2 + voffset);
-    double ptQ2_height = ChWorldFrame::Height(ptQ2);
-    ptQ2 = ptQ2 - (ptQ2_height - hQ2) * ChWorldFrame::Vertical();
-
-    ChVector3d ptQ3 = wheel_bottom_location + dy * lateral;
-    double hQ3 = terrain.GetHeight(ptQ3 + voffset);
-    double ptQ3_height = ChWorldFrame::Height(ptQ3);
-    ptQ3 = ptQ3 - (ptQ3_height - hQ3) * ChWorldFrame::Vertical();
-
-    ChVector3d ptQ4 = wheel_bottom_location - dy * lateral;
-    double hQ4 = terrain.GetHeight(ptQ4 + voffset);
-    double ptQ4_height = ChWorldFrame::Height(ptQ4);
-    ptQ4 = ptQ4 - (ptQ4_height - hQ4) * ChWorldFrame::Vertical();
+    // Calculate four contact points in the contact patch (single batched terrain height query).
+    // The query buffers are reused across calls (per thread, since tires may be processed concurrently).
+    ChVector3d ptQ[4] = {wheel_bottom_location + dx * longitudinal, wheel_bottom_location - dx * longitudinal,
+                         wheel_bottom_location + dy * lateral, wheel_bottom_location - dy * lateral};
+    thread_local std::vector<ChVector3d> locQ(4);
+    thread_local std::vector<double> hQ(4);
+    for (int k = 0; k < 4; k++)
+        locQ[k] = ptQ[k] + voffset;
+
+    terrain.GetHeights(locQ, hQ);
+
+    for (int k = 0; k < 4; k++) {
+        double ptQ_height = ChWorldFrame::Height(ptQ[k]);
+        ptQ[k] = ptQ[k] - (ptQ_height - hQ[k]) * ChWorldFrame::Vertical();
+    }
+    const ChVector3d& ptQ1 = ptQ[0];
+    const ChVector3d& ptQ2 = ptQ[1];
+    const ChVector3d& ptQ3 = ptQ[2];
+    const ChVector3d& ptQ4 = ptQ[3];
 
     // Calculate a smoothed road surface normal
     ChVector3d rQ2Q1 = ptQ1 - ptQ2;
@@ -352,11 +351,22 @@ bool ChTire::DiscTerrainCollisionEnvelope(
 
     const size_t n_div = 180;
     double x_step = 2.0 * disc_radius / n_div;
+
+    // Query the terrain heights at all sample points along the disc with a single batched call.
+    // The query buffers are reused across calls (per thread, since tires may be processed concurrently).
+    thread_local std::vector<ChVector3d> locs(n_div - 1);
+    thread_local std::vector<double> heights(n_div - 1);
+    for (size_t i = 1; i < n_div; i++) {
+        double x = -disc_radius + x_step * double(i);
+        locs[i - 1] = disc_center + x * longitudinal + voffset;
+    }
+    terrain.GetHeights(locs, heights);
+
     double A = 0;  // overlapping area of tire disc and road surface contour
     for (size_t i = 1; i < n_div; i++) {
         double x = -disc_radius + x_step * double(i);
         ChVector3d pTest = disc_center + x * longitudinal;
-        double q = terrain.GetHeight(pTest + voffset);
+        double q = heights[i - 1];
         double a = ChWorldFrame::Height(pTest) - sqrt(disc_radius * disc_radius - x * x);
         if (q > a) {
             A += q - a;
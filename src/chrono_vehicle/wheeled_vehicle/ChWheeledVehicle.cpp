@@ -16,6 +16,8 @@
 //
 // =============================================================================
 
+#include "chrono/utils/ChProfiler.h"
+
 #include "chrono_vehicle/wheeled_vehicle/ChWheeledVehicle.h"
 
 #include "chrono_thirdparty/rapidjson/document.h"
@@ -57,6 +59,8 @@ void ChWheeledVehicle::InitializeTire(std::shared_ptr<ChTire> tire,
 // to the terrain system.
 // -----------------------------------------------------------------------------
 void ChWheeledVehicle::Synchronize(double time, const DriverInputs& driver_inputs) {
+    CH_PROFILE_ZONE("ChWheeledVehicle::Synchronize");
+
     double powertrain_torque = m_powertrain_assembly ? m_powertrain_assembly->GetOutputTorque() : 0;
     double driveline_speed = m_driveline ? m_driveline->GetOutputDriveshaftSpeed() : 0;
 
@@ -91,10 +95,13 @@ void ChWheeledVehicle::Synchronize(double time, const DriverInputs& driver_input
 
 void ChWheeledVehicle::Synchronize(double time, const DriverInputs& driver_inputs, const ChTerrain& terrain) {
     // Synchronize any associated tires
-    for (auto& axle : m_axles) {
-        for (auto& wheel : axle->GetWheels()) {
-            if (wheel->m_tire)
-                wheel->m_tire->Synchronize(time, terrain);
+    {
+        CH_PROFILE_ZONE("ChWheeledVehicle::SynchronizeTires");
+        for (auto& axle : m_axles) {
+            for (auto& wheel : axle->GetWheels()) {
+                if (wheel->m_tire)
+                    wheel->m_tire->Synchronize(time, terrain);
+            }
         }
     }
 
@@ -105,6 +112,8 @@ void ChWheeledVehicle::Synchronize(double time, const DriverInputs& driver_input
 // Advance the state of this vehicle by the specified time step.
 // -----------------------------------------------------------------------------
 void ChWheeledVehicle::Advance(double step) {
+    CH_PROFILE_ZONE("ChWheeledVehicle::Advance");
+
     // Advance state of the associated powertrain (if any)
     if (m_powertrain_assembly) {
         m_powertrain_assembly->Advance(step);
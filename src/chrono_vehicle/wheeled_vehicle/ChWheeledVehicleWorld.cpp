@@ -0,0 +1,104 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Container for multiple wheeled vehicles sharing a Chrono system and a
+// terrain. The per-vehicle Synchronize and Advance phases (drivers, tires,
+// powertrains) are processed in parallel.
+//
+// =============================================================================
+
+#include <stdexcept>
+
+#include "chrono/utils/ChProfiler.h"
+
+#include "chrono_vehicle/wheeled_vehicle/ChWheeledVehicleWorld.h"
+
+namespace chrono {
+namespace vehicle {
+
+ChWheeledVehicleWorld::ChWheeledVehicleWorld(ChSystem* system)
+    : m_system(system), m_terrain(nullptr), m_num_threads(0) {}
+
+unsigned int ChWheeledVehicleWorld::AddVehicle(ChWheeledVehicle* vehicle, ChDriver* driver) {
+    if (vehicle->GetSystem() != m_system)
+        throw std::invalid_argument("ChWheeledVehicleWorld::AddVehicle: vehicle not constructed on the world system");
+
+    Entry entry;
+    entry.vehicle = vehicle;
+    entry.driver = driver;
+    entry.inputs = {0, 0, 0, 0};
+    m_entries.push_back(entry);
+
+    return (unsigned int)(m_entries.size() - 1);
+}
+
+int ChWheeledVehicleWorld::GetNumThreads() const {
+    return m_num_threads > 0 ? m_num_threads : (int)m_system->GetNumThreadsChrono();
+}
+
+// -----------------------------------------------------------------------------
+// The terrain is synchronized first (e.g., SCM may update its state), then each
+// vehicle together with its driver in an independent task. Tasks only modify
+// the bodies and subsystems of their own vehicle (tire forces are accumulated
+// on the vehicle's own spindles) and only read the terrain.
+// -----------------------------------------------------------------------------
+void ChWheeledVehicleWorld::Synchronize(double time) {
+    CH_PROFILE_ZONE("ChWheeledVehicleWorld::Synchronize");
+
+    m_timer_sync.reset();
+    m_timer_sync.start();
+
+    if (m_terrain)
+        m_terrain->Synchronize(time);
+
+    const ChTerrain& terrain = m_terrain ? *m_terrain : m_default_terrain;
+
+    int num_vehicles = (int)m_entries.size();
+#pragma omp parallel for schedule(dynamic, 1) num_threads(GetNumThreads())
+    for (int i = 0; i < num_vehicles; i++) {
+        auto& entry = m_entries[i];
+        if (entry.driver) {
+            entry.inputs = entry.driver->GetInputs();
+            entry.driver->Synchronize(time);
+        }
+        entry.vehicle->Synchronize(time, entry.inputs, terrain);
+    }
+
+    m_timer_sync.stop();
+}
+
+void ChWheeledVehicleWorld::Advance(double step) {
+    CH_PROFILE_ZONE("ChWheeledVehicleWorld::Advance");
+
+    m_timer_advance.reset();
+    m_timer_advance.start();
+
+    // Vehicles do not own the system, so ChVehicle::Advance does not integrate it
+    int num_vehicles = (int)m_entries.size();
+#pragma omp parallel for schedule(dynamic, 1) num_threads(GetNumThreads())
+    for (int i = 0; i < num_vehicles; i++) {
+        auto& entry = m_entries[i];
+        if (entry.driver)
+            entry.driver->Advance(step);
+        entry.vehicle->Advance(step);
+    }
+
+    if (m_terrain)
+        m_terrain->Advance(step);
+
+    m_timer_advance.stop();
+
+    m_system->DoStepDynamics(step);
+}
+
+}  // end namespace vehicle
+}  // end namespace chrono
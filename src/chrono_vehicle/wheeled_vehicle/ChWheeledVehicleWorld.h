@@ -0,0 +1,132 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Container for multiple wheeled vehicles sharing a Chrono system and a
+// terrain. The per-vehicle Synchronize and Advance phases (drivers, tires,
+// powertrains) are processed in parallel.
+//
+// =============================================================================
+
+#ifndef CH_WHEELED_VEHICLE_WORLD_H
+#define CH_WHEELED_VEHICLE_WORLD_H
+
+#include <vector>
+
+#include "chrono/core/ChTimer.h"
+#include "chrono/physics/ChSystem.h"
+
+#include "chrono_vehicle/ChApiVehicle.h"
+#include "chrono_vehicle/ChDriver.h"
+#include "chrono_vehicle/ChTerrain.h"
+#include "chrono_vehicle/wheeled_vehicle/ChWheeledVehicle.h"
+
+namespace chrono {
+namespace vehicle {
+
+/// @addtogroup vehicle_wheeled
+/// @{
+
+/// Container for multiple wheeled vehicles simulated in a single Chrono system on a common terrain.
+/// The world does not take ownership of the vehicles, drivers, and terrain it refers to. All vehicles must be
+/// constructed on the system associated with this world (so that none of them owns it). At each step, the world
+/// synchronizes the terrain, then the drivers and vehicles (including tire force evaluation and terrain queries) in
+/// parallel, one task per vehicle. Advance is processed the same way, followed by a single integration step of the
+/// underlying system. Since each task only updates its own vehicle, results do not depend on the number of threads.
+///
+/// Parallel processing requires that:
+/// - the terrain supports concurrent queries (RigidTerrain, FlatTerrain, SCMTerrain, and RandomSurfaceTerrain do;
+///   CRGTerrain does not, since OpenCRG caches the last query point);
+/// - drivers do not share state with other vehicles (interactive drivers should not be used with more than one
+///   thread);
+/// - vehicles do not enforce soft real-time (see ChVehicle::EnableRealtime).
+class CH_VEHICLE_API ChWheeledVehicleWorld {
+  public:
+    /// Construct a vehicle world associated with the given system.
+    ChWheeledVehicleWorld(ChSystem* system);
+
+    ~ChWheeledVehicleWorld() {}
+
+    /// Get the underlying Chrono system.
+    ChSystem* GetSystem() const { return m_system; }
+
+    /// Set the terrain shared by all vehicles.
+    /// If no terrain is specified, vehicles are synchronized with a flat terrain at zero height. The world invokes the
+    /// terrain Synchronize and Advance functions once per step.
+    void SetTerrain(ChTerrain* terrain) { m_terrain = terrain; }
+
+    /// Get the terrain shared by all vehicles.
+    ChTerrain* GetTerrain() const { return m_terrain; }
+
+    /// Add a vehicle, with an optional associated driver, and return its index in this world.
+    /// If no driver is provided, the vehicle is synchronized with the inputs specified through SetDriverInputs.
+    /// The vehicle must have been constructed on the system associated with this world.
+    unsigned int AddVehicle(ChWheeledVehicle* vehicle, ChDriver* driver = nullptr);
+
+    /// Get the number of vehicles in this world.
+    unsigned int GetNumVehicles() const { return (unsigned int)m_entries.size(); }
+
+    /// Get the vehicle with specified index.
+    ChWheeledVehicle* GetVehicle(unsigned int i) const { return m_entries[i].vehicle; }
+
+    /// Get the driver associated with the vehicle with specified index (if any).
+    ChDriver* GetDriver(unsigned int i) const { return m_entries[i].driver; }
+
+    /// Set the driver inputs for the vehicle with specified index.
+    /// These inputs are used only if the vehicle has no associated driver.
+    void SetDriverInputs(unsigned int i, const DriverInputs& inputs) { m_entries[i].inputs = inputs; }
+
+    /// Get the driver inputs used at the last synchronization of the vehicle with specified index.
+    const DriverInputs& GetDriverInputs(unsigned int i) const { return m_entries[i].inputs; }
+
+    /// Set the number of OpenMP threads used to process the vehicles.
+    /// By default (num_threads = 0), the number of Chrono threads of the associated system is used
+    /// (see ChSystem::SetNumThreads).
+    void SetNumThreads(int num_threads) { m_num_threads = num_threads; }
+
+    /// Synchronize the terrain, and then all drivers and vehicles at the specified time.
+    void Synchronize(double time);
+
+    /// Advance the state of all drivers, vehicles, and the terrain by the specified time step, then advance the
+    /// underlying system.
+    void Advance(double step);
+
+    /// Return the time (in seconds) spent in the last call to Synchronize.
+    double GetTimeSynchronize() const { return m_timer_sync(); }
+
+    /// Return the time (in seconds) spent in the last call to Advance, excluding the system integration step.
+    double GetTimeAdvance() const { return m_timer_advance(); }
+
+  private:
+    struct Entry {
+        ChWheeledVehicle* vehicle;  ///< vehicle
+        ChDriver* driver;           ///< associated driver (may be null)
+        DriverInputs inputs;        ///< current driver inputs
+    };
+
+    int GetNumThreads() const;
+
+    ChSystem* m_system;            ///< associated Chrono system
+    ChTerrain* m_terrain;          ///< terrain shared by all vehicles
+    ChTerrain m_default_terrain;   ///< flat terrain used if none was specified
+    std::vector<Entry> m_entries;  ///< vehicles in this world
+    int m_num_threads;             ///< number of threads (0: use Chrono threads of the system)
+
+    ChTimer m_timer_sync;     ///< timer for the Synchronize phase
+    ChTimer m_timer_advance;  ///< timer for the Advance phase
+};
+
+/// @} vehicle_wheeled
+
+}  // end namespace vehicle
+}  // end namespace chrono
+
+#endif
@@ -298,6 +298,139 @@ void ChPac02Tire::CalcFxyMz(double& Fx, double& Fy, double& Mz, double kappa, do
     }
 }
 
+void ChPac02Tire::EnableForceTable(bool val,
+                                   double max_load,
+                                   int num_slip,
+                                   int num_camber,
+                                   int num_load,
+                                   double max_mu_scale,
+                                   int num_mu) {
+    m_use_force_table = val;
+    m_table_max_load = max_load;
+    m_table_num_slip = num_slip;
+    m_table_num_camber = num_camber;
+    m_table_num_load = num_load;
+    m_table_max_mu_scale = max_mu_scale;
+    m_table_num_mu = std::max(num_mu, 1);
+}
+
+// -----------------------------------------------------------------------------
+// Force tables sample CalcFxyMz over (kappa, alpha, gamma, Fz), with the same
+// slip and camber ranges as enforced in Synchronize, at a fixed set of friction
+// scaling levels. Besides Fx, Fy, Mz, the tables store the grip saturation
+// values set by CalcFxyMz. The tables depend only on the tire parameters and the
+// table settings, and are shared through a cache keyed on all of these.
+// -----------------------------------------------------------------------------
+void ChPac02Tire::BuildForceTables() {
+    // All key members are doubles, so that keys have no padding bytes (MFCoeff only has double and int members)
+    struct ForceTableKey {
+        MFCoeff par;
+        double use_mode;
+        double friction_ellipsis;
+        double gamma_limit;
+        double max_load;
+        double num_slip;
+        double num_camber;
+        double num_load;
+        double max_mu_scale;
+        double num_mu;
+    };
+    static_assert(sizeof(MFCoeff) % sizeof(double) == 0, "unexpected padding in MFCoeff");
+
+    ForceTableKey key;
+    key.par = m_par;
+    key.use_mode = m_use_mode;
+    key.friction_ellipsis = m_use_friction_ellipsis ? 1 : 0;
+    key.gamma_limit = m_gamma_limit;
+    key.max_load = m_table_max_load > 0 ? m_table_max_load : 3 * m_par.FNOMIN;
+    key.num_slip = m_table_num_slip;
+    key.num_camber = m_table_num_camber;
+    key.num_load = m_table_num_load;
+    key.max_mu_scale = m_table_max_mu_scale;
+    key.num_mu = m_table_num_mu;
+
+    auto build = [this, &key](ForceTables& tables) {
+        // CalcFxyMz reads the load-dependent quantities from the tire states
+        TireStates states = m_states;
+        m_states.Fz0_prime = m_par.FNOMIN * m_par.LFZO;
+        m_states.Pi0_prime = m_par.IP_NOM * m_par.LIP;
+        m_states.dpi = (m_par.IP - m_states.Pi0_prime) / m_states.Pi0_prime;
+
+        auto f = [this](const double* in, double* out) {
+            double kappa = in[0];
+            double alpha = in[1];
+            double gamma = in[2];
+            double Fz = in[3];
+            m_states.dfz0 = (Fz - m_states.Fz0_prime) / m_states.Fz0_prime;
+            CalcFxyMz(out[0], out[1], out[2], kappa, alpha, Fz, gamma);
+            if (!std::isfinite(out[0]) || !std::isfinite(out[1]) || !std::isfinite(out[2])) {
+                // the combined slip formulas are singular at zero slip
+                CalcFxyMz(out[0], out[1], out[2], kappa + 1e-9, alpha + 1e-9, Fz, gamma);
+            }
+            out[3] = m_states.grip_sat_x;
+            out[4] = m_states.grip_sat_y;
+        };
+
+        std::array<ChTireSurfaceTable::Axis, ChTireSurfaceTable::NUM_INPUTS> axes = {{
+            {-1.0, 1.0, m_table_num_slip, true},                                           // kappa
+            {-CH_PI_2 + 0.01, CH_PI_2 - 0.01, m_table_num_slip, true},                     // alpha
+            {-m_gamma_limit, m_gamma_limit, m_table_num_camber, false},                    // gamma
+            {key.max_load / (m_table_num_load + 1), key.max_load, m_table_num_load, false}  // Fz
+        }};
+
+        tables.mu_step = m_table_max_mu_scale / m_table_num_mu;
+        tables.levels.resize(m_table_num_mu);
+        tables.error = VNULL;
+        size_t memory = 0;
+        for (int k = 0; k < m_table_num_mu; k++) {
+            m_states.mu_scale = tables.mu_step * (k + 1);
+            tables.levels[k].Build(axes, 5, f);
+            auto err = tables.levels[k].EstimateError(f);
+            tables.error = Vmax(tables.error, ChVector3d(err[0], err[1], err[2]));
+            memory += tables.levels[k].GetMemorySize();
+        }
+        if (m_verbose) {
+            std::cout << "Pac02 force tables (" << m_table_num_mu << " friction levels up to mu_scale = "
+                      << m_table_max_mu_scale << "): " << memory / 1024 << " kB, max errors Fx = " << tables.error.x()
+                      << " N, Fy = " << tables.error.y() << " N, Mz = " << tables.error.z() << " Nm" << std::endl;
+        }
+
+        m_states = states;
+    };
+
+    m_force_tables = ChTireTableCache<ForceTableKey, ForceTables>::Get(key, build);
+}
+
+void ChPac02Tire::EvalFxyMz(double& Fx, double& Fy, double& Mz, double kappa, double alpha, double Fz, double gamma) {
+    if (m_force_tables) {
+        // Interpolate linearly between the tables at the friction levels bracketing the current friction scaling
+        const auto& levels = m_force_tables->levels;
+        int num_levels = (int)levels.size();
+        double s = m_states.mu_scale / m_force_tables->mu_step - 1;
+        if (s >= 0 && s <= num_levels - 1) {
+            int k = std::max(0, std::min((int)s, num_levels - 2));
+            double w = s - k;
+            double in[ChTireSurfaceTable::NUM_INPUTS] = {kappa, alpha, gamma, Fz};
+            double out[5];
+            double out1[5];
+            if (levels[k].Eval(in, out) && (w == 0 || levels[k + 1].Eval(in, out1))) {
+                if (w > 0) {
+                    for (int i = 0; i < 5; i++)
+                        out[i] += w * (out1[i] - out[i]);
+                }
+                Fx = out[0];
+                Fy = out[1];
+                Mz = out[2];
+                m_states.grip_sat_x = out[3];
+                m_states.grip_sat_y = out[4];
+                return;
+            }
+        }
+    }
+
+    CalcFxyMz(Fx, Fy, Mz, kappa, alpha, Fz, gamma);
+}
+
 double ChPac02Tire::CalcSigmaK(double Fz) {
     double R0 = m_par.UNLOADED_RADIUS;
     return Fz * (m_par.PTX1 + m_par.PTX2 * m_states.dfz0) * exp(m_par.PTX3 * m_states.dfz0) *
@@ -1726,6 +1859,11 @@ void ChPac02Tire::Initialize(std::shared_ptr<ChWheel> wheel) {
     m_states.vsy = 0;
     m_states.omega = 0;
     m_states.disc_normal = ChVector3d(0, 0, 0);
+
+    // Tabulate the steady-state forces (or reuse the tables of a tire with identical parameters)
+    m_force_tables.reset();
+    if (m_use_force_table && m_use_mode > 0)
+        BuildForceTables();
 }
 
 void ChPac02Tire::Synchronize(double time, const ChTerrain& terrain) {
@@ -1842,12 +1980,12 @@ void ChPac02Tire::Advance(double step) {
             break;
         case 1:
             // steady state pure longitudinal slip
-            CalcFxyMz(Fx, Fy, Mz, kappa, 0.0, Fz, gamma);
+            EvalFxyMz(Fx, Fy, Mz, kappa, 0.0, Fz, gamma);
             My = CalcMy(Fx, Fz, gamma);
             break;
         case 2:
             // steady state pure lateral slip
-            CalcFxyMz(Fx, Fy, Mz, 0.0, alpha, Fz, gamma);
+            EvalFxyMz(Fx, Fy, Mz, 0.0, alpha, Fz, gamma);
             Mx = CalcMx(Fy, Fz, gamma);
             break;
         case 3:
@@ -1855,7 +1993,7 @@ void ChPac02Tire::Advance(double step) {
             // steady state (un)combined slip
             CombinedCoulombForces(Fx0, Fy0, Fz);
             double Fx_ss = 0, Fy_ss = 0;
-            CalcFxyMz(Fx_ss, Fy_ss, Mz, kappa, alpha, Fz, gamma);
+            EvalFxyMz(Fx_ss, Fy_ss, Mz, kappa, alpha, Fz, gamma);
             Fx = (1.0 - frblend) * Fx0 + frblend * Fx_ss;
             Fy = (1.0 - frblend) * Fy0 + frblend * Fy_ss;
             My = CalcMy(Fx, Fz, gamma);
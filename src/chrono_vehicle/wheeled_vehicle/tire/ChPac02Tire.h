@@ -39,6 +39,7 @@
 #include "chrono/assets/ChVisualShapeCylinder.h"
 
 #include "chrono_vehicle/wheeled_vehicle/tire/ChForceElementTire.h"
+#include "chrono_vehicle/wheeled_vehicle/tire/ChTireSurfaceTable.h"
 #include "chrono_vehicle/ChTerrain.h"
 
 namespace chrono {
@@ -91,10 +92,33 @@ class CH_VEHICLE_API ChPac02Tire : public ChForceElementTire {
     double GetLongitudinalGripSaturation();
     double GetLateralGripSaturation();
 
+    /// Enable evaluation of the steady-state forces and aligning moment from precomputed tables (default: false).
+    /// If enabled, Fx, Fy, Mz are tabulated at initialization over the full range of longitudinal slip and slip angle,
+    /// the camber range (see SetGammaLimit), and vertical loads up to 'max_load' (default: 3 * FNOMIN), using
+    /// 'num_slip' nodes along each slip axis, 'num_camber' nodes along the camber axis, and 'num_load' nodes along the
+    /// load axis. Since the road friction enters the formulas non-linearly, tables are built for 'num_mu' friction
+    /// scaling levels (ratio of road friction to the tire reference friction), evenly spaced up to 'max_mu_scale', and
+    /// interpolated linearly in between. Vertical loads and friction scalings outside the table ranges are evaluated
+    /// analytically. Tables are shared by all tires with identical parameters and table settings.
+    /// Must be called before initialization.
+    void EnableForceTable(bool val,
+                          double max_load = 0,
+                          int num_slip = 31,
+                          int num_camber = 5,
+                          int num_load = 16,
+                          double max_mu_scale = 1.25,
+                          int num_mu = 5);
+
+    /// Get the estimated interpolation errors of the force tables relative to the analytic formulas.
+    /// Returns the maximum absolute errors in Fx, Fy (in N), and Mz (in Nm) at the tabulated friction levels.
+    ChVector3d GetForceTableError() const { return m_force_tables ? m_force_tables->error : VNULL; }
+
   protected:
     double CalcMx(double Fy, double Fz, double gamma);  // get overturning couple
     double CalcMy(double Fx, double Fz, double gamma);  // get rolling resistance moment
     void CalcFxyMz(double& Fx, double& Fy, double& Mz, double kappa, double alpha, double Fz, double gamma);
+    void EvalFxyMz(double& Fx, double& Fy, double& Mz, double kappa, double alpha, double Fz, double gamma);
+    void BuildForceTables();  // find or build the force tables for the current parameters
     double CalcSigmaK(double Fz);  // relaxation length longitudinal
     double CalcSigmaA(double Fz);  // relaxation length lateral
     void CombinedCoulombForces(double& fx, double& fy, double fz);
@@ -139,6 +163,22 @@ class CH_VEHICLE_API ChPac02Tire : public ChForceElementTire {
 
     bool m_use_friction_ellipsis = true;
 
+    /// Force tables at evenly spaced friction scaling levels
+    struct ForceTables {
+        double mu_step;                          ///< friction scaling of the first level and increment between levels
+        std::vector<ChTireSurfaceTable> levels;  ///< tables at friction scalings mu_step * (k + 1)
+        ChVector3d error;                        ///< maximum interpolation errors of Fx, Fy, Mz
+    };
+
+    bool m_use_force_table = false;                     ///< evaluate Fx, Fy, Mz from tables?
+    double m_table_max_load = 0;                        ///< upper bound of the load axis (0: use 3 * FNOMIN)
+    int m_table_num_slip = 31;                          ///< number of table nodes along the slip axes
+    int m_table_num_camber = 5;                         ///< number of table nodes along the camber axis
+    int m_table_num_load = 16;                          ///< number of table nodes along the load axis
+    double m_table_max_mu_scale = 1.25;                 ///< largest tabulated friction scaling
+    int m_table_num_mu = 5;                             ///< number of tabulated friction scaling levels
+    std::shared_ptr<const ForceTables> m_force_tables;  ///< force tables (shared with identical tires)
+
     double m_g = 9.81;  // gravitational constant on earth m/s
 
     unsigned int m_use_mode;
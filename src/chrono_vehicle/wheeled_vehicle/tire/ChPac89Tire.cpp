@@ -30,6 +30,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <iostream>
 
 #include "chrono/core/ChGlobal.h"
 #include "chrono/functions/ChFunctionSineStep.h"
@@ -60,6 +61,11 @@ void ChPac89Tire::Initialize(std::shared_ptr<ChWheel> wheel) {
     m_states.cp_long_slip = 0;
     m_states.cp_side_slip = 0;
     m_states.R_eff = m_unloaded_radius;
+
+    // Tabulate the Magic Formula terms (or reuse the tables of a tire with identical parameters)
+    m_force_tables.reset();
+    if (m_use_force_table)
+        BuildForceTables();
 }
 
 void ChPac89Tire::Synchronize(double time, const ChTerrain& terrain) {
@@ -167,36 +173,29 @@ void ChPac89Tire::Advance(double step) {
     double alpha = -m_states.cp_side_slip * CH_RAD_TO_DEG;
     double kappa = m_states.cp_long_slip * 100.0;
 
+    // Magic Formula terms, from the force tables if available (the tables ignore inputs they do not depend on)
+    double in[ChTireSurfaceTable::NUM_INPUTS] = {kappa, alpha, gamma, Fz};
+    double mf_x;
+    double mf_yz[2];
+    if (!m_force_tables || !m_force_tables->x.Eval(in, &mf_x))
+        mf_x = CalcFx(kappa, Fz);
+    if (!m_force_tables || !m_force_tables->yz.Eval(in, mf_yz)) {
+        mf_yz[0] = CalcFy(alpha, Fz, gamma);
+        mf_yz[1] = CalcMz(alpha, Fz, gamma);
+    }
+
     // Longitudinal Force
     {
-        double C = m_PacCoeff.B0;
-        double D = (m_PacCoeff.B1 * std::pow(Fz, 2) + m_PacCoeff.B2 * Fz);
-        double BCD = (m_PacCoeff.B3 * std::pow(Fz, 2) + m_PacCoeff.B4 * Fz) * std::exp(-m_PacCoeff.B5 * Fz);
-        double B = BCD / (C * D);
-        double Sh = m_PacCoeff.B9 * Fz + m_PacCoeff.B10;
         double Sv = 0.0;
-        double X1 = (kappa + Sh);
-        double E = (m_PacCoeff.B6 * std::pow(Fz, 2) + m_PacCoeff.B7 * Fz + m_PacCoeff.B8);
 
-        Fx = mu_scale * (D * std::sin(C * std::atan(B * X1 - E * (B * X1 - std::atan(B * X1))))) + Sv;
+        Fx = mu_scale * mf_x + Sv;
     }
 
     // Lateral Force
     {
-        double C = m_PacCoeff.A0;
-        double D = (m_PacCoeff.A1 * std::pow(Fz, 2) + m_PacCoeff.A2 * Fz);
-        double BCD =
-            m_PacCoeff.A3 * std::sin(std::atan(Fz / m_PacCoeff.A4) * 2.0) * (1.0 - m_PacCoeff.A5 * std::abs(gamma));
-        double B = BCD / (C * D);
-        double Sh = m_PacCoeff.A9 * Fz + m_PacCoeff.A10 + m_PacCoeff.A8 * gamma;
         double Sv = m_PacCoeff.A11 * Fz * gamma + m_PacCoeff.A12 * Fz + m_PacCoeff.A13;
-        double X1 = alpha + Sh;
-        double E = m_PacCoeff.A6 * Fz + m_PacCoeff.A7;
 
-        // Ensure that X1 stays within +/-90 deg minus a little bit
-        ChClampValue(X1, -89.5, 89.5);
-
-        Fy = mu_scale * (D * std::sin(C * std::atan(B * X1 - E * (B * X1 - std::atan(B * X1))))) + Sv;
+        Fy = mu_scale * mf_yz[0] + Sv;
     }
 
     // Blend forces
@@ -208,22 +207,10 @@ void ChPac89Tire::Advance(double step) {
 
     // Self-Aligning Torque
     {
-        double C = m_PacCoeff.C0;
-        double D = (m_PacCoeff.C1 * std::pow(Fz, 2) + m_PacCoeff.C2 * Fz);
-        double BCD = (m_PacCoeff.C3 * std::pow(Fz, 2) + m_PacCoeff.C4 * Fz) * (1 - m_PacCoeff.C6 * std::abs(gamma)) *
-                     std::exp(-m_PacCoeff.C5 * Fz);
-        double B = BCD / (C * D);
-        double Sh = m_PacCoeff.C11 * gamma + m_PacCoeff.C12 * Fz + m_PacCoeff.C13;
         double Sv =
             (m_PacCoeff.C14 * std::pow(Fz, 2) + m_PacCoeff.C15 * Fz) * gamma + m_PacCoeff.C16 * Fz + m_PacCoeff.C17;
-        double X1 = alpha + Sh;
-        double E = (m_PacCoeff.C7 * std::pow(Fz, 2) + m_PacCoeff.C8 * Fz + m_PacCoeff.C9) *
-                   (1.0 - m_PacCoeff.C10 * std::abs(gamma));
-
-        // Ensure that X1 stays within +/-90 deg minus a little bit
-        ChClampValue(X1, -89.5, 89.5);
 
-        Mz = mu_scale * (D * std::sin(C * std::atan(B * X1 - E * (B * X1 - std::atan(B * X1))))) + Sv;
+        Mz = mu_scale * mf_yz[1] + Sv;
     }
 
     // Overturning Moment
@@ -252,6 +239,122 @@ void ChPac89Tire::Advance(double step) {
     m_tireforce.moment = ChVector3d(Mx, -My, -Mz);
 }
 
+double ChPac89Tire::CalcFx(double kappa, double Fz) const {
+    double C = m_PacCoeff.B0;
+    double D = (m_PacCoeff.B1 * std::pow(Fz, 2) + m_PacCoeff.B2 * Fz);
+    double BCD = (m_PacCoeff.B3 * std::pow(Fz, 2) + m_PacCoeff.B4 * Fz) * std::exp(-m_PacCoeff.B5 * Fz);
+    double B = BCD / (C * D);
+    double Sh = m_PacCoeff.B9 * Fz + m_PacCoeff.B10;
+    double X1 = (kappa + Sh);
+    double E = (m_PacCoeff.B6 * std::pow(Fz, 2) + m_PacCoeff.B7 * Fz + m_PacCoeff.B8);
+
+    return D * std::sin(C * std::atan(B * X1 - E * (B * X1 - std::atan(B * X1))));
+}
+
+double ChPac89Tire::CalcFy(double alpha, double Fz, double gamma) const {
+    double C = m_PacCoeff.A0;
+    double D = (m_PacCoeff.A1 * std::pow(Fz, 2) + m_PacCoeff.A2 * Fz);
+    double BCD =
+        m_PacCoeff.A3 * std::sin(std::atan(Fz / m_PacCoeff.A4) * 2.0) * (1.0 - m_PacCoeff.A5 * std::abs(gamma));
+    double B = BCD / (C * D);
+    double Sh = m_PacCoeff.A9 * Fz + m_PacCoeff.A10 + m_PacCoeff.A8 * gamma;
+    double X1 = alpha + Sh;
+    double E = m_PacCoeff.A6 * Fz + m_PacCoeff.A7;
+
+    // Ensure that X1 stays within +/-90 deg minus a little bit
+    ChClampValue(X1, -89.5, 89.5);
+
+    return D * std::sin(C * std::atan(B * X1 - E * (B * X1 - std::atan(B * X1))));
+}
+
+double ChPac89Tire::CalcMz(double alpha, double Fz, double gamma) const {
+    double C = m_PacCoeff.C0;
+    double D = (m_PacCoeff.C1 * std::pow(Fz, 2) + m_PacCoeff.C2 * Fz);
+    double BCD = (m_PacCoeff.C3 * std::pow(Fz, 2) + m_PacCoeff.C4 * Fz) * (1 - m_PacCoeff.C6 * std::abs(gamma)) *
+                 std::exp(-m_PacCoeff.C5 * Fz);
+    double B = BCD / (C * D);
+    double Sh = m_PacCoeff.C11 * gamma + m_PacCoeff.C12 * Fz + m_PacCoeff.C13;
+    double X1 = alpha + Sh;
+    double E = (m_PacCoeff.C7 * std::pow(Fz, 2) + m_PacCoeff.C8 * Fz + m_PacCoeff.C9) *
+               (1.0 - m_PacCoeff.C10 * std::abs(gamma));
+
+    // Ensure that X1 stays within +/-90 deg minus a little bit
+    ChClampValue(X1, -89.5, 89.5);
+
+    return D * std::sin(C * std::atan(B * X1 - E * (B * X1 - std::atan(B * X1))));
+}
+
+// -----------------------------------------------------------------------------
+// The friction scaling and the vertical shifts enter the Pac89 formulas
+// linearly, so that a single set of tables (for the Magic Formula sine terms)
+// serves all road friction coefficients. Fx does not depend on the slip angle
+// or the camber angle and is tabulated separately over (kappa, Fz). The tables
+// are shared through a cache keyed on the coefficients and table settings.
+// -----------------------------------------------------------------------------
+void ChPac89Tire::EnableForceTable(bool val, double max_load, int num_slip, int num_camber, int num_load) {
+    m_use_force_table = val;
+    m_table_max_load = max_load;
+    m_table_num_slip = num_slip;
+    m_table_num_camber = num_camber;
+    m_table_num_load = num_load;
+}
+
+void ChPac89Tire::BuildForceTables() {
+    // Default load range: up to the maximum of the quadratic peak factor of Fx (in kN)
+    double max_load = m_table_max_load / 1000;
+    if (max_load <= 0) {
+        if (m_PacCoeff.B1 >= 0 || m_PacCoeff.B2 <= 0) {
+            std::cerr << "Warning: Pac89 force tables not built for tire " << GetName()
+                      << " (no default load range, specify max_load in EnableForceTable)" << std::endl;
+            return;
+        }
+        max_load = -m_PacCoeff.B2 / (2 * m_PacCoeff.B1);
+    }
+    double max_alpha = (CH_PI_2 - 0.001) * CH_RAD_TO_DEG;
+    double max_gamma = m_gamma_limit * CH_RAD_TO_DEG;
+
+    // All key members are doubles, so that keys have no padding bytes
+    struct ForceTableKey {
+        PacCoeff coeff;
+        double max_load;
+        double max_gamma;
+        double num_slip;
+        double num_camber;
+        double num_load;
+    };
+    ForceTableKey key = {m_PacCoeff, max_load, max_gamma, (double)m_table_num_slip, (double)m_table_num_camber,
+                         (double)m_table_num_load};
+
+    auto build = [&](ForceTables& tables) {
+        ChTireSurfaceTable::Axis load_axis = {max_load / (m_table_num_load + 1), max_load, m_table_num_load, false};
+        ChTireSurfaceTable::Axis fixed_axis = {0, 0, 1, false};
+
+        auto fx = [this](const double* in, double* out) { out[0] = CalcFx(in[0], in[3]); };
+        auto fyz = [this](const double* in, double* out) {
+            out[0] = CalcFy(in[1], in[3], in[2]);
+            out[1] = CalcMz(in[1], in[3], in[2]);
+        };
+
+        tables.x.Build({{{-100.0, 100.0, m_table_num_slip, true}, fixed_axis, fixed_axis, load_axis}}, 1, fx);
+        tables.yz.Build({{fixed_axis,
+                          {-max_alpha, max_alpha, m_table_num_slip, true},
+                          {-max_gamma, max_gamma, m_table_num_camber, false},
+                          load_axis}},
+                        2, fyz);
+
+        auto err_x = tables.x.EstimateError(fx);
+        auto err_yz = tables.yz.EstimateError(fyz);
+        tables.error = ChVector3d(err_x[0], err_yz[0], err_yz[1]);
+        if (m_verbose) {
+            std::cout << "Pac89 force tables: " << (tables.x.GetMemorySize() + tables.yz.GetMemorySize()) / 1024
+                      << " kB, max errors Fx = " << tables.error.x() << " N, Fy = " << tables.error.y()
+                      << " N, Mz = " << tables.error.z() << " Nm" << std::endl;
+        }
+    };
+
+    m_force_tables = ChTireTableCache<ForceTableKey, ForceTables>::Get(key, build);
+}
+
 void ChPac89Tire::CombinedCoulombForces(double& fx, double& fy, double fz, double muscale) {
     ChVector2d F;
     /*
@@ -25,6 +25,7 @@
 #include "chrono/assets/ChVisualShapeCylinder.h"
 
 #include "chrono_vehicle/wheeled_vehicle/tire/ChForceElementTire.h"
+#include "chrono_vehicle/wheeled_vehicle/tire/ChTireSurfaceTable.h"
 #include "chrono_vehicle/ChTerrain.h"
 
 // The following undef is required in order to compile in conda-forge
@@ -77,10 +78,34 @@ class CH_VEHICLE_API ChPac89Tire : public ChForceElementTire {
     /// The reported value, expressed in radians, will be similar to that reported by ChTire::GetCamberAngle.
     double GetCamberAngle_internal() const { return m_gamma; }
 
+    /// Enable evaluation of the Magic Formula terms of Fx, Fy, Mz from precomputed tables (default: false).
+    /// If enabled, these terms are tabulated at initialization over the full range of longitudinal slip and slip
+    /// angle, the camber range (see SetGammaLimit), and vertical loads up to 'max_load' (in N), using 'num_slip' nodes
+    /// along each slip axis, 'num_camber' nodes along the camber axis, and 'num_load' nodes along the load axis.
+    /// By default, 'max_load' is the load at which the peak factor of the Fx formula (B1 * Fz^2 + B2 * Fz) is largest,
+    /// i.e., the upper end of the load range covered by the fit. Vertical loads outside the table range are evaluated
+    /// analytically. Tables are shared by all tires with identical parameters and table settings.
+    /// Must be called before initialization.
+    void EnableForceTable(bool val, double max_load = 0, int num_slip = 41, int num_camber = 5, int num_load = 16);
+
+    /// Get the estimated interpolation errors of the force tables relative to the analytic formulas.
+    /// Returns the maximum absolute errors in Fx, Fy (in N), and Mz (in Nm), for a road friction equal to the tire
+    /// reference friction.
+    ChVector3d GetForceTableError() const { return m_force_tables ? m_force_tables->error : VNULL; }
+
   protected:
     /// Set the parameters in the Pac89 model.
     virtual void SetPac89Params() = 0;
 
+    /// Magic Formula terms of Fx, Fy, and Mz (without friction scaling and vertical shifts).
+    /// Inputs are the longitudinal slip (in percent), slip angle and camber angle (in degrees), and load (in kN).
+    double CalcFx(double kappa, double Fz) const;
+    double CalcFy(double alpha, double Fz, double gamma) const;
+    double CalcMz(double alpha, double Fz, double gamma) const;
+
+    /// Find or build the tables for the Magic Formula terms.
+    void BuildForceTables();
+
     double m_gamma;        ///< camber angle
     double m_gamma_limit;  ///< limit camber angle
 
@@ -173,6 +198,20 @@ class CH_VEHICLE_API ChPac89Tire : public ChForceElementTire {
     };
 
     TireStates m_states;
+
+    /// Tables of the Magic Formula terms
+    struct ForceTables {
+        ChTireSurfaceTable x;   ///< table of the Fx term over (kappa, Fz)
+        ChTireSurfaceTable yz;  ///< table of the Fy and Mz terms over (alpha, gamma, Fz)
+        ChVector3d error;       ///< maximum interpolation errors of Fx, Fy, Mz
+    };
+
+    bool m_use_force_table = false;                     ///< evaluate Magic Formula terms from tables?
+    double m_table_max_load = 0;                        ///< upper bound of the load axis (N)
+    int m_table_num_slip = 41;                          ///< number of table nodes along the slip axes
+    int m_table_num_camber = 5;                         ///< number of table nodes along the camber axis
+    int m_table_num_load = 16;                          ///< number of table nodes along the load axis
+    std::shared_ptr<const ForceTables> m_force_tables;  ///< force tables (shared with identical tires)
 };
 
 /// @} vehicle_wheeled_tire
@@ -0,0 +1,185 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Lookup table for steady-state tire force and moment surfaces, tabulated over
+// (longitudinal slip, slip angle, camber angle, vertical load) and evaluated
+// through multilinear interpolation.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+
+#include "chrono/utils/ChUtils.h"
+
+#include "chrono_vehicle/wheeled_vehicle/tire/ChTireSurfaceTable.h"
+
+namespace chrono {
+namespace vehicle {
+
+ChTireSurfaceTable::ChTireSurfaceTable() : m_num_outputs(0) {}
+
+// -----------------------------------------------------------------------------
+// Clustered axes use nodes x_i = max * sign(u_i) * u_i^2, with u_i uniformly
+// spaced in [-1,1]. The node spacing near 0 is therefore (n-1)/2 times smaller
+// than the spacing at the ends of the range.
+// -----------------------------------------------------------------------------
+void ChTireSurfaceTable::Build(const std::array<Axis, NUM_INPUTS>& axes, int num_outputs, Function f) {
+    Clear();
+
+    size_t num_nodes = 1;
+    for (int d = 0; d < NUM_INPUTS; d++) {
+        auto& a = m_axes[d];
+        a.axis = axes[d];
+        a.axis.num_nodes = std::max(a.axis.num_nodes, 1);
+        if (a.axis.num_nodes == 1 || a.axis.max <= a.axis.min) {
+            a.axis.num_nodes = 1;
+            a.axis.clustered = false;
+        }
+        if (a.axis.clustered) {
+            a.axis.num_nodes += 1 - a.axis.num_nodes % 2;
+            a.axis.min = -std::max(std::abs(a.axis.min), std::abs(a.axis.max));
+            a.axis.max = -a.axis.min;
+        }
+
+        int n = a.axis.num_nodes;
+        a.nodes.resize(n);
+        if (n == 1) {
+            a.nodes[0] = a.axis.min;
+        } else {
+            for (int i = 0; i < n; i++) {
+                double u = -1.0 + (2.0 * i) / (n - 1);
+                a.nodes[i] = a.axis.clustered ? a.axis.max * ChSignum(u) * u * u
+                                              : a.axis.min + i * (a.axis.max - a.axis.min) / (n - 1);
+            }
+            a.nodes[n - 1] = a.axis.max;
+        }
+
+        a.stride = num_nodes;
+        num_nodes *= n;
+    }
+
+    m_num_outputs = num_outputs;
+    m_data.resize(num_nodes * num_outputs);
+
+    double in[NUM_INPUTS];
+    std::vector<double> out(num_outputs);
+    for (size_t k = 0; k < num_nodes; k++) {
+        for (int d = 0; d < NUM_INPUTS; d++)
+            in[d] = m_axes[d].nodes[(k / m_axes[d].stride) % m_axes[d].nodes.size()];
+        f(in, out.data());
+        for (int j = 0; j < num_outputs; j++)
+            m_data[k * num_outputs + j] = static_cast<float>(out[j]);
+    }
+}
+
+void ChTireSurfaceTable::Clear() {
+    m_num_outputs = 0;
+    m_data.clear();
+    m_data.shrink_to_fit();
+}
+
+void ChTireSurfaceTable::Locate(const AxisData& a, double x, int& i, double& w) {
+    int n = a.axis.num_nodes;
+    double t;
+    if (a.axis.clustered) {
+        double u = ChSignum(x) * std::sqrt(std::abs(x) / a.axis.max);
+        t = 0.5 * (u + 1) * (n - 1);
+    } else {
+        t = (x - a.axis.min) / (a.axis.max - a.axis.min) * (n - 1);
+    }
+    i = ChClamp(static_cast<int>(std::floor(t)), 0, n - 2);
+    w = ChClamp((x - a.nodes[i]) / (a.nodes[i + 1] - a.nodes[i]), 0.0, 1.0);
+}
+
+bool ChTireSurfaceTable::Eval(const double* in, double* out) const {
+    if (m_num_outputs == 0)
+        return false;
+
+    // Interval and weight along each axis with more than one node
+    int num_active = 0;
+    size_t base = 0;
+    size_t stride[NUM_INPUTS];
+    double w[NUM_INPUTS];
+    for (int d = 0; d < NUM_INPUTS; d++) {
+        const auto& a = m_axes[d];
+        if (a.axis.num_nodes == 1)
+            continue;
+        double tol = 1e-9 * (a.axis.max - a.axis.min);
+        if (in[d] < a.axis.min - tol || in[d] > a.axis.max + tol)
+            return false;
+        int i;
+        Locate(a, in[d], i, w[num_active]);
+        base += i * a.stride;
+        stride[num_active] = a.stride;
+        num_active++;
+    }
+
+    // Accumulate the weighted values at the cell corners
+    std::fill(out, out + m_num_outputs, 0.0);
+    for (int c = 0; c < (1 << num_active); c++) {
+        double wc = 1;
+        size_t k = base;
+        for (int d = 0; d < num_active; d++) {
+            if (c & (1 << d)) {
+                wc *= w[d];
+                k += stride[d];
+            } else {
+                wc *= 1 - w[d];
+            }
+        }
+        if (wc == 0)
+            continue;
+        const float* v = &m_data[k * m_num_outputs];
+        for (int j = 0; j < m_num_outputs; j++)
+            out[j] += wc * v[j];
+    }
+
+    return true;
+}
+
+std::vector<double> ChTireSurfaceTable::EstimateError(Function f) const {
+    std::vector<double> err(m_num_outputs, 0.0);
+    if (m_num_outputs == 0)
+        return err;
+
+    size_t num_cells = 1;
+    size_t cell_stride[NUM_INPUTS];
+    for (int d = 0; d < NUM_INPUTS; d++) {
+        cell_stride[d] = num_cells;
+        num_cells *= std::max((int)m_axes[d].nodes.size() - 1, 1);
+    }
+
+    double in[NUM_INPUTS];
+    std::vector<double> exact(m_num_outputs);
+    std::vector<double> table(m_num_outputs);
+    for (size_t k = 0; k < num_cells; k++) {
+        for (int d = 0; d < NUM_INPUTS; d++) {
+            const auto& nodes = m_axes[d].nodes;
+            if (nodes.size() == 1) {
+                in[d] = nodes[0];
+            } else {
+                size_t i = (k / cell_stride[d]) % (nodes.size() - 1);
+                in[d] = 0.5 * (nodes[i] + nodes[i + 1]);
+            }
+        }
+        f(in, exact.data());
+        Eval(in, table.data());
+        for (int j = 0; j < m_num_outputs; j++)
+            err[j] = std::max(err[j], std::abs(table[j] - exact[j]));
+    }
+
+    return err;
+}
+
+}  // end namespace vehicle
+}  // end namespace chrono
@@ -0,0 +1,152 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Lookup table for steady-state tire force and moment surfaces, tabulated over
+// (longitudinal slip, slip angle, camber angle, vertical load) and evaluated
+// through multilinear interpolation.
+//
+// =============================================================================
+
+#ifndef CH_TIRE_SURFACE_TABLE_H
+#define CH_TIRE_SURFACE_TABLE_H
+
+#include <array>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+#include "chrono_vehicle/ChApiVehicle.h"
+
+namespace chrono {
+namespace vehicle {
+
+/// @addtogroup vehicle_wheeled_tire
+/// @{
+
+/// Lookup table for steady-state tire force and moment surfaces.
+/// A table samples a function with NUM_INPUTS inputs (longitudinal slip, slip angle, camber angle, and vertical load,
+/// in the units used by the tire model) and an arbitrary number of outputs on a tensor grid. Table values are
+/// evaluated with multilinear interpolation between the 2^k nodes of the grid cell containing the query point (k
+/// being the number of axes with more than one node). Nodes along slip axes can be clustered around zero, where
+/// force curves have their largest gradients.
+class CH_VEHICLE_API ChTireSurfaceTable {
+  public:
+    /// Number of table inputs.
+    static constexpr int NUM_INPUTS = 4;
+
+    /// Definition of a table axis.
+    struct Axis {
+        double min;      ///< lower bound of the axis range
+        double max;      ///< upper bound of the axis range
+        int num_nodes;   ///< number of grid nodes (if 1, the input is fixed at 'min')
+        bool clustered;  ///< if true, nodes are clustered around 0 (symmetric range, odd number of nodes)
+    };
+
+    /// Function evaluating all table outputs at the given inputs.
+    typedef std::function<void(const double* in, double* out)> Function;
+
+    ChTireSurfaceTable();
+
+    /// Tabulate the specified function over the grid defined by the given axes.
+    /// The number of nodes along a clustered axis is increased by one if even, so that 0 is always a grid node.
+    void Build(const std::array<Axis, NUM_INPUTS>& axes, int num_outputs, Function f);
+
+    /// Release the table data.
+    void Clear();
+
+    /// Return true if the table was built.
+    bool IsBuilt() const { return m_num_outputs > 0; }
+
+    /// Get the number of table outputs.
+    int GetNumOutputs() const { return m_num_outputs; }
+
+    /// Get the memory used by the table values (in bytes).
+    size_t GetMemorySize() const { return m_data.size() * sizeof(float); }
+
+    /// Evaluate all outputs at the given inputs.
+    /// Return false (and leave 'out' unchanged) if the inputs are outside the table range. Inputs along axes with a
+    /// single node are ignored.
+    bool Eval(const double* in, double* out) const;
+
+    /// Estimate the interpolation error of the table relative to the specified function.
+    /// Return, for each output, the maximum absolute difference between the table and the function, evaluated at the
+    /// centers of all grid cells (where multilinear interpolation errors are largest).
+    std::vector<double> EstimateError(Function f) const;
+
+  private:
+    struct AxisData {
+        Axis axis;
+        std::vector<double> nodes;  ///< node coordinates
+        size_t stride;              ///< stride in the array of node values
+    };
+
+    /// Find the grid interval containing x along the given axis and the interpolation weight of its upper node.
+    static void Locate(const AxisData& a, double x, int& i, double& w);
+
+    std::array<AxisData, NUM_INPUTS> m_axes;
+    int m_num_outputs;
+    std::vector<float> m_data;  ///< node values (all outputs at a given node are stored contiguously)
+};
+
+/// Registry of tire force tables shared between tires with identical parameters.
+/// Tables are identified by a key of trivially copyable type without padding bytes (keys are compared bytewise). The
+/// tables for a given key are built on first request and released when no tire uses them anymore.
+template <typename Key, typename Tables>
+class ChTireTableCache {
+  public:
+    /// Return the tables for the specified key, invoking 'build' to create them if not available.
+    static std::shared_ptr<const Tables> Get(const Key& key, const std::function<void(Tables&)>& build) {
+        static_assert(std::is_trivially_copyable<Key>::value, "ChTireTableCache: key must be trivially copyable");
+        auto& registry = GetRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        for (auto it = registry.entries.begin(); it != registry.entries.end();) {
+            auto tables = it->tables.lock();
+            if (!tables) {
+                it = registry.entries.erase(it);
+                continue;
+            }
+            if (std::memcmp(&it->key, &key, sizeof(Key)) == 0)
+                return tables;
+            ++it;
+        }
+        auto tables = std::make_shared<Tables>();
+        build(*tables);
+        registry.entries.push_back({key, tables});
+        return tables;
+    }
+
+  private:
+    struct Entry {
+        Key key;
+        std::weak_ptr<const Tables> tables;
+    };
+
+    struct Registry {
+        std::mutex mutex;
+        std::vector<Entry> entries;
+    };
+
+    static Registry& GetRegistry() {
+        static Registry registry;
+        return registry;
+    }
+};
+
+/// @} vehicle_wheeled_tire
+
+}  // end namespace vehicle
+}  // end namespace chrono
+
+#endif
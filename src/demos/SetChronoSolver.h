@@ -52,6 +52,8 @@ bool SetChronoSolver(chrono::ChSystem& sys,
         if (slvr_type != chrono::ChSolver::Type::BARZILAIBORWEIN &&  //
             slvr_type != chrono::ChSolver::Type::APGD &&             //
             slvr_type != chrono::ChSolver::Type::PSOR &&             //
+            slvr_type != chrono::ChSolver::Type::PSOR_COLORED &&     //
+            slvr_type != chrono::ChSolver::Type::PSOR_ISLANDS &&     //
             slvr_type != chrono::ChSolver::Type::PSSOR) {
             slvr_type = chrono::ChSolver::Type::BARZILAIBORWEIN;
             cout << prefix << "NSC system - setting solver to BARZILAIBORWEIN" << endl;
@@ -103,7 +105,9 @@ bool SetChronoSolver(chrono::ChSystem& sys,
             }
             case chrono::ChSolver::Type::BARZILAIBORWEIN:
             case chrono::ChSolver::Type::APGD:
-            case chrono::ChSolver::Type::PSOR: {
+            case chrono::ChSolver::Type::PSOR:
+            case chrono::ChSolver::Type::PSOR_COLORED:
+            case chrono::ChSolver::Type::PSOR_ISLANDS: {
                 auto solver = std::static_pointer_cast<chrono::ChIterativeSolverVI>(sys.GetSolver());
                 solver->SetMaxIterations(100);
                 solver->SetOmega(0.8);
@@ -0,0 +1,119 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Benchmark test for the assembly of FEA internal forces and KRM blocks.
+//
+// A block of N x N x N cubes, each split in 6 tetrahedra, is assembled with an
+// increasing number of threads. With more than one thread, ChMesh processes the
+// elements by colors (elements of the same color do not share nodes), so that
+// internal and gravity forces are added to the residual without atomics.
+//
+// =============================================================================
+
+#include "chrono/utils/ChBenchmark.h"
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/fea/ChElementTetraCorot_4.h"
+#include "chrono/fea/ChMesh.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+class TetBlock {
+  public:
+    TetBlock(int n, int num_threads);
+
+    ChSystemSMC sys;
+    std::shared_ptr<ChMesh> mesh;
+    ChVectorDynamic<> R;
+};
+
+TetBlock::TetBlock(int n, int num_threads) {
+    sys.SetNumThreads(num_threads);
+    sys.SetGravitationalAcceleration(ChVector3d(0, -9.8, 0));
+
+    auto material = chrono_types::make_shared<ChContinuumElastic>(1e7, 0.3, 1000);
+
+    mesh = chrono_types::make_shared<ChMesh>();
+    sys.Add(mesh);
+
+    double h = 1.0 / n;
+    std::vector<std::shared_ptr<ChNodeFEAxyz>> nodes;
+    for (int k = 0; k <= n; k++) {
+        for (int j = 0; j <= n; j++) {
+            for (int i = 0; i <= n; i++) {
+                auto node = chrono_types::make_shared<ChNodeFEAxyz>(ChVector3d(i * h, j * h, k * h));
+                node->SetFixed(j == 0);
+                mesh->AddNode(node);
+                nodes.push_back(node);
+            }
+        }
+    }
+
+    auto node = [&](int i, int j, int k) { return nodes[(k * (n + 1) + j) * (n + 1) + i]; };
+
+    // Kuhn subdivision of each cube in 6 tetrahedra sharing the diagonal v0-v6
+    static const int tets[6][4] = {{0, 1, 2, 6}, {0, 2, 3, 6}, {0, 3, 7, 6}, {0, 7, 4, 6}, {0, 4, 5, 6}, {0, 5, 1, 6}};
+    for (int k = 0; k < n; k++) {
+        for (int j = 0; j < n; j++) {
+            for (int i = 0; i < n; i++) {
+                std::shared_ptr<ChNodeFEAxyz> v[8] = {
+                    node(i, j, k),         node(i + 1, j, k),         node(i + 1, j + 1, k),     node(i, j + 1, k),
+                    node(i, j, k + 1),     node(i + 1, j, k + 1),     node(i + 1, j + 1, k + 1), node(i, j + 1, k + 1)};
+                for (const auto& t : tets) {
+                    auto element = chrono_types::make_shared<ChElementTetraCorot_4>();
+                    element->SetNodes(v[t[0]], v[t[1]], v[t[2]], v[t[3]]);
+                    element->SetMaterial(material);
+                    mesh->AddElement(element);
+                }
+            }
+        }
+    }
+
+    sys.Initialize();
+    sys.Update();
+
+    R.setZero(sys.GetNumCoordsVelLevel());
+}
+
+static void ResidualF(benchmark::State& state) {
+    TetBlock block((int)state.range(0), (int)state.range(1));
+
+    for (auto _ : state) {
+        block.R.setZero();
+        block.mesh->IntLoadResidual_F(block.mesh->GetOffset_w(), block.R, 1.0);
+        benchmark::DoNotOptimize(block.R.data());
+    }
+
+    state.counters["elements"] = (double)block.mesh->GetNumElements();
+    state.counters["colors"] = (double)block.mesh->GetNumElementColors();
+}
+
+static void LoadKRM(benchmark::State& state) {
+    TetBlock block((int)state.range(0), (int)state.range(1));
+
+    for (auto _ : state) {
+        block.mesh->LoadKRMMatrices(1.0, 0.1, 0.01);
+    }
+
+    state.counters["elements"] = (double)block.mesh->GetNumElements();
+}
+
+// Mesh size N and number of threads
+static void Arguments(benchmark::internal::Benchmark* b) {
+    for (int n : {16, 32})
+        for (int num_threads : {1, 2, 4, 8})
+            b->Args({n, num_threads});
+}
+
+BENCHMARK(ResidualF)->Apply(Arguments)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(LoadKRM)->Apply(Arguments)->Unit(benchmark::kMillisecond)->UseRealTime();
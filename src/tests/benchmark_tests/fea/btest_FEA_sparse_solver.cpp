@@ -14,7 +14,8 @@
 //
 // Benchmark test for sparse matrix setup (assembly of system matrix).
 // This provides a measure of the effect and performance of using the "sparsity
-// learner".
+// learner" and the "sparsity pattern cache" (assembly in the matrix structure
+// of the previous call and reuse of the symbolic analysis).
 //
 // =============================================================================
 
@@ -105,6 +106,9 @@ class SystemFixture : public ::benchmark::Fixture {
         st.counters["LS_Setup_call"] = solver->GetTimeSetup_SolverCall() * 1e3 / num_it;
         st.counters["LS_Solve_assembly"] = solver->GetTimeSolve_Assembly() * 1e3 / num_it;
         st.counters["LS_Solve_call"] = solver->GetTimeSolve_SolverCall() * 1e3 / num_it;
+
+        st.counters["pattern_hits"] = solver->GetNumPatternHits();
+        st.counters["pattern_misses"] = solver->GetNumPatternMisses();
     }
 
   protected:
@@ -156,6 +160,20 @@ class SystemFixture : public ::benchmark::Fixture {
     }                                                                                 \
     BENCHMARK_REGISTER_F(SystemFixture, TEST_NAME)->Unit(benchmark::kMillisecond);
 
+// Sparsity pattern cache: the pattern is learned at the first call only and the symbolic analysis is reused
+#define BM_SOLVER_CACHE(TEST_NAME, N, SOLVER)                                         \
+    BENCHMARK_TEMPLATE_DEFINE_F(SystemFixture, TEST_NAME, N)(benchmark::State & st) { \
+        auto solver = chrono_types::make_shared<SOLVER>();                            \
+        solver->EnableSparsityPatternCache(true);                                     \
+        solver->SetVerbose(false);                                                    \
+        m_system->SetSolver(solver);                                                  \
+        while (st.KeepRunning()) {                                                    \
+            m_system->DoStaticLinear();                                               \
+        }                                                                             \
+        Report(st);                                                                   \
+    }                                                                                 \
+    BENCHMARK_REGISTER_F(SystemFixture, TEST_NAME)->Unit(benchmark::kMillisecond);
+
 #ifdef CHRONO_PARDISO_MKL
 BM_SOLVER_MKL(MKL_learner_500, 500, true)
 BM_SOLVER_MKL(MKL_no_learner_500, 500, false)
@@ -167,6 +185,11 @@ BM_SOLVER_MKL(MKL_learner_4000, 4000, true)
 BM_SOLVER_MKL(MKL_no_learner_4000, 4000, false)
 BM_SOLVER_MKL(MKL_learner_8000, 8000, true)
 BM_SOLVER_MKL(MKL_no_learner_8000, 8000, false)
+BM_SOLVER_CACHE(MKL_cache_500, 500, ChSolverPardisoMKL)
+BM_SOLVER_CACHE(MKL_cache_1000, 1000, ChSolverPardisoMKL)
+BM_SOLVER_CACHE(MKL_cache_2000, 2000, ChSolverPardisoMKL)
+BM_SOLVER_CACHE(MKL_cache_4000, 4000, ChSolverPardisoMKL)
+BM_SOLVER_CACHE(MKL_cache_8000, 8000, ChSolverPardisoMKL)
 #endif
 
 #ifdef CHRONO_MUMPS
@@ -192,6 +215,11 @@ BM_SOLVER_QR(QR_learner_4000, 4000, true)
 BM_SOLVER_QR(QR_no_learner_4000, 4000, false)
 BM_SOLVER_QR(QR_learner_8000, 8000, true)
 BM_SOLVER_QR(QR_no_learner_8000, 8000, false)
+BM_SOLVER_CACHE(QR_cache_500, 500, ChSolverSparseQR)
+BM_SOLVER_CACHE(QR_cache_1000, 1000, ChSolverSparseQR)
+BM_SOLVER_CACHE(QR_cache_2000, 2000, ChSolverSparseQR)
+BM_SOLVER_CACHE(QR_cache_4000, 4000, ChSolverSparseQR)
+BM_SOLVER_CACHE(QR_cache_8000, 8000, ChSolverSparseQR)
 
 int main(int argc, char* argv[]) {
     ::benchmark::Initialize(&argc, argv);
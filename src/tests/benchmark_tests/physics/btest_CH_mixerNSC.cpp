@@ -135,6 +135,31 @@ void MixerTestNSC<N>::SimulateVis() {
 CH_BM_SIMULATION_LOOP(MixerNSC032, MixerTestNSC<32>, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
 CH_BM_SIMULATION_LOOP(MixerNSC064, MixerTestNSC<64>, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
 
+// Benchmark of the contact container storage alone.
+// After the hot start, the contacts found by the last collision detection are repeatedly loaded into the contact
+// container, alternating with an empty contact set (so that the number of contacts swings from one refill to the next),
+// and the constraint right-hand sides are evaluated over all contacts.
+template <int N>
+static void ContactRefillNSC(benchmark::State& st) {
+    MixerTestNSC<N> test;
+    test.Simulate(NUM_SKIP_STEPS);
+
+    auto coll_sys = test.GetSystem()->GetCollisionSystem();
+    auto container = test.GetSystem()->GetContactContainer();
+
+    while (st.KeepRunning()) {
+        container->BeginAddContact();
+        container->EndAddContact();
+        coll_sys->ReportContacts(container.get());
+        container->ConstraintsBiLoad_C(1.0, 0.1, true);
+    }
+
+    st.counters["Contacts"] = container->GetNumContacts();
+}
+
+BENCHMARK_TEMPLATE(ContactRefillNSC, 32)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(ContactRefillNSC, 64)->Unit(benchmark::kMicrosecond);
+
 // =============================================================================
 
 int main(int argc, char* argv[]) {
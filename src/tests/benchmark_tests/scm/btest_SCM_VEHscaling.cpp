@@ -69,6 +69,9 @@ int nthreads = 4;
 // Moving patches under each wheel
 bool wheel_patches = false;
 
+// Store SCM grid node records in dense tiles (false: hash map)
+bool tiled_grid = false;
+
 // Better conserve mass by displacing soil to the sides of a rut
 const bool bulldozing = false;
 
@@ -99,6 +102,7 @@ int main(int argc, char* argv[]) {
     end_time = cli.GetAsType<double>("end_time");
     nthreads = cli.GetAsType<int>("nthreads");
     wheel_patches = cli.GetAsType<bool>("wheel_patches");
+    tiled_grid = cli.GetAsType<bool>("tiled_grid");
 
     chrono_collsys = cli.GetAsType<bool>("csys");
 #ifndef CHRONO_COLLISION
@@ -116,6 +120,7 @@ int main(int argc, char* argv[]) {
 
     std::cout << "Collision system: " << (chrono_collsys ? "Chrono" : "Bullet") << std::endl;
     std::cout << "Num SCM threads: " << nthreads << std::endl;
+    std::cout << "SCM grid storage: " << (tiled_grid ? "tiled" : "hash map") << std::endl;
 
     // ------------------------
     // Create the Chrono system
@@ -220,6 +225,7 @@ int main(int argc, char* argv[]) {
 
     terrain.SetPlotType(vehicle::SCMTerrain::PLOT_SINKAGE, 0, 0.1);
 
+    terrain.SetGridStorage(tiled_grid ? SCMGridStorage::TILED : SCMGridStorage::HASH_MAP);
     terrain.Initialize(terrainLength, terrainWidth, delta);
 
 #ifdef CHRONO_IRRLICHT
@@ -350,6 +356,8 @@ void AddCommandLineOptions(ChCLI& cli) {
     cli.AddOption<bool>("Test", "c,csys", "Use Chrono multicore collision (false: Bullet)",
                         std ::to_string(chrono_collsys));
     cli.AddOption<bool>("Test", "w,wheel_patches", "Use patches under each wheel", std::to_string(wheel_patches));
+    cli.AddOption<bool>("Test", "g,tiled_grid", "Use tiled SCM grid storage (false: hash map)",
+                        std::to_string(tiled_grid));
     cli.AddOption<bool>("Test", "v,vis", "Enable run-time visualization", std::to_string(visualize));
 }
 
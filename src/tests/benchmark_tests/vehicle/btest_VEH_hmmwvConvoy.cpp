@@ -0,0 +1,141 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Benchmark test for multiple HMMWV vehicles in a single system, synchronized
+// and advanced in parallel through a ChWheeledVehicleWorld.
+//
+// =============================================================================
+
+#include <vector>
+
+#include "chrono/utils/ChBenchmark.h"
+#include "chrono/physics/ChSystemSMC.h"
+
+#include "chrono_vehicle/ChVehicleModelData.h"
+#include "chrono_vehicle/driver/ChPathFollowerDriver.h"
+#include "chrono_vehicle/terrain/RigidTerrain.h"
+#include "chrono_vehicle/utils/ChVehiclePath.h"
+#include "chrono_vehicle/wheeled_vehicle/ChWheeledVehicleWorld.h"
+
+#include "chrono_models/vehicle/hmmwv/HMMWV.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+using namespace chrono::vehicle::hmmwv;
+
+// =============================================================================
+
+template <int NUM_VEHICLES, int NUM_THREADS>
+class HmmwvConvoyTest : public utils::ChBenchmarkTest {
+  public:
+    HmmwvConvoyTest();
+    ~HmmwvConvoyTest();
+
+    ChSystem* GetSystem() override { return m_system; }
+    void ExecuteStep() override;
+
+  private:
+    ChSystemSMC* m_system;
+    RigidTerrain* m_terrain;
+    std::vector<HMMWV_Full*> m_hmmwvs;
+    std::vector<ChPathFollowerDriver*> m_drivers;
+    ChWheeledVehicleWorld* m_world;
+
+    double m_step;
+};
+
+template <int NUM_VEHICLES, int NUM_THREADS>
+HmmwvConvoyTest<NUM_VEHICLES, NUM_THREADS>::HmmwvConvoyTest() : m_step(2e-3) {
+    m_system = new ChSystemSMC();
+    m_system->SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+    m_system->SetGravitationalAcceleration(ChVector3d(0, 0, -9.81));
+
+    // Create the terrain
+    m_terrain = new RigidTerrain(m_system);
+    auto patch_material = chrono_types::make_shared<ChContactMaterialSMC>();
+    patch_material->SetFriction(0.9f);
+    patch_material->SetRestitution(0.01f);
+    patch_material->SetYoungModulus(2e7f);
+    m_terrain->AddPatch(patch_material, CSYSNORM, 300, 6.0 * NUM_VEHICLES + 10);
+    m_terrain->Initialize();
+
+    m_world = new ChWheeledVehicleWorld(m_system);
+    m_world->SetTerrain(m_terrain);
+    m_world->SetNumThreads(NUM_THREADS);
+
+    // Create the vehicles side by side, each following a straight line
+    for (int i = 0; i < NUM_VEHICLES; i++) {
+        double y = 6.0 * (i - 0.5 * (NUM_VEHICLES - 1));
+
+        auto hmmwv = new HMMWV_Full(m_system);
+        hmmwv->SetChassisFixed(false);
+        hmmwv->SetInitPosition(ChCoordsys<>(ChVector3d(-120, y, 0.7), QUNIT));
+        hmmwv->SetEngineType(EngineModelType::SHAFTS);
+        hmmwv->SetTransmissionType(TransmissionModelType::AUTOMATIC_SHAFTS);
+        hmmwv->SetDriveType(DrivelineTypeWV::AWD);
+        hmmwv->SetTireType(TireModelType::TMEASY);
+        hmmwv->SetTireStepSize(m_step);
+        hmmwv->Initialize();
+
+        auto path = StraightLinePath(ChVector3d(-125, y, 0.1), ChVector3d(150, y, 0.1));
+        auto driver = new ChPathFollowerDriver(hmmwv->GetVehicle(), path, "path_" + std::to_string(i), 12.0);
+        driver->GetSteeringController().SetLookAheadDistance(5.0);
+        driver->GetSteeringController().SetGains(0.8, 0, 0);
+        driver->GetSpeedController().SetGains(0.4, 0, 0);
+        driver->Initialize();
+
+        m_world->AddVehicle(&hmmwv->GetVehicle(), driver);
+        m_hmmwvs.push_back(hmmwv);
+        m_drivers.push_back(driver);
+    }
+}
+
+template <int NUM_VEHICLES, int NUM_THREADS>
+HmmwvConvoyTest<NUM_VEHICLES, NUM_THREADS>::~HmmwvConvoyTest() {
+    delete m_world;
+    for (auto driver : m_drivers)
+        delete driver;
+    for (auto hmmwv : m_hmmwvs)
+        delete hmmwv;
+    delete m_terrain;
+    delete m_system;
+}
+
+template <int NUM_VEHICLES, int NUM_THREADS>
+void HmmwvConvoyTest<NUM_VEHICLES, NUM_THREADS>::ExecuteStep() {
+    m_world->Synchronize(m_system->GetChTime());
+    m_world->Advance(m_step);
+}
+
+// =============================================================================
+
+#define NUM_SKIP_STEPS 500  // number of steps for hot start (2e-3 * 500 = 1s)
+#define NUM_SIM_STEPS 1000  // number of simulation steps for each benchmark (2e-3 * 1000 = 2s)
+#define REPEATS 5
+
+// NOTE: trick to prevent erros in expanding macros due to types that contain a comma.
+typedef HmmwvConvoyTest<8, 1> convoy8_t1_test_type;
+typedef HmmwvConvoyTest<8, 2> convoy8_t2_test_type;
+typedef HmmwvConvoyTest<8, 4> convoy8_t4_test_type;
+typedef HmmwvConvoyTest<8, 8> convoy8_t8_test_type;
+
+CH_BM_SIMULATION_ONCE(HmmwvConvoy8_T1, convoy8_t1_test_type, NUM_SKIP_STEPS, NUM_SIM_STEPS, REPEATS);
+CH_BM_SIMULATION_ONCE(HmmwvConvoy8_T2, convoy8_t2_test_type, NUM_SKIP_STEPS, NUM_SIM_STEPS, REPEATS);
+CH_BM_SIMULATION_ONCE(HmmwvConvoy8_T4, convoy8_t4_test_type, NUM_SKIP_STEPS, NUM_SIM_STEPS, REPEATS);
+CH_BM_SIMULATION_ONCE(HmmwvConvoy8_T8, convoy8_t8_test_type, NUM_SKIP_STEPS, NUM_SIM_STEPS, REPEATS);
+
+// =============================================================================
+
+int main(int argc, char* argv[]) {
+    ::benchmark::Initialize(&argc, argv);
+    ::benchmark::RunSpecifiedBenchmarks();
+}
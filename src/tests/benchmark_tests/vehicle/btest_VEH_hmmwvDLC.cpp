@@ -17,6 +17,7 @@
 // =============================================================================
 
 #include "chrono/utils/ChBenchmark.h"
+#include "chrono/collision/bullet/ChCollisionSystemBullet.h"
 
 #include "chrono_vehicle/ChVehicleModelData.h"
 #include "chrono_vehicle/driver/ChPathFollowerDriver.h"
@@ -35,7 +36,7 @@ using namespace chrono::vehicle::hmmwv;
 
 // =============================================================================
 
-template <typename EnumClass, EnumClass TIRE_MODEL>
+template <typename EnumClass, EnumClass TIRE_MODEL, bool INCREMENTAL = false>
 class HmmwvDlcTest : public utils::ChBenchmarkTest {
   public:
     HmmwvDlcTest();
@@ -58,8 +59,8 @@ class HmmwvDlcTest : public utils::ChBenchmarkTest {
     double m_step_tire;
 };
 
-template <typename EnumClass, EnumClass TIRE_MODEL>
-HmmwvDlcTest<EnumClass, TIRE_MODEL>::HmmwvDlcTest() : m_step_veh(2e-3), m_step_tire(1e-3) {
+template <typename EnumClass, EnumClass TIRE_MODEL, bool INCREMENTAL = false>
+HmmwvDlcTest<EnumClass, TIRE_MODEL, INCREMENTAL>::HmmwvDlcTest() : m_step_veh(2e-3), m_step_tire(1e-3) {
     EngineModelType engine_model = EngineModelType::SHAFTS;
     TransmissionModelType transmission_model = TransmissionModelType::AUTOMATIC_SHAFTS;
     DrivelineTypeWV drive_type = DrivelineTypeWV::AWD;
@@ -78,6 +79,12 @@ HmmwvDlcTest<EnumClass, TIRE_MODEL>::HmmwvDlcTest() : m_step_veh(2e-3), m_step_t
     m_hmmwv->SetAerodynamicDrag(0.5, 5.0, 1.2);
     m_hmmwv->Initialize();
 
+    // Optionally, only re-run the narrowphase for collision pairs involving moving models
+    if (INCREMENTAL) {
+        auto coll_sys = std::static_pointer_cast<ChCollisionSystemBullet>(m_hmmwv->GetSystem()->GetCollisionSystem());
+        coll_sys->EnableIncrementalNarrowphase(true);
+    }
+
     m_hmmwv->SetChassisVisualizationType(VisualizationType::PRIMITIVES);
     m_hmmwv->SetSuspensionVisualizationType(VisualizationType::PRIMITIVES);
     m_hmmwv->SetSteeringVisualizationType(VisualizationType::PRIMITIVES);
@@ -104,15 +111,15 @@ HmmwvDlcTest<EnumClass, TIRE_MODEL>::HmmwvDlcTest() : m_step_veh(2e-3), m_step_t
     m_driver->Initialize();
 }
 
-template <typename EnumClass, EnumClass TIRE_MODEL>
-HmmwvDlcTest<EnumClass, TIRE_MODEL>::~HmmwvDlcTest() {
+template <typename EnumClass, EnumClass TIRE_MODEL, bool INCREMENTAL = false>
+HmmwvDlcTest<EnumClass, TIRE_MODEL, INCREMENTAL>::~HmmwvDlcTest() {
     delete m_hmmwv;
     delete m_terrain;
     delete m_driver;
 }
 
-template <typename EnumClass, EnumClass TIRE_MODEL>
-void HmmwvDlcTest<EnumClass, TIRE_MODEL>::ExecuteStep() {
+template <typename EnumClass, EnumClass TIRE_MODEL, bool INCREMENTAL = false>
+void HmmwvDlcTest<EnumClass, TIRE_MODEL, INCREMENTAL>::ExecuteStep() {
     double time = m_hmmwv->GetSystem()->GetChTime();
 
     // Driver inputs
@@ -129,8 +136,8 @@ void HmmwvDlcTest<EnumClass, TIRE_MODEL>::ExecuteStep() {
     m_hmmwv->Advance(m_step_veh);
 }
 
-template <typename EnumClass, EnumClass TIRE_MODEL>
-void HmmwvDlcTest<EnumClass, TIRE_MODEL>::SimulateVis() {
+template <typename EnumClass, EnumClass TIRE_MODEL, bool INCREMENTAL = false>
+void HmmwvDlcTest<EnumClass, TIRE_MODEL, INCREMENTAL>::SimulateVis() {
 #ifdef CHRONO_IRRLICHT
     auto vis = chrono_types::make_shared<ChWheeledVehicleVisualSystemIrrlicht>();
     vis->AttachVehicle(&m_hmmwv->GetVehicle());
@@ -177,11 +184,15 @@ typedef HmmwvDlcTest<TireModelType, TireModelType::TMEASY> tmeasy_test_type;
 typedef HmmwvDlcTest<TireModelType, TireModelType::FIALA> fiala_test_type;
 typedef HmmwvDlcTest<TireModelType, TireModelType::RIGID> rigid_test_type;
 typedef HmmwvDlcTest<TireModelType, TireModelType::RIGID_MESH> rigidmesh_test_type;
+typedef HmmwvDlcTest<TireModelType, TireModelType::RIGID, true> rigid_incr_test_type;
+typedef HmmwvDlcTest<TireModelType, TireModelType::RIGID_MESH, true> rigidmesh_incr_test_type;
 
 CH_BM_SIMULATION_ONCE(HmmwvDLC_TMEASY, tmeasy_test_type, NUM_SKIP_STEPS, NUM_SIM_STEPS, REPEATS);
 CH_BM_SIMULATION_ONCE(HmmwvDLC_FIALA, fiala_test_type, NUM_SKIP_STEPS, NUM_SIM_STEPS, REPEATS);
 CH_BM_SIMULATION_ONCE(HmmwvDLC_RIGID, rigid_test_type, NUM_SKIP_STEPS, NUM_SIM_STEPS, REPEATS);
 CH_BM_SIMULATION_ONCE(HmmwvDLC_RIGIDMESH, rigidmesh_test_type, NUM_SKIP_STEPS, NUM_SIM_STEPS, REPEATS);
+CH_BM_SIMULATION_ONCE(HmmwvDLC_RIGID_INCR, rigid_incr_test_type, NUM_SKIP_STEPS, NUM_SIM_STEPS, REPEATS);
+CH_BM_SIMULATION_ONCE(HmmwvDLC_RIGIDMESH_INCR, rigidmesh_incr_test_type, NUM_SKIP_STEPS, NUM_SIM_STEPS, REPEATS);
 
 // =============================================================================
 
@@ -13,9 +13,19 @@
 // =============================================================================
 //
 // Benchmark test for M113 acceleration test.
+// Each track shoe type is tested with wheel-shoe collisions processed either by
+// the underlying collision system or analytically (see
+// ChTrackedVehicle::EnableAnalyticWheelContact). Before running the benchmarks,
+// the chassis trajectory and speed obtained with the two approaches are compared.
 //
 // =============================================================================
 
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
 #include "chrono/ChConfig.h"
 #include "chrono/physics/ChSystemNSC.h"
 #include "chrono/solver/ChSolverPSOR.h"
@@ -38,7 +48,7 @@ using namespace chrono::vehicle::m113;
 
 // =============================================================================
 
-template <typename EnumClass, EnumClass SHOE_TYPE>
+template <typename EnumClass, EnumClass SHOE_TYPE, bool ANALYTIC_CONTACT>
 class M113AccTest : public utils::ChBenchmarkTest {
   public:
     M113AccTest();
@@ -47,6 +57,8 @@ class M113AccTest : public utils::ChBenchmarkTest {
     ChSystem* GetSystem() override { return m_m113->GetSystem(); }
     void ExecuteStep() override;
 
+    ChTrackedVehicle& GetVehicle() const { return m_m113->GetVehicle(); }
+
     void SimulateVis();
 
   private:
@@ -60,8 +72,8 @@ class M113AccTest : public utils::ChBenchmarkTest {
     double m_step;
 };
 
-template <typename EnumClass, EnumClass SHOE_TYPE>
-M113AccTest<EnumClass, SHOE_TYPE>::M113AccTest() : m_step(1e-3) {
+template <typename EnumClass, EnumClass SHOE_TYPE, bool ANALYTIC_CONTACT>
+M113AccTest<EnumClass, SHOE_TYPE, ANALYTIC_CONTACT>::M113AccTest() : m_step(1e-3) {
     DrivelineTypeTV driveline_type = DrivelineTypeTV::SIMPLE;
     BrakeType brake_type = BrakeType::SIMPLE;
     ChContactMethod contact_method = ChContactMethod::NSC;
@@ -84,6 +96,9 @@ M113AccTest<EnumClass, SHOE_TYPE>::M113AccTest() : m_step(1e-3) {
     m_m113->SetInitPosition(ChCoordsys<>(ChVector3d(-250 + 5, 0, 1.1), ChQuaternion<>(1, 0, 0, 0)));
     m_m113->Initialize();
 
+    if (m_m113->GetVehicle().EnableAnalyticWheelContact(ANALYTIC_CONTACT) != ANALYTIC_CONTACT)
+        throw std::runtime_error("Analytic wheel-shoe contact could not be enabled");
+
     m_m113->SetChassisVisualizationType(VisualizationType::NONE);
     m_m113->SetSprocketVisualizationType(VisualizationType::PRIMITIVES);
     m_m113->SetIdlerVisualizationType(VisualizationType::PRIMITIVES);
@@ -127,15 +142,15 @@ M113AccTest<EnumClass, SHOE_TYPE>::M113AccTest() : m_step(1e-3) {
     m_shoeR.resize(m_m113->GetVehicle().GetNumTrackShoes(RIGHT));
 }
 
-template <typename EnumClass, EnumClass SHOE_TYPE>
-M113AccTest<EnumClass, SHOE_TYPE>::~M113AccTest() {
+template <typename EnumClass, EnumClass SHOE_TYPE, bool ANALYTIC_CONTACT>
+M113AccTest<EnumClass, SHOE_TYPE, ANALYTIC_CONTACT>::~M113AccTest() {
     delete m_m113;
     delete m_terrain;
     delete m_driver;
 }
 
-template <typename EnumClass, EnumClass SHOE_TYPE>
-void M113AccTest<EnumClass, SHOE_TYPE>::ExecuteStep() {
+template <typename EnumClass, EnumClass SHOE_TYPE, bool ANALYTIC_CONTACT>
+void M113AccTest<EnumClass, SHOE_TYPE, ANALYTIC_CONTACT>::ExecuteStep() {
     double time = m_m113->GetVehicle().GetChTime();
 
     if (time < 0.5) {
@@ -158,8 +173,8 @@ void M113AccTest<EnumClass, SHOE_TYPE>::ExecuteStep() {
     m_m113->Advance(m_step);
 }
 
-template <typename EnumClass, EnumClass SHOE_TYPE>
-void M113AccTest<EnumClass, SHOE_TYPE>::SimulateVis() {
+template <typename EnumClass, EnumClass SHOE_TYPE, bool ANALYTIC_CONTACT>
+void M113AccTest<EnumClass, SHOE_TYPE, ANALYTIC_CONTACT>::SimulateVis() {
 #ifdef CHRONO_IRRLICHT
     auto vis = chrono_types::make_shared<ChTrackedVehicleVisualSystemIrrlicht>();
     vis->AttachVehicle(&m_m113->GetVehicle());
@@ -188,11 +203,47 @@ void M113AccTest<EnumClass, SHOE_TYPE>::SimulateVis() {
 #define REPEATS 10
 
 // NOTE: trick to prevent erros in expanding macros due to types that contain a comma.
-typedef M113AccTest<TrackShoeType, TrackShoeType::SINGLE_PIN> sp_test_type;
-typedef M113AccTest<TrackShoeType, TrackShoeType::DOUBLE_PIN> dp_test_type;
+typedef M113AccTest<TrackShoeType, TrackShoeType::SINGLE_PIN, false> sp_test_type;
+typedef M113AccTest<TrackShoeType, TrackShoeType::DOUBLE_PIN, false> dp_test_type;
+typedef M113AccTest<TrackShoeType, TrackShoeType::SINGLE_PIN, true> sp_analytic_test_type;
+typedef M113AccTest<TrackShoeType, TrackShoeType::DOUBLE_PIN, true> dp_analytic_test_type;
 
 CH_BM_SIMULATION_LOOP(M113Acc_SP, sp_test_type, NUM_SKIP_STEPS, NUM_SIM_STEPS, REPEATS);
 CH_BM_SIMULATION_LOOP(M113Acc_DP, dp_test_type, NUM_SKIP_STEPS, NUM_SIM_STEPS, REPEATS);
+CH_BM_SIMULATION_LOOP(M113Acc_SP_analytic, sp_analytic_test_type, NUM_SKIP_STEPS, NUM_SIM_STEPS, REPEATS);
+CH_BM_SIMULATION_LOOP(M113Acc_DP_analytic, dp_analytic_test_type, NUM_SKIP_STEPS, NUM_SIM_STEPS, REPEATS);
+
+// =============================================================================
+
+// Tolerances for the differences in chassis position (m) and speed (m/s) between the two wheel-shoe contact approaches.
+// Results are not identical, since the collision system may generate several contacts for a wheel-shoe pair.
+#define POS_TOLERANCE 0.05
+#define SPEED_TOLERANCE 0.1
+
+// Simulate the acceleration test with wheel-shoe contact from the underlying collision system and from the analytic
+// contact generator, over as many steps as a benchmark run, and compare the chassis trajectories and speeds.
+template <typename EnumClass, EnumClass SHOE_TYPE>
+bool CheckAnalyticContact(const std::string& name) {
+    M113AccTest<EnumClass, SHOE_TYPE, false> test;
+    M113AccTest<EnumClass, SHOE_TYPE, true> test_analytic;
+
+    double max_pos_diff = 0;
+    double max_speed_diff = 0;
+    for (int i = 0; i < NUM_SKIP_STEPS + NUM_SIM_STEPS; i++) {
+        test.ExecuteStep();
+        test_analytic.ExecuteStep();
+        const auto& vehicle = test.GetVehicle();
+        const auto& vehicle_analytic = test_analytic.GetVehicle();
+        max_pos_diff = std::max(max_pos_diff, (vehicle.GetPos() - vehicle_analytic.GetPos()).Length());
+        max_speed_diff = std::max(max_speed_diff, std::abs(vehicle.GetSpeed() - vehicle_analytic.GetSpeed()));
+    }
+
+    bool passed = max_pos_diff <= POS_TOLERANCE && max_speed_diff <= SPEED_TOLERANCE;
+    std::cout << name << ": final speed " << test.GetVehicle().GetSpeed() << " m/s, analytic contact max differences "
+              << max_pos_diff << " m (position), " << max_speed_diff << " m/s (speed)"
+              << (passed ? "" : " -- FAILED") << std::endl;
+    return passed;
+}
 
 // =============================================================================
 
@@ -201,12 +252,17 @@ int main(int argc, char* argv[]) {
 
 #ifdef CHRONO_IRRLICHT
     if (::benchmark::ReportUnrecognizedArguments(argc, argv)) {
-        M113AccTest<TrackShoeType, TrackShoeType::SINGLE_PIN> test;
-        ////M113AccTest<TrackShoeType, TrackShoeType::DOUBLE_PIN> test;
+        M113AccTest<TrackShoeType, TrackShoeType::SINGLE_PIN, false> test;
+        ////M113AccTest<TrackShoeType, TrackShoeType::DOUBLE_PIN, false> test;
         test.SimulateVis();
         return 0;
     }
 #endif
 
+    bool passed = CheckAnalyticContact<TrackShoeType, TrackShoeType::SINGLE_PIN>("M113Acc_SP");
+    passed &= CheckAnalyticContact<TrackShoeType, TrackShoeType::DOUBLE_PIN>("M113Acc_DP");
+    if (!passed)
+        return 1;
+
     ::benchmark::RunSpecifiedBenchmarks();
 }
@@ -0,0 +1,107 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for the adaptive two-level broadphase grid of the multicore
+// collision system. On a scene with many small spheres and a few large boxes,
+// the candidate pairs found with GridType::ADAPTIVE must be identical to those
+// found with the fixed grid types, over several steps with moving shapes.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <utility>
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/collision/multicore/ChCollisionSystemMulticore.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+typedef std::vector<std::pair<int, int>> PairList;
+
+// Create the mixed-size scene, run the collision detection over several steps (moving the small shapes between
+// steps), and return the sorted list of broadphase candidate pairs at each step.
+static std::vector<PairList> CollectPairs(std::function<void(ChCollisionSystemMulticore&)> setup) {
+    const int num_spheres = 500;
+    const int num_steps = 5;
+
+    ChSystemNSC sys;
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::MULTICORE);
+    auto coll_sys = std::static_pointer_cast<ChCollisionSystemMulticore>(sys.GetCollisionSystem());
+    setup(*coll_sys);
+
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+
+    // A few large shapes: floor, wall, and a big box overlapping the granular material
+    auto floor = chrono_types::make_shared<ChBodyEasyBox>(6.0, 0.2, 6.0, 1000, false, true, mat);
+    floor->SetPos(ChVector3d(0, -0.1, 0));
+    sys.AddBody(floor);
+
+    auto wall = chrono_types::make_shared<ChBodyEasyBox>(0.2, 3.0, 6.0, 1000, false, true, mat);
+    wall->SetPos(ChVector3d(-1.1, 1.5, 0));
+    sys.AddBody(wall);
+
+    auto block = chrono_types::make_shared<ChBodyEasyBox>(1.0, 1.0, 1.0, 1000, false, true, mat);
+    block->SetPos(ChVector3d(0.5, 0.8, 0.3));
+    block->SetRot(QuatFromAngleY(0.4));
+    sys.AddBody(block);
+
+    // Many small spheres of slightly different sizes
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<double> pos(-1.0, 1.0);
+    std::uniform_real_distribution<double> rad(0.03, 0.06);
+    std::vector<std::shared_ptr<ChBody>> spheres;
+    for (int i = 0; i < num_spheres; i++) {
+        auto sphere = chrono_types::make_shared<ChBodyEasySphere>(rad(gen), 1000, false, true, mat);
+        sphere->SetPos(ChVector3d(pos(gen), 1.0 + pos(gen), pos(gen)));
+        sys.AddBody(sphere);
+        spheres.push_back(sphere);
+    }
+
+    std::uniform_real_distribution<double> disp(-0.02, 0.02);
+    std::vector<PairList> pairs(num_steps);
+    for (int step = 0; step < num_steps; step++) {
+        sys.Setup();
+        sys.Update();
+        sys.ComputeCollisions();
+
+        for (const auto& p : coll_sys->GetOverlappingPairs())
+            pairs[step].push_back(std::make_pair(std::min(p.x, p.y), std::max(p.x, p.y)));
+        std::sort(pairs[step].begin(), pairs[step].end());
+
+        for (auto& sphere : spheres)
+            sphere->SetPos(sphere->GetPos() + ChVector3d(disp(gen), disp(gen), disp(gen)));
+    }
+
+    return pairs;
+}
+
+TEST(ChBroadphase, adaptive) {
+    auto adaptive = CollectPairs([](ChCollisionSystemMulticore& cs) { cs.SetBroadphaseGridAdaptive(4); });
+    auto resolution =
+        CollectPairs([](ChCollisionSystemMulticore& cs) { cs.SetBroadphaseGridResolution(ChVector3i(10, 10, 10)); });
+    auto bin_size =
+        CollectPairs([](ChCollisionSystemMulticore& cs) { cs.SetBroadphaseGridSize(ChVector3d(0.2, 0.2, 0.2)); });
+    auto density = CollectPairs([](ChCollisionSystemMulticore& cs) { cs.SetBroadphaseGridDensity(5); });
+
+    for (size_t step = 0; step < adaptive.size(); step++) {
+        // Check that the scene produces pairs among the small shapes and with the large shapes
+        ASSERT_GT(adaptive[step].size(), 500);
+        ASSERT_EQ(adaptive[step], resolution[step]) << "step " << step;
+        ASSERT_EQ(adaptive[step], bin_size[step]) << "step " << step;
+        ASSERT_EQ(adaptive[step], density[step]) << "step " << step;
+    }
+}
@@ -0,0 +1,165 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for the incremental narrowphase of the Bullet collision system.
+// Bodies resting on a floor, some of them moved kinematically by small and
+// large amounts, must produce the same set of contacts with the incremental
+// narrowphase enabled and disabled, over several steps.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <tuple>
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/collision/bullet/ChCollisionSystemBullet.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+// Contact between the bodies with tags a < b
+struct ContactInfo {
+    int a;
+    int b;
+    double distance;
+    ChVector3d pA;
+    ChVector3d pB;
+    bool operator<(const ContactInfo& other) const {
+        return std::make_tuple(a, b, pA.x(), pA.y(), pA.z()) <
+               std::make_tuple(other.a, other.b, other.pA.x(), other.pA.y(), other.pA.z());
+    }
+};
+
+class ContactCollector : public ChContactContainer::ReportContactCallback {
+  public:
+    virtual bool OnReportContact(const ChVector3d& pA,
+                                 const ChVector3d& pB,
+                                 const ChMatrix33<>& plane_coord,
+                                 const double& distance,
+                                 const double& eff_radius,
+                                 const ChVector3d& react_forces,
+                                 const ChVector3d& react_torques,
+                                 ChContactable* contactobjA,
+                                 ChContactable* contactobjB) override {
+        int a = dynamic_cast<ChBody*>(contactobjA)->GetTag();
+        int b = dynamic_cast<ChBody*>(contactobjB)->GetTag();
+        if (a < b)
+            contacts.push_back({a, b, distance, pA, pB});
+        else
+            contacts.push_back({b, a, distance, pB, pA});
+        return true;
+    }
+
+    std::vector<ContactInfo> contacts;
+};
+
+// Create the test scene, move bodies kinematically over several steps, and return the sorted contacts at each step.
+// Also return the smallest number of collision models flagged as moving over all steps.
+static std::vector<std::vector<ContactInfo>> CollectContacts(bool incremental, int& min_moving) {
+    const int num_steps = 20;
+
+    ChSystemNSC sys;
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+    auto coll_sys = std::static_pointer_cast<ChCollisionSystemBullet>(sys.GetCollisionSystem());
+    coll_sys->EnableIncrementalNarrowphase(incremental);
+
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+    int tag = 0;
+
+    auto floor = chrono_types::make_shared<ChBodyEasyBox>(4.0, 0.2, 4.0, 1000, false, true, mat);
+    floor->SetPos(ChVector3d(0, -0.1, 0));
+    floor->SetFixed(true);
+    floor->SetTag(tag++);
+    sys.AddBody(floor);
+
+    // Static bodies resting on the floor (a box and a row of spheres)
+    auto box = chrono_types::make_shared<ChBodyEasyBox>(0.4, 0.2, 0.4, 1000, false, true, mat);
+    box->SetPos(ChVector3d(-1.0, 0.1 + 0.005, -1.0));
+    box->SetTag(tag++);
+    sys.AddBody(box);
+
+    for (int i = 0; i < 5; i++) {
+        auto sphere = chrono_types::make_shared<ChBodyEasySphere>(0.1, 1000, false, true, mat);
+        sphere->SetPos(ChVector3d(-1.0 + 0.4 * i, 0.1 + 0.005, 1.0));
+        sphere->SetTag(tag++);
+        sys.AddBody(sphere);
+    }
+
+    // Spheres moved kinematically: slow sliding (below the motion threshold for a few steps at a time), fast
+    // sliding, slow vertical drift, and one approaching a static sphere (creating a new pair after 15 steps)
+    std::vector<std::shared_ptr<ChBody>> movers;
+    std::vector<ChVector3d> velocities = {ChVector3d(0.002, 0, 0), ChVector3d(0, 0, 0.03), ChVector3d(0, 0.001, 0),
+                                          ChVector3d(-0.006, 0, 0)};
+    std::vector<ChVector3d> positions = {ChVector3d(0.5, 0.105, -0.5), ChVector3d(1.2, 0.105, -1.5),
+                                         ChVector3d(-0.5, 0.1 - 0.004, 0), ChVector3d(0.95, 0.105, 1.0)};
+    for (size_t i = 0; i < velocities.size(); i++) {
+        auto sphere = chrono_types::make_shared<ChBodyEasySphere>(0.1, 1000, false, true, mat);
+        sphere->SetPos(positions[i]);
+        sphere->SetTag(tag++);
+        sys.AddBody(sphere);
+        movers.push_back(sphere);
+    }
+
+    sys.Setup();
+    sys.Update();
+
+    auto collector = chrono_types::make_shared<ContactCollector>();
+    std::vector<std::vector<ContactInfo>> contacts(num_steps);
+    min_moving = tag;
+    for (int step = 0; step < num_steps; step++) {
+        for (size_t i = 0; i < movers.size(); i++)
+            movers[i]->SetPos(positions[i] + velocities[i] * step);
+        sys.Update();
+        sys.ComputeCollisions();
+
+        collector->contacts.clear();
+        sys.GetContactContainer()->ReportAllContacts(collector);
+        contacts[step] = collector->contacts;
+        std::sort(contacts[step].begin(), contacts[step].end());
+
+        if (step > 0)
+            min_moving = std::min(min_moving, coll_sys->GetNumMovingModels());
+    }
+
+    return contacts;
+}
+
+TEST(BulletCollision, IncrementalNarrowphase) {
+    int min_moving_ref;
+    int min_moving;
+    auto ref = CollectContacts(false, min_moving_ref);
+    auto inc = CollectContacts(true, min_moving);
+
+    // Check that the incremental narrowphase skipped the static models
+    ASSERT_LT(min_moving, 6);
+
+    // Contact points cached for models that did not move are refreshed with the model motion; on the other body, they
+    // may lag the points of a new narrowphase by at most half the envelope. Distances along the normal are exact for
+    // the shapes and motions in this test.
+    double tol = 0.5 * ChCollisionModel::GetDefaultSuggestedEnvelope();
+
+    for (size_t step = 0; step < ref.size(); step++) {
+        ASSERT_GT(ref[step].size(), 0);
+        ASSERT_EQ(ref[step].size(), inc[step].size()) << "step " << step;
+        for (size_t i = 0; i < ref[step].size(); i++) {
+            const auto& r = ref[step][i];
+            const auto& c = inc[step][i];
+            ASSERT_EQ(r.a, c.a) << "step " << step;
+            ASSERT_EQ(r.b, c.b) << "step " << step;
+            ASSERT_NEAR(r.distance, c.distance, 1e-6) << "step " << step;
+            ASSERT_NEAR((r.pA - c.pA).Length(), 0.0, tol) << "step " << step;
+            ASSERT_NEAR((r.pB - c.pB).Length(), 0.0, tol) << "step " << step;
+        }
+    }
+}
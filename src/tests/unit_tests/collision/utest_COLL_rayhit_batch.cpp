@@ -0,0 +1,73 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for batched ray-hit queries.
+// A grid of vertical rays is cast over a set of boxes and spheres; results of
+// RayHitBatch must match those of individual RayHit calls.
+//
+// =============================================================================
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+TEST(RayHitBatch, bullet) {
+    ChSystemNSC sys;
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+    for (int i = 0; i < 4; i++) {
+        auto box = chrono_types::make_shared<ChBodyEasyBox>(0.8, 0.5, 0.6, 1000, false, true, mat);
+        box->SetPos(ChVector3d(-1.5 + i, 0.2 * i, 0.5));
+        box->SetRot(QuatFromAngleY(0.3 * i));
+        sys.AddBody(box);
+
+        auto sphere = chrono_types::make_shared<ChBodyEasySphere>(0.3, 1000, false, true, mat);
+        sphere->SetPos(ChVector3d(-1.5 + i, 0.5, -0.8));
+        sys.AddBody(sphere);
+    }
+
+    sys.Setup();
+    sys.Update();
+    sys.ComputeCollisions();
+
+    std::vector<ChCollisionSystem::ChRay> rays;
+    for (int i = 0; i <= 60; i++) {
+        for (int k = 0; k <= 40; k++) {
+            ChVector3d from(-2.5 + 0.08 * i, -2.0, -1.6 + 0.08 * k);
+            rays.push_back({from, from + ChVector3d(0, 4, 0)});
+        }
+    }
+
+    auto coll_sys = sys.GetCollisionSystem();
+
+    std::vector<ChCollisionSystem::ChRayhitResult> results;
+    coll_sys->RayHitBatch(rays, results, 2);
+    ASSERT_EQ(results.size(), rays.size());
+
+    int num_hits = 0;
+    for (size_t i = 0; i < rays.size(); i++) {
+        ChCollisionSystem::ChRayhitResult ref;
+        coll_sys->RayHit(rays[i].from, rays[i].to, ref);
+        ASSERT_EQ(ref.hit, results[i].hit);
+        if (!ref.hit)
+            continue;
+        num_hits++;
+        ASSERT_EQ(ref.hitModel, results[i].hitModel);
+        ASSERT_NEAR(ref.dist_factor, results[i].dist_factor, 1e-6);
+        ASSERT_NEAR((ref.abs_hitPoint - results[i].abs_hitPoint).Length(), 0.0, 1e-5);
+    }
+    ASSERT_GT(num_hits, 0);
+}
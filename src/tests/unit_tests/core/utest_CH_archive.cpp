@@ -20,6 +20,7 @@
 
 #include "gtest/gtest.h"
 
+#include <sstream>
 #include <typeinfo>
 
 #include "chrono/serialization/ChArchive.h"
@@ -575,3 +576,112 @@ TEST(ChArchiveJSON, ChVectorDynamicTest) {
     ASSERT_DOUBLE_EQ(myVect_before.y(), myVect.y());
     ASSERT_DOUBLE_EQ(myVect_before.z(), myVect.z());
 }
+
+// Binary archives writing and reading all arrays element by element (as in older versions)
+class ChArchiveOutBinaryElementwise : public ChArchiveOutBinary {
+  public:
+    ChArchiveOutBinaryElementwise(std::ostream& stream_out) : ChArchiveOutBinary(stream_out) {}
+    virtual bool out_array_raw(ChValue&, const void*, size_t, size_t, size_t, bool) override { return false; }
+};
+
+class ChArchiveInBinaryElementwise : public ChArchiveInBinary {
+  public:
+    ChArchiveInBinaryElementwise(std::istream& stream_in) : ChArchiveInBinary(stream_in) {}
+    virtual bool in_array_raw(const std::string&, void*, size_t, size_t, size_t, bool) override { return false; }
+};
+
+struct ArraysTest {
+    ChVectorDynamic<> vec;
+    ChMatrixDynamic<> mat;
+    std::vector<double> dvec;
+    std::vector<int> ivec;
+    std::vector<bool> bvec;
+    std::vector<ChVector3d> points;
+    std::vector<ChQuaterniond> rots;
+    double arr[4];
+
+    void Fill() {
+        vec.resize(1000);
+        mat.resize(7, 5);
+        for (int i = 0; i < 1000; i++) {
+            vec[i] = 0.5 * i;
+            dvec.push_back(-0.25 * i);
+            ivec.push_back(3 * i);
+            bvec.push_back(i % 3 == 0);
+            points.push_back(ChVector3d(i, 2 * i, 3 * i));
+            rots.push_back(ChQuaterniond(1, 0.1 * i, 0.2 * i, 0.3 * i));
+        }
+        for (int i = 0; i < 7; i++)
+            for (int j = 0; j < 5; j++)
+                mat(i, j) = 10 * i + j;
+        for (int i = 0; i < 4; i++)
+            arr[i] = 1.5 * i;
+    }
+
+    void Write(ChArchiveOut& archive_out) {
+        archive_out << CHNVP(vec) << CHNVP(mat) << CHNVP(dvec) << CHNVP(ivec) << CHNVP(bvec) << CHNVP(points)
+                    << CHNVP(rots) << CHNVP(arr);
+    }
+
+    void Read(ChArchiveIn& archive_in) {
+        archive_in >> CHNVP(vec) >> CHNVP(mat) >> CHNVP(dvec) >> CHNVP(ivec) >> CHNVP(bvec) >> CHNVP(points) >>
+            CHNVP(rots) >> CHNVP(arr);
+    }
+
+    void Check(const ArraysTest& other) {
+        ASSERT_TRUE(vec == other.vec);
+        ASSERT_TRUE(mat == other.mat);
+        ASSERT_TRUE(dvec == other.dvec);
+        ASSERT_TRUE(ivec == other.ivec);
+        ASSERT_TRUE(bvec == other.bvec);
+        ASSERT_TRUE(points == other.points);
+        ASSERT_TRUE(rots == other.rots);
+        for (int i = 0; i < 4; i++)
+            ASSERT_EQ(arr[i], other.arr[i]);
+    }
+};
+
+TEST(ChArchiveBinary, RawArrays) {
+    ArraysTest ref;
+    ref.Fill();
+
+    // Raw blocks, read back with raw blocks
+    {
+        std::stringstream stream;
+        ChArchiveOutBinary archive_out(stream);
+        ref.Write(archive_out);
+        ChArchiveInBinary archive_in(stream);
+        ArraysTest res;
+        res.Read(archive_in);
+        res.Check(ref);
+    }
+
+    // Element-wise arrays (older format), read back with raw blocks
+    {
+        std::stringstream stream;
+        ChArchiveOutBinaryElementwise archive_out(stream);
+        ref.Write(archive_out);
+        ChArchiveInBinary archive_in(stream);
+        ArraysTest res;
+        res.Read(archive_in);
+        res.Check(ref);
+    }
+
+    // Arrays of scalars are identical in both formats
+    {
+        std::stringstream stream1;
+        ChArchiveOutBinary archive_out1(stream1);
+        archive_out1 << CHNVP(ref.vec) << CHNVP(ref.dvec) << CHNVP(ref.ivec);
+        std::stringstream stream2;
+        ChArchiveOutBinaryElementwise archive_out2(stream2);
+        archive_out2 << CHNVP(ref.vec) << CHNVP(ref.dvec) << CHNVP(ref.ivec);
+        ASSERT_TRUE(stream1.str() == stream2.str());
+
+        ChArchiveInBinaryElementwise archive_in(stream1);
+        ArraysTest res;
+        archive_in >> CHNVP(res.vec) >> CHNVP(res.dvec) >> CHNVP(res.ivec);
+        ASSERT_TRUE(res.vec == ref.vec);
+        ASSERT_TRUE(res.dvec == ref.dvec);
+        ASSERT_TRUE(res.ivec == ref.ivec);
+    }
+}
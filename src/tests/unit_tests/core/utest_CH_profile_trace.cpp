@@ -0,0 +1,101 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Test of the trace profiler: zones recorded concurrently from several threads
+// must all be collected and exported in the Chrome trace event format.
+//
+// =============================================================================
+
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "chrono/utils/ChProfiler.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::utils;
+
+static size_t CountOccurrences(const std::string& str, const std::string& sub) {
+    size_t count = 0;
+    for (size_t pos = str.find(sub); pos != std::string::npos; pos = str.find(sub, pos + sub.size()))
+        count++;
+    return count;
+}
+
+TEST(ChProfileTrace, zones) {
+    const int num_threads = 4;
+    const int num_zones = 100;
+
+    // No zones recorded while disabled
+    ChProfileTrace::Enable(false);
+    ChProfileTrace::Reset();
+    {
+        CH_PROFILE_ZONE("disabled");
+    }
+    ASSERT_EQ(ChProfileTrace::GetNumZones(), 0);
+
+    // Record nested zones from multiple threads
+    ChProfileTrace::Enable(true);
+#pragma omp parallel for num_threads(num_threads)
+    for (int i = 0; i < num_zones; i++) {
+        CH_PROFILE_ZONE("outer");
+        {
+            CH_PROFILE_ZONE("inner \"quoted\"");
+        }
+    }
+    ChProfileTrace::Enable(false);
+    ASSERT_EQ(ChProfileTrace::GetNumZones(), 2 * num_zones);
+
+    // Export trace and check its content
+    std::string filename = "profile_trace.json";
+    ASSERT_TRUE(ChProfileTrace::WriteChromeTrace(filename));
+
+    std::ifstream file(filename);
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    std::string trace = buffer.str();
+
+    ASSERT_EQ(trace.find("{\"displayTimeUnit\":\"ms\",\"traceEvents\":["), 0);
+    ASSERT_EQ(CountOccurrences(trace, "\"ph\":\"X\""), 2 * num_zones);
+    ASSERT_EQ(CountOccurrences(trace, "\"name\":\"outer\""), num_zones);
+    ASSERT_EQ(CountOccurrences(trace, "\"name\":\"inner \\\"quoted\\\"\""), num_zones);
+
+    ChProfileTrace::Reset();
+    ASSERT_EQ(ChProfileTrace::GetNumZones(), 0);
+}
+
+TEST(ChProfileTrace, write_while_recording) {
+    const int num_threads = 4;
+    const int num_zones = 2000;
+
+    // Export the trace from one thread while the other threads keep recording zones
+    ChProfileTrace::Reset();
+    ChProfileTrace::Enable(true);
+    bool written = true;
+#pragma omp parallel for num_threads(num_threads)
+    for (int i = 0; i < num_zones; i++) {
+        CH_PROFILE_ZONE("zone");
+        if (i % 500 == 0) {
+            bool ok = ChProfileTrace::WriteChromeTrace("profile_trace_partial.json");
+#pragma omp critical
+            written = written && ok;
+        }
+    }
+    ChProfileTrace::Enable(false);
+
+    ASSERT_TRUE(written);
+    ASSERT_EQ(ChProfileTrace::GetNumZones(), num_zones);
+
+    ChProfileTrace::Reset();
+}
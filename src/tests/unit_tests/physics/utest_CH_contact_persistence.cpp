@@ -0,0 +1,87 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Test of contact persistence in the NSC contact container.
+// A box resting on the ground is simulated with contact persistence enabled;
+// once the box has settled, all contacts must be matched with contacts from the
+// previous step. With a small, fixed number of solver iterations, the box must
+// sink into the ground much less than without persistence (when all contact
+// reactions start from zero). The reaction caches of the Bullet persistent
+// manifolds are disabled in both runs, as they would also warm-start the contacts
+// kept in these manifolds.
+//
+// =============================================================================
+
+#include <cmath>
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChContactContainerNSC.h"
+#include "chrono/solver/ChIterativeSolverVI.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+// Discard the reaction caches of the Bullet persistent manifolds
+class NoReactionCache : public ChCollisionSystem::NarrowphaseCallback {
+  public:
+    virtual bool OnNarrowphase(ChCollisionInfo& contactinfo) override {
+        contactinfo.reaction_cache = nullptr;
+        return true;
+    }
+};
+
+struct Results {
+    double match_rate;  // fraction of contacts matched at the last step
+    double sinkage;     // penetration of the box into the ground at the last step
+};
+
+static Results Simulate(bool persistence) {
+    ChSystemNSC sys;
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+    sys.GetCollisionSystem()->RegisterNarrowphaseCallback(chrono_types::make_shared<NoReactionCache>());
+    sys.SetGravitationalAcceleration(ChVector3d(0, -9.81, 0));
+    sys.SetSolverType(ChSolver::Type::PSOR);
+    sys.GetSolver()->AsIterative()->SetMaxIterations(5);
+    sys.GetSolver()->AsIterative()->SetTolerance(0);
+    sys.GetSolver()->AsIterative()->EnableWarmStart(true);
+    std::static_pointer_cast<ChContactContainerNSC>(sys.GetContactContainer())->EnableContactPersistence(persistence);
+
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+    mat->SetFriction(0.4f);
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(10, 1, 10, 1000, true, true, mat);
+    ground->SetPos(ChVector3d(0, -0.5, 0));
+    ground->SetFixed(true);
+    sys.AddBody(ground);
+
+    auto box = chrono_types::make_shared<ChBodyEasyBox>(0.5, 0.5, 0.5, 1000, true, true, mat);
+    box->SetPos(ChVector3d(0, 0.25, 0));
+    sys.AddBody(box);
+
+    for (int i = 0; i < 200; i++)
+        sys.DoStepDynamics(2e-3);
+
+    EXPECT_GT(sys.GetNumContacts(), 0u);
+    return {sys.GetContactMatchRate(), 0.25 - box->GetPos().y()};
+}
+
+TEST(ContactPersistenceTest, match_rate) {
+    auto cold = Simulate(false);
+    auto warm = Simulate(true);
+    std::cout << "Box sinkage:  cold start " << cold.sinkage << "  warm start " << warm.sinkage << std::endl;
+
+    ASSERT_EQ(cold.match_rate, 0.0);
+    ASSERT_EQ(warm.match_rate, 1.0);
+    ASSERT_LT(std::abs(warm.sinkage), 0.1 * cold.sinkage);
+}
@@ -0,0 +1,137 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Test of the deterministic multithreaded stepping mode.
+// A pile of boxes (frictional contacts, island-based PSOR solver) and a hanging
+// FEA block are simulated with 1, 2, and 8 threads. With deterministic mode
+// enabled, a hash of the system state must be identical at every step.
+//
+// =============================================================================
+
+#include <cstdint>
+#include <cstring>
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/fea/ChElementTetraCorot_4.h"
+#include "chrono/fea/ChMesh.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+// FNV-1a hash of the bit patterns of the given state vectors
+static std::uint64_t StateHash(const ChState& x, const ChStateDelta& v) {
+    std::uint64_t hash = 14695981039346656037ull;
+    auto add = [&hash](const double* data, Eigen::Index size) {
+        for (Eigen::Index i = 0; i < size; i++) {
+            std::uint64_t bits;
+            std::memcpy(&bits, &data[i], sizeof(bits));
+            for (int b = 0; b < 8; b++) {
+                hash ^= (bits >> (8 * b)) & 0xff;
+                hash *= 1099511628211ull;
+            }
+        }
+    };
+    add(x.data(), x.size());
+    add(v.data(), v.size());
+    return hash;
+}
+
+// Simulate the test model and return the state hash at each step
+static std::vector<std::uint64_t> Simulate(int num_threads) {
+    ChSystemNSC sys;
+    sys.SetNumThreads(num_threads);
+    sys.SetDeterministic(true);
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+    sys.SetGravitationalAcceleration(ChVector3d(0, -9.81, 0));
+    sys.SetSolverType(ChSolver::Type::PSOR_ISLANDS);
+    sys.GetSolver()->AsIterative()->SetMaxIterations(50);
+
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+    mat->SetFriction(0.4f);
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(10, 1, 10, 1000, true, true, mat);
+    ground->SetPos(ChVector3d(0, -0.5, 0));
+    ground->SetFixed(true);
+    sys.AddBody(ground);
+
+    // Two piles of boxes
+    for (int p = 0; p < 2; p++) {
+        for (int i = 0; i < 4; i++) {
+            auto box = chrono_types::make_shared<ChBodyEasyBox>(0.5, 0.5, 0.5, 1000, true, true, mat);
+            box->SetPos(ChVector3d(2.0 * p + 0.05 * i, 0.3 + 0.55 * i, 0.02 * i));
+            sys.AddBody(box);
+        }
+    }
+
+    // FEA block of 3 x 3 x 3 cubes (each split in 6 tetrahedra), hanging from its top face
+    auto fea_mat = chrono_types::make_shared<ChContinuumElastic>(1e6, 0.3, 1000);
+    auto mesh = chrono_types::make_shared<ChMesh>();
+    sys.Add(mesh);
+
+    const int n = 3;
+    const double h = 0.1;
+    std::vector<std::shared_ptr<ChNodeFEAxyz>> nodes;
+    for (int k = 0; k <= n; k++) {
+        for (int j = 0; j <= n; j++) {
+            for (int i = 0; i <= n; i++) {
+                auto node = chrono_types::make_shared<ChNodeFEAxyz>(ChVector3d(-3 + i * h, 2 + j * h, k * h));
+                node->SetFixed(j == n);
+                mesh->AddNode(node);
+                nodes.push_back(node);
+            }
+        }
+    }
+    auto node = [&](int i, int j, int k) { return nodes[(k * (n + 1) + j) * (n + 1) + i]; };
+    static const int tets[6][4] = {{0, 1, 2, 6}, {0, 2, 3, 6}, {0, 3, 7, 6}, {0, 7, 4, 6}, {0, 4, 5, 6}, {0, 5, 1, 6}};
+    for (int k = 0; k < n; k++) {
+        for (int j = 0; j < n; j++) {
+            for (int i = 0; i < n; i++) {
+                std::shared_ptr<ChNodeFEAxyz> v[8] = {
+                    node(i, j, k),         node(i + 1, j, k),         node(i + 1, j + 1, k),     node(i, j + 1, k),
+                    node(i, j, k + 1),     node(i + 1, j, k + 1),     node(i + 1, j + 1, k + 1), node(i, j + 1, k + 1)};
+                for (const auto& t : tets) {
+                    auto element = chrono_types::make_shared<ChElementTetraCorot_4>();
+                    element->SetNodes(v[t[0]], v[t[1]], v[t[2]], v[t[3]]);
+                    element->SetMaterial(fea_mat);
+                    mesh->AddElement(element);
+                }
+            }
+        }
+    }
+
+    std::vector<std::uint64_t> hashes;
+    ChState x;
+    ChStateDelta v;
+    double T;
+    for (int i = 0; i < 100; i++) {
+        sys.DoStepDynamics(1e-3);
+        x.setZero(sys.GetNumCoordsPosLevel(), &sys);
+        v.setZero(sys.GetNumCoordsVelLevel(), &sys);
+        sys.StateGather(x, v, T);
+        hashes.push_back(StateHash(x, v));
+    }
+
+    return hashes;
+}
+
+TEST(DeterministicTest, num_threads) {
+    auto ref = Simulate(1);
+    for (int num_threads : {2, 8}) {
+        auto res = Simulate(num_threads);
+        ASSERT_EQ(ref.size(), res.size());
+        for (size_t i = 0; i < ref.size(); i++)
+            ASSERT_EQ(ref[i], res[i]) << "state differs at step " << i << " with " << num_threads << " threads";
+    }
+}
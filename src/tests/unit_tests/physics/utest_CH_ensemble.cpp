@@ -0,0 +1,126 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Test of the ensemble runner.
+// An ensemble of pendulums with different initial angular velocities, swinging
+// into a fixed obstacle (Bullet collision detection), is run with 1 to 4
+// workers. Results must match those of stand-alone simulations of each member,
+// independently of the number of workers. The profiler is active in all workers
+// (profile tree and trace).
+//
+// =============================================================================
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/utils/ChEnsembleRunner.h"
+#include "chrono/utils/ChProfiler.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+static const unsigned int num_members = 8;
+static const unsigned int num_steps = 500;
+static const double step_size = 1e-3;
+
+static std::shared_ptr<ChSystem> CreateModel() {
+    auto sys = chrono_types::make_shared<ChSystemNSC>();
+    sys->SetGravitationalAcceleration(ChVector3d(0, -9.81, 0));
+    sys->SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetFixed(true);
+    sys->AddBody(ground);
+
+    auto pend = chrono_types::make_shared<ChBodyEasyBox>(1, 0.1, 0.1, 1000, true, true, mat);
+    pend->SetPos(ChVector3d(0.5, 0, 0));
+    sys->AddBody(pend);
+
+    auto rev = chrono_types::make_shared<ChLinkLockRevolute>();
+    rev->Initialize(ground, pend, ChFrame<>(ChVector3d(0, 0, 0)));
+    sys->AddLink(rev);
+
+    // Fixed obstacle hit by the pendulum tip
+    auto obstacle = chrono_types::make_shared<ChBodyEasyBox>(1, 0.2, 0.5, 1000, true, true, mat);
+    obstacle->SetPos(ChVector3d(1.0, -0.4, 0));
+    obstacle->SetFixed(true);
+    sys->AddBody(obstacle);
+
+    return sys;
+}
+
+// Set the initial angular velocity of the pendulum for the given member
+static void SetupMember(unsigned int member, ChSystem& sys) {
+    double omega = 0.5 * member;
+    auto pend = sys.GetBodies()[1];
+    pend->SetAngVelParent(ChVector3d(0, 0, omega));
+    pend->SetPosDt(ChVector3d(0, 0.5 * omega, 0));
+}
+
+class PendulumCallback : public utils::ChEnsembleRunner::MemberCallback {
+  public:
+    PendulumCallback() : final_pos(num_members), num_outputs(num_members, 0) {}
+
+    virtual void OnSetup(unsigned int member, ChSystem& sys) override { SetupMember(member, sys); }
+    virtual void OnOutput(unsigned int member, ChSystem& sys) override { num_outputs[member]++; }
+    virtual void OnFinish(unsigned int member, ChSystem& sys) override {
+        final_pos[member] = sys.GetBodies()[1]->GetPos();
+    }
+
+    std::vector<ChVector3d> final_pos;
+    std::vector<int> num_outputs;
+};
+
+TEST(ChEnsembleRunner, members) {
+    // Stand-alone simulations
+    std::vector<ChVector3d> ref(num_members);
+    unsigned int num_contacts = 0;
+    for (unsigned int m = 0; m < num_members; m++) {
+        auto sys = CreateModel();
+        SetupMember(m, *sys);
+        for (unsigned int s = 0; s < num_steps; s++) {
+            sys->DoStepDynamics(step_size);
+            num_contacts += sys->GetNumContacts();
+        }
+        ref[m] = sys->GetBodies()[1]->GetPos();
+    }
+    ASSERT_GT(num_contacts, 0u);
+
+    for (int num_workers : {1, 2, 3, 4}) {
+        utils::ChEnsembleRunner ensemble(CreateModel, num_workers);
+        ensemble.SetOutputInterval(10);
+        ASSERT_EQ(ensemble.GetNumWorkers(), num_workers);
+
+        PendulumCallback callback;
+        utils::ChProfileTrace::Reset();
+        utils::ChProfileTrace::Enable(true);
+        ensemble.Run(num_members, num_steps, step_size, callback);
+        utils::ChProfileTrace::Enable(false);
+        ASSERT_GT(utils::ChProfileTrace::GetNumZones(), 0);
+
+        unsigned int total = 0;
+        for (int w = 0; w < num_workers; w++)
+            total += ensemble.GetNumMembers(w);
+        ASSERT_EQ(total, num_members);
+
+        for (unsigned int m = 0; m < num_members; m++) {
+            ASSERT_TRUE(ensemble.IsMemberSuccessful(m));
+            ASSERT_EQ(callback.num_outputs[m], (int)(num_steps / 10));
+            ASSERT_EQ(callback.final_pos[m].x(), ref[m].x());
+            ASSERT_EQ(callback.final_pos[m].y(), ref[m].y());
+            ASSERT_EQ(callback.final_pos[m].z(), ref[m].z());
+        }
+    }
+}
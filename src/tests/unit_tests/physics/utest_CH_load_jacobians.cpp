@@ -0,0 +1,327 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Test of the analytical Jacobians of loads on nodes and bodies.
+// The K and R matrices of forces and torques on bodies, of bushings between two
+// bodies, and of springs and bushings between XYZ nodes and between an XYZ node
+// and a body are compared against the Jacobians obtained by finite differences.
+//
+// =============================================================================
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/physics/ChLoadContainer.h"
+#include "chrono/physics/ChLoadsNodeXYZ.h"
+#include "chrono/physics/ChLoadsBody.h"
+#include "chrono/fea/ChMesh.h"
+#include "chrono/fea/ChNodeFEAxyz.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+// Spring load which does not provide analytical Jacobians
+class SpringFD : public ChLoadNodeXYZNodeXYZSpring {
+  public:
+    using ChLoadNodeXYZNodeXYZSpring::ChLoadNodeXYZNodeXYZSpring;
+    virtual bool ComputeForceJacobian(const ChVector3d& rel_pos,
+                                      const ChVector3d& rel_vel,
+                                      ChMatrix33<>& dF_dpos,
+                                      ChMatrix33<>& dF_dvel) override {
+        return false;
+    }
+};
+
+// Bushing load which does not provide analytical Jacobians
+class BushingFD : public ChLoadNodeXYZNodeXYZBushing {
+  public:
+    using ChLoadNodeXYZNodeXYZBushing::ChLoadNodeXYZNodeXYZBushing;
+    virtual bool ComputeForceJacobian(const ChVector3d& rel_pos,
+                                      const ChVector3d& rel_vel,
+                                      ChMatrix33<>& dF_dpos,
+                                      ChMatrix33<>& dF_dvel) override {
+        return false;
+    }
+};
+
+// Constant nodal force, declared stiff, with or without analytical Jacobians
+class NodeForce : public ChLoadNodeXYZForceAbs {
+  public:
+    NodeForce(std::shared_ptr<ChNodeXYZ> node, const ChVector3d& force, bool analytic)
+        : ChLoadNodeXYZForceAbs(node, force), m_analytic(analytic) {}
+    virtual bool ComputeForceJacobian(const ChVector3d& abs_pos,
+                                      const ChVector3d& abs_vel,
+                                      ChMatrix33<>& dF_dpos,
+                                      ChMatrix33<>& dF_dvel) override {
+        return m_analytic && ChLoadNodeXYZForceAbs::ComputeForceJacobian(abs_pos, abs_vel, dF_dpos, dF_dvel);
+    }
+    virtual bool IsStiff() override { return true; }
+    bool m_analytic;
+};
+
+// Force and torque loads on a body, using finite differences for the Jacobians
+class BodyForceFD : public ChLoadBodyForce {
+  public:
+    using ChLoadBodyForce::ChLoadBodyForce;
+    virtual void ComputeJacobian(ChState* state_x, ChStateDelta* state_w) override {
+        ChLoadCustom::ComputeJacobian(state_x, state_w);
+    }
+};
+
+class BodyTorqueFD : public ChLoadBodyTorque {
+  public:
+    using ChLoadBodyTorque::ChLoadBodyTorque;
+    virtual void ComputeJacobian(ChState* state_x, ChStateDelta* state_w) override {
+        ChLoadCustom::ComputeJacobian(state_x, state_w);
+    }
+};
+
+// Body-body bushings which do not provide analytical Jacobians
+template <class Bushing>
+class BushingBodyFD : public Bushing {
+  public:
+    using Bushing::Bushing;
+    virtual bool ComputeBodyBodyForceTorqueJacobian(const ChFrameMoving<>& rel_AB,
+                                                    ChMatrix66d& dFT_dpos,
+                                                    ChMatrix66d& dFT_dvel) override {
+        return false;
+    }
+};
+
+// Node-body loads which do not provide analytical Jacobians
+template <class Load>
+class NodeBodyFD : public Load {
+  public:
+    using Load::Load;
+    virtual bool ComputeForceJacobian(const ChFrameMoving<>& rel_AB,
+                                      ChMatrix33<>& dF_dpos,
+                                      ChMatrix33<>& dF_dvel) override {
+        return false;
+    }
+};
+
+class LoadJacobianTest : public ::testing::Test {
+  protected:
+    LoadJacobianTest() {
+        auto mesh = chrono_types::make_shared<ChMesh>();
+        sys.Add(mesh);
+
+        nodeA = chrono_types::make_shared<ChNodeFEAxyz>(ChVector3d(0.3, 1.2, -0.4));
+        nodeB = chrono_types::make_shared<ChNodeFEAxyz>(ChVector3d(-0.2, 0.1, 0.5));
+        nodeA->SetPosDt(ChVector3d(0.5, -1.0, 0.2));
+        nodeB->SetPosDt(ChVector3d(-0.3, 0.4, 0.8));
+        mesh->AddNode(nodeA);
+        mesh->AddNode(nodeB);
+
+        bodyA = chrono_types::make_shared<ChBody>();
+        bodyA->SetPos(ChVector3d(0.2, 0.5, -0.1));
+        bodyA->SetRot(QuatFromAngleAxis(0.7, ChVector3d(1, 2, 0.5).GetNormalized()));
+        bodyA->SetPosDt(ChVector3d(0.3, -0.2, 0.1));
+        bodyA->SetAngVelLocal(ChVector3d(0.5, -1.2, 0.8));
+        sys.AddBody(bodyA);
+
+        bodyB = chrono_types::make_shared<ChBody>();
+        bodyB->SetPos(ChVector3d(-0.3, 0.1, 0.4));
+        bodyB->SetRot(QuatFromAngleAxis(-0.4, ChVector3d(0.2, 1, -0.3).GetNormalized()));
+        bodyB->SetPosDt(ChVector3d(-0.1, 0.4, 0.2));
+        bodyB->SetAngVelLocal(ChVector3d(1.1, 0.3, -0.6));
+        sys.AddBody(bodyB);
+
+        // Application frames of body-body loads, with a finite relative displacement and rotation
+        frameA = ChFrame<>(ChVector3d(0.1, -0.2, 0.05), QuatFromAngleAxis(0.6, ChVector3d(1, -1, 2).GetNormalized()));
+        frameB = ChFrame<>(ChVector3d(-0.15, 0.3, 0.2), QuatFromAngleAxis(-0.3, ChVector3d(0, 1, 1).GetNormalized()));
+
+        container = chrono_types::make_shared<ChLoadContainer>();
+        sys.Add(container);
+    }
+
+    void Check(std::shared_ptr<ChLoadBase> analytic, std::shared_ptr<ChLoadBase> numeric) {
+        container->Add(analytic);
+        container->Add(numeric);
+        sys.Setup();
+        sys.Update();
+
+        ASSERT_TRUE(analytic->GetJacobians());
+        ASSERT_TRUE(numeric->GetJacobians());
+        const auto& Ka = analytic->GetJacobians()->K;
+        const auto& Kn = numeric->GetJacobians()->K;
+        const auto& Ra = analytic->GetJacobians()->R;
+        const auto& Rn = numeric->GetJacobians()->R;
+        double scale = std::max(1.0, Kn.lpNorm<Eigen::Infinity>());
+        ASSERT_NEAR((Ka - Kn).lpNorm<Eigen::Infinity>() / scale, 0.0, 1e-5);
+        scale = std::max(1.0, Rn.lpNorm<Eigen::Infinity>());
+        ASSERT_NEAR((Ra - Rn).lpNorm<Eigen::Infinity>() / scale, 0.0, 1e-5);
+    }
+
+    // Check a pair of body-body bushings, with the same application frames
+    void CheckBushing(std::shared_ptr<ChLoadBodyBody> analytic, std::shared_ptr<ChLoadBodyBody> numeric) {
+        for (auto load : {analytic, numeric}) {
+            load->SetApplicationFrameA(frameA);
+            load->SetApplicationFrameB(frameB);
+        }
+        Check(analytic, numeric);
+    }
+
+    ChSystemSMC sys;
+    std::shared_ptr<ChNodeFEAxyz> nodeA;
+    std::shared_ptr<ChNodeFEAxyz> nodeB;
+    std::shared_ptr<ChBody> bodyA;
+    std::shared_ptr<ChBody> bodyB;
+    ChFrame<> frameA;
+    ChFrame<> frameB;
+    std::shared_ptr<ChLoadContainer> container;
+};
+
+TEST_F(LoadJacobianTest, spring) {
+    auto analytic = chrono_types::make_shared<ChLoadNodeXYZNodeXYZSpring>(nodeA, nodeB, 1e3, 50, 0.7);
+    auto numeric = chrono_types::make_shared<SpringFD>(nodeA, nodeB, 1e3, 50, 0.7);
+    analytic->SetStiff(true);
+    numeric->SetStiff(true);
+    Check(analytic, numeric);
+}
+
+TEST_F(LoadJacobianTest, bushing) {
+    auto fx = chrono_types::make_shared<ChFunctionPoly>();
+    fx->SetCoefficients({0, -2e3, 0, -5e2});
+    auto fy = chrono_types::make_shared<ChFunctionConst>(10.0);
+    auto fz = chrono_types::make_shared<ChFunctionPoly>();
+    fz->SetCoefficients({1, -1e3});
+
+    auto analytic = chrono_types::make_shared<ChLoadNodeXYZNodeXYZBushing>(nodeA, nodeB);
+    auto numeric = chrono_types::make_shared<BushingFD>(nodeA, nodeB);
+    for (auto load : {std::static_pointer_cast<ChLoadNodeXYZNodeXYZBushing>(analytic),
+                      std::static_pointer_cast<ChLoadNodeXYZNodeXYZBushing>(numeric)}) {
+        load->SetFunctionForceX(fx);
+        load->SetFunctionForceY(fy);
+        load->SetFunctionForceZ(fz);
+        load->SetDamping(ChVector3d(10, 20, 30));
+        load->SetStiff(true);
+    }
+    Check(analytic, numeric);
+}
+
+TEST_F(LoadJacobianTest, node_force) {
+    auto analytic = chrono_types::make_shared<NodeForce>(nodeA, ChVector3d(10, -20, 5), true);
+    auto numeric = chrono_types::make_shared<NodeForce>(nodeA, ChVector3d(10, -20, 5), false);
+    Check(analytic, numeric);
+}
+
+TEST_F(LoadJacobianTest, body_force) {
+    ChVector3d force(120, -80, 200);
+    ChVector3d point(0.3, -0.4, 0.25);
+    for (bool local_force : {true, false}) {
+        for (bool local_point : {true, false}) {
+            auto analytic = chrono_types::make_shared<ChLoadBodyForce>(bodyA, force, local_force, point, local_point);
+            auto numeric = chrono_types::make_shared<BodyForceFD>(bodyA, force, local_force, point, local_point);
+            analytic->SetStiff(true);
+            numeric->SetStiff(true);
+            Check(analytic, numeric);
+        }
+    }
+}
+
+TEST_F(LoadJacobianTest, body_torque) {
+    ChVector3d torque(30, 45, -60);
+    for (bool local_torque : {true, false}) {
+        auto analytic = chrono_types::make_shared<ChLoadBodyTorque>(bodyA, torque, local_torque);
+        auto numeric = chrono_types::make_shared<BodyTorqueFD>(bodyA, torque, local_torque);
+        analytic->SetStiff(true);
+        numeric->SetStiff(true);
+        Check(analytic, numeric);
+    }
+}
+
+TEST_F(LoadJacobianTest, bushing_spherical) {
+    ChVector3d k(1e3, 2e3, 3e3);
+    ChVector3d d(10, 20, 30);
+    auto analytic = chrono_types::make_shared<ChLoadBodyBodyBushingSpherical>(bodyA, bodyB, ChFrame<>(), k, d);
+    auto numeric =
+        chrono_types::make_shared<BushingBodyFD<ChLoadBodyBodyBushingSpherical>>(bodyA, bodyB, ChFrame<>(), k, d);
+    CheckBushing(analytic, numeric);
+}
+
+TEST_F(LoadJacobianTest, bushing_plastic) {
+    // Small yield along Y, so that the force is capped in that direction
+    ChVector3d k(1e3, 2e3, 3e3);
+    ChVector3d d(10, 20, 30);
+    ChVector3d yield(1e4, 1.0, 1e4);
+    auto analytic =
+        chrono_types::make_shared<ChLoadBodyBodyBushingPlastic>(bodyA, bodyB, ChFrame<>(), k, d, yield);
+    auto numeric =
+        chrono_types::make_shared<BushingBodyFD<ChLoadBodyBodyBushingPlastic>>(bodyA, bodyB, ChFrame<>(), k, d, yield);
+    CheckBushing(analytic, numeric);
+    ASSERT_DOUBLE_EQ(std::abs(analytic->GetForce().y()), yield.y());
+}
+
+TEST_F(LoadJacobianTest, bushing_mate) {
+    ChVector3d k(1e3, 2e3, 3e3);
+    ChVector3d d(10, 20, 30);
+    ChVector3d rk(500, 700, 900);
+    ChVector3d rd(5, 7, 9);
+    auto analytic = chrono_types::make_shared<ChLoadBodyBodyBushingMate>(bodyA, bodyB, ChFrame<>(), k, d, rk, rd);
+    auto numeric =
+        chrono_types::make_shared<BushingBodyFD<ChLoadBodyBodyBushingMate>>(bodyA, bodyB, ChFrame<>(), k, d, rk, rd);
+    CheckBushing(analytic, numeric);
+}
+
+TEST_F(LoadJacobianTest, bushing_generic) {
+    // Coupled stiffness and damping matrices
+    ChMatrix66d K;
+    ChMatrix66d D;
+    for (int i = 0; i < 6; i++) {
+        for (int j = 0; j < 6; j++) {
+            K(i, j) = (i == j) ? 2e3 : 100.0 * ((i + 2 * j) % 5 - 2);
+            D(i, j) = (i == j) ? 20 : 1.0 * ((2 * i + j) % 3 - 1);
+        }
+    }
+    auto analytic = chrono_types::make_shared<ChLoadBodyBodyBushingGeneric>(bodyA, bodyB, ChFrame<>(), K, D);
+    auto numeric =
+        chrono_types::make_shared<BushingBodyFD<ChLoadBodyBodyBushingGeneric>>(bodyA, bodyB, ChFrame<>(), K, D);
+    for (auto load : {std::static_pointer_cast<ChLoadBodyBodyBushingGeneric>(analytic),
+                      std::static_pointer_cast<ChLoadBodyBodyBushingGeneric>(numeric)}) {
+        load->NeutralDisplacement() = ChFrame<>(ChVector3d(0.02, 0, -0.01), QuatFromAngleZ(0.2));
+        load->SetNeutralForce(ChVector3d(5, 0, 0));
+    }
+    CheckBushing(analytic, numeric);
+}
+
+TEST_F(LoadJacobianTest, node_body_spring) {
+    auto analytic = chrono_types::make_shared<ChLoadNodeXYZBodySpring>(nodeA, bodyB, 1e3, 50, 0.2);
+    auto numeric = chrono_types::make_shared<NodeBodyFD<ChLoadNodeXYZBodySpring>>(nodeA, bodyB, 1e3, 50, 0.2);
+    for (auto load : {std::static_pointer_cast<ChLoadNodeXYZBodySpring>(analytic),
+                      std::static_pointer_cast<ChLoadNodeXYZBodySpring>(numeric)}) {
+        load->SetApplicationFrameB(frameB);
+        load->SetStiff(true);
+    }
+    Check(analytic, numeric);
+}
+
+TEST_F(LoadJacobianTest, node_body_bushing) {
+    auto fx = chrono_types::make_shared<ChFunctionPoly>();
+    fx->SetCoefficients({0, -2e3, 0, -5e2});
+    auto fy = chrono_types::make_shared<ChFunctionConst>(10.0);
+    auto fz = chrono_types::make_shared<ChFunctionPoly>();
+    fz->SetCoefficients({1, -1e3});
+
+    auto analytic = chrono_types::make_shared<ChLoadNodeXYZBodyBushing>(nodeA, bodyB);
+    auto numeric = chrono_types::make_shared<NodeBodyFD<ChLoadNodeXYZBodyBushing>>(nodeA, bodyB);
+    for (auto load : {std::static_pointer_cast<ChLoadNodeXYZBodyBushing>(analytic),
+                      std::static_pointer_cast<ChLoadNodeXYZBodyBushing>(numeric)}) {
+        load->SetApplicationFrameB(frameB);
+        load->SetFunctionForceX(fx);
+        load->SetFunctionForceY(fy);
+        load->SetFunctionForceZ(fz);
+        load->SetDamping(ChVector3d(10, 20, 30));
+        load->SetStiff(true);
+    }
+    Check(analytic, numeric);
+}
@@ -0,0 +1,169 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Test of the asynchronous output pipeline.
+// - All frames are processed, in order with a single worker, and with data
+//   matching the state of the system at capture time.
+// - A slow sink with a small ring buffer causes back-pressure.
+// - Exceptions thrown by a sink are reported to the simulation thread.
+// - The body output sink generates the same files as WriteBodies.
+//
+// =============================================================================
+
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/utils/ChOutputPipeline.h"
+#include "chrono/utils/ChUtilsInputOutput.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::utils;
+
+static void CreateModel(ChSystemNSC& sys) {
+    sys.SetGravitationalAcceleration(ChVector3d(0, -9.81, 0));
+    for (int i = 0; i < 5; i++) {
+        auto body = chrono_types::make_shared<ChBodyEasyBox>(0.5, 0.5, 0.5, 1000, true, false);
+        body->SetPos(ChVector3d(i, 0, 0));
+        body->SetPosDt(ChVector3d(0, 0.1 * i, 0));
+        sys.AddBody(body);
+    }
+}
+
+// Sink recording the height of the last body, optionally sleeping or failing
+class RecordingSink : public ChOutputPipeline::Sink {
+  public:
+    RecordingSink(int delay_ms = 0, int fail_frame = -1) : m_delay_ms(delay_ms), m_fail_frame(fail_frame) {}
+
+    virtual void Capture(ChSystem& sys, ChOutputPipeline::Frame& frame) override {
+        frame.values.clear();
+        frame.values.push_back(sys.GetBodies().back()->GetPos().y());
+    }
+
+    virtual void Process(const ChOutputPipeline::Frame& frame) override {
+        if (m_delay_ms > 0)
+            std::this_thread::sleep_for(std::chrono::milliseconds(m_delay_ms));
+        if ((int)frame.index == m_fail_frame)
+            throw std::runtime_error("sink failure");
+        indices.push_back(frame.index);
+        times.push_back(frame.time);
+        heights.push_back(frame.values[0]);
+    }
+
+    virtual void Finalize() override { finalized = true; }
+
+    std::vector<unsigned int> indices;
+    std::vector<double> times;
+    std::vector<double> heights;
+    bool finalized = false;
+
+  private:
+    int m_delay_ms;
+    int m_fail_frame;
+};
+
+static std::string ReadFile(const std::string& filename) {
+    std::ifstream ifile(filename);
+    std::stringstream buffer;
+    buffer << ifile.rdbuf();
+    return buffer.str();
+}
+
+TEST(ChOutputPipeline, frames) {
+    ChSystemNSC sys;
+    CreateModel(sys);
+
+    auto sink = chrono_types::make_shared<RecordingSink>();
+    ChOutputPipeline pipeline(4, 1);
+    pipeline.AddSink(sink);
+
+    std::vector<double> times;
+    std::vector<double> heights;
+    for (int i = 0; i < 50; i++) {
+        sys.DoStepDynamics(1e-3);
+        pipeline.WriteFrame(sys);
+        times.push_back(sys.GetChTime());
+        heights.push_back(sys.GetBodies().back()->GetPos().y());
+    }
+    pipeline.Close();
+
+    ASSERT_EQ(pipeline.GetNumFrames(), 50u);
+    ASSERT_TRUE(sink->finalized);
+    ASSERT_EQ(sink->indices.size(), 50u);
+    for (unsigned int i = 0; i < 50; i++) {
+        ASSERT_EQ(sink->indices[i], i);
+        ASSERT_EQ(sink->times[i], times[i]);
+        ASSERT_EQ(sink->heights[i], heights[i]);
+    }
+}
+
+TEST(ChOutputPipeline, back_pressure) {
+    ChSystemNSC sys;
+    CreateModel(sys);
+
+    auto sink = chrono_types::make_shared<RecordingSink>(5);
+    ChOutputPipeline pipeline(2, 1);
+    pipeline.AddSink(sink);
+
+    for (int i = 0; i < 10; i++)
+        pipeline.WriteFrame(sys);
+    pipeline.Flush();
+
+    ASSERT_EQ(sink->indices.size(), 10u);
+    ASSERT_TRUE(pipeline.GetTimerWait() > 0);
+}
+
+TEST(ChOutputPipeline, errors) {
+    ChSystemNSC sys;
+    CreateModel(sys);
+
+    ChOutputPipeline pipeline(4, 2);
+    pipeline.AddSink(chrono_types::make_shared<RecordingSink>(0, 3));
+
+    bool thrown = false;
+    try {
+        for (int i = 0; i < 10; i++)
+            pipeline.WriteFrame(sys);
+        pipeline.Flush();
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    ASSERT_TRUE(thrown);
+}
+
+TEST(ChOutputPipeline, bodies_sink) {
+    ChSystemNSC sys;
+    CreateModel(sys);
+
+    ChOutputPipeline pipeline(4, 2);
+    pipeline.AddSink(chrono_types::make_shared<ChOutputSinkBodies>("pipeline_bodies_", false, true));
+
+    std::vector<std::string> expected;
+    for (int i = 0; i < 5; i++) {
+        sys.DoStepDynamics(1e-3);
+        pipeline.WriteFrame(sys);
+        WriteBodies(&sys, "pipeline_ref.csv", false, true);
+        expected.push_back(ReadFile("pipeline_ref.csv"));
+    }
+    pipeline.Close();
+
+    for (int i = 0; i < 5; i++) {
+        std::ostringstream filename;
+        filename << "pipeline_bodies_0000" << i << ".csv";
+        ASSERT_EQ(ReadFile(filename.str()), expected[i]);
+    }
+}
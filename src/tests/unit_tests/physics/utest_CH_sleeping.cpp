@@ -0,0 +1,82 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Test of body sleeping.
+// A rotor driven by a motor to ground (with a delayed speed function) and an arm
+// welded to the rotor are at rest for longer than the sleep time, but must stay
+// awake (they are linked to a fixed body) and follow the motor once it starts.
+// A free body at rest must fall asleep.
+//
+// =============================================================================
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/physics/ChLinkMotorRotationSpeed.h"
+#include "chrono/functions/ChFunctionSineStep.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+TEST(ChSystemSleeping, delayed_ground_motor) {
+    ChSystemNSC sys;
+    sys.SetGravitationalAcceleration(VNULL);
+    sys.SetSleepingAllowed(true);
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetFixed(true);
+    sys.AddBody(ground);
+
+    auto rotor = chrono_types::make_shared<ChBodyEasyCylinder>(ChAxis::Z, 0.5, 0.1, 1000, false, false);
+    rotor->SetSleepTime(0.2f);
+    sys.AddBody(rotor);
+
+    auto arm = chrono_types::make_shared<ChBodyEasyBox>(1.0, 0.1, 0.1, 1000, false, false);
+    arm->SetPos(ChVector3d(1.0, 0, 0.2));
+    arm->SetSleepTime(0.2f);
+    sys.AddBody(arm);
+
+    auto free_body = chrono_types::make_shared<ChBodyEasyBox>(0.5, 0.5, 0.5, 1000, false, false);
+    free_body->SetPos(ChVector3d(0, 5, 0));
+    free_body->SetSleepTime(0.2f);
+    sys.AddBody(free_body);
+
+    // Motor at rest until t = 1, then ramping up to 2 rad/s at t = 1.5
+    double speed = 2.0;
+    auto motor = chrono_types::make_shared<ChLinkMotorRotationSpeed>();
+    motor->Initialize(rotor, ground, ChFrame<>(VNULL, QUNIT));
+    motor->SetSpeedFunction(
+        chrono_types::make_shared<ChFunctionSineStep>(ChVector2d(1.0, 0.0), ChVector2d(1.5, speed)));
+    sys.AddLink(motor);
+
+    auto weld = chrono_types::make_shared<ChLinkLockLock>();
+    weld->Initialize(rotor, arm, ChFrame<>(ChVector3d(0.5, 0, 0.1), QUNIT));
+    sys.AddLink(weld);
+
+    double step = 1e-3;
+    while (sys.GetChTime() < 2.0) {
+        sys.DoStepDynamics(step);
+
+        // Before the motor starts, all bodies are at rest for longer than their sleep time
+        if (sys.GetChTime() > 0.5 && sys.GetChTime() < 1.0) {
+            ASSERT_TRUE(free_body->IsSleeping());
+            ASSERT_FALSE(rotor->IsSleeping());
+            ASSERT_FALSE(arm->IsSleeping());
+        }
+    }
+
+    ASSERT_FALSE(rotor->IsSleeping());
+    ASSERT_FALSE(arm->IsSleeping());
+    ASSERT_NEAR(rotor->GetAngVelParent().z(), speed, 1e-3);
+    ASSERT_NEAR(arm->GetAngVelParent().z(), speed, 1e-3);
+}
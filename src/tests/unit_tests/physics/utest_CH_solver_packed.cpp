@@ -0,0 +1,145 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Test of the packed constraint mode of the iterative VI solvers.
+// A pile of boxes (frictional contacts) and a pendulum (bilateral constraints)
+// are simulated with and without packed mode; results must be identical.
+// The graph-colored and island-based PSOR solvers must produce results that
+// do not depend on the number of threads.
+//
+// =============================================================================
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/solver/ChIterativeSolverVI.h"
+#include "chrono/solver/ChSolverPSORIslands.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+static std::vector<ChVector3d> Simulate(ChSolver::Type type, bool packed, int num_threads = 1) {
+    ChSystemNSC sys;
+    sys.SetNumThreads(num_threads);
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+    sys.SetGravitationalAcceleration(ChVector3d(0, -9.81, 0));
+    sys.SetSolverType(type);
+    auto solver = sys.GetSolver()->AsIterative();
+    solver->SetMaxIterations(50);
+    std::static_pointer_cast<ChIterativeSolverVI>(sys.GetSolver())->EnablePackedMode(packed);
+
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+    mat->SetFriction(0.4f);
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(10, 1, 10, 1000, true, true, mat);
+    ground->SetPos(ChVector3d(0, -0.5, 0));
+    ground->SetFixed(true);
+    sys.AddBody(ground);
+
+    for (int i = 0; i < 4; i++) {
+        auto box = chrono_types::make_shared<ChBodyEasyBox>(0.5, 0.5, 0.5, 1000, true, true, mat);
+        box->SetPos(ChVector3d(0.05 * i, 0.3 + 0.55 * i, 0));
+        sys.AddBody(box);
+    }
+
+    auto pend = chrono_types::make_shared<ChBodyEasyBox>(1, 0.1, 0.1, 1000, true, false);
+    pend->SetPos(ChVector3d(2.5, 2, 0));
+    sys.AddBody(pend);
+    auto rev = chrono_types::make_shared<ChLinkLockRevolute>();
+    rev->Initialize(ground, pend, ChFrame<>(ChVector3d(2, 2, 0)));
+    sys.AddLink(rev);
+
+    for (int i = 0; i < 100; i++)
+        sys.DoStepDynamics(2e-3);
+
+    std::vector<ChVector3d> pos;
+    for (const auto& body : sys.GetBodies())
+        pos.push_back(body->GetPos());
+    return pos;
+}
+
+class PackedSolverTest : public ::testing::TestWithParam<ChSolver::Type> {};
+
+TEST_P(PackedSolverTest, identical) {
+    auto ref = Simulate(GetParam(), false);
+    auto res = Simulate(GetParam(), true);
+    ASSERT_EQ(ref.size(), res.size());
+    for (size_t i = 0; i < ref.size(); i++) {
+        ASSERT_EQ(ref[i].x(), res[i].x());
+        ASSERT_EQ(ref[i].y(), res[i].y());
+        ASSERT_EQ(ref[i].z(), res[i].z());
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(ChronoSolver,
+                         PackedSolverTest,
+                         ::testing::Values(ChSolver::Type::PSOR,
+                                           ChSolver::Type::PSSOR,
+                                           ChSolver::Type::PJACOBI,
+                                           ChSolver::Type::APGD,
+                                           ChSolver::Type::BARZILAIBORWEIN));
+
+TEST(PSORColoredTest, num_threads) {
+    auto ref = Simulate(ChSolver::Type::PSOR_COLORED, true, 1);
+    auto res = Simulate(ChSolver::Type::PSOR_COLORED, true, 4);
+    ASSERT_EQ(ref.size(), res.size());
+    for (size_t i = 0; i < ref.size(); i++) {
+        ASSERT_EQ(ref[i].x(), res[i].x());
+        ASSERT_EQ(ref[i].y(), res[i].y());
+        ASSERT_EQ(ref[i].z(), res[i].z());
+    }
+}
+
+TEST(PSORIslandsTest, num_threads) {
+    auto ref = Simulate(ChSolver::Type::PSOR_ISLANDS, true, 1);
+    auto res = Simulate(ChSolver::Type::PSOR_ISLANDS, true, 4);
+    ASSERT_EQ(ref.size(), res.size());
+    for (size_t i = 0; i < ref.size(); i++) {
+        ASSERT_EQ(ref[i].x(), res[i].x());
+        ASSERT_EQ(ref[i].y(), res[i].y());
+        ASSERT_EQ(ref[i].z(), res[i].z());
+    }
+}
+
+TEST(PSORIslandsTest, islands) {
+    // Two pendulums hanging from the (fixed) ground and a free body: the ground does not connect the pendulums, so
+    // there are two islands of 5 bilateral constraints each
+    ChSystemNSC sys;
+    sys.SetSolverType(ChSolver::Type::PSOR_ISLANDS);
+    sys.GetSolver()->AsIterative()->SetMaxIterations(100);
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetFixed(true);
+    sys.AddBody(ground);
+
+    for (int i = 0; i < 2; i++) {
+        auto pend = chrono_types::make_shared<ChBodyEasyBox>(1, 0.1, 0.1, 1000, false, false);
+        pend->SetPos(ChVector3d(0.5, 0, 2.0 * i));
+        sys.AddBody(pend);
+        auto rev = chrono_types::make_shared<ChLinkLockRevolute>();
+        rev->Initialize(ground, pend, ChFrame<>(ChVector3d(0, 0, 2.0 * i)));
+        sys.AddLink(rev);
+    }
+
+    auto free_body = chrono_types::make_shared<ChBodyEasyBox>(1, 1, 1, 1000, false, false);
+    sys.AddBody(free_body);
+
+    sys.DoStepDynamics(1e-3);
+
+    auto solver = std::static_pointer_cast<ChSolverPSORIslands>(sys.GetSolver());
+    ASSERT_EQ(solver->GetNumIslands(), 2u);
+    ASSERT_EQ(solver->GetIslandSize(0), 5u);
+    ASSERT_EQ(solver->GetIslandSize(1), 5u);
+    ASSERT_EQ(solver->GetTotalIslandIterations(), solver->GetIslandIterations(0) + solver->GetIslandIterations(1));
+    ASSERT_EQ(solver->GetIterations(), std::max(solver->GetIslandIterations(0), solver->GetIslandIterations(1)));
+}
@@ -0,0 +1,95 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Test of the sparsity pattern cache of the direct sparse solvers.
+// A chain of pendulums (constant sparsity pattern) is simulated with and
+// without the pattern cache; results must be identical and the symbolic
+// analysis must be reused at all but the first factorization.
+//
+// =============================================================================
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/solver/ChDirectSolverLS.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+static std::vector<ChVector3d> Simulate(std::shared_ptr<ChDirectSolverLS> solver,
+                                        bool pattern_cache,
+                                        unsigned int& hits,
+                                        unsigned int& misses) {
+    ChSystemSMC sys;
+    sys.SetGravitationalAcceleration(ChVector3d(0, -9.81, 0));
+    solver->EnableSparsityPatternCache(pattern_cache);
+    sys.SetSolver(solver);
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetFixed(true);
+    sys.AddBody(ground);
+
+    auto prev = std::static_pointer_cast<ChBody>(ground);
+    for (int i = 0; i < 5; i++) {
+        auto link = chrono_types::make_shared<ChBodyEasyBox>(1, 0.1, 0.1, 1000, false, false);
+        link->SetPos(ChVector3d(i + 0.5, 0, 0));
+        sys.AddBody(link);
+        auto rev = chrono_types::make_shared<ChLinkLockRevolute>();
+        rev->Initialize(prev, link, ChFrame<>(ChVector3d(i, 0, 0)));
+        sys.AddLink(rev);
+        prev = link;
+    }
+
+    for (int i = 0; i < 100; i++)
+        sys.DoStepDynamics(1e-3);
+
+    hits = solver->GetNumPatternHits();
+    misses = solver->GetNumPatternMisses();
+
+    std::vector<ChVector3d> pos;
+    for (const auto& body : sys.GetBodies())
+        pos.push_back(body->GetPos());
+    return pos;
+}
+
+class PatternCacheTest : public ::testing::TestWithParam<ChSolver::Type> {};
+
+static std::shared_ptr<ChDirectSolverLS> CreateSolver(ChSolver::Type type) {
+    if (type == ChSolver::Type::SPARSE_QR)
+        return chrono_types::make_shared<ChSolverSparseQR>();
+    return chrono_types::make_shared<ChSolverSparseLU>();
+}
+
+TEST_P(PatternCacheTest, identical) {
+    unsigned int ref_hits, ref_misses;
+    unsigned int hits, misses;
+    auto ref = Simulate(CreateSolver(GetParam()), false, ref_hits, ref_misses);
+    auto res = Simulate(CreateSolver(GetParam()), true, hits, misses);
+
+    ASSERT_EQ(ref.size(), res.size());
+    for (size_t i = 0; i < ref.size(); i++) {
+        ASSERT_EQ(ref[i].x(), res[i].x());
+        ASSERT_EQ(ref[i].y(), res[i].y());
+        ASSERT_EQ(ref[i].z(), res[i].z());
+    }
+
+    // The sparsity pattern is constant: the symbolic analysis is performed only once
+    ASSERT_EQ(ref_misses, 1);
+    ASSERT_EQ(misses, 1);
+    ASSERT_EQ(hits, ref_hits);
+    ASSERT_GT(hits, 0);
+}
+
+INSTANTIATE_TEST_SUITE_P(ChronoSolver,
+                         PatternCacheTest,
+                         ::testing::Values(ChSolver::Type::SPARSE_LU, ChSolver::Type::SPARSE_QR));
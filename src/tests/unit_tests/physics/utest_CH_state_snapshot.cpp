@@ -0,0 +1,199 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Test of in-memory state snapshots (ChSystem::SaveState / RestoreState).
+// - A double pendulum integrated with HHT is rolled back to a snapshot; the
+//   restored state must be identical to the saved one, and the simulation from
+//   the restored state must reproduce the original trajectory (up to the Newton
+//   tolerance: HHT starts a step with the constraint Jacobians of the last
+//   Newton iterate, which are not part of the state).
+// - A pile of boxes (frictional contacts, contact persistence) is restored
+//   repeatedly to the same snapshot; all branches must be identical.
+// - Snapshots of a system with bodies at rest share most of their pages.
+// - Restoring a snapshot in a system with a different structure throws and
+//   leaves the system unchanged.
+//
+// =============================================================================
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChContactContainerNSC.h"
+#include "chrono/physics/ChLinkLock.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+static std::vector<double> GetState(ChSystem& sys) {
+    std::vector<double> state;
+    for (const auto& body : sys.GetBodies()) {
+        auto x = body->GetPos();
+        auto q = body->GetRot();
+        auto v = body->GetPosDt();
+        auto w = body->GetAngVelLocal();
+        state.insert(state.end(), {x.x(), x.y(), x.z(), q.e0(), q.e1(), q.e2(), q.e3(), v.x(), v.y(), v.z(), w.x(),
+                                   w.y(), w.z()});
+    }
+    return state;
+}
+
+TEST(ChSystemSnapshot, rollback) {
+    ChSystemNSC sys;
+    sys.SetGravitationalAcceleration(ChVector3d(0, -9.81, 0));
+    sys.SetSolverType(ChSolver::Type::SPARSE_QR);
+    sys.SetTimestepperType(ChTimestepper::Type::HHT);
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetFixed(true);
+    sys.AddBody(ground);
+
+    auto body1 = chrono_types::make_shared<ChBodyEasyBox>(1, 0.1, 0.1, 1000, true, false);
+    body1->SetPos(ChVector3d(0.5, 0, 0));
+    sys.AddBody(body1);
+    auto body2 = chrono_types::make_shared<ChBodyEasyBox>(1, 0.1, 0.1, 1000, true, false);
+    body2->SetPos(ChVector3d(1.5, 0, 0));
+    sys.AddBody(body2);
+
+    auto rev1 = chrono_types::make_shared<ChLinkLockRevolute>();
+    rev1->Initialize(ground, body1, ChFrame<>(ChVector3d(0, 0, 0)));
+    sys.AddLink(rev1);
+    auto rev2 = chrono_types::make_shared<ChLinkLockRevolute>();
+    rev2->Initialize(body1, body2, ChFrame<>(ChVector3d(1, 0, 0)));
+    sys.AddLink(rev2);
+
+    for (int i = 0; i < 50; i++)
+        sys.DoStepDynamics(1e-3);
+
+    auto snapshot = sys.SaveState();
+    ASSERT_EQ(snapshot->GetChTime(), sys.GetChTime());
+    auto state0 = GetState(sys);
+
+    std::vector<std::vector<double>> ref;
+    for (int i = 0; i < 50; i++) {
+        sys.DoStepDynamics(1e-3);
+        ref.push_back(GetState(sys));
+    }
+
+    sys.RestoreState(snapshot);
+    ASSERT_EQ(sys.GetChTime(), snapshot->GetChTime());
+    ASSERT_EQ(GetState(sys), state0);
+
+    for (int i = 0; i < 50; i++) {
+        sys.DoStepDynamics(1e-3);
+        auto state = GetState(sys);
+        for (size_t k = 0; k < state.size(); k++)
+            ASSERT_NEAR(state[k], ref[i][k], 1e-6) << "trajectories differ at step " << i;
+    }
+}
+
+TEST(ChSystemSnapshot, branching) {
+    ChSystemNSC sys;
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+    sys.SetGravitationalAcceleration(ChVector3d(0, -9.81, 0));
+    sys.GetSolver()->AsIterative()->SetMaxIterations(50);
+    sys.GetSolver()->AsIterative()->EnableWarmStart(true);
+    std::static_pointer_cast<ChContactContainerNSC>(sys.GetContactContainer())->EnableContactPersistence(true);
+
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+    mat->SetFriction(0.4f);
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(10, 1, 10, 1000, true, true, mat);
+    ground->SetPos(ChVector3d(0, -0.5, 0));
+    ground->SetFixed(true);
+    sys.AddBody(ground);
+
+    for (int i = 0; i < 4; i++) {
+        auto box = chrono_types::make_shared<ChBodyEasyBox>(0.5, 0.5, 0.5, 1000, true, true, mat);
+        box->SetPos(ChVector3d(0.05 * i, 0.3 + 0.55 * i, 0));
+        sys.AddBody(box);
+    }
+
+    for (int i = 0; i < 100; i++)
+        sys.DoStepDynamics(2e-3);
+    ASSERT_TRUE(sys.GetNumContacts() > 0);
+
+    auto snapshot = sys.SaveState();
+
+    std::vector<std::vector<double>> branches;
+    for (int b = 0; b < 3; b++) {
+        sys.RestoreState(snapshot);
+        for (int i = 0; i < 50; i++)
+            sys.DoStepDynamics(2e-3);
+        branches.push_back(GetState(sys));
+    }
+
+    ASSERT_EQ(branches[0], branches[1]);
+    ASSERT_EQ(branches[0], branches[2]);
+}
+
+TEST(ChSystemSnapshot, sharing) {
+    ChSystemNSC sys;
+    sys.SetGravitationalAcceleration(ChVector3d(0, 0, 0));
+
+    // Many bodies at rest and a single moving body
+    for (int i = 0; i < 2000; i++) {
+        auto body = chrono_types::make_shared<ChBody>();
+        body->SetPos(ChVector3d(i, 0, 0));
+        if (i == 0)
+            body->SetPosDt(ChVector3d(0, 1, 0));
+        sys.AddBody(body);
+    }
+
+    sys.DoStepDynamics(1e-3);
+    auto snapshot1 = sys.SaveState();
+    sys.DoStepDynamics(1e-3);
+    auto snapshot2 = sys.SaveState();
+
+    ASSERT_EQ(snapshot1->GetSize(), snapshot2->GetSize());
+    ASSERT_TRUE(snapshot2->GetNumPages() > 1);
+    ASSERT_TRUE(snapshot2->GetNumSharedPages() > 0);
+    ASSERT_TRUE(snapshot2->GetMemorySize() < snapshot1->GetMemorySize());
+}
+
+TEST(ChSystemSnapshot, mismatch) {
+    ChSystemNSC sys;
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+    sys.SetGravitationalAcceleration(ChVector3d(0, -9.81, 0));
+    std::static_pointer_cast<ChContactContainerNSC>(sys.GetContactContainer())->EnableContactPersistence(true);
+
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(10, 1, 10, 1000, true, true, mat);
+    ground->SetPos(ChVector3d(0, -0.5, 0));
+    ground->SetFixed(true);
+    sys.AddBody(ground);
+
+    auto box = chrono_types::make_shared<ChBodyEasyBox>(0.5, 0.5, 0.5, 1000, true, true, mat);
+    box->SetPos(ChVector3d(0, 0.3, 0));
+    sys.AddBody(box);
+
+    for (int i = 0; i < 50; i++)
+        sys.DoStepDynamics(2e-3);
+    auto snapshot = sys.SaveState();
+
+    // Change the system structure (additional constraints)
+    auto rev = chrono_types::make_shared<ChLinkLockRevolute>();
+    rev->Initialize(ground, box, ChFrame<>(box->GetPos()));
+    sys.AddLink(rev);
+    for (int i = 0; i < 10; i++)
+        sys.DoStepDynamics(2e-3);
+
+    auto time = sys.GetChTime();
+    auto state = GetState(sys);
+    auto num_contacts = sys.GetNumContacts();
+    ASSERT_TRUE(num_contacts > 0);
+
+    ASSERT_THROW(sys.RestoreState(snapshot), std::invalid_argument);
+    ASSERT_EQ(sys.GetChTime(), time);
+    ASSERT_EQ(GetState(sys), state);
+    ASSERT_EQ(sys.GetNumContacts(), num_contacts);
+}
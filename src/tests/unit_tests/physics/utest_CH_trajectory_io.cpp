@@ -0,0 +1,140 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Test of binary trajectory files.
+// A pile of boxes connected to a pendulum is simulated and its trajectory is
+// written with and without compression (using a chunk size which does not
+// divide the number of frames). The data read back must match exactly the
+// states recorded during the simulation.
+//
+// =============================================================================
+
+#include <fstream>
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/utils/ChTrajectoryIO.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::utils;
+
+static const int num_frames = 150;
+
+static void CreateModel(ChSystemNSC& sys) {
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+    sys.SetGravitationalAcceleration(ChVector3d(0, -9.81, 0));
+
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(10, 1, 10, 1000, true, true, mat);
+    ground->SetPos(ChVector3d(0, -0.5, 0));
+    ground->SetFixed(true);
+    sys.AddBody(ground);
+
+    for (int i = 0; i < 3; i++) {
+        auto box = chrono_types::make_shared<ChBodyEasyBox>(0.5, 0.5, 0.5, 1000, true, true, mat);
+        box->SetPos(ChVector3d(0.05 * i, 0.3 + 0.55 * i, 0));
+        sys.AddBody(box);
+    }
+
+    auto pend = chrono_types::make_shared<ChBodyEasyBox>(1, 0.1, 0.1, 1000, true, false);
+    pend->SetPos(ChVector3d(3.5, 2, 0));
+    sys.AddBody(pend);
+
+    auto rev = chrono_types::make_shared<ChLinkLockRevolute>();
+    rev->Initialize(ground, pend, ChFrame<>(ChVector3d(3, 2, 0)));
+    sys.AddLink(rev);
+}
+
+static void WriteAndCheck(bool compress) {
+    std::string filename = compress ? "trajectory_compressed.bin" : "trajectory.bin";
+
+    ChSystemNSC sys;
+    CreateModel(sys);
+
+    // Simulate and record the expected data
+    std::vector<double> times;
+    std::vector<std::vector<double>> body_y;
+    std::vector<std::vector<double>> link_fx;
+    std::vector<size_t> num_contacts;
+    {
+        ChWriterTrajectory writer(filename, 32, compress);
+        writer.EnableChannel(TrajectoryChannel::LINKS, true);
+        writer.EnableChannel(TrajectoryChannel::CONTACTS, true);
+
+        for (int i = 0; i < num_frames; i++) {
+            sys.DoStepDynamics(2e-3);
+            writer.WriteFrame(sys);
+
+            times.push_back(sys.GetChTime());
+            std::vector<double> y;
+            for (const auto& body : sys.GetBodies())
+                y.push_back(body->GetPos().y());
+            body_y.push_back(y);
+            std::vector<double> fx;
+            for (const auto& link : sys.GetLinks())
+                fx.push_back(link->GetReaction2().force.x());
+            link_fx.push_back(fx);
+            num_contacts.push_back(sys.GetNumContacts());
+        }
+
+        writer.Close();
+        ASSERT_EQ(writer.GetNumFrames(), (size_t)num_frames);
+    }
+
+    ChReaderTrajectory reader(filename);
+    ASSERT_EQ(reader.GetNumFrames(), (size_t)num_frames);
+    ASSERT_TRUE(reader.HasChannel(TrajectoryChannel::BODIES));
+    ASSERT_TRUE(reader.HasChannel(TrajectoryChannel::LINKS));
+    ASSERT_TRUE(reader.HasChannel(TrajectoryChannel::CONTACTS));
+    ASSERT_TRUE(!reader.HasChannel(TrajectoryChannel::SHAFTS));
+
+    for (int i = 0; i < num_frames; i++) {
+        ASSERT_EQ(reader.GetTime(i), times[i]);
+
+        ASSERT_EQ(reader.GetNumRows(TrajectoryChannel::BODIES, i), body_y[i].size());
+        const double* id = reader.GetColumn(TrajectoryChannel::BODIES, i, 0);
+        const double* y = reader.GetColumn(TrajectoryChannel::BODIES, i, 2);
+        for (size_t k = 0; k < body_y[i].size(); k++) {
+            ASSERT_EQ(id[k], (double)sys.GetBodies()[k]->GetIdentifier());
+            ASSERT_EQ(y[k], body_y[i][k]);
+        }
+
+        ASSERT_EQ(reader.GetNumRows(TrajectoryChannel::LINKS, i), link_fx[i].size());
+        const double* fx = reader.GetColumn(TrajectoryChannel::LINKS, i, 4);
+        for (size_t k = 0; k < link_fx[i].size(); k++)
+            ASSERT_EQ(fx[k], link_fx[i][k]);
+
+        ASSERT_EQ(reader.GetNumRows(TrajectoryChannel::CONTACTS, i), num_contacts[i]);
+    }
+    ASSERT_TRUE(num_contacts.back() > 0);
+
+    // Conversion to CSV: one header line and one line per body and frame
+    reader.ConvertToCSV(TrajectoryChannel::BODIES, filename + ".csv");
+    std::ifstream csv(filename + ".csv");
+    std::string line;
+    size_t num_lines = 0;
+    while (std::getline(csv, line))
+        num_lines++;
+    ASSERT_EQ(num_lines, 1 + num_frames * sys.GetBodies().size());
+}
+
+TEST(ChTrajectoryIO, uncompressed) {
+    WriteAndCheck(false);
+}
+
+TEST(ChTrajectoryIO, compressed) {
+    WriteAndCheck(true);
+}
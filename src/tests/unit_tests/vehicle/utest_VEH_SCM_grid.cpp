@@ -0,0 +1,99 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All right reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Test of the storage for SCM grid node records. The hash-map and tiled
+// storage types must hold the same records as a reference std::map, including
+// for negative grid coordinates and across tile boundaries. Tiles left empty
+// after a reset must be released.
+//
+// =============================================================================
+
+#include <map>
+#include <random>
+#include <stdexcept>
+
+#include "gtest/gtest.h"
+
+#include "chrono_vehicle/terrain/SCMNodeGrid.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+class SCMGridTest : public ::testing::TestWithParam<SCMGridStorage> {};
+
+TEST_P(SCMGridTest, records) {
+    SCMNodeGrid<double> grid;
+    grid.SetStorage(GetParam());
+
+    std::map<std::pair<int, int>, double> ref;
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> dist(-300, 300);
+
+    for (int step = 0; step < 4; step++) {
+        // Insert records (existing records must not be overwritten)
+        for (int k = 0; k < 5000; k++) {
+            int x = dist(rng) + 200 * step;
+            int y = dist(rng) / 4;
+            auto& rec = grid.Insert(ChVector2i(x, y), (double)k);
+            auto it = ref.insert(std::make_pair(std::make_pair(x, y), (double)k)).first;
+            ASSERT_EQ(rec, it->second);
+        }
+
+        // Query records
+        for (int x = -350; x < 1000; x += 3) {
+            for (int y = -100; y < 100; y += 2) {
+                auto rec = grid.Find(ChVector2i(x, y));
+                auto it = ref.find(std::make_pair(x, y));
+                ASSERT_EQ(rec != nullptr, it != ref.end());
+                if (rec)
+                    ASSERT_EQ(*rec, it->second);
+            }
+        }
+
+        // Traverse records
+        size_t num_records = 0;
+        grid.ForEach([&](const ChVector2i& ij, double& rec) {
+            num_records++;
+            ASSERT_EQ(rec, ref.at(std::make_pair(ij.x(), ij.y())));
+        });
+        ASSERT_EQ(num_records, ref.size());
+        ASSERT_EQ(grid.size(), ref.size());
+
+        if (step == 1) {
+            grid.Reset();
+            ref.clear();
+            ASSERT_EQ(grid.size(), 0);
+        }
+    }
+
+    // Access to a missing record
+    ASSERT_THROW(grid.At(ChVector2i(5000, 5000)), std::out_of_range);
+
+    // Tiles left empty by a reset are released
+    auto memory = grid.GetMemorySize();
+    grid.Reset();
+    grid.Insert(ChVector2i(0, 0), 1.0);
+    grid.Reset();
+    ASSERT_EQ(grid.size(), 0);
+    ASSERT_LT(grid.GetMemorySize(), memory);
+    if (GetParam() == SCMGridStorage::TILED)
+        ASSERT_EQ(grid.GetNumTiles(), 1);
+    ASSERT_TRUE(grid.Find(ChVector2i(0, 0)) == nullptr);
+
+    grid.Clear();
+    ASSERT_EQ(grid.size(), 0);
+    ASSERT_EQ(grid.GetNumTiles(), 0);
+}
+
+INSTANTIATE_TEST_SUITE_P(ChronoVehicle,
+                         SCMGridTest,
+                         ::testing::Values(SCMGridStorage::HASH_MAP, SCMGridStorage::TILED));
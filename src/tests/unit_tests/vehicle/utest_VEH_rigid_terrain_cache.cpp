@@ -0,0 +1,168 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All right reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Test of the height cache for RigidTerrain mesh patches. Heights and normals
+// interpolated from the cache must match the analytical surface the mesh was
+// generated from, and a cache saved to file must give identical results once
+// loaded for the same patch. On a non-planar mesh (step and overhang), results
+// must match those obtained by ray casting, with queries in the step and
+// overhang regions resolved by the ray casting fallback.
+//
+// =============================================================================
+
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono_vehicle/terrain/RigidTerrain.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+// Inclined plane, sampled on a coarse triangle mesh
+static double Surface(double x, double y) {
+    return 0.1 * x - 0.05 * y + 1;
+}
+
+// Optionally, the mesh includes a step of height 1 (rising over one mesh cell, from x = 1 to x = 1.5) and a horizontal
+// roof at height 4, overhanging the region [-3,-1.5] x [-3,-1.5]
+static void WriteMesh(const std::string& filename, bool step_and_roof = false) {
+    std::ofstream obj(filename);
+    int n = 20;
+    double size = 10.0;
+    for (int j = 0; j <= n; j++) {
+        for (int i = 0; i <= n; i++) {
+            double x = -size / 2 + i * size / n;
+            double y = -size / 2 + j * size / n;
+            double z = Surface(x, y) + ((step_and_roof && x > 1.25) ? 1.0 : 0.0);
+            obj << "v " << x << " " << y << " " << z << "\n";
+        }
+    }
+    if (step_and_roof) {
+        int v0 = (n + 1) * (n + 1) + 1;
+        obj << "v -3 -3 4\nv -1.5 -3 4\nv -3 -1.5 4\nv -1.5 -1.5 4\n";
+        obj << "f " << v0 << " " << v0 + 1 << " " << v0 + 3 << "\n";
+        obj << "f " << v0 << " " << v0 + 3 << " " << v0 + 2 << "\n";
+    }
+    for (int j = 0; j < n; j++) {
+        for (int i = 0; i < n; i++) {
+            int v0 = j * (n + 1) + i + 1;
+            int v1 = v0 + 1;
+            int v2 = v0 + n + 1;
+            int v3 = v2 + 1;
+            obj << "f " << v0 << " " << v1 << " " << v3 << "\n";
+            obj << "f " << v0 << " " << v3 << " " << v2 << "\n";
+        }
+    }
+}
+
+TEST(RigidTerrainCache, lookup) {
+    std::string mesh_file = "utest_VEH_rigid_terrain_cache.obj";
+    std::string cache_file = "utest_VEH_rigid_terrain_cache.bin";
+    WriteMesh(mesh_file);
+
+    ChSystemNSC sys;
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+
+    RigidTerrain terrain1(&sys);
+    auto patch1 = terrain1.AddPatch(mat, ChCoordsys<>(ChVector3d(1, 2, 0), QUNIT), mesh_file, true, 0, false);
+    terrain1.Initialize();
+    patch1->EnableHeightCache(0.1, 8);
+
+    ChVector3d n_exact = ChVector3d(-0.1, 0.05, 1).GetNormalized();
+    for (double x = -3.9; x < 5.9; x += 0.37) {
+        for (double y = -2.9; y < 6.9; y += 0.41) {
+            ChVector3d loc(x, y, 10);
+            ASSERT_NEAR(terrain1.GetHeight(loc), Surface(x - 1, y - 2), 1e-9);
+            ASSERT_NEAR((terrain1.GetNormal(loc) - n_exact).Length(), 0, 1e-6);
+        }
+    }
+
+    ASSERT_TRUE(patch1->SaveHeightCache(cache_file));
+
+    // A cache loaded for the same patch gives identical results
+    RigidTerrain terrain2(&sys);
+    auto patch2 = terrain2.AddPatch(mat, ChCoordsys<>(ChVector3d(1, 2, 0), QUNIT), mesh_file, true, 0, false);
+    terrain2.Initialize();
+    patch2->EnableHeightCache(0.1, 8);
+    ASSERT_TRUE(patch2->LoadHeightCache(cache_file));
+    for (double x = -3.9; x < 5.9; x += 0.53) {
+        for (double y = -2.9; y < 6.9; y += 0.29) {
+            ChVector3d loc(x, y, 10);
+            ASSERT_EQ(terrain1.GetHeight(loc), terrain2.GetHeight(loc));
+            ASSERT_EQ(terrain1.GetNormal(loc), terrain2.GetNormal(loc));
+        }
+    }
+
+    // A cache saved for a different patch position or grid is rejected
+    RigidTerrain terrain3(&sys);
+    auto patch3 = terrain3.AddPatch(mat, ChCoordsys<>(ChVector3d(0, 2, 0), QUNIT), mesh_file, true, 0, false);
+    terrain3.Initialize();
+    patch3->EnableHeightCache(0.1, 8);
+    ASSERT_FALSE(patch3->LoadHeightCache(cache_file));
+    patch3->EnableHeightCache(0.2, 8);
+    ASSERT_FALSE(patch3->LoadHeightCache(cache_file));
+
+    std::remove(mesh_file.c_str());
+    std::remove(cache_file.c_str());
+}
+
+TEST(RigidTerrainCache, fallback) {
+    std::string mesh_file = "utest_VEH_rigid_terrain_cache_step.obj";
+    WriteMesh(mesh_file, true);
+
+    ChSystemNSC sys;
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+
+    // Same mesh patch, with and without height cache
+    RigidTerrain terrain_ray(&sys);
+    terrain_ray.AddPatch(mat, ChCoordsys<>(ChVector3d(1, 2, 0), QUNIT), mesh_file, true, 0, false);
+    terrain_ray.Initialize();
+
+    RigidTerrain terrain_cache(&sys);
+    auto patch = terrain_cache.AddPatch(mat, ChCoordsys<>(ChVector3d(1, 2, 0), QUNIT), mesh_file, true, 0, false);
+    terrain_cache.Initialize();
+    patch->EnableHeightCache(0.1, 8);
+
+    // Queries on the flat part, on the step (rising over mesh x in [1, 1.5]), and below the roof (mesh x and y in
+    // [-3, -1.5]) are answered from the cache and by ray casting, respectively
+    ASSERT_TRUE(patch->IsHeightCached(ChVector3d(1 - 1.93, 2 + 2.12, 10)));
+    ASSERT_FALSE(patch->IsHeightCached(ChVector3d(1 + 1.27, 2 + 0.33, 10)));
+    ASSERT_FALSE(patch->IsHeightCached(ChVector3d(1 - 2.21, 2 - 2.37, 10)));
+    ASSERT_FALSE(patch->IsHeightCached(ChVector3d(1 - 2.21, 2 - 2.37, 2)));
+
+    // Cached and ray cast results agree everywhere, for queries from above the roof and from below it
+    int num_cached = 0;
+    int num_fallback = 0;
+    for (double z : {10.0, 2.5}) {
+        for (double x = -3.9; x < 5.9; x += 0.37) {
+            for (double y = -2.9; y < 6.9; y += 0.41) {
+                ChVector3d loc(x, y, z);
+                if (patch->IsHeightCached(loc))
+                    num_cached++;
+                else
+                    num_fallback++;
+                ASSERT_NEAR(terrain_cache.GetHeight(loc), terrain_ray.GetHeight(loc), 1e-6);
+                ASSERT_NEAR((terrain_cache.GetNormal(loc) - terrain_ray.GetNormal(loc)).Length(), 0, 1e-6);
+            }
+        }
+    }
+    ASSERT_GT(num_cached, 0);
+    ASSERT_GT(num_fallback, 0);
+
+    std::remove(mesh_file.c_str());
+}
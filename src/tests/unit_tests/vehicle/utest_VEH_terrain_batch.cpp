@@ -0,0 +1,112 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All right reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Test of batched terrain queries. For each terrain type, the batched
+// GetProperties must return the same heights, normals, and coefficients of
+// friction as the single-point GetProperties, and the batched GetHeights the same
+// heights as GetHeight.
+//
+// =============================================================================
+
+#include <cmath>
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono_vehicle/terrain/FlatTerrain.h"
+#include "chrono_vehicle/terrain/RandomSurfaceTerrain.h"
+#include "chrono_vehicle/terrain/RigidTerrain.h"
+#include "chrono_vehicle/terrain/SCMTerrain.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+class FrictionFunctor : public ChTerrain::FrictionFunctor {
+  public:
+    virtual float operator()(const ChVector3d& loc) override { return loc.x() > 0 ? 0.9f : 0.6f; }
+};
+
+class HeightFunctor : public ChTerrain::HeightFunctor {
+  public:
+    virtual double operator()(const ChVector3d& loc) override { return 0.1 * std::sin(loc.x()); }
+};
+
+static void CheckBatch(const ChTerrain& terrain) {
+    std::vector<ChVector3d> locs;
+    for (double x = -12; x < 12; x += 0.37) {
+        for (double y = -3; y < 3; y += 0.29)
+            locs.push_back(ChVector3d(x, y, 5));
+    }
+
+    std::vector<double> heights;
+    std::vector<ChVector3d> normals;
+    std::vector<float> friction;
+    terrain.GetProperties(locs, heights, normals, friction);
+    ASSERT_EQ(heights.size(), locs.size());
+    ASSERT_EQ(normals.size(), locs.size());
+    ASSERT_EQ(friction.size(), locs.size());
+
+    for (size_t i = 0; i < locs.size(); i++) {
+        double height;
+        ChVector3d normal;
+        float mu;
+        terrain.GetProperties(locs[i], height, normal, mu);
+        ASSERT_EQ(heights[i], height);
+        ASSERT_EQ(normals[i], normal);
+        ASSERT_EQ(friction[i], mu);
+    }
+
+    std::vector<double> heights_only;
+    terrain.GetHeights(locs, heights_only);
+    ASSERT_EQ(heights_only.size(), locs.size());
+    for (size_t i = 0; i < locs.size(); i++)
+        ASSERT_EQ(heights_only[i], terrain.GetHeight(locs[i]));
+}
+
+TEST(TerrainBatch, flat) {
+    FlatTerrain terrain(0.5, 0.7f);
+    CheckBatch(terrain);
+}
+
+TEST(TerrainBatch, rigid) {
+    ChSystemNSC sys;
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+    mat->SetFriction(0.7f);
+
+    // Two overlapping patches, one of them inclined
+    RigidTerrain terrain(&sys);
+    terrain.AddPatch(mat, ChCoordsys<>(ChVector3d(-4, 0, 0), QUNIT), 16, 4);
+    terrain.AddPatch(mat, ChCoordsys<>(ChVector3d(6, 0, 0.2), QuatFromAngleY(-0.1)), 10, 8);
+    terrain.Initialize();
+    CheckBatch(terrain);
+
+    terrain.RegisterFrictionFunctor(chrono_types::make_shared<FrictionFunctor>());
+    CheckBatch(terrain);
+
+    terrain.RegisterHeightFunctor(chrono_types::make_shared<HeightFunctor>());
+    CheckBatch(terrain);
+}
+
+TEST(TerrainBatch, random_surface) {
+    ChSystemNSC sys;
+    RandomSurfaceTerrain terrain(&sys, 20, 4);
+    terrain.Initialize(RandomSurfaceTerrain::SurfaceType::ISO8608_C_NOCORR, 2.0,
+                       RandomSurfaceTerrain::VisualisationType::NONE);
+    CheckBatch(terrain);
+}
+
+TEST(TerrainBatch, scm) {
+    ChSystemNSC sys;
+    SCMTerrain terrain(&sys, false);
+    terrain.Initialize(30, 10, 0.1);
+    CheckBatch(terrain);
+}
@@ -0,0 +1,172 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All right reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Test of the tabulated steady-state forces of the HMMWV Pac02 and Pac89 tires.
+// Tabulated forces and moments must match the analytic formulas, including at
+// road friction values between the tabulated friction levels (Pac02), and
+// tires with identical parameters must share their tables.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+
+#include "gtest/gtest.h"
+
+#include "chrono_models/vehicle/hmmwv/tire/HMMWV_Pac02Tire.h"
+#include "chrono_models/vehicle/hmmwv/tire/HMMWV_Pac89Tire.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+using namespace chrono::vehicle::hmmwv;
+
+static const double kappa_vals[] = {-0.6, -0.13, -0.02, 0.007, 0.05, 0.3};
+static const double alpha_vals[] = {-0.5, -0.06, 0.013, 0.11, 0.8};
+static const double gamma_vals[] = {-0.03, 0.0, 0.021};
+
+static ChVector3d Abs(const ChVector3d& v) {
+    return ChVector3d(std::abs(v.x()), std::abs(v.y()), std::abs(v.z()));
+}
+
+// Expose the Pac02 force evaluation (tabulated and analytic) outside of a vehicle
+class Pac02Tire : public HMMWV_Pac02Tire {
+  public:
+    Pac02Tire(double max_mu_scale = 1.25) : HMMWV_Pac02Tire("pac02") {
+        SetMFParams();
+        EnableForceTable(true, 0, 31, 5, 16, max_mu_scale);
+        BuildForceTables();
+    }
+
+    double GetNominalLoad() const { return m_par.FNOMIN; }
+    const void* GetTables() const { return m_force_tables.get(); }
+
+    // Evaluate Fx, Fy, Mz from the tables (if 'table' is true) or from the analytic formulas
+    ChVector3d Eval(bool table, double kappa, double alpha, double Fz, double gamma, double mu_scale) {
+        m_states.mu_scale = mu_scale;
+        m_states.Fz0_prime = m_par.FNOMIN * m_par.LFZO;
+        m_states.Pi0_prime = m_par.IP_NOM * m_par.LIP;
+        m_states.dpi = (m_par.IP - m_states.Pi0_prime) / m_states.Pi0_prime;
+        m_states.dfz0 = (Fz - m_states.Fz0_prime) / m_states.Fz0_prime;
+        double Fx, Fy, Mz;
+        if (table)
+            EvalFxyMz(Fx, Fy, Mz, kappa, alpha, Fz, gamma);
+        else
+            CalcFxyMz(Fx, Fy, Mz, kappa, alpha, Fz, gamma);
+        return ChVector3d(Fx, Fy, Mz);
+    }
+};
+
+// Expose the Pac89 Magic Formula terms (tabulated and analytic) outside of a vehicle
+class Pac89Tire : public HMMWV_Pac89Tire {
+  public:
+    Pac89Tire(int num_slip = 41) : HMMWV_Pac89Tire("pac89") {
+        SetPac89Params();
+        EnableForceTable(true, 0, num_slip);
+        BuildForceTables();
+    }
+
+    const void* GetTables() const { return m_force_tables.get(); }
+
+    // Evaluate the Magic Formula terms of Fx, Fy, Mz (inputs in percent, degrees, and kN)
+    ChVector3d Eval(bool table, double kappa, double alpha, double Fz, double gamma) {
+        if (!table)
+            return ChVector3d(CalcFx(kappa, Fz), CalcFy(alpha, Fz, gamma), CalcMz(alpha, Fz, gamma));
+        double in[ChTireSurfaceTable::NUM_INPUTS] = {kappa, alpha, gamma, Fz};
+        double mf_x;
+        double mf_yz[2];
+        EXPECT_TRUE(m_force_tables->x.Eval(in, &mf_x));
+        EXPECT_TRUE(m_force_tables->yz.Eval(in, mf_yz));
+        return ChVector3d(mf_x, mf_yz[0], mf_yz[1]);
+    }
+};
+
+TEST(TireForceTable, pac02) {
+    Pac02Tire tire;
+    double Fz0 = tire.GetNominalLoad();
+
+    ChVector3d err_levels(0);  // errors at tabulated friction levels
+    ChVector3d err_mid(0);     // errors between tabulated friction levels
+    ChVector3d max_force(0);
+    for (double mu_scale : {1.0, 0.5, 0.875, 0.6}) {
+        for (double load : {0.3, 0.8, 1.5, 2.4}) {
+            for (double kappa : kappa_vals) {
+                for (double alpha : alpha_vals) {
+                    for (double gamma : gamma_vals) {
+                        auto f_tab = tire.Eval(true, kappa, alpha, load * Fz0, gamma, mu_scale);
+                        auto f_ref = tire.Eval(false, kappa, alpha, load * Fz0, gamma, mu_scale);
+                        auto& err = (mu_scale == 1.0 || mu_scale == 0.5) ? err_levels : err_mid;
+                        err = Vmax(err, Abs(f_tab - f_ref));
+                        max_force = Vmax(max_force, Abs(f_ref));
+                    }
+                }
+            }
+        }
+    }
+    std::cout << "Pac02 max forces:                " << max_force << std::endl;
+    std::cout << "Pac02 errors at friction levels: " << err_levels << std::endl;
+    std::cout << "Pac02 errors between levels:     " << err_mid << std::endl;
+
+    for (int i = 0; i < 3; i++) {
+        ASSERT_LT(err_levels[i], 0.02 * max_force[i]);
+        ASSERT_LT(err_mid[i], 0.04 * max_force[i]);
+    }
+
+    // Friction scaling and loads outside the table ranges are evaluated analytically
+    for (double mu_scale : {0.1, 1.5}) {
+        auto f_tab = tire.Eval(true, 0.05, 0.11, Fz0, 0.0, mu_scale);
+        auto f_ref = tire.Eval(false, 0.05, 0.11, Fz0, 0.0, mu_scale);
+        ASSERT_EQ(f_tab, f_ref);
+    }
+    auto f_tab = tire.Eval(true, 0.05, 0.11, 4 * Fz0, 0.0, 1.0);
+    auto f_ref = tire.Eval(false, 0.05, 0.11, 4 * Fz0, 0.0, 1.0);
+    ASSERT_EQ(f_tab, f_ref);
+
+    // Tables are shared by tires with identical parameters and table settings
+    Pac02Tire tire2;
+    Pac02Tire tire3(1.5);
+    ASSERT_EQ(tire.GetTables(), tire2.GetTables());
+    ASSERT_NE(tire.GetTables(), tire3.GetTables());
+}
+
+TEST(TireForceTable, pac89) {
+    Pac89Tire tire;
+
+    // Pac89 inputs: slip in percent, angles in degrees, load in kN
+    ChVector3d err(0);
+    ChVector3d max_force(0);
+    for (double Fz : {5.0, 12.0, 20.0, 30.0}) {
+        for (double kappa : kappa_vals) {
+            for (double alpha : alpha_vals) {
+                for (double gamma : gamma_vals) {
+                    double k = 100 * kappa;
+                    double a = alpha * CH_RAD_TO_DEG;
+                    double g = gamma * CH_RAD_TO_DEG;
+                    auto f_tab = tire.Eval(true, k, a, Fz, g);
+                    auto f_ref = tire.Eval(false, k, a, Fz, g);
+                    err = Vmax(err, Abs(f_tab - f_ref));
+                    max_force = Vmax(max_force, Abs(f_ref));
+                }
+            }
+        }
+    }
+    std::cout << "Pac89 max forces: " << max_force << std::endl;
+    std::cout << "Pac89 errors:     " << err << std::endl;
+
+    for (int i = 0; i < 3; i++)
+        ASSERT_LT(err[i], 0.02 * max_force[i]);
+
+    // Tables are shared by tires with identical parameters and table settings
+    Pac89Tire tire2;
+    Pac89Tire tire3(31);
+    ASSERT_EQ(tire.GetTables(), tire2.GetTables());
+    ASSERT_NE(tire.GetTables(), tire3.GetTables());
+}
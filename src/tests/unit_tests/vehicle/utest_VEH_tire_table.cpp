@@ -0,0 +1,99 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All right reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Test of the lookup tables for tire force surfaces. Multilinear functions must
+// be reproduced exactly, and the interpolation error of a Magic Formula curve
+// must decrease with the table resolution and bound the error at arbitrary
+// query points.
+//
+// =============================================================================
+
+#include <cmath>
+
+#include "gtest/gtest.h"
+
+#include "chrono_vehicle/wheeled_vehicle/tire/ChTireSurfaceTable.h"
+
+using namespace chrono::vehicle;
+
+typedef std::array<ChTireSurfaceTable::Axis, ChTireSurfaceTable::NUM_INPUTS> Axes;
+
+// Function linear in each input
+static void Multilinear(const double* in, double* out) {
+    out[0] = (1 + 2 * in[0]) * (3 - in[1]) * (2 + in[2]) * in[3];
+    out[1] = in[0] - 4 * in[1] + 0.5 * in[3];
+}
+
+// Magic Formula curves of the slip inputs, scaled by the load
+static void MagicFormula(const double* in, double* out) {
+    double x = 12 * in[0];
+    double y = 9 * in[1];
+    double D = in[3] * (1 - 0.2 * in[2] * in[2]);
+    out[0] = D * std::sin(1.65 * std::atan(x - 0.5 * (x - std::atan(x))));
+    out[1] = D * std::sin(1.3 * std::atan(y - 0.2 * (y - std::atan(y))));
+}
+
+TEST(TireSurfaceTable, multilinear) {
+    Axes axes = {{{-1, 1, 11, true}, {-1.5, 1.5, 9, true}, {-0.1, 0.1, 3, false}, {500, 10000, 8, false}}};
+    ChTireSurfaceTable table;
+    table.Build(axes, 2, Multilinear);
+    ASSERT_TRUE(table.IsBuilt());
+    ASSERT_EQ(table.GetNumOutputs(), 2);
+
+    double in[4];
+    double out[2];
+    double exact[2];
+    for (double kappa = -1; kappa <= 1; kappa += 0.173) {
+        for (double alpha = -1.5; alpha <= 1.5; alpha += 0.211) {
+            in[0] = kappa;
+            in[1] = alpha;
+            in[2] = 0.037;
+            in[3] = 4321;
+            ASSERT_TRUE(table.Eval(in, out));
+            Multilinear(in, exact);
+            ASSERT_NEAR(out[0], exact[0], 1e-5 * std::abs(exact[0]) + 1e-3);
+            ASSERT_NEAR(out[1], exact[1], 1e-5 * std::abs(exact[1]) + 1e-3);
+        }
+    }
+
+    // Queries outside the load range are rejected
+    in[3] = 12000;
+    ASSERT_FALSE(table.Eval(in, out));
+}
+
+TEST(TireSurfaceTable, accuracy) {
+    ChTireSurfaceTable coarse;
+    ChTireSurfaceTable fine;
+    coarse.Build({{{-1, 1, 21, true}, {-1.5, 1.5, 21, true}, {-0.05, 0.05, 3, false}, {500, 10000, 8, false}}}, 2,
+                 MagicFormula);
+    fine.Build({{{-1, 1, 61, true}, {-1.5, 1.5, 61, true}, {-0.05, 0.05, 3, false}, {500, 10000, 8, false}}}, 2,
+               MagicFormula);
+    auto err_coarse = coarse.EstimateError(MagicFormula);
+    auto err_fine = fine.EstimateError(MagicFormula);
+    ASSERT_LT(err_fine[0], 0.25 * err_coarse[0]);
+    ASSERT_LT(err_fine[1], 0.25 * err_coarse[1]);
+
+    // The estimated error bounds the error at arbitrary query points (up to a safety factor)
+    double in[4];
+    double out[2];
+    double exact[2];
+    for (double kappa = -0.97; kappa < 1; kappa += 0.0131) {
+        in[0] = kappa;
+        in[1] = -0.7 * kappa;
+        in[2] = 0.01;
+        in[3] = 6789;
+        ASSERT_TRUE(fine.Eval(in, out));
+        MagicFormula(in, exact);
+        ASSERT_LT(std::abs(out[0] - exact[0]), 1.5 * err_fine[0] + 1e-3);
+        ASSERT_LT(std::abs(out[1] - exact[1]), 1.5 * err_fine[1] + 1e-3);
+    }
+}
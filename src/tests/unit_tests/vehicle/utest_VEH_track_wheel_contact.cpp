@@ -0,0 +1,178 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for the analytic cylinder-box collision test used for contact
+// between track wheels and track shoes. The analytic contacts are compared with
+// those generated by the Bullet collision system for a road wheel resting on a
+// track shoe tread (line contact, with contacts at both ends of the axial
+// overlap), a road wheel hitting a guide pin laterally (single contact), and a
+// road wheel above the tread (no contact).
+//
+// =============================================================================
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/collision/ChCollisionShapeBox.h"
+#include "chrono/collision/ChCollisionShapeCylinder.h"
+
+#include "chrono_vehicle/tracked_vehicle/ChTrackContactManager.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+static const double wheel_radius = 0.25;
+static const double wheel_hlen = 0.05;
+
+// Contact reported by Bullet, with normal from the wheel to the shoe
+struct ContactData {
+    ChVector3d normal;
+    ChVector3d ptW;
+    ChVector3d ptS;
+    double distance;
+};
+
+class ContactCollector : public ChContactContainer::ReportContactCallback {
+  public:
+    ContactCollector(ChBody* wheel) : m_wheel(wheel) {}
+
+    virtual bool OnReportContact(const ChVector3d& pA,
+                                 const ChVector3d& pB,
+                                 const ChMatrix33<>& plane_coord,
+                                 const double& distance,
+                                 const double& eff_radius,
+                                 const ChVector3d& react_forces,
+                                 const ChVector3d& react_torques,
+                                 ChContactable* contactobjA,
+                                 ChContactable* contactobjB) override {
+        ChVector3d normal = plane_coord.GetAxisX();
+        if (contactobjA == m_wheel)
+            contacts.push_back({normal, pA, pB, distance});
+        else
+            contacts.push_back({-normal, pB, pA, distance});
+        return true;
+    }
+
+    std::vector<ContactData> contacts;
+
+  private:
+    ChBody* m_wheel;
+};
+
+// Compare the analytic contacts with the Bullet contacts between a wheel (axis along Y) and a box, both in the
+// specified absolute frames, and return the analytic contacts (sorted along the wheel axis).
+static std::vector<ChCollisionInfo> CheckContact(const ChFrame<>& wheel_abs,
+                                                 const ChFrame<>& box_abs,
+                                                 const ChVector3d& box_hdims) {
+    ChSystemNSC sys;
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+    ChFrame<> cyl_frame(VNULL, QuatFromAngleX(CH_PI_2));
+
+    // Note: contacts between two fixed bodies are discarded, so the wheel body is left free (no time step is taken)
+    auto wheel = chrono_types::make_shared<ChBody>();
+    wheel->SetPos(wheel_abs.GetPos());
+    wheel->SetRot(wheel_abs.GetRot());
+    wheel->AddCollisionShape(chrono_types::make_shared<ChCollisionShapeCylinder>(mat, wheel_radius, 2 * wheel_hlen),
+                             cyl_frame);
+    wheel->EnableCollision(true);
+    sys.AddBody(wheel);
+
+    auto shoe = chrono_types::make_shared<ChBody>();
+    shoe->SetFixed(true);
+    shoe->SetPos(box_abs.GetPos());
+    shoe->SetRot(box_abs.GetRot());
+    shoe->AddCollisionShape(chrono_types::make_shared<ChCollisionShapeBox>(mat, 2.0 * box_hdims));
+    shoe->EnableCollision(true);
+    sys.AddBody(shoe);
+
+    sys.Setup();
+    sys.Update();
+    sys.ComputeCollisions();
+
+    auto collector = chrono_types::make_shared<ContactCollector>(wheel.get());
+    sys.GetContactContainer()->ReportAllContacts(collector);
+
+    double envelope = 2 * ChCollisionModel::GetDefaultSuggestedEnvelope();
+    std::array<ChCollisionInfo, 2> cinfo;
+    int num_contacts = ChTrackWheelContactGenerator::CollideCylinderBox(wheel_radius, wheel_hlen, wheel_abs * cyl_frame,
+                                                                        box_hdims, box_abs, envelope, cinfo);
+    std::vector<ChCollisionInfo> contacts(cinfo.begin(), cinfo.begin() + num_contacts);
+    std::sort(contacts.begin(), contacts.end(),
+              [](const ChCollisionInfo& a, const ChCollisionInfo& b) { return a.vpA.y() < b.vpA.y(); });
+
+    EXPECT_EQ(contacts.empty(), collector->contacts.empty());
+    for (const auto& c : collector->contacts) {
+        for (const auto& a : contacts) {
+            EXPECT_NEAR(c.distance, a.distance, 1e-3);
+            EXPECT_GT(c.normal.Dot(a.vN), 0.999);
+            // Contact points may differ in the contact plane, but must lie on the same planes along the normal
+            EXPECT_NEAR((c.ptW - a.vpA).Dot(a.vN), 0.0, 1e-3);
+            EXPECT_NEAR((c.ptS - a.vpB).Dot(a.vN), 0.0, 1e-3);
+        }
+    }
+
+    return contacts;
+}
+
+TEST(ChTrackWheelContact, tread) {
+    // Road wheel resting on the pitched tread of a track shoe, off the shoe centerline
+    ChVector3d hdims(0.1, 0.3, 0.02);
+    ChFrame<> box_abs(ChVector3d(0, 0, 0), QuatFromAngleY(0.1));
+    ChVector3d up = box_abs.TransformDirectionLocalToParent(ChVector3d(0, 0, 1));
+    ChFrame<> wheel_abs(ChVector3d(0, 0.15, 0) + up * (hdims.z() + wheel_radius - 0.005), QUNIT);
+    auto contacts = CheckContact(wheel_abs, box_abs, hdims);
+
+    // Line contact over the whole wheel width: contacts at the two wheel faces
+    ASSERT_EQ(contacts.size(), 2);
+    ASSERT_NEAR(contacts[0].vpA.y(), 0.15 - wheel_hlen, 1e-9);
+    ASSERT_NEAR(contacts[1].vpA.y(), 0.15 + wheel_hlen, 1e-9);
+    ASSERT_NEAR(contacts[0].distance, -0.005, 1e-9);
+    ASSERT_NEAR(contacts[1].distance, -0.005, 1e-9);
+}
+
+TEST(ChTrackWheelContact, tread_edge) {
+    // Road wheel partially over the edge of a track shoe tread
+    ChVector3d hdims(0.1, 0.3, 0.02);
+    ChFrame<> box_abs(ChVector3d(0, 0, 0), QUNIT);
+    ChFrame<> wheel_abs(ChVector3d(0, hdims.y() + 0.02, hdims.z() + wheel_radius - 0.005), QUNIT);
+    auto contacts = CheckContact(wheel_abs, box_abs, hdims);
+
+    // Contacts at the ends of the axial overlap: the inner wheel face and the tread edge
+    ASSERT_EQ(contacts.size(), 2);
+    ASSERT_NEAR(contacts[0].vpA.y(), hdims.y() + 0.02 - wheel_hlen, 1e-9);
+    ASSERT_NEAR(contacts[1].vpA.y(), hdims.y(), 1e-9);
+}
+
+TEST(ChTrackWheelContact, guide_pin) {
+    // Inner face of a road wheel hitting the side of a guide pin
+    ChVector3d hdims(0.04, 0.02, 0.05);
+    ChFrame<> box_abs(ChVector3d(0, 0, 0), QUNIT);
+    ChFrame<> wheel_abs(ChVector3d(0, hdims.y() + wheel_hlen - 0.005, 0.2), QUNIT);
+    auto contacts = CheckContact(wheel_abs, box_abs, hdims);
+    ASSERT_EQ(contacts.size(), 1);
+    ASSERT_NEAR(contacts[0].distance, -0.005, 1e-9);
+}
+
+TEST(ChTrackWheelContact, no_contact) {
+    // Road wheel above the tread of a track shoe
+    ChVector3d hdims(0.1, 0.3, 0.02);
+    ChFrame<> box_abs(ChVector3d(0, 0, 0), QUNIT);
+    ChFrame<> wheel_abs(ChVector3d(0, 0.15, hdims.z() + wheel_radius + 0.1), QUNIT);
+    auto contacts = CheckContact(wheel_abs, box_abs, hdims);
+    ASSERT_TRUE(contacts.empty());
+}
@@ -0,0 +1,108 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All right reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Test of the parallel processing of multiple vehicles in ChWheeledVehicleWorld.
+// Several HMMWVs with different driver inputs are simulated on a rigid terrain
+// with 1 and with 3 threads; the vehicle states after a number of steps must be
+// identical.
+//
+// =============================================================================
+
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChSystemSMC.h"
+
+#include "chrono_vehicle/terrain/RigidTerrain.h"
+#include "chrono_vehicle/wheeled_vehicle/ChWheeledVehicleWorld.h"
+
+#include "chrono_models/vehicle/hmmwv/HMMWV.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+using namespace chrono::vehicle::hmmwv;
+
+static const int num_vehicles = 3;
+static const int num_steps = 500;
+static const double step_size = 2e-3;
+
+struct VehicleState {
+    ChVector3d pos;
+    ChQuaternion<> rot;
+    ChVector3d vel;
+    ChVector3d wheel_omega;
+};
+
+static std::vector<VehicleState> Simulate(int num_threads) {
+    ChSystemSMC sys;
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+    sys.SetGravitationalAcceleration(ChVector3d(0, 0, -9.81));
+
+    RigidTerrain terrain(&sys);
+    auto mat = chrono_types::make_shared<ChContactMaterialSMC>();
+    mat->SetFriction(0.9f);
+    terrain.AddPatch(mat, CSYSNORM, 200, 40);
+    terrain.Initialize();
+
+    ChWheeledVehicleWorld world(&sys);
+    world.SetTerrain(&terrain);
+    world.SetNumThreads(num_threads);
+
+    std::vector<std::unique_ptr<HMMWV_Full>> hmmwvs;
+    for (int i = 0; i < num_vehicles; i++) {
+        auto hmmwv = std::unique_ptr<HMMWV_Full>(new HMMWV_Full(&sys));
+        hmmwv->SetChassisFixed(false);
+        hmmwv->SetInitPosition(ChCoordsys<>(ChVector3d(-50, 8.0 * (i - 1), 0.7), QUNIT));
+        hmmwv->SetInitFwdVel(2.0 * i);
+        hmmwv->SetEngineType(EngineModelType::SHAFTS);
+        hmmwv->SetTransmissionType(TransmissionModelType::AUTOMATIC_SHAFTS);
+        hmmwv->SetDriveType(DrivelineTypeWV::AWD);
+        hmmwv->SetTireType(TireModelType::TMEASY);
+        hmmwv->SetTireStepSize(step_size);
+        hmmwv->Initialize();
+
+        unsigned int index = world.AddVehicle(&hmmwv->GetVehicle());
+        world.SetDriverInputs(index, {0.2 * (i - 1), 0.5 + 0.2 * i, 0.0, 0.0});
+        hmmwvs.push_back(std::move(hmmwv));
+    }
+
+    for (int step = 0; step < num_steps; step++) {
+        world.Synchronize(sys.GetChTime());
+        world.Advance(step_size);
+    }
+
+    std::vector<VehicleState> states;
+    for (const auto& hmmwv : hmmwvs) {
+        const auto& vehicle = hmmwv->GetVehicle();
+        states.push_back({vehicle.GetPos(), vehicle.GetRot(), vehicle.GetChassisBody()->GetPosDt(),
+                          vehicle.GetSpindleAngVel(0, LEFT)});
+    }
+    return states;
+}
+
+TEST(ChWheeledVehicleWorld, threads) {
+    auto serial = Simulate(1);
+    auto parallel = Simulate(3);
+
+    ASSERT_EQ(serial.size(), parallel.size());
+    for (size_t i = 0; i < serial.size(); i++) {
+        // Check that the vehicle moved
+        ASSERT_GT(serial[i].pos.x(), -50 + 1.0);
+
+        ASSERT_EQ(serial[i].pos, parallel[i].pos) << "vehicle " << i;
+        ASSERT_EQ(serial[i].rot, parallel[i].rot) << "vehicle " << i;
+        ASSERT_EQ(serial[i].vel, parallel[i].vel) << "vehicle " << i;
+        ASSERT_EQ(serial[i].wheel_omega, parallel[i].wheel_omega) << "vehicle " << i;
+    }
+}